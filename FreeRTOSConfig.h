@@ -142,6 +142,8 @@ NVIC value of 255. */
 #define configSPI_BUS_INTERRUPT_PRIORITY (configLIBRARY_KERNEL_INTERRUPT_PRIORITY-3)
 /* Priority 11: Spirit1 IC interrupts */
 #define configSPIRIT1_INTERRUPT_PRIORITY (configLIBRARY_KERNEL_INTERRUPT_PRIORITY-4)
+/* Priority 11: HPT timer compare interrupt (HPT_HW_TIMER): the most urgent that may still call the RTOS */
+#define configHPT_TIMER_INTERRUPT_PRIORITY (configLIBRARY_KERNEL_INTERRUPT_PRIORITY-4)
 /* Priority 10: GPS PPS line interrupt */
 #define configGPS_PPS_INTERRUPT_PRIORITY (configLIBRARY_KERNEL_INTERRUPT_PRIORITY-5)
 /* Priority 9: Power button line interrupt */
@@ -1,68 +1,190 @@
 /**
   ************************************
   * @file    cir_buf.c
-  * @author  
-  * @brief   Simple circular buffer
+  * @author
+  * @brief   Single-producer/single-consumer ring buffer
   ************************************
   */
-	
+
 #include <stdint.h>
 #include <stddef.h>
 #include "cir_buf.h"
 
+/* Each record starts with a 4-byte header holding the data length, the data follows   */
+/* and the record is padded to a multiple of 4 bytes, thus the data is always aligned. */
+/* A record never wraps around the end of the buffer: when it does not fit there,      */
+/* a header with CIR_WRAP is left at the end and the record starts at the beginning.   */
+#define CIR_HDR_LEN   4
+#define CIR_WRAP      0xFFFF
+
 static cir_buf_str cir_buf[CIR_BUF_NUM];
-static uint8_t cir_buf_data[CIR_BUF_NUM][CIR_BUF_LEN];
+static uint32_t cir_buf_nmea[CIR_BUF_NMEA_LEN/4];
+static uint32_t cir_buf_console[CIR_BUF_CONSOLE_LEN/4];
+
+/* head and tail are handed between an interrupt and a task (or two threads on the host) */
+#define CIR_LOAD(var)         __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define CIR_STORE(var, val)   __atomic_store_n(&(var), (val), __ATOMIC_RELEASE)
 
 /**
-  * @brief  Init selected cir buffer, 
+  * @brief  Init selected cir buffer,
   * @param  buffer number: <0-CIR_BUF_NUM)
   * @retval addres of CIR buffer descriptor structure
   */
 cir_buf_str* init_cir_buf(cir_buf_num buf_nr)
 {
-   cir_buf[buf_nr].buf_data = cir_buf_data[buf_nr];
-   cir_buf[buf_nr].buf_len  = CIR_BUF_LEN;
-   cir_buf[buf_nr].buf_ptr  = 0;
-   
+   cir_buf_str* buf = &cir_buf[buf_nr];
+   if (buf_nr == CIR_BUF_NMEA)
+   {
+      buf->buf_data = (uint8_t*)cir_buf_nmea;
+      buf->buf_len  = CIR_BUF_NMEA_LEN;
+   }
+   else
+   {
+      buf->buf_data = (uint8_t*)cir_buf_console;
+      buf->buf_len  = CIR_BUF_CONSOLE_LEN;
+   }
+   buf->head       = 0;
+   buf->tail       = 0;
+   buf->res_len    = 0;
+   buf->high_water = 0;
+   buf->overruns   = 0;
+
+   return buf;
+}
+
+/**
+  * @brief  Get selected cir buffer (for statistics).
+  * @param  buffer number: <0-CIR_BUF_NUM)
+  * @retval addres of CIR buffer descriptor structure
+  */
+cir_buf_str* get_cir_buf(cir_buf_num buf_nr)
+{
    return &cir_buf[buf_nr];
 }
 
+static void cir_set_header(cir_buf_str* buf_str_ptr, uint16_t pos, uint16_t len)
+{
+   *(uint16_t*)&buf_str_ptr->buf_data[pos] = len;
+}
+
+static uint16_t cir_get_header(const cir_buf_str* buf_str_ptr, uint16_t pos)
+{
+   return *(const uint16_t*)&buf_str_ptr->buf_data[pos];
+}
+
 /**
-  * @brief   Allocate space in selected cir buffer
-  * @param   buf_str_ptr:pointer to buffer, data: data address, len: data length 
-  * @retval  addres of data stored in cir buffer
-  * @details Allocate space in selected cir buffer and put data to selected cir buffer.
-  *          If source data pointer is non NULL then allocated buffer is populated with
-  *          data pointed by uint8_t* data.
+  * @brief   Reserve a contiguous span in selected cir buffer (producer).
+  * @param   buf_str_ptr: pointer to buffer, len: data length
+  * @retval  address of the reserved span or NULL if there is not enough free space
+  * @details The span is not visible to the consumer until cir_commit().
+  *          Calling cir_reserve() again before cir_commit() replaces the reservation.
   */
+uint8_t* cir_reserve(cir_buf_str* buf_str_ptr, uint16_t len)
+{
+   uint16_t head = buf_str_ptr->head;
+   uint16_t tail = CIR_LOAD(buf_str_ptr->tail);
+   uint16_t need = CIR_HDR_LEN + ((len+3)&0xFFFC);
+   uint16_t pos;
 
-uint8_t* cir_put_data(cir_buf_str* buf_str_ptr, uint8_t* data, uint16_t len)
+   if (head >= tail)
+   {
+      /* free space: from head to the end and from the start to tail, */
+      /* never fill it up completely: head==tail only when empty       */
+      if (buf_str_ptr->buf_len - head > need) pos = head;
+      else if ((buf_str_ptr->buf_len - head == need) && (tail != 0)) pos = head;
+      else if (tail > need) pos = 0;           /* wrap around */
+      else pos = CIR_WRAP;
+   }
+   else
+   {
+      /* free space: from head to tail */
+      if (tail - head > need) pos = head;
+      else pos = CIR_WRAP;
+   }
+   if (pos == CIR_WRAP)
+   {
+      buf_str_ptr->res_len = 0;
+      buf_str_ptr->overruns++;
+      return NULL;
+   }
+   buf_str_ptr->res_pos  = pos;
+   buf_str_ptr->res_len  = need;
+   buf_str_ptr->res_data = len;
+   return &buf_str_ptr->buf_data[pos + CIR_HDR_LEN];
+}
+
+/**
+  * @brief   Make the reserved span available to the consumer (producer).
+  * @param   buf_str_ptr: pointer to buffer
+  * @retval  None
+  */
+void cir_commit(cir_buf_str* buf_str_ptr)
 {
-   int i;
-   uint16_t data_start_ptr;
-   
-   /* Check if there's enough data left in buffer to allocate 'len' bytes */
-   if (len > buf_str_ptr->buf_len - buf_str_ptr->buf_ptr)
+   uint16_t head = buf_str_ptr->head;
+   uint16_t pos  = buf_str_ptr->res_pos;
+   uint16_t used;
+
+   if (buf_str_ptr->res_len == 0) return;
+   cir_set_header(buf_str_ptr, pos, buf_str_ptr->res_data);
+   if ((pos != head) && (buf_str_ptr->buf_len - head >= CIR_HDR_LEN))
    {
-      /* there is not enough data at the end of buffer -> reset pointer*/
-      buf_str_ptr->buf_ptr = 0;
+      /* record wrapped: tell the consumer to skip the end of the buffer */
+      cir_set_header(buf_str_ptr, head, CIR_WRAP);
    }
-   data_start_ptr = buf_str_ptr->buf_ptr;
-   
-   /* No source buffer defined - just reserve space of length len */
-   if( NULL != data )
+   head = pos + buf_str_ptr->res_len;
+   if (head >= buf_str_ptr->buf_len) head = 0;
+   buf_str_ptr->res_len = 0;
+   CIR_STORE(buf_str_ptr->head, head);
+
+   used = cir_used(buf_str_ptr);
+   if (used > buf_str_ptr->high_water) buf_str_ptr->high_water = used;
+}
+
+/**
+  * @brief   Get the oldest committed record (consumer).
+  * @param   buf_str_ptr: pointer to buffer, len: record length (can be NULL)
+  * @retval  address of the record or NULL if the buffer is empty
+  */
+uint8_t* cir_peek(cir_buf_str* buf_str_ptr, uint16_t* len)
+{
+   uint16_t tail = buf_str_ptr->tail;
+   uint16_t head = CIR_LOAD(buf_str_ptr->head);
+
+   if (tail == head) return NULL;
+   if ((buf_str_ptr->buf_len - tail < CIR_HDR_LEN) || (cir_get_header(buf_str_ptr, tail) == CIR_WRAP))
    {
-      for (i=0; i<len; i++)
-      {
-         /* copy the data into buffer */
-         buf_str_ptr->buf_data[data_start_ptr+i] = data[i];
-      }
+      tail = 0;
    }
-   /* Update pointer data for the next call */
-   buf_str_ptr->buf_ptr+= len;
-   /* Reset pointer if ptr overrun */
-   if (buf_str_ptr->buf_ptr >= buf_str_ptr->buf_len) buf_str_ptr->buf_ptr-= buf_str_ptr->buf_len;
-   
-   /* Return pointer to allocated buffer */
-   return &buf_str_ptr->buf_data[data_start_ptr];
+   if (len) *len = cir_get_header(buf_str_ptr, tail);
+   return &buf_str_ptr->buf_data[tail + CIR_HDR_LEN];
+}
+
+/**
+  * @brief   Free the oldest committed record (consumer).
+  * @param   buf_str_ptr: pointer to buffer
+  * @retval  None
+  */
+void cir_release(cir_buf_str* buf_str_ptr)
+{
+   uint16_t len;
+   uint8_t* data = cir_peek(buf_str_ptr, &len);
+   uint16_t tail;
+
+   if (data == NULL) return;
+   tail = (data - buf_str_ptr->buf_data) + ((len+3)&0xFFFC);
+   if (tail >= buf_str_ptr->buf_len) tail = 0;
+   CIR_STORE(buf_str_ptr->tail, tail);
+}
+
+/**
+  * @brief   Number of bytes in use (including headers and the skipped end).
+  * @param   buf_str_ptr: pointer to buffer
+  * @retval  bytes in use
+  */
+uint16_t cir_used(const cir_buf_str* buf_str_ptr)
+{
+   uint16_t head = CIR_LOAD(buf_str_ptr->head);
+   uint16_t tail = CIR_LOAD(buf_str_ptr->tail);
+   if (head >= tail) return head - tail;
+   return buf_str_ptr->buf_len - tail + head;
 }
@@ -1,28 +1,39 @@
 /**
   ************************************
-  * @file    cir_buf.h 
-  * @author  
-  * @brief   Simple circular buffer
+  * @file    cir_buf.h
+  * @author
+  * @brief   Single-producer/single-consumer ring buffer
   ************************************
   */
-	
+
 #ifndef __CIR_BUF_H
 #define __CIR_BUF_H
 
 #include <stdint.h>
 
-#define CIR_BUF_LEN  512
+#define CIR_BUF_NMEA_LEN     1024      /* holds 8 NMEA sentence descriptors (see OGN_NMEA_MsgSize) */
+#define CIR_BUF_CONSOLE_LEN  256       /* NMEA sentences typed on the console */
 
 typedef enum
 {
    CIR_BUF_NMEA = 0,
+   CIR_BUF_CONSOLE,
    CIR_BUF_NUM
 } cir_buf_num;
 
+/* Every record is a contiguous span: reserve() -> fill -> commit() on the producer side,  */
+/* peek() -> use -> release() on the consumer side, records are released in commit order.  */
+/* head is written only by the producer, tail only by the consumer.                        */
 typedef struct {
-   uint8_t*  buf_data;
-   uint16_t  buf_ptr;
-   uint16_t  buf_len;
+   uint8_t*           buf_data;
+   uint16_t           buf_len;
+   volatile uint16_t  head;        /* producer: where the next record goes */
+   volatile uint16_t  tail;        /* consumer: oldest record not yet released */
+   uint16_t           res_pos;     /* producer: reserved record (header position) */
+   uint16_t           res_len;     /* producer: reserved length (header + data, rounded up), 0 if nothing reserved */
+   uint16_t           res_data;    /* producer: reserved data length */
+   uint16_t           high_water;  /* max. number of bytes in use */
+   uint32_t           overruns;    /* reserve() calls which failed for lack of space */
 } cir_buf_str;
 
 #ifdef __cplusplus
@@ -30,7 +41,12 @@ extern "C" {
 #endif
 
 cir_buf_str* init_cir_buf(cir_buf_num buf_nr);
-uint8_t*     cir_put_data(cir_buf_str* buf_str_ptr, uint8_t* data, uint16_t len);
+cir_buf_str* get_cir_buf(cir_buf_num buf_nr);
+uint8_t*     cir_reserve(cir_buf_str* buf_str_ptr, uint16_t len);
+void         cir_commit(cir_buf_str* buf_str_ptr);
+uint8_t*     cir_peek(cir_buf_str* buf_str_ptr, uint16_t* len);
+void         cir_release(cir_buf_str* buf_str_ptr);
+uint16_t     cir_used(const cir_buf_str* buf_str_ptr);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,191 @@
+#include "clock.h"
+#include <string.h>
+#include <stm32l1xx.h>
+#include <FreeRTOS.h>
+#include <task.h>
+
+/* -------- defines -------- */
+/* -------- variables -------- */
+/* Both the reference and the UTC offset have a single writer each and are published like     */
+/* snapshot.h does: the writer fills the copy the readers are not pointed at, then advances   */
+/* the sequence counter; a reader copies and tries again if the counter moved meanwhile.      */
+static clock_ref_t   clock_ref[2];     /* PPS interrupt only */
+static uint32_t      clock_ref_seq;
+static clock_ofs_t   clock_ofs[2];     /* GPS task only */
+static uint32_t      clock_ofs_seq;
+static clock_stats_t clock_stats;
+
+/* -------- functions -------- */
+/**
+* @brief  Configures TIM5 as a free-running 32-bit counter at CLOCK_TIMER_HZ.
+* @param  None
+* @retval None
+*/
+void Clock_Config(void)
+{
+   TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+
+   RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM5, ENABLE);
+   TIM_TimeBaseStructInit(&TIM_TimeBaseStructure);
+   /* APB1 is not divided: TIM5 runs from the 32 MHz core clock (HSE crystal and PLL) */
+   TIM_TimeBaseStructure.TIM_Prescaler     = SystemCoreClock/CLOCK_TIMER_HZ - 1;
+   TIM_TimeBaseStructure.TIM_Period        = 0xFFFFFFFF;
+   TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+   TIM_TimeBaseStructure.TIM_CounterMode   = TIM_CounterMode_Up;
+   TIM_TimeBaseInit(TIM5, &TIM_TimeBaseStructure);
+   TIM_Cmd(TIM5, ENABLE);
+}
+
+/**
+* @brief  Reads the free-running timer.
+* @param  None
+* @retval timer count [1/CLOCK_TIMER_HZ s], modulo 2^32
+*/
+uint32_t Clock_Count(void)
+{
+   return TIM5->CNT;
+}
+
+/**
+* @brief  GPS PPS rising edge: timestamps it and moves the reference, called from the PPS ISR.
+* @param  None
+* @retval 1 - edge accepted, 0 - glitch, -1 - counting started again
+*/
+int8_t Clock_PPS_FromISR(void)
+{
+   uint32_t cnt = TIM5->CNT;           /* first: the interrupt latency is all the error there is */
+   uint32_t seq = clock_ref_seq;
+   clock_ref_t ref = clock_ref[seq&1];
+   int8_t ret = clock_pps_update(&ref, cnt, xTaskGetTickCountFromISR()*portTICK_PERIOD_MS, &clock_stats);
+   if (ret == 0) return ret;
+   clock_ref[(seq+1)&1] = ref;
+   __atomic_store_n(&clock_ref_seq, seq+1, __ATOMIC_RELEASE);
+   return ret;
+}
+
+/**
+* @brief  Copies the current reference and reads the timer with it.
+* @param  reference copy, timer count out
+* @retval None
+*/
+static void Clock_ReadRef(clock_ref_t* ref, uint32_t* cnt)
+{
+   for (;;)
+   {
+      uint32_t seq = __atomic_load_n(&clock_ref_seq, __ATOMIC_ACQUIRE);
+      *ref = clock_ref[seq&1];
+      if (cnt) *cnt = TIM5->CNT;
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);
+      if (__atomic_load_n(&clock_ref_seq, __ATOMIC_RELAXED) == seq) return;
+   }
+}
+
+/**
+* @brief  Copies the current UTC offset.
+* @param  offset copy
+* @retval None
+*/
+static void Clock_ReadOfs(clock_ofs_t* ofs)
+{
+   for (;;)
+   {
+      uint32_t seq = __atomic_load_n(&clock_ofs_seq, __ATOMIC_ACQUIRE);
+      *ofs = clock_ofs[seq&1];
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);
+      if (__atomic_load_n(&clock_ofs_seq, __ATOMIC_RELAXED) == seq) return;
+   }
+}
+
+/**
+* @brief  A valid fix: ties the PPS seconds count to UTC, called from the GPS task at every fix.
+* @param  fix UTC [Unix s], fix ms within the second, Clock_Count() when the first sentence of the fix arrived
+* @retval None
+*/
+void Clock_SetUTC(uint32_t unix_sec, uint16_t ms, uint32_t first)
+{
+   clock_ref_t ref;
+   Clock_ReadRef(&ref, NULL);
+   if (ref.period == 0) return;        /* no PPS yet */
+   clock_ofs_t ofs = clock_ofs[clock_ofs_seq&1];
+   /* not the timer now: the fix may complete after the next edge, its first sentence is always within its second */
+   uint32_t base = clock_base(&ref, unix_sec, ms, clock_since_us(&ref, first));
+   if (ofs.valid && ofs.epoch == ref.epoch && ofs.base == base) return; /* the usual case: nothing to publish */
+   if (ofs.valid && ofs.epoch == ref.epoch) clock_stats.utc_steps++;
+   ofs.base = base; ofs.epoch = ref.epoch; ofs.valid = 1;
+   clock_ofs[(clock_ofs_seq+1)&1] = ofs;
+   __atomic_store_n(&clock_ofs_seq, clock_ofs_seq+1, __ATOMIC_RELEASE);
+}
+
+/**
+* @brief  UTC of a timer count taken with Clock_Count() (not more than 35 minutes ago).
+* @param  timer count, UTC out
+* @retval quality: CLOCK_NONE leaves utc unchanged
+*/
+clock_quality_t Clock_CountToUTC(uint32_t cnt, clock_utc_t* utc)
+{
+   clock_ref_t ref;
+   clock_ofs_t ofs;
+   Clock_ReadOfs(&ofs);
+   Clock_ReadRef(&ref, NULL);
+   uint32_t age = xTaskGetTickCountFromISR()*portTICK_PERIOD_MS - ref.tick; /* masks interrupts only: fine in tasks too */
+   if (age > CLOCK_HOLDOVER_S*1000) return CLOCK_NONE;
+   if (!clock_to_utc(&ref, &ofs, cnt, utc)) return CLOCK_NONE;
+   return age < CLOCK_LOCK_MS ? CLOCK_LOCKED : CLOCK_HOLDOVER;
+}
+
+/**
+* @brief  UTC now: tasks and interrupts.
+* @param  UTC out
+* @retval quality: CLOCK_NONE leaves utc unchanged
+*/
+clock_quality_t Clock_GetUTC(clock_utc_t* utc)
+{
+   clock_ref_t ref;
+   clock_ofs_t ofs;
+   uint32_t cnt;
+   Clock_ReadOfs(&ofs);
+   Clock_ReadRef(&ref, &cnt);
+   uint32_t age = xTaskGetTickCountFromISR()*portTICK_PERIOD_MS - ref.tick;
+   if (age > CLOCK_HOLDOVER_S*1000) return CLOCK_NONE;
+   if (!clock_to_utc(&ref, &ofs, cnt, utc)) return CLOCK_NONE;
+   return age < CLOCK_LOCK_MS ? CLOCK_LOCKED : CLOCK_HOLDOVER;
+}
+
+/**
+* @brief  Prints the UTC time of day, without sprintf(): interrupts may use it.
+* @param  output string (16 chars with the terminating null), UTC
+* @retval number of chars printed
+*/
+uint16_t Clock_Format(char* out, const clock_utc_t* utc)
+{
+   uint32_t day = utc->sec%86400, usec = utc->usec;
+   uint8_t  field[3] = { day/3600, day/60%60, day%60 };
+   uint8_t  i;
+   for (i = 0; i < 3; i++)
+   {
+      *out++ = '0' + field[i]/10;
+      *out++ = '0' + field[i]%10;
+      *out++ = i < 2 ? ':' : '.';
+   }
+   for (i = 6; i-- > 0; )
+   {
+      out[i] = '0' + usec%10; usec /= 10;
+   }
+   out[6] = 0;
+   return 15;
+}
+
+const clock_stats_t* Clock_GetStats(void)
+{
+   return &clock_stats;
+}
+
+void Clock_GetRef(clock_ref_t* ref)
+{
+   Clock_ReadRef(ref, NULL);
+}
+
+void Clock_ClearStats(void)
+{
+   memset(&clock_stats, 0, sizeof(clock_stats));
+}
@@ -0,0 +1,189 @@
+/**
+  ************************************
+  * @file    clock.h
+  * @author
+  * @brief   UTC clock: a free-running 1 MHz hardware timer disciplined by the GPS PPS
+  ************************************
+  */
+
+#ifndef __CLOCK_H
+#define __CLOCK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------- defines -------- */
+#define CLOCK_TIMER_HZ     1000000     /* TIM5 (32-bit) counts at 1 MHz: wraps every 71 minutes              */
+#define CLOCK_PPS_TOL_US   500         /* [us] a PPS edge further than this from the seconds grid is a glitch */
+#define CLOCK_RATE_FILTER  3           /* the timer rate is averaged over 2^3 PPS intervals                   */
+#define CLOCK_REJECT_MAX   4           /* that many glitches in a row: start again from the next edge         */
+#define CLOCK_LOCK_MS      1500        /* [ms] PPS edge younger than this: locked, else holding over          */
+#define CLOCK_HOLDOVER_S   1800        /* [s] no PPS for longer: the UTC is dropped (well before the wrap)    */
+
+/* The PPS interrupt timestamps each edge with the timer and keeps the reference: the count at the  */
+/* latest good edge, the number of GPS seconds since the first one and the timer counts per second. */
+/* The GPS task tells which UTC second that count of seconds is, at every valid fix. Any task or    */
+/* interrupt then gets the UTC from the timer in O(1): a multiply and a divide, no lock, no mutex.  */
+
+typedef enum
+{
+   CLOCK_NONE = 0,                     /* no UTC: no PPS or no valid fix yet, or PPS lost for too long */
+   CLOCK_HOLDOVER,                     /* PPS lost: running on the last measured timer rate            */
+   CLOCK_LOCKED                        /* PPS seen within CLOCK_LOCK_MS                                */
+} clock_quality_t;
+
+typedef struct
+{
+   uint32_t sec;                       /* Unix time [s] */
+   uint32_t usec;                      /* [us] within the second */
+} clock_utc_t;
+
+typedef struct                         /* the latest good PPS edge: written by the PPS interrupt only */
+{
+   uint32_t cnt;                       /* timer count at the edge */
+   uint32_t tick;                      /* [ms] RTOS tick at the edge: tells a timer wrap from a short gap */
+   uint32_t seq;                       /* GPS seconds since the first edge of this epoch */
+   uint32_t period;                    /* [1/256 count] timer counts per GPS second */
+   uint32_t scale;                     /* [2^-30 us per count] 1e6/period: a multiply instead of a divide */
+   uint8_t  epoch;                     /* incremented when the edges are counted again from zero */
+   uint8_t  rated;                     /* period measured (not nominal) */
+   uint8_t  rejects;                   /* glitches in a row */
+} clock_ref_t;
+
+typedef struct                         /* UTC of the seconds count: written by the GPS task only */
+{
+   uint32_t base;                      /* Unix time of seq==0 */
+   uint8_t  epoch;                     /* clock_ref_t epoch it refers to */
+   uint8_t  valid;
+} clock_ofs_t;
+
+typedef struct
+{
+   uint32_t pps;                       /* edges accepted */
+   uint32_t missed;                    /* seconds without an edge, bridged by the rate */
+   uint32_t rejected;                  /* edges off the seconds grid */
+   uint32_t restarts;                  /* counting started again: long PPS loss or rate jump */
+   uint32_t utc_steps;                 /* UTC of the seconds count changed by a fix */
+   int32_t  last_err;                  /* [us] last edge against the expected one */
+   int32_t  max_err;                   /* [us] largest |last_err| */
+} clock_stats_t;
+
+/* -------- functions -------- */
+void            Clock_Config(void);                                     /* start the timer: before the scheduler */
+int8_t          Clock_PPS_FromISR(void);                                /* GPS PPS rising edge: first thing in the interrupt */
+void            Clock_SetUTC(uint32_t unix_sec, uint16_t ms, uint32_t first); /* a valid fix: its UTC and Clock_Count() at its first sentence */
+uint32_t        Clock_Count(void);                                      /* raw timer count: cheap timestamps, also in interrupts */
+clock_quality_t Clock_GetUTC(clock_utc_t* utc);                         /* UTC now */
+clock_quality_t Clock_CountToUTC(uint32_t cnt, clock_utc_t* utc);       /* UTC of a Clock_Count() timestamp */
+uint16_t        Clock_Format(char* out, const clock_utc_t* utc);        /* "hh:mm:ss.uuuuuu" */
+const clock_stats_t* Clock_GetStats(void);
+void            Clock_GetRef(clock_ref_t* ref);                         /* copy of the current reference: for the console */
+void            Clock_ClearStats(void);
+
+/* -------- the arithmetic: no hardware, shared with the host tests -------- */
+
+/**
+  * @brief  Timer count difference to microseconds factor.
+  * @param  period: [1/256 count] timer counts per second
+  * @retval [2^-30 us per count]
+  */
+static inline uint32_t clock_scale(uint32_t period)
+{
+   return (uint32_t)(((uint64_t)256000000<<30)/period);
+}
+
+/**
+  * @brief  Move the reference to a PPS edge.
+  * @param  ref, the edge timer count, ms since the reference edge by the RTOS tick, statistics
+  * @retval 1 - edge accepted, 0 - glitch (reference unchanged), -1 - counting started again
+  */
+static inline int8_t clock_pps_update(clock_ref_t* ref, uint32_t cnt, uint32_t tick, clock_stats_t* stats)
+{
+   uint32_t tol = ref->rated ? CLOCK_PPS_TOL_US : CLOCK_TIMER_HZ/50;  /* nominal rate: within 2% */
+   if (ref->period == 0 || (tick - ref->tick) > CLOCK_HOLDOVER_S*1000 || ref->rejects >= CLOCK_REJECT_MAX)
+   {
+      if (ref->period == 0) ref->period = CLOCK_TIMER_HZ*256;
+      else stats->restarts++;
+      if (ref->rejects >= CLOCK_REJECT_MAX) ref->rated = 0;        /* the rate may have changed: measure it again */
+      ref->cnt = cnt; ref->tick = tick; ref->seq = 0; ref->epoch++; ref->rejects = 0;
+      ref->scale = clock_scale(ref->period);
+      return -1;
+   }
+   uint32_t d = cnt - ref->cnt;
+   uint32_t n = (uint32_t)((((uint64_t)d<<8) + ref->period/2)/ref->period); /* whole seconds since the reference */
+   int32_t err = (int32_t)((((int64_t)d<<8) - (int64_t)n*ref->period)>>8);
+   if (n == 0 || err > (int32_t)tol || err < -(int32_t)tol)
+   {
+      stats->rejected++; ref->rejects++;
+      return 0;
+   }
+   if (n == 1)
+   {
+      if (ref->rated) ref->period += (int32_t)((d<<8) - ref->period)>>CLOCK_RATE_FILTER;
+      else { ref->period = d<<8; ref->rated = 1; }
+      ref->scale = clock_scale(ref->period);
+   }
+   stats->pps++; stats->missed += n-1;
+   stats->last_err = err;
+   if (err < 0) err = -err;
+   if (err > stats->max_err) stats->max_err = err;
+   ref->cnt = cnt; ref->tick = tick; ref->seq += n; ref->rejects = 0;
+   return 1;
+}
+
+/**
+  * @brief  UTC of a timer count.
+  * @param  ref, ofs, timer count (up to 35 minutes before or after the reference edge), UTC out
+  * @retval 1 - done, 0 - no UTC for this reference
+  */
+static inline uint8_t clock_to_utc(const clock_ref_t* ref, const clock_ofs_t* ofs, uint32_t cnt, clock_utc_t* utc)
+{
+   if (!ofs->valid || ofs->epoch != ref->epoch) return 0;
+   int32_t d = (int32_t)(cnt - ref->cnt);
+   uint32_t sec = ofs->base + ref->seq;
+   if (d >= 0)
+   {
+      uint32_t us = (uint32_t)(((uint64_t)d*ref->scale + (1<<29))>>30);
+      utc->sec = sec + us/1000000; utc->usec = us%1000000;
+   }
+   else                                                            /* timestamp taken before the reference edge */
+   {
+      uint32_t us = (uint32_t)(((uint64_t)(uint32_t)(-d)*ref->scale + (1<<29))>>30);
+      uint32_t back = (us + 999999)/1000000;
+      utc->sec = sec - back; utc->usec = back*1000000 - us;
+   }
+   return 1;
+}
+
+/**
+  * @brief  Microseconds from the reference edge to a timer count.
+  * @param  ref, timer count (up to 35 minutes before or after the reference edge)
+  * @retval [us] negative when the count was taken before the edge
+  */
+static inline int32_t clock_since_us(const clock_ref_t* ref, uint32_t cnt)
+{
+   int32_t d = (int32_t)(cnt - ref->cnt);
+   return (int32_t)(((int64_t)d*ref->scale)>>30);
+}
+
+/**
+  * @brief  Which UTC second the seconds count is: from a fix and the time its first sentence arrived.
+  * @param  ref, fix UTC second and ms within, [us] from the reference edge to the first sentence of the fix
+  *         (clock_since_us(): negative when an edge came while the fix was being received)
+  * @retval Unix time of seq==0
+  */
+static inline uint32_t clock_base(const clock_ref_t* ref, uint32_t unix_sec, uint16_t ms, int32_t first_us)
+{
+   int32_t since = first_us - (int32_t)ms*1000;                  /* [us] from the fix epoch's own second edge: the GPS sends within the second */
+   int32_t sec = since >= 0 ? since/1000000 : -(( -since + 999999)/1000000);
+   return unix_sec - (ref->seq + sec);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CLOCK_H */
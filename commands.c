@@ -19,9 +19,14 @@
 #include "spi.h"
 #include "spirit1.h"
 #include "gps.h"
+#include "usart.h"
 #include "control.h"
 #include "hpt_timer.h"
 #include "background.h"
+#include "cir_buf.h"
+#include "log_buf.h"
+#include "log.h"
+#include "clock.h"
 
 /* -------- defines -------- */
 #define SPI_DATA_LEN 256
@@ -109,7 +114,8 @@ static portBASE_TYPE prvVerCommand( char *pcWriteBuffer,
 static portBASE_TYPE prvResetCommand( char *pcWriteBuffer,
                              size_t xWriteBufferLen,
                              const char *pcCommandString )
-{ NVIC_SystemReset();
+{ Log_Flush();                                  // what is queued for the console goes out first
+  NVIC_SystemReset();
   return pdFALSE; }
 
 // ---------------------------------------------------------------------------------------------------------------------------
@@ -307,7 +313,11 @@ static portBASE_TYPE prvFreqOfsCommand( char *pcWriteBuffer,
 static portBASE_TYPE prvGPSTimeCommand( char *pcWriteBuffer,
                              size_t xWriteBufferLen,
                              const char *pcCommandString )
-{ uint32_t Time = GPS_GetPosition(NULL);
+{ clock_utc_t UTC;
+  if (Clock_GetUTC(&UTC) != CLOCK_NONE)                   /* PPS disciplined: down to the microsecond */
+  { sprintf(pcWriteBuffer,"GPS Time = %ld.%06ldsec\r\n", UTC.sec, UTC.usec);
+    return pdFALSE; }
+  uint32_t Time = GPS_GetPosition(NULL);
   sprintf(pcWriteBuffer,"GPS Time = %ldsec\r\n", Time);
   return pdFALSE; }
 
@@ -616,8 +626,30 @@ static portBASE_TYPE prvMemStatCommand( char *pcWriteBuffer,
                              size_t xWriteBufferLen,
                              const char *pcCommandString )
 {
-    int heap_used = (int)configTOTAL_HEAP_SIZE - (int)xPortGetFreeHeapSize();
-    sprintf(pcWriteBuffer,"Free RTOS heap used: %d/%d (%d%%)\r\n", heap_used, (int)configTOTAL_HEAP_SIZE, (100*heap_used)/(int)configTOTAL_HEAP_SIZE);
+    static const char * const buf_names[CIR_BUF_NUM] = { "GPS NMEA", "console NMEA" };
+    static uint8_t line = 0;
+
+    if (line == 0)
+    {
+        int heap_used = (int)configTOTAL_HEAP_SIZE - (int)xPortGetFreeHeapSize();
+        sprintf(pcWriteBuffer,"Free RTOS heap used: %d/%d (%d%%)\r\n", heap_used, (int)configTOTAL_HEAP_SIZE, (100*heap_used)/(int)configTOTAL_HEAP_SIZE);
+    }
+    else if (line <= CIR_BUF_NUM)
+    {
+        /* one line per ring buffer: bytes in use now and at most, failed reservations */
+        cir_buf_str* buf = get_cir_buf((cir_buf_num)(line-1));
+        sprintf(pcWriteBuffer, "%s buffer: used %d/%d, high-water %d, overruns %lu\r\n", buf_names[line-1],
+                (int)cir_used(buf), (int)buf->buf_len, (int)buf->high_water, buf->overruns);
+    }
+    else
+    {
+        log_buf_str* log = get_log_buf();
+        sprintf(pcWriteBuffer, "console log buffer: used %d/%d, high-water %d, drops %lu\r\n",
+                (int)log_used(), LOG_BUF_LEN, (int)log->high_water, log->drops);
+    }
+    line++;
+    if (line <= CIR_BUF_NUM+1) return pdTRUE;
+    line = 0;
     return pdFALSE;
 }
 
@@ -687,6 +719,40 @@ static portBASE_TYPE prvGPSAlwONCommand( char *pcWriteBuffer,
     return pdFALSE;
 }
 
+static portBASE_TYPE prvGPSDMACommand( char *pcWriteBuffer,
+                             size_t xWriteBufferLen,
+                             const char *pcCommandString )
+{
+    BaseType_t  param_len;
+    uint8_t gps_dma = 0;
+
+    const char* param = FreeRTOS_CLIGetParameter(pcCommandString, 1, &param_len);
+    if(param)
+    {
+       if (!strcmp(param, "en"))
+       {
+           gps_dma = 1;
+       }
+       else if (!strcmp(param, "dis"))
+       {
+           gps_dma = 0;
+       }
+       SetOption(OPT_GPS_DMA, &gps_dma);
+    }
+
+    gps_dma = *(uint8_t *)GetOption(OPT_GPS_DMA);
+    if (gps_dma)
+    {
+        sprintf(pcWriteBuffer, "GPS DMA reception - enabled (after reset), %lu buffer overruns\r\n",
+                (unsigned long)USART3_RxDMA_Laps());
+    }
+    else
+    {
+        sprintf(pcWriteBuffer, "GPS DMA reception - disabled (after reset)\r\n");
+    }
+    return pdFALSE;
+}
+
 static portBASE_TYPE prvBackupRegCommand( char *pcWriteBuffer,
                              size_t xWriteBufferLen,
                              const char *pcCommandString )
@@ -873,6 +939,285 @@ static portBASE_TYPE prvGPSWdgTimeCommand( char *pcWriteBuffer,
     return pdFALSE;
 }
 
+static portBASE_TYPE prvRxStatCommand( char *pcWriteBuffer,
+                             size_t xWriteBufferLen,
+                             const char *pcCommandString )
+{
+    static uint8_t line = 0;
+    BaseType_t  param_len;
+    const OGN_RxStats_t* stats = OGN_GetRxStats();
+    int i, len;
+
+    const char* param = FreeRTOS_CLIGetParameter(pcCommandString, 1, &param_len);
+    if ((line == 0) && (param) && (!strcmp(param, "clear")))
+    {
+        OGN_ClearRxStats();
+    }
+
+    if (line == 0)
+    {
+        sprintf(pcWriteBuffer, "RX packets: OK: %lu, corrected: %lu, failed: %lu\r\n",
+            stats->ok, stats->corrected, stats->failed);
+        line = OGN_RX_MAX_ITER+1;
+        return pdTRUE;
+    }
+    if (line == OGN_RX_MAX_ITER+1)
+    {
+        /* corrected without the LDPC decoder */
+        sprintf(pcWriteBuffer, "Syndrome table: 1-bit %lu, 2-bit %lu, bit flipping: %lu (cycles: last %lu, max %lu)\r\n",
+            stats->syndrome_hits[0], stats->syndrome_hits[1], stats->bitflip_hits,
+            stats->bitflip_cycles_last, stats->bitflip_cycles_max);
+        line = 1;
+        return pdTRUE;
+    }
+
+    /* iteration histogram: number of packets corrected after 1, 2, ... iterations, eight per line */
+    len = sprintf(pcWriteBuffer, "LDPC iterations %2d-%2d:", line, line+7);
+    for (i = line; (i < line+8) && (i <= OGN_RX_MAX_ITER); i++)
+    {
+        len += sprintf(&pcWriteBuffer[len], " %lu", stats->iter_hist[i]);
+    }
+    sprintf(&pcWriteBuffer[len], "\r\n");
+    line = i;
+    if (line <= OGN_RX_MAX_ITER) return pdTRUE;
+    line = 0;
+    return pdFALSE;
+}
+
+/**
+  * @brief  Command gps_pos_stat: how long the position readers wait, clear the statistics.
+  * @param  CLI template
+  * @retval CLI template
+  */
+static portBASE_TYPE prvGPSPosStatCommand( char *pcWriteBuffer,
+                             size_t xWriteBufferLen,
+                             const char *pcCommandString )
+{
+    BaseType_t  param_len;
+    const OGN_PosStats_t* stats = OGN_GetPosStats();
+
+    const char* param = FreeRTOS_CLIGetParameter(pcCommandString, 1, &param_len);
+    if ((param) && (!strcmp(param, "clear")))
+    {
+        OGN_ClearPosStats();
+    }
+#ifdef OGN_POS_USE_MUTEX
+    sprintf(pcWriteBuffer, "Position reads (mutex): %lu, wait cycles: last %lu, max %lu\r\n",
+        stats->reads, stats->wait_cycles_last, stats->wait_cycles_max);
+#else
+    sprintf(pcWriteBuffer, "Position reads (snapshot): %lu, retries: %lu, wait cycles: last %lu, max %lu\r\n",
+        stats->reads, stats->retries, stats->wait_cycles_last, stats->wait_cycles_max);
+#endif
+    return pdFALSE;
+}
+
+/**
+  * @brief  Command clock: PPS disciplined UTC clock state and statistics, TX slot timing, clear the statistics.
+  * @param  CLI template
+  * @retval CLI template
+  */
+static portBASE_TYPE prvClockCommand( char *pcWriteBuffer,
+                             size_t xWriteBufferLen,
+                             const char *pcCommandString )
+{
+    static const char* const quality[] = { "none", "holdover", "locked" };
+    static uint8_t line = 0;
+    BaseType_t  param_len;
+    const clock_stats_t* stats = Clock_GetStats();
+    const OGN_TxStats_t* tx_stats = OGN_GetTxStats();
+    clock_utc_t utc;
+    clock_ref_t ref;
+    char time[16];
+    int32_t ppb;
+
+    if (line == 1)
+    {
+        sprintf(pcWriteBuffer, "PPS: %lu, missed %lu, rejected %lu, restarts %lu, UTC steps %lu, error: last %ld, max %ld us\r\n",
+            stats->pps, stats->missed, stats->rejected, stats->restarts, stats->utc_steps, stats->last_err, stats->max_err);
+        line = 2;
+        return pdTRUE;
+    }
+    if (line == 2)
+    {
+        sprintf(pcWriteBuffer, "TX slot: last %lu ms, out of slot %lu, without clock %lu, requests dropped %lu\r\n",
+            tx_stats->slot_ms_last, tx_stats->out_of_slot, tx_stats->no_clock, Spirit1_TxDropped());
+        line = 0;
+        return pdFALSE;
+    }
+
+    const char* param = FreeRTOS_CLIGetParameter(pcCommandString, 1, &param_len);
+    if ((param) && (!strcmp(param, "clear")))
+    {
+        Clock_ClearStats();
+    }
+
+    clock_quality_t q = Clock_GetUTC(&utc);
+    if (q == CLOCK_NONE) strcpy(time, "--:--:--.------");
+    else Clock_Format(time, &utc);
+    Clock_GetRef(&ref);
+    /* timer rate against nominal: period is in 1/256 count per second, 1 count per second is 1 ppm */
+    ppb = ref.period ? ((int32_t)(ref.period - CLOCK_TIMER_HZ*256)*125)/32 : 0;
+    sprintf(pcWriteBuffer, "UTC %s (%s), timer %c%ld.%03ld ppm (%s)\r\n", time, quality[q],
+        ppb < 0 ? '-' : '+', labs(ppb)/1000, labs(ppb)%1000, ref.rated ? "measured" : "nominal");
+    line = 1;
+    return pdTRUE;
+}
+
+/**
+  * @brief  Command hpt_sync: phase lock of the HPT tables to the PPS, clear the statistics.
+  * @param  CLI template
+  * @retval CLI template
+  */
+static portBASE_TYPE prvHPTSyncCommand( char *pcWriteBuffer,
+                             size_t xWriteBufferLen,
+                             const char *pcCommandString )
+{
+    static const char* const state[] = { "free running", "acquiring", "locked", "holdover" };
+    static uint8_t line = 0;
+    BaseType_t  param_len;
+    const hpt_pll_t* pll = HPT_GetPll();
+    const hpt_pll_stats_t* stats = HPT_GetPllStats();
+
+    if (line == 1)
+    {
+        sprintf(pcWriteBuffer, "PPS: %lu, resyncs %lu, locks %lu, holdover cycles %lu, max. error %ld us, last trim %d ms\r\n",
+            stats->pps, stats->resyncs, stats->locks, stats->holdover, stats->max_err, stats->trim_last);
+        line = 0;
+        return pdFALSE;
+    }
+
+    const char* param = FreeRTOS_CLIGetParameter(pcCommandString, 1, &param_len);
+    if ((param) && (!strcmp(param, "clear")))
+    {
+        HPT_ClearPllStats();
+    }
+    sprintf(pcWriteBuffer, "HPT PPS lock: %s, phase error %ld us, rate %ld us/s\r\n",
+        state[pll->state], pll->err, pll->drift);
+    line = 1;
+    return pdTRUE;
+}
+
+/**
+  * @brief  Command hpt_jitter: how late each HPT table event runs, clear the statistics.
+  * @param  CLI template
+  * @retval CLI template
+  */
+static portBASE_TYPE prvHPTJitterCommand( char *pcWriteBuffer,
+                             size_t xWriteBufferLen,
+                             const char *pcCommandString )
+{
+    static uint8_t line = 0;
+    BaseType_t  param_len;
+    uint8_t     events;
+    uint32_t    dropped;
+    const HPT_Jitter* jitter = HPT_GetJitter(&events, &dropped);
+
+    if (line == 0)
+    {
+        const char* param = FreeRTOS_CLIGetParameter(pcCommandString, 1, &param_len);
+        if ((param) && (!strcmp(param, "clear")))
+        {
+            HPT_ClearJitter();
+        }
+#ifdef HPT_HW_TIMER
+        sprintf(pcWriteBuffer, "HPT on TIM5 compare, dropped messages: %lu\r\n", dropped);
+#else
+        sprintf(pcWriteBuffer, "HPT on RTOS timer, dropped messages: %lu\r\n", dropped);
+#endif
+        if (events == 0) return pdFALSE;
+        line = 1;
+        return pdTRUE;
+    }
+
+    /* one line per event: late against the PPS second plus the table time */
+    const HPT_Event* event = &HPT_GetTable()[line-1];
+    jitter += line-1;
+    sprintf(pcWriteBuffer, "%2d %s %4lu ms: %lu, late: last %ld, min %ld, max %ld us\r\n",
+        line-1, hpt_opcodes_str[event->opcode], event->time,
+        jitter->count, jitter->last, jitter->min, jitter->max);
+    if (line++ < events) return pdTRUE;
+    line = 0;
+    return pdFALSE;
+}
+
+static portBASE_TYPE prvEncrKeyCommand( char *pcWriteBuffer,
+                             size_t xWriteBufferLen,
+                             const char *pcCommandString )
+{
+    static uint8_t line = 0;
+    BaseType_t  param_len;
+    const OGN_TxStats_t* stats = OGN_GetTxStats();
+    uint8_t encrypt;
+
+    if (line == 1)
+    {
+        sprintf(pcWriteBuffer, "Encrypted: %lu, whitened: %lu, cycles: last %lu, max %lu, over %u: %lu\r\n",
+            stats->encrypted, stats->plain, stats->encr_cycles_last, stats->encr_cycles_max,
+            OGN_ENCR_CYCLE_BUDGET, stats->encr_over_budget);
+        line = 0;
+        return pdFALSE;
+    }
+
+    const char* param = FreeRTOS_CLIGetParameter(pcCommandString, 1, &param_len);
+    if (param)
+    {
+        if (!strcmp(param, "en"))
+        {
+            encrypt = 1;
+            SetOption(OPT_ENCRYPT, &encrypt);
+        }
+        else if (!strcmp(param, "dis"))
+        {
+            encrypt = 0;
+            SetOption(OPT_ENCRYPT, &encrypt);
+        }
+        else if (!strcmp(param, "clear"))
+        {
+            OGN_ClearTxStats();
+        }
+        else if (param_len == 32)
+        {
+            /* 128-bit key as 32 hex digits: Key[0] first */
+            uint32_t key[4];
+            char word[9], *end;
+            int i;
+            for (i = 0; i < 4; i++)
+            {
+                memcpy(word, &param[8*i], 8); word[8] = 0;
+                key[i] = strtoul(word, &end, 16);
+                if (*end) break;
+            }
+            if (i < 4)
+            {
+                sprintf(pcWriteBuffer, "Invalid argument, must be 32 hex digits\r\n");
+                return pdFALSE;
+            }
+            SetOption(OPT_ENCR_KEY, key);
+            encrypt = 1;
+            SetOption(OPT_ENCRYPT, &encrypt);
+        }
+        else
+        {
+            sprintf(pcWriteBuffer, "Invalid argument, must be en, dis, clear or 32 hex digits\r\n");
+            return pdFALSE;
+        }
+        encrypt = *(uint8_t *)GetOption(OPT_ENCRYPT);
+        OGN_SetEncryptKey(encrypt ? (uint32_t *)GetOption(OPT_ENCR_KEY) : NULL);
+    }
+
+    /* the key itself is never shown: only its check value */
+    if (OGN_GetEncryptKeyCheck())
+    {
+        sprintf(pcWriteBuffer, "Position encryption - enabled, key check %04X\r\n", OGN_GetEncryptKeyCheck());
+    }
+    else
+    {
+        sprintf(pcWriteBuffer, "Position encryption - disabled\r\n");
+    }
+    line = 1;
+    return pdTRUE;
+}
+
 // ---------------------------------------------------------------------------------------------------------------------------
 
 static const CLI_Command_Definition_t VerCommand           = { "ver",            "ver: version number and MCU ID\r\n",           prvVerCommand,           0 };
@@ -883,6 +1228,8 @@ static const CLI_Command_Definition_t SP1SendPacketCommand = { "sp1_pkt",
 
 static const CLI_Command_Definition_t GPSTimeCommand       = { "gps_time",       "gps_time: GPS UTC Time\r\n",                   prvGPSTimeCommand,   0 };
 static const CLI_Command_Definition_t GPSPosCommand        = { "gps_pos",        "gps_pos: GPS Time & Position\r\n",             prvGPSPosCommand,    0 };
+static const CLI_Command_Definition_t GPSPosStatCommand    = { "gps_pos_stat",   "gps_pos_stat [clear]: position reader wait statistics\r\n", prvGPSPosStatCommand, -1 };
+static const CLI_Command_Definition_t ClockCommand         = { "clock",          "clock [clear]: PPS disciplined UTC clock and TX slot timing\r\n", prvClockCommand, -1 };
 
 static const CLI_Command_Definition_t ConsSpeedCommand     = { "cons_speed",   "cons_speed: console USART speed\r\n",            prvConsSpeedCommand, -1 };
 static const CLI_Command_Definition_t GPSSpeedCommand      = { "gps_speed",    "gps_speed: GPS USART speed\r\n",                 prvGPSSpeedCommand,  -1 };
@@ -891,6 +1238,7 @@ static const CLI_Command_Definition_t GPSResetCommand      = { "gps_reset",    "
 static const CLI_Command_Definition_t GPSOnCommand         = { "gps_on",       "gps_on: turn GPS on.\r\n",                       prvGPSOnCommand, 0 };
 static const CLI_Command_Definition_t GPSOffCommand        = { "gps_off",      "gps_off: turn GPS off.\r\n",                     prvGPSOffCommand, 0 };
 static const CLI_Command_Definition_t GPSAlwONCommand      = { "gps_always_on","gps_always_on en/dis: disable GPS power control\r\n", prvGPSAlwONCommand, -1 };
+static const CLI_Command_Definition_t GPSDMACommand        = { "gps_dma",      "gps_dma en/dis: GPS USART reception by DMA\r\n", prvGPSDMACommand, -1 };
 
 static const CLI_Command_Definition_t AcftIDCommand        = { "acft_id",      "acft_id:  aircraft identification\r\n",          prvAcftIDCommand,    -1 };
 static const CLI_Command_Definition_t TxPowerCommand       = { "tx_power",     "tx_power: transmitter power level [dBm].\r\n",   prvTxPowerCommand,   -1 };
@@ -904,12 +1252,16 @@ static const CLI_Command_Definition_t MaxTxPowerCommand    = { "max_tx_power", "
 static const CLI_Command_Definition_t BackupRegCommand     = { "backup_reg",   "backup_reg reg [value].\r\n",                    prvBackupRegCommand,  -1 };
 static const CLI_Command_Definition_t DebugGPSCommand      = { "debug_gps",    "debug_gps - enable GPS logging.\r\n",            prvDebugGPSCommand,  0 };
 static const CLI_Command_Definition_t DebugHPTCommand      = { "debug_hpt",    "debug_hpt - enable HPT logging.\r\n",            prvDebugHPTCommand,  0 };
+static const CLI_Command_Definition_t HPTSyncCommand       = { "hpt_sync",     "hpt_sync [clear] - HPT phase lock to PPS.\r\n", prvHPTSyncCommand, -1 };
+static const CLI_Command_Definition_t HPTJitterCommand     = { "hpt_jitter",   "hpt_jitter [clear] - HPT event timing.\r\n",    prvHPTJitterCommand, -1 };
 static const CLI_Command_Definition_t GPSAntCommand        = { "gps_ant",      "gps_ant [int|ext] - select GPS antenna.\r\n",    prvGPSAntCommand,  -1 };
 static const CLI_Command_Definition_t VoltCommand          = { "volt",         "volt: show voltages.\r\n",                       prvVoltCommand, 0 };
 static const CLI_Command_Definition_t CPUTempCommand       = { "cpu_temp",     "cpu_temp: show internal CPU temp.\r\n",          prvCPUTempCommand, 0 };
 static const CLI_Command_Definition_t JamRatioCommand      = { "jam_ratio",    "jam_ratio: [0-100].\r\n",                        prvJamRatioCommand, -1 };
 static const CLI_Command_Definition_t MinBatLvlCommand     = { "min_bat_lvl",  "min_bat_lvl: [0-4000 mV].\r\n",                  prvMinBatLvlCommand, -1 };
 static const CLI_Command_Definition_t GPSWdgTimeCommand    = { "gps_wdg_time", "gps_wdg_time: [1-64k sec. (0-disabled)].\r\n",   prvGPSWdgTimeCommand, -1 };
+static const CLI_Command_Definition_t RxStatCommand        = { "rx_stat",      "rx_stat [clear]: RX packets decoder statistics.\r\n", prvRxStatCommand, -1 };
+static const CLI_Command_Definition_t EncrKeyCommand       = { "encr_key",     "encr_key [en|dis|clear|32xhex]: position encryption key and TX statistics.\r\n", prvEncrKeyCommand, -1 };
 
 
 /**
@@ -931,11 +1283,14 @@ void RegisterCommands(void)
 
    FreeRTOS_CLIRegisterCommand(&GPSTimeCommand);
    FreeRTOS_CLIRegisterCommand(&GPSPosCommand);
+   FreeRTOS_CLIRegisterCommand(&GPSPosStatCommand);
+   FreeRTOS_CLIRegisterCommand(&ClockCommand);
    FreeRTOS_CLIRegisterCommand(&GPSDumpCommand);
    FreeRTOS_CLIRegisterCommand(&GPSResetCommand);
    FreeRTOS_CLIRegisterCommand(&GPSOnCommand);
    FreeRTOS_CLIRegisterCommand(&GPSOffCommand);
    FreeRTOS_CLIRegisterCommand(&GPSAlwONCommand);
+   FreeRTOS_CLIRegisterCommand(&GPSDMACommand);
 
    FreeRTOS_CLIRegisterCommand(&AcftIDCommand);
    FreeRTOS_CLIRegisterCommand(&TxPowerCommand);
@@ -950,11 +1305,15 @@ void RegisterCommands(void)
    FreeRTOS_CLIRegisterCommand(&BackupRegCommand);
    FreeRTOS_CLIRegisterCommand(&DebugGPSCommand);
    FreeRTOS_CLIRegisterCommand(&DebugHPTCommand);
+   FreeRTOS_CLIRegisterCommand(&HPTSyncCommand);
+   FreeRTOS_CLIRegisterCommand(&HPTJitterCommand);
    FreeRTOS_CLIRegisterCommand(&GPSAntCommand);
    FreeRTOS_CLIRegisterCommand(&VoltCommand);
    FreeRTOS_CLIRegisterCommand(&CPUTempCommand);
    FreeRTOS_CLIRegisterCommand(&JamRatioCommand);
    FreeRTOS_CLIRegisterCommand(&MinBatLvlCommand);
+   FreeRTOS_CLIRegisterCommand(&RxStatCommand);
+   FreeRTOS_CLIRegisterCommand(&EncrKeyCommand);
 }
 
 // ---------------------------------------------------------------------------------------------------------------------------
@@ -13,6 +13,7 @@
 #include "commands.h"
 #include "cir_buf.h"
 #include "options.h"
+#include "log.h"
 
 /* -------- defines -------- */
 #define MAX_INPUT_LENGTH    100
@@ -48,6 +49,7 @@ void Console_Config(void)
    {
       USART2_Config(*cons_speed);
    }
+   Log_Config();
 }
 
 /**
@@ -71,16 +73,19 @@ void Console_SetGPSQue(xQueueHandle* handle)
 }
 
 /**
-* @brief  Sends Console string.
-* @param  String address & len.
+* @brief  Sends Console string: copied to the log ring, sent by DMA.
+* @param  String address, block: wait for space in the ring instead of dropping (tasks only).
 * @retval None
 */
 void Console_Send(const char* str, char block)
 {
-   USART2_Send((uint8_t*)str, strlen(str));
    if (block)
    {
-         USART2_Wait();
+      Log_SendWait(str);
+   }
+   else
+   {
+      Log_Send(str);
    }
 }
 
@@ -91,9 +96,7 @@ void Console_Send(const char* str, char block)
 */
 void Console_Send_Char(char ch)
 {
-   static uint8_t data;
-   data = ch;
-   USART2_Send(&data, 1);
+   Log_Write(&ch, 1);
 }
 /**
 * @brief  Handle char entered by console.
@@ -236,11 +239,18 @@ void vTaskConsole(void* pvParameters)
                    nmea_sentence[nmea_sent_len++] = '\0';
                    if (gps_task_cir_buf && gps_task_queue)
                    {
-                      gps_msg.msg_data = (uint32_t)cir_put_data(gps_task_cir_buf, (uint8_t*)nmea_sentence, nmea_sent_len);
-                      gps_msg.msg_len  = nmea_sent_len;
-                      gps_msg.src_id   = CONSOLE_USART_SRC_ID;
-                      /* Send NMEA sentence to GPS task */
-                      xQueueSend(*gps_task_queue, &gps_msg, portMAX_DELAY);
+                      /* GPS task releases the sentence from the buffer when parsed */
+                      uint8_t* nmea_copy = cir_reserve(gps_task_cir_buf, nmea_sent_len);
+                      if (nmea_copy)
+                      {
+                         memcpy(nmea_copy, nmea_sentence, nmea_sent_len);
+                         cir_commit(gps_task_cir_buf);
+                         gps_msg.msg_data = (uint32_t)nmea_copy;
+                         gps_msg.msg_len  = nmea_sent_len;
+                         gps_msg.src_id   = CONSOLE_USART_SRC_ID;
+                         /* Send NMEA sentence to GPS task */
+                         xQueueSend(*gps_task_queue, &gps_msg, portMAX_DELAY);
+                      }
                    }
                    /* go back to normal console mode */
                    console_mode = CONSOLE_SENTENCE_MODE;
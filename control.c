@@ -18,10 +18,12 @@
 #include "console.h"
 #include "gps.h"
 #include "timer_const.h"
+#include "log.h"
+#include "clock.h"
 
 
 /* -------- defines -------- */
-#define MAX_HPT_TABLE_LEN  16
+#define MAX_HPT_TABLE_LEN  HPT_MAX_EVENTS
 /* -------- variables -------- */
 HPT_Event hpt_table[MAX_HPT_TABLE_LEN];
 TimerHandle_t xPowerDownTimer;
@@ -29,9 +31,6 @@ TimerHandle_t xCtrlTaskTimer;
 /* data for jamming random packet */
 uint8_t jam_packet[OGN_PKT_LEN];
 
-/* pointer to TX packet data */
-uint8_t* TX_pkt_data = NULL;
-
 /* Console task queue */
 xQueueHandle  control_queue;
 /* -------- interrupt handlers -------- */
@@ -40,12 +39,16 @@ xQueueHandle  control_queue;
 void EXTI9_5_IRQHandler(void)
 {
    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+   int8_t     pps;
    
    if(EXTI_GetITStatus(EXTI_Line6) != RESET)
    {
+      /* timestamp the edge before anything else */
+      pps = Clock_PPS_FromISR();
       /* Clear the EXTI line 6 pending bit */
       EXTI_ClearITPendingBit(EXTI_Line6); 
-      xHigherPriorityTaskWoken = HPT_RestartFromISR();      
+      /* an edge off the seconds grid must not move the tables */
+      if (pps != 0) xHigherPriorityTaskWoken = HPT_RestartFromISR();      
    }
    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
    
@@ -112,6 +115,7 @@ void PreShutDownSequence(void)
     
     RTC_WriteBackupRegister(SHDN_REG_NUM, SHDN_MAGIC_NUM);
     vTaskDelay(500);
+    Log_Flush();
     NVIC_SystemReset();  
 }
 
@@ -152,13 +156,12 @@ uint8_t Create_HPT_Table_OGN(HPT_Event* hpt_table_arr)
 {
    const HPT_Event Table_OGN[] = 
    {   /* time,          event,             event data (optional) */
-       { TIMER_MS(150),  HPT_COPY_PKT,      0   },  /* Copy packet to TX buffer (manchester encoding) */  
+       { TIMER_MS(150),  HPT_COPY_PKT,      0   },  /* Transmit the GPS position, encoded at each transmission: once per cycle is enough */
        { TIMER_MS(300),  HPT_SP1_CHANNEL,   4   },  /* Change channel to 868.4 */
        { TIMER_MS(400),  HPT_TX_PKT_LBT,    380 },  /* Start random transmit within next 380 ms */
        { TIMER_MS(800),  HPT_SP1_CHANNEL,   2   },  /* Change channel to 868.2 */
        { TIMER_MS(800),  HPT_TX_PKT_LBT,    380 },  /* Start random transmit within next 380 ms */
        { TIMER_MS(925),  HPT_IWDG_RELOAD,   0   },  /* Kick Independent Watchdog */
-       { TIMER_MS(950),  HPT_PREPARE_PKT,   0   },  /* Prepare packet from GPS position */
        { TIMER_MS(1000), HPT_RESTART,       0   }   /* Restart table */ 
    }; 
    
@@ -453,8 +456,10 @@ static uint8_t print_hex_val(uint8_t data, char* dest)
 
 void Print_packet(rcv_packet_str* packet)
 {
-    char buffer[80];
+    char buffer[128];
     int i, Neg=0;
+    OGN_Decode_res_t res;
+    clock_utc_t utc;
 
     float rssi = packet->rssi;
     int lqi = packet->lqi;
@@ -465,17 +470,24 @@ void Print_packet(rcv_packet_str* packet)
     int Int = (int)floor(rssi);
     int Frac = (int)floor((rssi-Int)*10);
     if(Neg) Int=(-Int);
-    sprintf(buffer, "Packet received: RSSI: %+d.%ddBm, LQI: %d, PQI: %d, SQI: %d\r\n", Int, Frac, lqi, pqi, sqi);
-    Console_Send(buffer, 1);
+    int ctr = sprintf(buffer, "Packet received");
+    if (Clock_CountToUTC(packet->time, &utc) != CLOCK_NONE)
+    {
+       /* UTC at the end of the packet */
+       ctr += sprintf(&buffer[ctr], " at ");
+       ctr += Clock_Format(&buffer[ctr], &utc);
+    }
+    sprintf(&buffer[ctr], ": RSSI: %+d.%ddBm, LQI: %d, PQI: %d, SQI: %d\r\n", Int, Frac, lqi, pqi, sqi);
+    Log_Send(buffer);
 
-    int ctr=0;
+    ctr=0;
     for (i=0; i < OGN_PKT_LEN; i++)
     {
        ctr+= print_hex_val(packet->data_ptr[i], &buffer[ctr]);
     }
     buffer[ctr++] = '\r'; buffer[ctr++] = '\n';
     buffer[ctr++] = '\0';
-    Console_Send(buffer, 1);
+    Log_Send(buffer);
 
     ctr=0;
     for (i=0; i < OGN_PKT_LEN; i++)
@@ -484,8 +496,19 @@ void Print_packet(rcv_packet_str* packet)
     }
     buffer[ctr++] = '\r'; buffer[ctr++] = '\n';
     buffer[ctr++] = '\0';
-    Console_Send(buffer, 1);
+    Log_Send(buffer);
 
+    /* correct the packet with the LDPC decoder, then decode the position */
+    res = OGN_DecodePacket(packet->data_ptr, packet->err_ptr, packet->rssi, &buffer[2]);
+    if (res == OGN_DECODE_FAILED)
+    {
+        Log_Send("LDPC: failed\r\n");
+        return;
+    }
+    Log_Send(res == OGN_DECODE_CORRECTED ? "LDPC: corrected\r\n" : "LDPC: OK\r\n");
+    buffer[0] = ' '; buffer[1] = ' ';
+    strcat(buffer, "\r\n");
+    Log_Send(buffer);
 }
 
 /**
@@ -517,14 +540,10 @@ static void Handle_hpt_msgs(task_message* msg)
     
     switch (msg->msg_opcode)
     {
-        case HPT_PREPARE_PKT:
-            TX_pkt_data = OGN_PreparePacket();
-            break;
-
         case HPT_COPY_PKT:
-            sp1_msg.msg_data   = (uint32_t)TX_pkt_data; /* null allowed - packet data will be cleared */
-            sp1_msg.msg_len    = OGN_PKT_LEN;
-            sp1_msg.msg_opcode = SP1_COPY_OGN_PKT;
+            sp1_msg.msg_data   = 0;     /* the SP1 task extrapolates the latest fix at each transmission */
+            sp1_msg.msg_len    = 0;
+            sp1_msg.msg_opcode = SP1_COPY_OGN_TX;
             sp1_msg.src_id     = CONTROL_SRC_ID;
             xQueueHandle* sp1_task_queue = Get_SP1Queue();
             xQueueSend(*sp1_task_queue, &sp1_msg, portMAX_DELAY);
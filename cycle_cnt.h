@@ -0,0 +1,47 @@
+/**
+  ************************************
+  * @file    cycle_cnt.h
+  * @author
+  * @brief   CPU cycle counter (DWT CYCCNT) for timing short code sections
+  ************************************
+  */
+
+#ifndef __CYCLE_CNT_H
+#define __CYCLE_CNT_H
+
+#include <stdint.h>
+#include "stm32l1xx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The counter runs at the core clock and wraps around every 2^32 cycles: differences of */
+/* two readings are right as long as the timed section is shorter than that.            */
+
+/**
+  * @brief  Start the cycle counter (once, any task).
+  * @param  None
+  * @retval None
+  */
+static inline void cycle_cnt_init(void)
+{
+   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+  * @brief  Read the cycle counter.
+  * @param  None
+  * @retval number of core clock cycles since the counter was started (modulo 2^32)
+  */
+static inline uint32_t cycle_cnt_get(void)
+{
+   return DWT->CYCCNT;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CYCLE_CNT_H */
@@ -16,6 +16,8 @@
 #include "ogn_lib.h"
 #include "display.h"
 #include "timer_const.h"
+#include "log.h"
+#include "clock.h"
 
 /* -------- constants -------- */
 /* http://support.maestro-wireless.com/knowledgebase.php?article=6 */
@@ -28,13 +30,18 @@ static const char * const pcShutDownNMEA = "$PSRF117,16*0B\r\n";
 #define GPS_ON_OFF_PORT  GPIOB
 #define GPS_ON_OFF_CLK   RCC_AHBPeriph_GPIOB
 /* -------- variables -------- */
-/* circular buffer for NMEA messages */
+/* circular buffers for NMEA messages: from the GPS and typed on the console */
 cir_buf_str* nmea_buffer;
+cir_buf_str* console_nmea_buffer;
 xQueueHandle gps_que;
 static TimerHandle_t xGPSValidTimer;
 static TimerHandle_t xGPSWdgTimer;
 static uint8_t GPS_fix_found;
 static uint8_t debug_mode;
+/* DMA reception: sentence being framed by the GPS task (never committed to nmea_buffer) */
+static void* gps_dma_msg;
+/* [us] one byte on the line: DMA bytes are framed later, their '$' is timed back from the read */
+static uint32_t gps_byte_us = CLOCK_TIMER_HZ*10/9600;
 
 /* -------- functions -------- */
 
@@ -81,6 +88,7 @@ void vGPSValidTimerCallback(TimerHandle_t pxTimer)
 void vGPSWdgTimerCallback(TimerHandle_t pxTimer)
 {
     Console_Send("!! GPS watchdog reset (use gps_wdg_time 0 to disable) !!\r\n", 1);
+    Log_Flush();
     NVIC_SystemReset();
 }
 
@@ -110,23 +118,89 @@ void GPS_Valid_Position(void)
 
 uint32_t GPS_GetPosition(char *Output) { return OGN_GetPosition(Output); }
 
-void Handle_NMEA_String(const char* str, uint8_t len)
+static void Handle_NMEA_Result(OGN_Parse_res_t ret_value, const char* str, uint8_t len)
 {
-    OGN_Parse_res_t ret_value;
     static char DebugStr[120];
 
-    ret_value = OGN_Parse_NMEA(str, len);
     if (debug_mode)
     {
-        sprintf(DebugStr, "NMEA:%6.6s[%2d] => %d\r\n", str, len, (int)ret_value);
-        Console_Send(DebugStr, 0);
+        sprintf(DebugStr, "NMEA:%6.6s[%2d] => %d\r\n", str ? str : "??????", len, (int)ret_value);
+        Log_SendTime(DebugStr);
     }
 
     if (ret_value == OGN_PARSE_POS_VALID_CURRENT)
     {
         GPS_Valid_Position();
-    }   
-    return; 
+    }
+    return;
+}
+
+void Handle_NMEA_String(const char* str, uint8_t len)
+{
+    Handle_NMEA_Result(OGN_Parse_NMEA(str, len), str, len);
+}
+
+/**
+* @brief  Handles NMEA sentence indexed by the USART3 interrupt.
+* @param  sentence descriptor (in the NMEA circular buffer)
+* @retval None
+*/
+void Handle_NMEA_Msg(void* nmea_msg)
+{
+    uint8_t len;
+    const char* str = OGN_NMEA_Sentence(nmea_msg, &len);
+
+    if (*(uint8_t*)GetOption(OPT_GPSDUMP) && str)
+    {
+        /* Send received NMEA sentence to console (with blocking) */
+        Console_Send(str, 1);
+        Console_Send("\r\n", 1);
+    }
+    if (str && (len >= 6))
+    {
+        /* A2235-H possible bug: observed (very rarely) lack of CRC (*12) at the end of NMEA sentence */
+        /* cold reset triggered to get out of the state */
+        if (str[len-3] != '*')
+        {
+            Console_Send("GPS bug detected - GPS cold reset should fix this.\r\nIf not - reconnect battery.\r\n", 1);
+            GPS_Reset();
+        }
+    }
+    Handle_NMEA_Result(OGN_Parse_NMEA_Msg(nmea_msg), str, len);
+}
+
+/**
+* @brief  Frames and handles NMEA sentences from the USART3 DMA buffer.
+* @param  None
+* @retval None
+*/
+void Handle_NMEA_DMA(void)
+{
+    uint8_t* data;
+    uint16_t len, idx;
+    uint32_t now;
+
+    while ((len = USART3_RxDMA_Read(&data)) > 0)
+    {
+        /* the last byte came just before the read (idle line or half buffer): a span cut */
+        /* by the buffer end or a late task only makes the times later, never earlier     */
+        now = Clock_Count();
+        for (idx = 0; idx < len; idx++)
+        {
+            if (OGN_NMEA_ProcessByte(gps_dma_msg, data[idx]))
+            {
+                if (xGPSWdgTimer) xTimerStart(xGPSWdgTimer, portMAX_DELAY);
+                Handle_NMEA_Msg(gps_dma_msg);
+                OGN_NMEA_MsgInit(gps_dma_msg);
+            }
+            else if (data[idx] == '$')
+            {
+                OGN_NMEA_SetTime(gps_dma_msg, now - (len - idx)*gps_byte_us);
+            }
+        }
+    }
+    /* bytes lost to a DMA lap: start framing again at the next '$' */
+    if (data == NULL) OGN_NMEA_MsgInit(gps_dma_msg);
 }
 
 /**
@@ -181,6 +255,7 @@ void GPS_Config(void)
    if (gps_speed)
    {
       USART3_Config(*gps_speed);
+      gps_byte_us = CLOCK_TIMER_HZ*10 / *gps_speed;
    } 
    
    /* GPS validity timer */
@@ -233,12 +308,23 @@ void vTaskGPS(void* pvParameters)
    
    OGN_Init();
    OGN_SetAcftID(*(uint32_t*)GetOption(OPT_ACFT_ID));
+   OGN_SetEncryptKey(*(uint8_t*)GetOption(OPT_ENCRYPT) ? (uint32_t*)GetOption(OPT_ENCR_KEY) : NULL);
  
-   /* Allocate data buffer */
+   /* Allocate data buffers: one per producer */
    nmea_buffer = init_cir_buf(CIR_BUF_NMEA);
+   console_nmea_buffer = init_cir_buf(CIR_BUF_CONSOLE);
    /* Send cir. buf. handle for USART3 driver & console */
-   USART3_SetBuf(nmea_buffer);
-   Console_SetNMEABuf(nmea_buffer);
+   if (*(uint8_t*)GetOption(OPT_GPS_DMA))
+   {
+      /* DMA reception: sentences are framed here, one at a time */
+      gps_dma_msg = OGN_NMEA_MsgInit(cir_reserve(nmea_buffer, OGN_NMEA_MsgSize()));
+      USART3_RxDMA_Config();
+   }
+   else
+   {
+      USART3_SetBuf(nmea_buffer);
+   }
+   Console_SetNMEABuf(console_nmea_buffer);
 
    /* Create queue for GPS task messages received */
    gps_que = xQueueCreate(10, sizeof(task_message));
@@ -264,31 +350,23 @@ void vTaskGPS(void* pvParameters)
       {
          case GPS_USART_SRC_ID:
          {
-            /* Received NMEA sentence from real GPS */
-            char* nmea_str= (char*)msg.msg_data;
-            if (xGPSWdgTimer) xTimerStart(xGPSWdgTimer, portMAX_DELAY);
-            if (*(uint8_t*)GetOption(OPT_GPSDUMP))
-            {
-                /* Send received NMEA sentence to console (with blocking) */
-                Console_Send(nmea_str, 1);
-            }
-            if (msg.msg_len >= 6) 
+            if (msg.msg_opcode == USART3_RX_DMA)
             {
-                /* A2235-H possible bug: observed (very rarely) lack of CRC (*12) at the end of NMEA sentence */
-                /* cold reset triggered to get out of the state */
-                if ((nmea_str[0] == '$') && (nmea_str[msg.msg_len-5] != '*'))
-                {
-                    Console_Send("GPS bug detected - GPS cold reset should fix this.\r\nIf not - reconnect battery.\r\n", 1);
-                    GPS_Reset();
-                }                
+               /* New data in the DMA buffer: idle line or half/full buffer */
+               Handle_NMEA_DMA();
+               break;
             }
-            Handle_NMEA_String(nmea_str, msg.msg_len);
+            /* Received NMEA sentence from real GPS: already indexed by the USART3 interrupt */
+            if (xGPSWdgTimer) xTimerStart(xGPSWdgTimer, portMAX_DELAY);
+            Handle_NMEA_Msg((void*)msg.msg_data);
+            if (cir_peek(nmea_buffer, NULL) == (uint8_t*)msg.msg_data) cir_release(nmea_buffer);
             break;
          }
          case CONSOLE_USART_SRC_ID:
          {
             /* Received NMEA sentence from console */
             Handle_NMEA_String((char*)msg.msg_data, msg.msg_len);
+            if (cir_peek(console_nmea_buffer, NULL) == (uint8_t*)msg.msg_data) cir_release(console_nmea_buffer);
             break;
          }
          default:
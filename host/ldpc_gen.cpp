@@ -0,0 +1,128 @@
+// Generator for the LDPC look-up tables kept in ldpc_enc.h and ldpc_dec.h
+// The tables are derived from LDPC_ParityGen[] and LDPC_ParityCheckIndex[]: the encoder table, the bit-to-check index
+// and the single/double error syndrome tables for the decoder, thus this program
+// has to be built with -DLDPC_NO_TABLES: it must not depend on the tables it generates.
+//
+// usage: ldpc_gen enc > ldpc_enc.h
+//        ldpc_gen dec > ldpc_dec.h
+
+#include <stdio.h>
+#include <string.h>
+
+#include <unordered_map>
+
+#include "ldpc.h"
+
+static void PrintEncodeTable(void)
+{ printf("// parity contribution of every data byte value at every byte position:\n");
+  printf("// 20 data bytes x 256 values x 48 parity bits (32 bits in [0], 16 bits in [1])\n");
+  printf("static const uint32_t LDPC_ParityTable[20][256][2] = {\n");
+  for(int Byte=0; Byte<20; Byte++)
+  { printf(" { // data byte #%d\n", Byte);
+    for(int Value=0; Value<256; Value++)
+    { uint32_t Data[5]; memset(Data, 0, sizeof(Data));
+      Data[Byte>>2] = (uint32_t)Value<<(8*(Byte&3));
+      uint32_t Parity[2];
+      LDPC_Encode(Data, Parity, LDPC_ParityGen);
+      if((Value&3)==0) printf("  ");
+      printf("{ 0x%08X, 0x%04X },", Parity[0], Parity[1]);
+      if((Value&3)==3) printf("\n"); }
+    printf(" },\n"); }
+  printf("} ;\n"); }
+
+static void PrintBitCheckIndex(void)
+{ uint8_t Weight[208]; uint8_t Index[208][8]; int Edges=0, MaxWeight=0;
+  memset(Weight, 0, sizeof(Weight));
+  for(int Row=0; Row<48; Row++)
+  { const uint8_t *CheckIndex = LDPC_ParityCheckIndex[Row];
+    uint8_t CheckWeight = *CheckIndex++;
+    for(int Bit=0; Bit<CheckWeight; Bit++)
+    { uint8_t BitIdx=CheckIndex[Bit];
+      Index[BitIdx][Weight[BitIdx]++]=Row; Edges++; }
+  }
+  for(int Bit=0; Bit<208; Bit++)
+  { if(Weight[Bit]!=LDPC_BitWeight[Bit]) fprintf(stderr, "Bit #%d: weight %d != %d\n", Bit, Weight[Bit], LDPC_BitWeight[Bit]);
+    if(Weight[Bit]>MaxWeight) MaxWeight=Weight[Bit]; }
+  printf("static const uint16_t LDPC_Edges = %d;         // number of ones in the parity check matrix = sum of all check weights\n", Edges);
+  printf("static const uint8_t  LDPC_MaxBitWeight = %d;   // max. number of checks a single bit takes part in\n\n", MaxWeight);
+  printf("// for every codeword bit: number of parity checks it takes part in, followed by the list of these checks\n");
+  printf("static const uint8_t LDPC_BitCheckIndex[208][%d] = {\n", MaxWeight+1);
+  for(int Bit=0; Bit<208; Bit++)
+  { printf(" { %d,", Weight[Bit]);
+    for(int Idx=0; Idx<Weight[Bit]; Idx++) printf(" %2d,", Index[Bit][Idx]);
+    printf(" },");
+    if((Bit&3)==3) printf("\n"); }
+  printf("} ;\n"); }
+
+static const int SyndromeHashSize = 512;          // open addressing, 208 entries: at most a few probes
+
+static uint16_t SyndromeHashIdx(uint64_t Syndrome)  // must stay the same as LDPC_SyndromeHashIdx() in ldpc.h
+{ uint32_t Hash = (uint32_t)Syndrome*0x9E3779B1 + (uint32_t)(Syndrome>>32)*0x85EBCA6B;
+  return Hash>>(32-9); }
+
+static void PrintSyndromeTable(void)
+{ uint64_t Column[208]; memset(Column, 0, sizeof(Column));
+  for(int Row=0; Row<48; Row++)
+  { const uint8_t *CheckIndex = LDPC_ParityCheckIndex[Row];
+    uint8_t CheckWeight = *CheckIndex++;
+    for(int Bit=0; Bit<CheckWeight; Bit++)
+      Column[CheckIndex[Bit]] |= (uint64_t)1<<Row; }
+
+  uint8_t Hash[SyndromeHashSize]; memset(Hash, 0xFF, sizeof(Hash));
+  int MaxProbe=0;
+  for(int Bit=0; Bit<208; Bit++)
+  { for(int Other=0; Other<Bit; Other++)
+      if(Column[Other]==Column[Bit]) fprintf(stderr, "Bits #%d and #%d have the same syndrome\n", Other, Bit);
+    int Probe=0; uint16_t Idx=SyndromeHashIdx(Column[Bit]);
+    for( ; Hash[Idx]!=0xFF; Idx=(Idx+1)&(SyndromeHashSize-1)) Probe++;
+    Hash[Idx]=Bit; if(Probe>MaxProbe) MaxProbe=Probe; }
+
+  std::unordered_map<uint64_t, int> Pairs;          // double error syndromes: how many pairs give each of them
+  int Total=0, Unique=0, AsSingle=0;
+  for(int Bit=0; Bit<208; Bit++)
+    for(int Other=0; Other<Bit; Other++)
+    { Pairs[Column[Bit]^Column[Other]]++; Total++; }
+  for(int Bit=0; Bit<208; Bit++)
+    for(int Other=0; Other<Bit; Other++)
+    { uint64_t Syndrome=Column[Bit]^Column[Other];
+      bool Single=false;
+      for(int Idx=0; Idx<208; Idx++) if(Column[Idx]==Syndrome) Single=true;
+      if(Single) AsSingle++;
+      else if(Pairs[Syndrome]==1) Unique++; }
+
+  printf("// syndrome of a single error at every codeword bit = the column of the parity check matrix\n");
+  printf("static const uint64_t LDPC_BitSyndrome[208] = {\n");
+  for(int Bit=0; Bit<208; Bit++)
+  { if((Bit&3)==0) printf(" ");
+    printf(" 0x%012llX,", (unsigned long long)Column[Bit]);
+    if((Bit&3)==3) printf("\n"); }
+  printf("} ;\n\n");
+  printf("// syndrome => codeword bit of a single error: open addressing on LDPC_SyndromeHashIdx(), 0xFF = empty, max. %d extra probes\n", MaxProbe);
+  printf("// double errors: all %d single errors and %d of the %d double errors have a syndrome no other single or double error has,\n", 208, Unique, Total);
+  printf("// %d double errors look like a single error and the other %d share their syndrome with another double error\n", AsSingle, Total-Unique-AsSingle);
+  printf("static const uint16_t LDPC_SyndromeHashSize = %d;\n", SyndromeHashSize);
+  printf("static const uint16_t LDPC_SyndromeDoubles = %d;  // double errors corrected by LDPC_SyndromeCorrect()\n", Unique);
+  printf("static const uint8_t LDPC_SyndromeHash[%d] = {\n", SyndromeHashSize);
+  for(int Idx=0; Idx<SyndromeHashSize; Idx++)
+  { if((Idx&15)==0) printf(" ");
+    printf(" 0x%02X,", Hash[Idx]);
+    if((Idx&15)==15) printf("\n"); }
+  printf("} ;\n"); }
+
+static void PrintDecodeTables(void)
+{ PrintBitCheckIndex();
+  printf("\n");
+  PrintSyndromeTable(); }
+
+static int PrintHeader(const char *Guard, void (*Print)(void))
+{ printf("// generated by host/ldpc_gen from the LDPC code matrices in ldpc.h - do not edit\n\n");
+  printf("#ifndef %s\n#define %s\n\n#include <stdint.h>\n\n", Guard, Guard);
+  (*Print)();
+  printf("\n#endif // of %s\n", Guard);
+  return 0; }
+
+int main(int argc, char *argv[])
+{ if(argc>1 && strcmp(argv[1], "enc")==0) return PrintHeader("__LDPC_ENC_H__", PrintEncodeTable);
+  if(argc>1 && strcmp(argv[1], "dec")==0) return PrintHeader("__LDPC_DEC_H__", PrintDecodeTables);
+  fprintf(stderr, "usage: %s enc|dec\n", argv[0]);
+  return 1; }
@@ -0,0 +1,1140 @@
+// Micro-benchmarks for the OGN codec: position encode, whitening, FEC encode/check,
+// soft LDPC decode (scalar and SIMD), Manchester emulation, packet field codecs, batch decode into arrays, batch TEA, key trial of encrypted packets, NMEA parsing, the NMEA ring buffer (two-thread stress), the console log ring (multi-producer stress)
+// and the position snapshot against a mutex (reader wait while the GPS side keeps parsing). All inputs come from a seeded generator,
+// thus two runs with the same seed process exactly the same data.
+//
+// usage: ogn_bench [-n <ops>] [-s <seed>] [<name-filter>]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <mutex>
+#include <algorithm>
+
+#include "ogn_host.h"
+#include "ldpc_simd.h"
+#include "tea_simd.h"
+#include "manchester.h"
+#include "cir_buf.h"
+#include "log_buf.h"
+#include "snapshot.h"
+#include "clock.h"
+#include "hpt_pll.h"
+
+static const int Inputs = 1024;                    // number of distinct inputs, cycled through by the benchmarks
+
+static OgnPosition Pos[Inputs];
+static OGN_Packet  Packet[Inputs];                 // complete (whitened + FEC) packets
+static OGN_Packet  Corrupt[Inputs];                // same packets with a few bit errors
+static char        NMEA[Inputs][3][96];            // GGA, RMC, GSA sentences for every position
+
+static const char *Filter = 0;
+
+static bool Selected(const char *Name)
+{ return Filter==0 || strstr(Name, Filter)!=0; }
+
+static const uint16_t PacketStride = sizeof(OGN_Packet)/sizeof(uint32_t);
+
+static uint64_t RefSyndrome(const uint32_t *Packet) // reference syndrome: one dense parity check row at a time
+{ uint64_t Syndrome=0;
+  for(int Row=0; Row<48; Row++)
+  { int Count=0;
+    for(int Idx=0; Idx<7; Idx++) Count+=Count1s(Packet[Idx]&LDPC_ParityCheck[Row][Idx]&(Idx<6?0xFFFFFFFF:0x0000FFFF));
+    if(Count&1) Syndrome|=(uint64_t)1<<Row; }
+  return Syndrome; }
+
+static int VerifyBatch(void)                       // batch syndromes must agree with the single-packet checks
+{ int Errors=0;
+  static uint64_t Syndrome32[Inputs], Syndrome64[Inputs];
+  int Fail32=LDPC_CheckBatch<uint32_t>(&Corrupt[0].Header, Inputs-5, Syndrome32, PacketStride); // odd count: last batch is partial
+  int Fail64=LDPC_CheckBatch<uint64_t>(&Corrupt[0].Header, Inputs-5, Syndrome64, PacketStride);
+  int Fail=0;
+  for(int Idx=0; Idx<Inputs-5; Idx++)
+  { uint64_t Ref=RefSyndrome(&Corrupt[Idx].Header);
+    if(Ref) Fail++;
+    if( (Syndrome32[Idx]!=Ref) || (Syndrome64[Idx]!=Ref) ) Errors++;
+    if( (Ref!=0) != (Corrupt[Idx].checkFEC()!=0) ) Errors++; }
+  if( (Fail32!=Fail) || (Fail64!=Fail) ) Errors++;
+  return Errors; }
+
+static bool SameCode(const uint32_t *Out, const uint32_t *Ref);
+
+static int VerifySyndrome(void)                    // syndrome table: every single and every double error, exhaustively
+{ int Errors=0, Doubles=0;
+  const uint32_t *Ref=&Packet[0].Header;
+  for(int Idx=0; Idx<Inputs; Idx++)
+  { uint64_t Ref=RefSyndrome(&Corrupt[Idx].Header);
+    if(LDPC_Syndrome(&Corrupt[Idx].Header)!=Ref) Errors++;
+    if(LDPC_SparseSyndrome(&Corrupt[Idx].Header)!=Ref) Errors++; }
+  for(int Bit=0; Bit<208; Bit++)
+  { uint32_t Code[7]; memcpy(Code, Ref, sizeof(Code));
+    Code[Bit>>5]^=(uint32_t)1<<(Bit&31);
+    uint32_t One[7]; memcpy(One, Code, sizeof(One));
+    if( (LDPC_SyndromeCorrect(One, LDPC_Syndrome(One))!=1) || !SameCode(One, Ref) ) Errors++;
+    for(int Other=0; Other<Bit; Other++)
+    { uint32_t Two[7]; memcpy(Two, Code, sizeof(Two));
+      Two[Other>>5]^=(uint32_t)1<<(Other&31);
+      int8_t Fixed=LDPC_SyndromeCorrect(Two, LDPC_Syndrome(Two));
+      if(Fixed==2) { Doubles++; if(!SameCode(Two, Ref)) Errors++; }
+      else if(Fixed!=-1) Errors++; }
+  }
+  if(Doubles!=LDPC_SyndromeDoubles) Errors++;
+  return Errors; }
+
+template <class LaneDecoder>                       // SIMD decoder: the soft bits of every lane after every iteration equal the scalar ones
+ static int VerifyLanes(const int8_t *const *Soft)
+{ static LaneDecoder Lanes; static LDPC_Decoder Decoder[32]; int Errors=0;
+  Lanes.Input(Soft, Lanes.Lanes);
+  for(int Lane=0; Lane<Lanes.Lanes; Lane++) memcpy(Decoder[Lane].InpBit, Soft[Lane], 208);
+  for(int Iter=0; Iter<32; Iter++)                 // a codeword which passed all checks is not changed by further iterations
+  { uint32_t Mask=Lanes.ProcessChecks();
+    for(int Lane=0; Lane<Lanes.Lanes; Lane++)
+    { if( (Decoder[Lane].ProcessChecks()!=0) != ((Mask>>Lane)&1) ) Errors++;
+      int8_t Out[208]; Lanes.getSoft(Out, Lane);
+      if(memcmp(Out, Decoder[Lane].InpBit, 208)) Errors++; }
+    if(Mask==0) break; }
+  return Errors; }
+
+template <class LaneDecoder>
+ static int VerifyLanes(HostRandom &Rnd)           // hard (clean) inputs from the packets with a few errors, then random soft inputs
+{ static int8_t Soft[32][208]; const int8_t *Ptr[32]; int Errors=0;
+  for(int Lane=0; Lane<32; Lane++) Ptr[Lane]=Soft[Lane];
+  for(int Base=0; Base<Inputs; Base+=32)
+  { for(int Lane=0; Lane<32; Lane++)
+    { const uint32_t *Code=&Corrupt[Base+Lane].Header;
+      for(int Bit=0; Bit<208; Bit++) Soft[Lane][Bit] = (Code[Bit>>5]>>(Bit&31))&1 ? +32:-32; }
+    Errors+=VerifyLanes<LaneDecoder>(Ptr); }
+  for(int Lane=0; Lane<32; Lane++)                 // extreme values, including -128
+    for(int Bit=0; Bit<208; Bit++) Soft[Lane][Bit] = Rnd.Next();
+  Errors+=VerifyLanes<LaneDecoder>(Ptr);
+  return Errors; }
+
+static int VerifySIMD(void)                        // every instruction set this CPU has against the scalar decoder
+{ int Errors=0; HostRandom Rnd(1);
+#ifdef __SSE2__
+  Errors+=VerifyLanes<LDPC_SSE2::LDPC_LaneDecoder>(Rnd);
+#endif
+#ifdef LDPC_SIMD_AVX2
+  if(LDPC_SIMD_Supported(LDPC_ISA_AVX2)) Errors+=VerifyLanes<LDPC_AVX2::LDPC_LaneDecoder>(Rnd);
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+  Errors+=VerifyLanes<LDPC_NEON::LDPC_LaneDecoder>(Rnd);
+#endif
+  static OGN_Packet Ref[Inputs], Batch[Inputs]; static uint64_t Syndrome[Inputs];
+  memcpy(Ref, Corrupt, sizeof(Ref));
+  LDPC_CheckBatch<uint64_t>(&Ref[0].Header, Inputs, Syndrome, PacketStride);
+  LDPC_Decoder Decoder;
+  int Corrected=LDPC_DecodeBatch(&Ref[0].Header, Inputs, Syndrome, Decoder, 32, PacketStride);
+  for(int ISA=LDPC_ISA_SSE2; ISA<=LDPC_ISA_NEON; ISA++)
+  { if(!LDPC_SIMD_Supported((LDPC_SIMD_ISA)ISA)) continue;
+    memcpy(Batch, Corrupt, sizeof(Batch));
+    if(LDPC_DecodeBatchSIMD(&Batch[0].Header, Inputs, Syndrome, 32, PacketStride, (LDPC_SIMD_ISA)ISA)!=Corrected) Errors++;
+    if(memcmp(Batch, Ref, sizeof(Batch))) Errors++; }
+  return Errors; }
+
+// reference: Manchester emulation of the Spirit1 firmware as it was, nibble by nibble (tables copied from spirit1.c)
+
+static const uint8_t RefManchEnc[16] =
+{ 0xAA, 0xA9, 0xA6, 0xA5, 0x9A, 0x99, 0x96, 0x95, 0x6A, 0x69, 0x66, 0x65, 0x5A, 0x59, 0x56, 0x55 } ;
+
+static const uint8_t RefManchDec[256] =        // lower nibble: data bits, upper nibble: violations
+{
+  0xF0, 0xE1, 0xE0, 0xF1, 0xD2, 0xC3, 0xC2, 0xD3, 0xD0, 0xC1, 0xC0, 0xD1, 0xF2, 0xE3, 0xE2, 0xF3,
+  0xB4, 0xA5, 0xA4, 0xB5, 0x96, 0x87, 0x86, 0x97, 0x94, 0x85, 0x84, 0x95, 0xB6, 0xA7, 0xA6, 0xB7,
+  0xB0, 0xA1, 0xA0, 0xB1, 0x92, 0x83, 0x82, 0x93, 0x90, 0x81, 0x80, 0x91, 0xB2, 0xA3, 0xA2, 0xB3,
+  0xF4, 0xE5, 0xE4, 0xF5, 0xD6, 0xC7, 0xC6, 0xD7, 0xD4, 0xC5, 0xC4, 0xD5, 0xF6, 0xE7, 0xE6, 0xF7,
+  0x78, 0x69, 0x68, 0x79, 0x5A, 0x4B, 0x4A, 0x5B, 0x58, 0x49, 0x48, 0x59, 0x7A, 0x6B, 0x6A, 0x7B,
+  0x3C, 0x2D, 0x2C, 0x3D, 0x1E, 0x0F, 0x0E, 0x1F, 0x1C, 0x0D, 0x0C, 0x1D, 0x3E, 0x2F, 0x2E, 0x3F,
+  0x38, 0x29, 0x28, 0x39, 0x1A, 0x0B, 0x0A, 0x1B, 0x18, 0x09, 0x08, 0x19, 0x3A, 0x2B, 0x2A, 0x3B,
+  0x7C, 0x6D, 0x6C, 0x7D, 0x5E, 0x4F, 0x4E, 0x5F, 0x5C, 0x4D, 0x4C, 0x5D, 0x7E, 0x6F, 0x6E, 0x7F,
+  0x70, 0x61, 0x60, 0x71, 0x52, 0x43, 0x42, 0x53, 0x50, 0x41, 0x40, 0x51, 0x72, 0x63, 0x62, 0x73,
+  0x34, 0x25, 0x24, 0x35, 0x16, 0x07, 0x06, 0x17, 0x14, 0x05, 0x04, 0x15, 0x36, 0x27, 0x26, 0x37,
+  0x30, 0x21, 0x20, 0x31, 0x12, 0x03, 0x02, 0x13, 0x10, 0x01, 0x00, 0x11, 0x32, 0x23, 0x22, 0x33,
+  0x74, 0x65, 0x64, 0x75, 0x56, 0x47, 0x46, 0x57, 0x54, 0x45, 0x44, 0x55, 0x76, 0x67, 0x66, 0x77,
+  0xF8, 0xE9, 0xE8, 0xF9, 0xDA, 0xCB, 0xCA, 0xDB, 0xD8, 0xC9, 0xC8, 0xD9, 0xFA, 0xEB, 0xEA, 0xFB,
+  0xBC, 0xAD, 0xAC, 0xBD, 0x9E, 0x8F, 0x8E, 0x9F, 0x9C, 0x8D, 0x8C, 0x9D, 0xBE, 0xAF, 0xAE, 0xBF,
+  0xB8, 0xA9, 0xA8, 0xB9, 0x9A, 0x8B, 0x8A, 0x9B, 0x98, 0x89, 0x88, 0x99, 0xBA, 0xAB, 0xAA, 0xBB,
+  0xFC, 0xED, 0xEC, 0xFD, 0xDE, 0xCF, 0xCE, 0xDF, 0xDC, 0xCD, 0xCC, 0xDD, 0xFE, 0xEF, 0xEE, 0xFF
+} ;
+
+static int RefManchEncode(uint8_t *Fifo, const uint8_t *Data, int Bytes) // as SpiritCopyPacket_OGN()
+{ int Out=0; uint8_t Buff=0x06, Byte;
+  Byte=RefManchEnc[0x5]; Buff=(Buff<<4)|(Byte>>4); Fifo[Out++]=Buff; Buff=Byte&0x0F;
+  Byte=RefManchEnc[0x6]; Buff=(Buff<<4)|(Byte>>4); Fifo[Out++]=Buff; Buff=Byte&0x0F;
+  Byte=RefManchEnc[0xC]; Buff=(Buff<<4)|(Byte>>4); Fifo[Out++]=Buff; Buff=Byte&0x0F;
+  for(int Idx=0; Idx<Bytes; Idx++)
+  { Byte=RefManchEnc[Data[Idx]>>4];   Buff=(Buff<<4)|(Byte>>4); Fifo[Out++]=Buff; Buff=Byte&0x0F;
+    Byte=RefManchEnc[Data[Idx]&0x0F]; Buff=(Buff<<4)|(Byte>>4); Fifo[Out++]=Buff; Buff=Byte&0x0F; }
+  Fifo[Out++]=(Buff<<4)|0x0A;
+  return Out; }
+
+static void RefManchDecode(uint8_t *Data, uint8_t *Err, const uint8_t *Fifo, int Bytes) // as SpiritReceivePacket_OGN()
+{ int In=0; uint8_t Nibble=0, Viol=0;
+  for(int Idx=0; Idx<4; Idx++) { Nibble=RefManchDec[Fifo[In++]]; Viol=Nibble>>4; Nibble&=0x0F; }
+  for(int Idx=0; Idx<Bytes; Idx++)
+  { uint8_t DataByte=Nibble, ErrByte=Viol;
+    Nibble=RefManchDec[Fifo[In++]]; Viol=Nibble>>4; Nibble&=0x0F;
+    DataByte=(DataByte<<4)|Nibble;     ErrByte=(ErrByte<<4)|Viol;
+    Nibble=RefManchDec[Fifo[In++]]; Viol=Nibble>>4; Nibble&=0x0F;
+    DataByte=(DataByte<<2)|(Nibble>>2); ErrByte=(ErrByte<<2)|(Viol>>2);
+    Data[Idx]=DataByte; Err[Idx]=ErrByte; }
+}
+
+static const uint8_t ManchOfs  = 6;                // as SPIRIT1_PKT_OFS, SPIRIT1_SYNC_HEAD, SPIRIT1_PKT_TAIL
+static const uint16_t ManchHead = 0x256C;
+
+static int ManchEncode(uint8_t *Fifo, const uint8_t *Data, int Bytes) // as SpiritCopyPacket_OGN() now
+{ uint16_t Code=Manch_EncTable[ManchHead>>ManchOfs];
+  Fifo[0]=Code>>8; Fifo[1]=Code;
+  return Manch_Encode(Fifo+2, Data, Bytes, ManchOfs, (uint8_t)ManchHead, 0x00)-Fifo; }
+
+static int VerifyManch(HostRandom &Rnd)            // new Manchester codec against the old tables: every byte value and random FIFO contents
+{ int Errors=0;
+  for(int Byte=0; Byte<256; Byte++)
+  { if(Manch_EncTable[Byte] != ((RefManchEnc[Byte>>4]<<8) | RefManchEnc[Byte&0x0F])) Errors++;
+    uint8_t Bits=0, Viol=0;                        // every chip byte: 01 => 1, 10 => 0, 00 => 0 + violation, 11 => 1 + violation
+    for(int Pair=6; Pair>=0; Pair-=2)
+    { uint8_t Chips=(Byte>>Pair)&3; Bits=(Bits<<1)|(Chips&1); Viol=(Viol<<1)|(Chips==0 || Chips==3); }
+    if(Manch_DecTable[Byte]!=((Viol<<4)|Bits) || Manch_DecTable[Byte]!=RefManchDec[Byte]) Errors++; }
+  for(int Idx=0; Idx<Inputs; Idx++)
+  { uint8_t Data[26], Fifo[64], RefFifo[64];
+    Corrupt[Idx].sendBytes(Data);
+    int Len=ManchEncode(Fifo, Data, 26);
+    if(Len!=RefManchEncode(RefFifo, Data, 26) || Len!=56 || memcmp(Fifo, RefFifo, Len)) Errors++;
+    uint8_t Out[26], Err[26], RefOut[26], RefErr[26];
+    for(int Chip=0; Chip<56; Chip++) { if(Rnd.Range(0, 3)==0) RefFifo[Chip]^=Rnd.Next(); } // chip errors
+    Manch_Decode(Out, Err, RefFifo+2, 26, ManchOfs); RefManchDecode(RefOut, RefErr, RefFifo, 26);
+    if(memcmp(Out, RefOut, 26) || memcmp(Err, RefErr, 26)) Errors++;
+    for(int Ofs=0; Ofs<8; Ofs++)                   // any offset: encode then decode gives the data back
+    { uint8_t Head=Rnd.Next(), Tail=Rnd.Next();
+      Len=Manch_Encode(Fifo, Data, 26, Ofs, Head, Tail)-Fifo;
+      if(Len!=2*Manch_AirBytes(26, Ofs)) Errors++;
+      Manch_Decode(Out, Err, Fifo, 26, Ofs);
+      if(memcmp(Out, Data, 26) || Manch_CountErr(Err, 26)) Errors++;
+      Manch_Decode(Out, Err, Fifo, 1, 0);           // the head bits come first
+      if( Ofs && (Out[0]>>(8-Ofs)) != (Head&((1<<Ofs)-1)) ) Errors++; }
+  }
+  return Errors; }
+
+// reference: the field codecs of OGN_Packet as they were, compare chains (copied from ogn.h)
+
+class RefFields
+{ public:
+   uint32_t Position[4];
+
+   void EncodeAltitude(int32_t Altitude)        // encode altitude in meters
+   {      if(Altitude<0)      Altitude=0;
+     else if(Altitude<0x1000) { }
+     else if(Altitude<0x3000) Altitude = 0x1000 | ((Altitude-0x1000)>>1);
+     else if(Altitude<0x7000) Altitude = 0x2000 | ((Altitude-0x3000)>>2);
+     else if(Altitude<0xF000) Altitude = 0x3000 | ((Altitude-0x7000)>>3);
+     else                     Altitude = 0x3FFF;
+     Position[2] = (Position[2]&0xFFFFC000) | (Altitude&0x3FFF); }
+
+   int32_t DecodeAltitude(void) const            // return Altitude in meters
+   { int32_t Altitude =  Position[2]     &0x0FFF;
+     int32_t Range    = (Position[2]>>12)&0x0003;
+     if(Range==0) return         Altitude;       // 0000..0FFF
+     if(Range==1) return 0x1001+(Altitude<<1);   // 1000..2FFE
+     if(Range==2) return 0x3002+(Altitude<<2);   // 3000..6FFC
+                  return 0x7004+(Altitude<<3); } // 7000..EFF8 => max. altitude: 61432 meters
+
+   void EncodeDOP(uint8_t DOP)
+   {      if(DOP<0)    DOP=0;
+     else if(DOP<0x10) { }
+     else if(DOP<0x30) DOP = 0x10 | ((DOP-0x10)>>1);
+     else if(DOP<0x70) DOP = 0x20 | ((DOP-0x30)>>2);
+     else if(DOP<0xF0) DOP = 0x30 | ((DOP-0x70)>>3);
+     else              DOP = 0x3F;
+     Position[1] = (Position[1]&0xC0FFFFFF) | ((uint32_t)DOP<<24); }
+
+   uint8_t DecodeDOP(void) const
+   { uint8_t DOP   =  (Position[1]>>24)&0x0F;
+     int8_t Range =  (Position[1]>>28)&0x03;
+     if(Range==0) return       DOP;              // 00..0F
+     if(Range==1) return 0x11+(DOP<<1);          // 10..2E
+     if(Range==2) return 0x31+(DOP<<2);          // 30..6C
+                  return 0x74+(DOP<<4); }        // 70..E8 => max. DOP = 232*0.1=23.2
+
+   void EncodeSpeed(int16_t Speed)            // speed in 0.2 knots
+   {      if(Speed<0)     Speed=0;
+     else if(Speed<0x100) { }
+     else if(Speed<0x300) Speed = 0x100 | ((Speed-0x100)>>1);
+     else if(Speed<0x700) Speed = 0x200 | ((Speed-0x300)>>2);
+     else if(Speed<0xF00) Speed = 0x300 | ((Speed-0x700)>>3);
+     else                 Speed = 0x3FF;
+     Position[2] = (Position[2]&0xFF003FFF) | ((uint32_t)Speed<<14); }
+
+   int16_t DecodeSpeed(void) const           // return speed in 0.2 knots units (0.2 knots is about 0.1 m/s)
+   { int16_t Speed = (Position[2]>>14)&0x00FF;
+     int8_t  Range = (Position[2]>>22)&0x0003;
+     if(Range==0) return Speed;              // 000..0FF
+     if(Range==1) return 0x101+(Speed<<1);   // 100..2FE
+     if(Range==2) return 0x302+(Speed<<2);   // 300..6FC
+                  return 0x704+(Speed<<3); } // 700..EF8 => max. speed: 3832*0.2 = 766 knots
+
+   void EncodeTurnRate(int16_t Turn)
+   { int8_t Sign=0; if(Turn<0) { Turn=(-Turn); Sign=0x80; }
+          if(Turn<0x020) { }
+     else if(Turn<0x060) Turn = 0x020 | ((Turn-0x020)>>1);
+     else if(Turn<0x0E0) Turn = 0x040 | ((Turn-0x060)>>2);
+     else if(Turn<0x1E0) Turn = 0x060 | ((Turn-0x0E0)>>3);
+     else                Turn = 0x07F;
+     Turn |= Sign;
+     Position[2] = (Position[2]&0x00FFFFFF) | ((uint32_t)Turn<<24); }
+
+   int16_t DecodeTurnRate(void) const
+   { int8_t Sign =(Position[2]>>31)&0x01;
+     int8_t Range=(Position[2]>>29)&0x03;
+     int16_t Turn =(Position[2]>>24)&0x1F;
+          if(Range==0) { }                          // 000..01F
+     else if(Range==1) { Turn = 0x021+(Turn<<1); }  // 020..05E
+     else if(Range==2) { Turn = 0x062+(Turn<<2); }  // 060..0DC
+     else              { Turn = 0x0E4+(Turn<<3); }  // 0E0..1D8 => max. turn rate = +/- 472*0.1 = +/- 47.2 deg/s
+     return Sign ? -Turn:Turn; }
+
+   void EncodeClimbRate(int16_t Climb)
+   { int16_t Sign=0; if(Climb<0) { Climb=(-Climb); Sign=0x100; }
+          if(Climb<0x040) { }
+     else if(Climb<0x0C0) Climb = 0x040 | ((Climb-0x040)>>1);
+     else if(Climb<0x1C0) Climb = 0x080 | ((Climb-0x0C0)>>2);
+     else if(Climb<0x3C0) Climb = 0x0C0 | ((Climb-0x1C0)>>3);
+     else                 Climb = 0x0FF;
+     Climb |= Sign;
+     Position[3] = (Position[3]&0xFFF803FF) | ((int32_t)Climb<<10); }
+
+   int16_t DecodeClimbRate(void) const
+   { int32_t Sign =(Position[3]>>18)&0x01;
+     int32_t Range=(Position[3]>>16)&0x03;
+     int32_t Climb=(Position[3]>>10)&0x3F;
+          if(Range==0) { }                            // 000..03F
+     else if(Range==1) { Climb = 0x041+(Climb<<1); }  // 040..0BE
+     else if(Range==2) { Climb = 0x0C2+(Climb<<2); }  // 0C0..1BC
+     else              { Climb = 0x1C4+(Climb<<3); }  // 1C0..3B8 => max. climb rate = +/- 952*0.1 = +/- 95.2 m/s
+     return Sign ? -Climb:Climb; }
+
+   void EncodeTemperature(int16_t Temp)
+   { int8_t Sign=0; if(Temp<0) { Temp=(-Temp); Sign=0x80; }
+          if(Temp<0x020) { }
+     else if(Temp<0x060) Temp = 0x020 | ((Temp-0x020)>>1);
+     else if(Temp<0x0E0) Temp = 0x040 | ((Temp-0x060)>>2);
+     else if(Temp<0x1E0) Temp = 0x060 | ((Temp-0x0E0)>>3);
+     else                Temp = 0x07F;
+     Temp |= Sign;
+     Position[3] = (Position[3]&0x00FFFFFF) | ((int32_t)Temp<<24); }
+
+   int16_t DecodeTemperature(void) const
+   { int8_t Sign =(Position[3]>>31)&0x01;
+     int8_t Range=(Position[3]>>29)&0x03;
+     int16_t Temp =(Position[3]>>24)&0x1F;
+          if(Range==0) { }                          // 000..01F
+     else if(Range==1) { Temp = 0x021+(Temp<<1); }  // 020..05E
+     else if(Range==2) { Temp = 0x062+(Temp<<2); }  // 060..0DC
+     else              { Temp = 0x0E4+(Temp<<3); }  // 0E0..1D8 => max. temperature = +/- 472*0.5 = +/- 236 degC
+     return Sign ? -Temp:Temp; }
+
+} ;
+
+template <class Field>                             // decode(encode()) lands on the middle of the step: encoding it again gives the same code
+ static int VerifyFieldRoundTrip(int32_t Value)
+{ uint32_t Code=Field::Encode(Value);
+  if(Field::Encode(Field::Decode(Code))!=Code) return 1;
+  if(Code>=((uint32_t)1<<Field::Bits)) return 1;
+  return 0; }
+
+static int VerifyFields(HostRandom &Rnd)           // new field codecs against the old ones: every input value and every code
+{ int Errors=0, DOPFixed=0;
+  OGN_Packet New; RefFields Old;
+  for(int32_t Value=-32768; Value<=32767; Value++)
+  { for(int Idx=0; Idx<4; Idx++) Old.Position[Idx]=New.Position[Idx]=Rnd.Next();  // other fields must not change
+    if(Value>=0 && Value<256) { New.EncodeDOP(Value); Old.EncodeDOP(Value); }
+    New.EncodeSpeed(Value); Old.EncodeSpeed(Value);
+    if(Value!=-32768)                              // the old code did not take -32768: it wrote outside the field
+    { New.EncodeTurnRate(Value); Old.EncodeTurnRate(Value);
+      New.EncodeClimbRate(Value); Old.EncodeClimbRate(Value);
+      New.EncodeTemperature(Value); Old.EncodeTemperature(Value); }
+    if(memcmp(New.Position, Old.Position, sizeof(Old.Position))) Errors++;
+    Errors+=VerifyFieldRoundTrip<OGN_Packet::SpeedField>(Value)+VerifyFieldRoundTrip<OGN_Packet::TurnRateField>(Value)
+           +VerifyFieldRoundTrip<OGN_Packet::ClimbRateField>(Value)+VerifyFieldRoundTrip<OGN_Packet::TemperatureField>(Value); }
+  if(OGN_Packet::TurnRateField::Encode(-32768)!=OGN_Packet::TurnRateField::Encode(-32767)) Errors++; // now it saturates
+  if(OGN_Packet::ClimbRateField::Encode(-32768)!=OGN_Packet::ClimbRateField::Encode(-32767)) Errors++;
+  for(int32_t Value=-100000; Value<=(1<<20); Value++)
+  { New.Position[2]=Old.Position[2]=Rnd.Next();
+    New.EncodeAltitude(Value); Old.EncodeAltitude(Value);
+    if(New.Position[2]!=Old.Position[2]) Errors++;
+    Errors+=VerifyFieldRoundTrip<OGN_Packet::AltitudeField>(Value); }
+  for(uint32_t Code=0; Code<(1<<14); Code++)       // every code of every field
+  { for(int Idx=0; Idx<4; Idx++) Old.Position[Idx]=New.Position[Idx]=(Code<<24)|(Code<<14)|(Code<<10)|Code;
+    if(New.DecodeAltitude()!=Old.DecodeAltitude()) Errors++;
+    if(Code>=(1<<10)) continue;
+    if(New.DecodeSpeed()!=Old.DecodeSpeed()) Errors++;
+    if(New.DecodeClimbRate()!=Old.DecodeClimbRate()) Errors++;
+    if(Code>=(1<<8)) continue;
+    if(New.DecodeTurnRate()!=Old.DecodeTurnRate()) Errors++;
+    if(New.DecodeTemperature()!=Old.DecodeTemperature()) Errors++;
+    if(Code>=(1<<6)) continue;
+    if(New.DecodeDOP()!=Old.DecodeDOP())           // the old DOP decode was off in the two upper ranges
+    { if(Code<0x20) Errors++; else DOPFixed++; }
+  }
+  if(DOPFixed!=31) Errors++;                       // 0x31 instead of 0x32 in range 2, <<4 instead of <<3 in range 3 (except mantissa 0)
+  return Errors; }
+
+static int VerifySoA(HostRandom &Rnd)              // batch decode into arrays against the per-field accessors, also for random headers
+{ int Errors=0;
+  static OGN_Packet Rx[Inputs]; std::vector<uint8_t> Buffer(OgnDecodedSoA::Size(Inputs)); OgnDecodedSoA SoA; SoA.Assign(Buffer.data(), Inputs);
+  size_t Plain=0;
+  for(int Idx=0; Idx<Inputs; Idx++)
+  { Rx[Idx]=Packet[Idx];
+    if(Idx&1) Rx[Idx].Header=Rnd.Next();          // all the header flags, encrypted packets included
+    if(!Rx[Idx].isEncrypted()) Plain++; }
+  if(OGN_DecodeBatch(Rx, Inputs, &SoA)!=Plain) Errors++;
+  for(int Idx=0; Idx<Inputs; Idx++)
+  { OGN_Packet Ref=Rx[Idx]; uint32_t Flags=SoA.Flags[Idx];
+    if(SoA.Address[Idx]!=Ref.getAddress()) Errors++;
+    if( ((Flags&OGN_SOA_EMERGENCY)!=0) != Ref.isEmergency() || ((Flags&OGN_SOA_ENCRYPTED)!=0) != Ref.isEncrypted()
+     || ((Flags&OGN_SOA_METEO)!=0) != Ref.isMeteo() || (Flags&OGN_SOA_RELAY)>>28 != Ref.getRelayCount()
+     || (Flags&OGN_SOA_ADDR_TYPE)>>24 != Ref.getAddrType() ) Errors++;
+    if(Ref.isEncrypted()) continue;
+    Ref.Dewhiten();
+    if( (Flags&OGN_SOA_ACFT_TYPE)>>20 != Ref.getAcftType() || ((Flags&OGN_SOA_PRIVATE)!=0) != Ref.isPrivate()
+     || ((Flags&OGN_SOA_BARO)!=0) != Ref.isBaro() || (Flags&OGN_SOA_FIX_MODE)>>17 != Ref.getFixMode()
+     || (Flags&OGN_SOA_FIX_QUAL)>>15 != Ref.getFixQuality() ) Errors++;
+    if( SoA.Latitude[Idx]!=Ref.DecodeLatitude() || SoA.Longitude[Idx]!=Ref.DecodeLongitude() || SoA.Altitude[Idx]!=Ref.DecodeAltitude()
+     || SoA.Speed[Idx]!=Ref.DecodeSpeed() || SoA.Heading[Idx]!=Ref.DecodeHeading() || SoA.ClimbRate[Idx]!=Ref.DecodeClimbRate()
+     || SoA.TurnRate[Idx]!=Ref.DecodeTurnRate() || SoA.Time[Idx]!=Ref.getTime() || SoA.DOP[Idx]!=Ref.DecodeDOP() ) Errors++; }
+  std::vector<uint8_t> TailBuffer(OgnDecodedSoA::Size(37)); OgnDecodedSoA Tail; Tail.Assign(TailBuffer.data(), 37);
+  OGN_DecodeBatch(Rx+100, 37, &Tail);             // a partial chunk at the end
+  for(int Idx=0; Idx<37; Idx++)
+    if(Tail.Latitude[Idx]!=SoA.Latitude[100+Idx] || Tail.Flags[Idx]!=SoA.Flags[100+Idx] || Tail.DOP[Idx]!=SoA.DOP[100+Idx]) Errors++;
+  for(int Idx=0; Idx<Inputs; Idx++)
+    if(memcmp(&Rx[Idx].Position, (Idx&1) ? Rx[Idx].Position:Packet[Idx].Position, sizeof(Rx[Idx].Position))) Errors++; // input not modified
+  return Errors; }
+
+static int VerifyTEA(HostRandom &Rnd)              // batch TEA (scalar and every instruction set) against the one-block functions
+{ int Errors=0;
+  for(int Test=0; Test<400; Test++)
+  { int Blocks=Rnd.Range(0, 40); uint16_t Stride=2+Rnd.Range(0, 5); int Loops=Rnd.Range(1, 8);
+    uint32_t Key[4]; for(int Idx=0; Idx<4; Idx++) Key[Idx]=Rnd.Next();
+    const uint32_t *UseKey = Test&1 ? Key:0;
+    std::vector<uint32_t> Plain(Blocks*Stride+2), Ref, Data;
+    for(size_t Idx=0; Idx<Plain.size(); Idx++) Plain[Idx]=Rnd.Next();
+    Ref=Plain;
+    for(int Block=0; Block<Blocks; Block++)
+    { uint32_t *Ptr=&Ref[Block*Stride];
+      if(UseKey) OGN_Packet::TEA_Encrypt(Ptr, Key, Loops); else OGN_Packet::TEA_Encrypt_Key0(Ptr, Loops); }
+    for(int ISA=LDPC_ISA_SCALAR; ISA<=LDPC_ISA_NEON; ISA++)
+    { if(!LDPC_SIMD_Supported((LDPC_SIMD_ISA)ISA)) continue;
+      Data=Plain; TEA_EncryptBatchSIMD(Data.data(), Blocks, UseKey, Loops, Stride, (LDPC_SIMD_ISA)ISA);
+      if(Data!=Ref) Errors++;
+      TEA_DecryptBatchSIMD(Data.data(), Blocks, UseKey, Loops, Stride, (LDPC_SIMD_ISA)ISA);
+      if(Data!=Plain) Errors++; }
+    Data=Plain; TEA_EncryptBatch(Data.data(), Blocks, UseKey, Loops, Stride);
+    if(Data!=Ref) Errors++; }
+  static OGN_Packet Work[Inputs];                  // whole packets: the other words must not change
+  for(int ISA=LDPC_ISA_SCALAR; ISA<=LDPC_ISA_NEON; ISA++)
+  { if(!LDPC_SIMD_Supported((LDPC_SIMD_ISA)ISA)) continue;
+    memcpy(Work, Packet, sizeof(Work)); OGN_DewhitenBatchSIMD(Work, Inputs-3, (LDPC_SIMD_ISA)ISA);
+    for(int Idx=0; Idx<Inputs; Idx++)
+    { OGN_Packet Ref=Packet[Idx]; if(Idx<Inputs-3) Ref.Dewhiten();
+      if(memcmp(&Ref, &Work[Idx], sizeof(Ref))) Errors++; }
+    OGN_WhitenBatchSIMD(Work, Inputs-3, (LDPC_SIMD_ISA)ISA);
+    if(memcmp(Work, Packet, sizeof(Work))) Errors++; }
+  memcpy(Work, Packet, sizeof(Work)); OGN_DewhitenBatch(Work, Inputs); OGN_WhitenBatch(Work, Inputs);
+  if(memcmp(Work, Packet, sizeof(Work))) Errors++;
+  return Errors; }
+
+static const OGN_KeyTrialRef KeyRef = { 48*600000, 17*600000, 3*600000, 25 }; // receiver for the key trial: every aircraft within 2 deg
+
+static void KeyTrialPackets(OGN_Packet *Out, int *Key, int Packets, const OGN_TEAKey *Keys, int NumKeys, HostRandom &Rnd)
+{ for(int Idx=0; Idx<Packets; Idx++)               // Key[]: index into Keys[], -1 for whitened packets
+  { OgnPosition P=Pos[Idx&(Inputs-1)];
+    P.Latitude =KeyRef.Latitude +Rnd.Range(-2*600000, 2*600000);
+    P.Longitude=KeyRef.Longitude+Rnd.Range(-2*600000, 2*600000);
+    P.Sec=KeyRef.Time+Rnd.Range(-1, 0); P.FracSec=Rnd.Range(0, 9)*10;
+    Key[Idx]=Rnd.Range(-1, NumKeys-1);
+    Host_PreparePacket(Out[Idx], P, 0x07000000+Idx, Key[Idx]<0 ? 0:Keys+Key[Idx]); }
+}
+
+static int VerifyEncrypt(HostRandom &Rnd)          // keyed position encryption and the key trial
+{ int Errors=0;
+  OGN_TEAKey Keys[20];
+  for(int Key=0; Key<20; Key++)
+  { uint32_t Raw[4]; for(int Idx=0; Idx<4; Idx++) Raw[Idx]=Rnd.Next();
+    Keys[Key].Set(Raw); }
+  for(int Test=0; Test<1000; Test++)               // OGN_TEAKey against the one-block TEA
+  { const OGN_TEAKey &Key=Keys[Test%20];
+    uint32_t Data[2] = { Rnd.Next(), Rnd.Next() }, Ref[2] = { Data[0], Data[1] };
+    Key.Encrypt(Data); OGN_Packet::TEA_Encrypt(Ref, Key.Key, OGN_TEAKey::Loops);
+    if(Data[0]!=Ref[0] || Data[1]!=Ref[1]) Errors++;
+    Key.Decrypt(Data); OGN_Packet::TEA_Decrypt(Ref, Key.Key, OGN_TEAKey::Loops);
+    if(Data[0]!=Ref[0] || Data[1]!=Ref[1]) Errors++; }
+  for(int Idx=0; Idx<Inputs; Idx++)                // encrypted packet: flag set, same position once decrypted
+  { OGN_Packet Plain, Encr;
+    Host_PreparePacket(Plain, Pos[Idx], 0x07000000+Idx); Host_PreparePacket(Encr, Pos[Idx], 0x07000000+Idx, Keys+(Idx%20));
+    if(Plain.isEncrypted() || !Encr.isEncrypted() || Encr.checkFEC()) Errors++;
+    Plain.Dewhiten(); Encr.Decrypt(Keys[Idx%20]);
+    if(memcmp(Plain.Position, Encr.Position, sizeof(Plain.Position))) Errors++; }
+  static OGN_Packet Rx[Inputs], Sent[Inputs]; int Key[Inputs]; int16_t KeyIdx[Inputs];
+  KeyTrialPackets(Sent, Key, Inputs, Keys, 20, Rnd);
+  for(int ISA=LDPC_ISA_SCALAR; ISA<=LDPC_ISA_NEON; ISA++)
+  { if(!LDPC_SIMD_Supported((LDPC_SIMD_ISA)ISA)) continue;
+    memcpy(Rx, Sent, sizeof(Rx)); for(int Idx=0; Idx<Inputs; Idx++) KeyIdx[Idx]=-1;
+    int Known=0;
+    for(int Idx=0; Idx<Inputs; Idx++) if(Key[Idx]>=0 && Key[Idx]<16) Known++;
+    if(OGN_TryKeys(Rx, Inputs, Keys, 16, KeyRef, KeyIdx, (LDPC_SIMD_ISA)ISA)!=Known) Errors++; // keys 16..19 are not known
+    for(int Idx=0; Idx<Inputs; Idx++)
+    { int Expect = Key[Idx]<16 ? Key[Idx]:-1;
+      if(KeyIdx[Idx]!=Expect) Errors++;
+      if(Expect<0) { if(memcmp(&Rx[Idx], &Sent[Idx], sizeof(Rx[Idx]))) Errors++; continue; }
+      OGN_Packet Ref=Sent[Idx]; Ref.Decrypt(Keys[Expect]); Ref.Whiten(); Ref.clrEncrypted();
+      if(memcmp(Ref.Position, Rx[Idx].Position, sizeof(Ref.Position)) || Rx[Idx].Header!=Ref.Header) Errors++; }
+  }
+  return Errors; }
+
+static int VerifyPredict(HostRandom &Rnd)          // integer extrapolation against the same model in floating point
+{ int Errors=0;
+  for(int32_t Angle=-3600; Angle<=7200; Angle++)
+  { if(fabs(OGN_Icos(Angle)-16384*cos(Angle*M_PI/1800))>2.5) Errors++;
+    if(fabs(OGN_Isin(Angle)-16384*sin(Angle*M_PI/1800))>2.5) Errors++; }
+  for(int Idx=0; Idx<Inputs; Idx++)
+  { OgnPosition P=Pos[Idx];
+    OGN_Packet Ref, Pkt; Ref.Header=Pkt.Header=0;
+    P.Encode(Ref); P.Encode(Pkt); P.EncodePredicted(Pkt, 0);      // zero delay: same packet as Encode()
+    if(memcmp(Ref.Position, Pkt.Position, sizeof(Ref.Position))) Errors++;
+    int32_t Delta=Rnd.Range(0, 2500), Lat, Lon, Alt;
+    P.Predict(Lat, Lon, Alt, Delta);
+    double Track=(P.Heading+0.5*P.TurnRate*Delta/1000)*M_PI/1800;
+    double Dist=P.Speed*(double)Delta/3600;                       // [0.0001/60 deg]
+    double CosLat=cos(P.Latitude*M_PI/(180*600000)); if(CosLat<1.0/64) CosLat=1.0/64;
+    double RefLat=P.Latitude+Dist*cos(Track), RefLon=P.Longitude+Dist*sin(Track)/CosLat;
+    double TanLat=sqrt(1-CosLat*CosLat)/CosLat;                   // heading and latitude are taken to 0.1 deg: up to 0.9e-3 of the distance
+    if(fabs(Lat-RefLat)>1+Dist*1e-3) Errors++;
+    if(fabs(Lon-RefLon)>(2+Dist*1e-3*(1+TanLat))/CosLat) Errors++;
+    if(fabs(Alt-(P.Altitude+P.ClimbRate*Delta/1000.0))>0.5) Errors++; }
+  return Errors; }
+
+static int VerifyFit(HostRandom &Rnd)              // sliding least squares against a direct fit, the position history against its contents
+{ int Errors=0;
+  OGN_LinFit<1> Fit; Fit.Clear();
+  int32_t Time[64], Value[64]; int First=0, Last=0; int32_t Now=Rnd.Range(0, 86400000);
+  for(int Step=0; Step<20000; Step++)
+  { if(Last-First<16 && (Last-First<2 || Rnd.Range(0, 2)))     // add a sample or drop the oldest one
+    { Now+=Rnd.Range(1, 1000); Time[Last&63]=Now; Value[Last&63]=Rnd.Range(-1000000, 1000000); Fit.Add(Time[Last&63], Value+(Last&63)); Last++; }
+    else
+    { Fit.Remove(Time[First&63], Value+(First&63)); First++;
+      Fit.Rebase(Time[First&63], Value+(First&63)); }
+    int N=Last-First; double St=0, Stt=0, Sy=0, Sty=0;
+    for(int Idx=First; Idx<Last; Idx++)
+    { double T=Time[Idx&63]-Time[First&63], Y=Value[Idx&63]; St+=T; Stt+=T*T; Sy+=Y; Sty+=T*Y; }
+    double Slope = N>=2 ? (N*Sty-St*Sy)/(N*Stt-St*St)*1000:0;
+    if(Fit.Count!=N || fabs(Fit.Slope(0, 1000)-Slope)>0.5+1e-9*fabs(Slope)) Errors++; }
+  static OgnPosHistory<8> Hist(2000);                // straight line: exact slopes, every fix found by its time
+  OgnPosition P; Host_RandomPosition(P, Rnd); P.Heading=3500;
+  Hist.Head()=P;
+  for(int Fix=0; Fix<100; Fix++)                     // 5 Hz over midnight, heading over north
+  { OgnPosition &H=Hist.Head();
+    H.Altitude=P.Altitude+Fix*3; H.Heading=(P.Heading+Fix*40)%3600; H.Latitude=P.Latitude; H.Longitude=P.Longitude;
+    int32_t Ms=(86400000-10000+Fix*200)%86400000;   // from 23:59:50
+    H.Hour=Ms/3600000; H.Min=(Ms/60000)%60; H.Sec=(Ms/1000)%60; H.FracSec=(Ms%1000)/10;
+    int32_t Delta=Hist.Commit();
+    if(Fix>0 && Delta!=200) Errors++;
+    if(Fix>=5 && (Hist.Last().ClimbRate!=15 || Hist.Last().TurnRate!=200)) Errors++; // 0.3 m and 4 deg per 0.2 s
+    if(Fix<5 && (Hist.Last().ClimbRate!=0 || Hist.Last().TurnRate!=0)) Errors++;     // less than half the window: no rates yet
+    for(uint8_t Back=0; Back<Hist.Count; Back++)
+    { if(Hist.Find(Hist.getTime(Back))!=&Hist.Last(Back)) Errors++;
+      if(Hist.Find(Hist.getTime(Back)+199)!=&Hist.Last(Back)) Errors++; }
+    if(Hist.Count && Hist.Find(Hist.getTime(Hist.Count-1)-1)!=0) Errors++; }
+  OgnPosition &H=Hist.Head(); H.Sec=0; H.FracSec=0;  // GPS restart: time back to 00:00:00, the history starts again
+  if(Hist.Commit()!=-1 || Hist.Count!=1 || Hist.Find(Hist.getTime())!=&Hist.Last()) Errors++;
+  return Errors; }
+
+static int VerifyClock(HostRandom &Rnd)            // PPS discipline: drifting timer with a wrap, jitter, missed and false edges, a long outage
+{ int Errors=0;
+  clock_ref_t Ref; memset(&Ref, 0, sizeof(Ref));
+  clock_ofs_t Ofs; memset(&Ofs, 0, sizeof(Ofs));
+  clock_stats_t Stats; memset(&Stats, 0, sizeof(Stats));
+  const double   Rate=1e6*(1+37.3e-6);               // timer counts per true second: 37.3 ppm fast
+  const uint32_t Start=0xFFFFFFFFu-3000000;          // the timer wraps in the fourth second
+  const uint32_t Unix0=1700000000;
+  auto Count = [&](double Time) { return (uint32_t)(Start+(uint64_t)llround(Time*Rate)); };
+  int Missed=0, Glitches=0, Steps=0, Settled=0;
+  for(int Edge=0; Edge<700; Edge++)
+  { double Time = Edge<400 ? Edge : Edge+2000;       // 2000 s without PPS: longer than CLOCK_HOLDOVER_S
+    if(Edge%131==70)                                 // a false edge: off the seconds grid
+    { if(clock_pps_update(&Ref, Count(Time-0.7), (uint32_t)((Time-0.7)*1000), &Stats)!=0) Errors++;
+      Glitches++; }
+    if(Edge%97==50) { Missed++; continue; }          // a missing edge: bridged by the next one
+    int8_t Ret=clock_pps_update(&Ref, Count(Time)+Rnd.Range(-1, 1), (uint32_t)(Time*1000)+Rnd.Range(0, 1), &Stats);
+    if(Ret!=(Edge==0 || Edge==400 ? -1:1)) Errors++;
+    if(Ret<0) { Settled=Edge+20; clock_utc_t UTC; if(clock_to_utc(&Ref, &Ofs, Count(Time), &UTC)) Errors++; } // no UTC until a fix
+    struct { double Fix, First, Done; } Arrive[4] =  // fix epoch, its first and last sentence: 1 Hz, 10 Hz, a fix of the previous
+    { { 0, 0.1, 0.3 }, { 0.9, 0.92, 0.95 }, { -0.8, 0.05, 0.1 }, // second all after this edge, and one completed after this
+      { -0.9, -0.75, 0.15 } };                       // edge (9600 bps, a slow task): the timer then is a second off, its first sentence not
+    for(int Idx=0; Idx<4; Idx++)
+    { double Fix=Time+Arrive[Idx].Fix;
+      uint32_t Sec=(uint32_t)floor(Fix); uint16_t Ms=(uint16_t)llround((Fix-Sec)*1000);
+      uint32_t Base=clock_base(&Ref, Unix0+Sec, Ms, clock_since_us(&Ref, Count(Time+Arrive[Idx].First)));
+      if(!Ofs.valid || Ofs.epoch!=Ref.epoch) { Ofs.base=Base; Ofs.epoch=Ref.epoch; Ofs.valid=1; }
+      else if(Base!=Ofs.base) Steps++;
+      if(Base!=Unix0+(uint32_t)llround(Time)-Ref.seq) Errors++; // seq counts from the first edge of the epoch, at whole seconds
+      uint32_t Late=clock_base(&Ref, Unix0+Sec, Ms, clock_since_us(&Ref, Count(Time+Arrive[Idx].Done)));
+      if(Arrive[Idx].First<0 && Late==Base) Errors++; } // the timer at completion would have stepped the UTC
+    if(Edge<Settled) continue;
+    for(int Idx=0; Idx<8; Idx++)                     // timestamps around the edge, also before it
+    { double Stamp=Time+Rnd.Range(-500000, 1500000)*1e-6;
+      clock_utc_t UTC;
+      if(!clock_to_utc(&Ref, &Ofs, Count(Stamp), &UTC) || UTC.usec>=1000000) { Errors++; continue; }
+      double Err=((double)UTC.sec-Unix0)*1e6+UTC.usec-Stamp*1e6;
+      if(fabs(Err)>3) Errors++; }
+  }
+  if(Steps || Stats.restarts!=1 || Stats.rejected!=(uint32_t)Glitches || Stats.missed!=(uint32_t)Missed) Errors++;
+  return Errors; }
+
+static int VerifyPLL(HostRandom &Rnd, double Ppm)  // HPT table cycle against the PPS: tick by tick for an hour, 10 minutes of it without PPS
+{ int Errors=0;
+  hpt_pll_t Pll; memset(&Pll, 0, sizeof(Pll));
+  hpt_pll_stats_t Stats; memset(&Stats, 0, sizeof(Stats));
+  const double   Rate=1e6*(1+Ppm*1e-6);              // timer counts per true second, the tick is 1000 counts
+  const double   Phase0=0.3712;                      // [s] where the first tick falls: far from the PPS
+  auto Count = [&](double Time) { return (uint32_t)(0xFFF00000u+(uint64_t)llround(Time*Rate)); };
+  auto TickTime = [&](uint32_t Tick) { return Phase0+Tick*1000.0/Rate; };
+  const uint32_t Table[2] = { 925, 1000 };           // the last event before HPT_RESTART, the HPT_RESTART
+  uint32_t Expiry=Table[0], Event=0, CycleCnt=Count(Phase0), CycleLen=1000*HPT_PLL_TICK_CNT;
+  uint32_t PpsSeq=0, PllSeq=0, Resyncs=0, PllResyncs=0; int32_t PpsErr=0; bool Synced=0;
+  double NextPPS=1, MaxErr=0, MaxHold=0;
+  const uint32_t Ticks=(uint32_t)(3600*Rate/1000);
+  for(uint32_t Tick=1; Tick<Ticks; Tick++)
+  { double Time=TickTime(Tick);
+    if(NextPPS<=Time)                                // the PPS interrupt, between the previous tick and this one
+    { bool Lost = NextPPS>=1200 && NextPPS<1800;
+      if(!Lost)
+      { uint32_t Now=Count(NextPPS)+Rnd.Range(-1, 1)+Rnd.Range(0, 5);
+        int32_t Err=hpt_pll_phase(Now-CycleCnt, CycleLen);
+        if(!Synced || Err>HPT_PLL_RESYNC_US || Err<-HPT_PLL_RESYNC_US)
+        { Expiry=Tick-1+Table[0]; Event=0; CycleCnt=Now; Err=0; Synced=1; Resyncs++; }
+        PpsErr=Err; PpsSeq++; }
+      NextPPS+=1; }
+    if(Tick!=Expiry) continue;
+    if(Event==1)                                     // HPT_RESTART: the cycle starts with this tick
+    { CycleCnt=Count(Time)+Rnd.Range(0, 30);         // stamped by the timer task a little later
+      Expiry=Tick+Table[0]; Event=0;
+      if(Synced && Time>20)
+      { double Err=fabs(Time-floor(Time+0.5))*1e3;   // [ms] the cycle start against the GPS second
+        if(Time>=1200 && Time<1800+20) { if(Err>MaxHold) MaxHold=Err; }
+        else if(Err>MaxErr) MaxErr=Err; }
+      continue; }
+    if(Resyncs!=PllResyncs) { PllResyncs=Resyncs; Pll.acc=0; Pll.good=0; }
+    int32_t Drift = Time>10 ? (int32_t)((uint32_t)llround(Rate*256)-CLOCK_TIMER_HZ*256)/256 : 0; // the rate is measured after a few edges
+    int16_t Trim=hpt_pll_cycle(&Pll, PpsSeq!=PllSeq, PpsErr, Drift, &Stats); PllSeq=PpsSeq;
+    CycleLen=(Table[1]+Trim)*HPT_PLL_TICK_CNT;
+    Expiry=Tick+Table[1]-Table[0]+Trim; Event=1;
+    bool Hold = Time>=1200+HPT_PLL_LOST+1 && Time<1800;
+    bool Change = (Time>=1200 && Time<1200+HPT_PLL_LOST+1) || (Time>=1800 && Time<1800+HPT_PLL_LOCK_COUNT+1);
+    if(Time>20 && !Change && Pll.state!=(Hold ? HPT_PLL_HOLDOVER:HPT_PLL_LOCKED)) Errors++; }
+  if(MaxErr>1.2 || MaxHold>3 || Resyncs!=1 || Stats.locks!=2) Errors++;
+  printf("verify: HPT at %+.1f ppm: cycle start within %.2f ms of PPS, %.2f ms in holdover, free running would drift %.0f ms\n",
+         Ppm, MaxErr, MaxHold, fabs(Ppm)*3.6);
+  return Errors; }
+
+static int VerifyGrid(HostRandom &Rnd)             // hardware timer HPT: the PPS edges and the table times in timer counts, over the wrap
+{ int Errors=0;
+  for(int Test=0; Test<100000; Test++)
+  { clock_ref_t Ref; memset(&Ref, 0, sizeof(Ref));
+    Ref.cnt=Rnd.Range(0, 0x7FFFFFFF)*2+Rnd.Range(0, 1); Ref.period=CLOCK_TIMER_HZ*256+Rnd.Range(-25600, 25600); // within 100 ppm
+    int32_t Sec=Rnd.Range(-CLOCK_HOLDOVER_S, CLOCK_HOLDOVER_S);
+    uint32_t Edge=Ref.cnt+(uint32_t)llround(Sec*(Ref.period/256.0));
+    uint32_t Cnt=Edge+Rnd.Range(-490000, 490000);
+    if(hpt_pps_grid(&Ref, Cnt)!=Edge) Errors++;
+    uint32_t Ms=Rnd.Range(0, 2000);
+    if(hpt_ms_to_cnt(Ms, Ref.period)!=(uint32_t)llround(Ms*(Ref.period/256000.0))) Errors++; }
+  clock_ref_t Ref; memset(&Ref, 0, sizeof(Ref));     // a cycle started off the edges: the next one is on them, the rest stay there
+  Ref.cnt=0xFFFF0000u; Ref.period=CLOCK_TIMER_HZ*256+12467; Ref.rated=1;
+  uint32_t Start=Ref.cnt-723456;
+  for(int Cycle=0; Cycle<CLOCK_HOLDOVER_S; Cycle++)
+  { uint32_t End=Start+hpt_ms_to_cnt(1000, Ref.period), Next=hpt_pps_grid(&Ref, End);
+    if((int32_t)(Next-End)<-HPT_PLL_RESYNC_US) Next+=hpt_ms_to_cnt(1000, Ref.period); // as HPT_NextCycle()
+    if(Cycle>0 && hpt_pps_grid(&Ref, Next)!=Next) Errors++;
+    if(Cycle>0 && abs((int32_t)(Next-Start-hpt_ms_to_cnt(1000, Ref.period)))>1) Errors++; // edges are whole counts
+    if((int32_t)(Next-End)<-HPT_PLL_RESYNC_US) Errors++;
+    Start=Next; }
+  return Errors; }
+
+static int Verify(void)                            // sanity checks: if these fail the timings are meaningless
+{ HostRandom Rnd(2); int Errors=VerifyBatch()+VerifySyndrome()+VerifySIMD()+VerifyManch(Rnd)+VerifyFields(Rnd)+VerifySoA(Rnd)+VerifyTEA(Rnd)+VerifyEncrypt(Rnd)+VerifyPredict(Rnd)+VerifyFit(Rnd)+VerifyClock(Rnd)+VerifyPLL(Rnd, 48.7)+VerifyPLL(Rnd, -33.1)+VerifyGrid(Rnd);
+  for(int Idx=0; Idx<Inputs; Idx++)
+  { if(Packet[Idx].checkFEC()!=0) Errors++;
+    OGN_Packet Copy=Packet[Idx]; Copy.Whiten(); Copy.Dewhiten();
+    if(memcmp(Copy.Position, Packet[Idx].Position, sizeof(Copy.Position))) Errors++;
+    OgnPosition Read;
+    for(int Sent=0; Sent<3; Sent++)
+    { if(Read.ReadNMEA(NMEA[Idx][Sent])<=0) Errors++; }
+    if( (Read.Latitude!=Pos[Idx].Latitude) || (Read.Longitude!=Pos[Idx].Longitude)
+     || (Read.Altitude!=Pos[Idx].Altitude) || (Read.Speed!=Pos[Idx].Speed)
+     || (Read.Heading!=Pos[Idx].Heading) || (Read.PDOP!=Pos[Idx].PDOP)
+     || (!Read.isComplete()) ) Errors++;
+    OgnPosition Stream; NMEA_RxMsg RxMsg;          // same position when indexed byte-by-byte as in the USART interrupt
+    for(int Sent=0; Sent<3; Sent++)
+    { RxMsg.Clear();
+      for(const char *Char=NMEA[Idx][Sent]; *Char; Char++) RxMsg.ProcessByte(*Char);
+      if( (!RxMsg.isChecked()) || (Stream.ReadNMEA(RxMsg)<=0) ) Errors++; }
+    if(memcmp(&Stream, &Read, offsetof(OgnPosition, Temperature)+sizeof(Read.Temperature))) Errors++; // not the tail padding
+    uint32_t Ref[2], Par[2];                       // all LDPC encoders must give bit-identical parity
+    LDPC_Encode(&Packet[Idx].Header, Ref, LDPC_ParityGen);
+    LDPC_Encode_Parity(&Packet[Idx].Header, Par, LDPC_ParityGen);
+    if( (Par[0]!=Ref[0]) || (Par[1]!=Ref[1]) ) Errors++;
+#if LDPC_ENCODER==LDPC_ENCODER_TABLE
+    LDPC_Encode_Table(&Packet[Idx].Header, Par);
+    if( (Par[0]!=Ref[0]) || (Par[1]!=Ref[1]) ) Errors++;
+    uint8_t Bytes[26], RefBytes[26]; Packet[Idx].sendBytes(Bytes); memcpy(RefBytes, Bytes, 26);
+    LDPC_Encode(RefBytes, RefBytes+20, LDPC_ParityGen); LDPC_Encode_Table(Bytes, Bytes+20);
+    if(memcmp(Bytes, RefBytes, 26)) Errors++;
+#endif
+  }
+  printf("verify: %d errors over %d inputs\n", Errors, Inputs);
+  return Errors; }
+
+static bool SameCode(const uint32_t *Out, const uint32_t *Ref) // compare the 208 code bits
+{ for(int Idx=0; Idx<6; Idx++) if(Out[Idx]!=Ref[Idx]) return 0;
+  return ((Out[6]^Ref[6])&0xFFFF)==0; }
+
+class DecoderStat                                  // frames decoded correctly and the time it took
+{ public:
+   int Frames, Good; uint64_t Time_ns; int Iter;
+   DecoderStat() { Frames=0; Good=0; Time_ns=0; Iter=0; }
+   void Print(const char *Name) const
+   { printf("  %s: FER=%6.4f %8.1f ns/frame", Name, 1.0-(double)Good/Frames, (double)Time_ns/Frames);
+     if(Iter) printf(" %4.2f iter", (double)Iter/Frames); }
+} ;
+
+// old decoder (flooding with the 9/10 blend) against the layered min-sum, same iteration cap for both
+static void DecodeBoth(const uint32_t *Ref, const float *Soft, const uint8_t *Data, const uint8_t *Err, DecoderStat &Old, DecoderStat &New)
+{ static LDPC_Decoder Decoder; static LDPC_MinSumDecoder MinSum; uint32_t Out[7];
+  uint64_t Start=Host_Time_ns();
+  if(Soft) Decoder.Input(Soft); else Decoder.Input(Data, (uint8_t *)Err);
+  for(int Iter=0; Iter<=LDPC_MinSumDecoder::MaxIter; Iter++) { if(Decoder.ProcessChecks()==0) break; }
+  Decoder.Output(Out);
+  Old.Time_ns+=Host_Time_ns()-Start; Old.Frames++; if(SameCode(Out, Ref)) Old.Good++;
+  Start=Host_Time_ns();
+  if(Soft) MinSum.Input(Soft); else MinSum.Input(Data, Err);
+  MinSum.Decode(); MinSum.Output(Out);
+  New.Time_ns+=Host_Time_ns()-Start; New.Frames++; if(SameCode(Out, Ref)) New.Good++;
+  New.Iter+=MinSum.Iterations; }
+
+static void Sweep(int Frames, HostRandom &Rnd)     // frame error rate and decode time over AWGN and erasure channels
+{ const double Rate = 160.0/208;
+  printf("AWGN (BPSK, soft input), %d frames per point, max. %d iterations:\n", Frames, LDPC_MinSumDecoder::MaxIter);
+  for(double EbN0=1.0; EbN0<=6.01; EbN0+=1.0)
+  { double Sigma=sqrt(1.0/(2*Rate*pow(10.0, EbN0/10)));
+    DecoderStat Old, New;
+    for(int Frame=0; Frame<Frames; Frame++)
+    { const uint32_t *Ref=&Packet[Frame&(Inputs-1)].Header; float Soft[208];
+      for(int Bit=0; Bit<208; Bit++)
+        Soft[Bit] = ((Ref[Bit>>5]>>(Bit&31))&1 ? 1.0:-1.0) + Sigma*Rnd.Gauss();
+      DecodeBoth(Ref, Soft, 0, 0, Old, New); }
+    printf(" Eb/N0=%3.1fdB", EbN0); Old.Print("old"); New.Print("min-sum"); printf("\n"); }
+  printf("Erasures (hard input), %d frames per point:\n", Frames);
+  for(int Erase=5; Erase<=40; Erase+=5)
+  { DecoderStat Old, New;
+    for(int Frame=0; Frame<Frames; Frame++)
+    { const OGN_Packet &Pkt=Packet[Frame&(Inputs-1)];
+      uint8_t Data[26], Err[26]; Pkt.sendBytes(Data);
+      for(int Idx=0; Idx<26; Idx++)
+      { Err[Idx]=0;
+        for(int Bit=0; Bit<8; Bit++) if(Rnd.Range(0, 99)<Erase) Err[Idx]|=1<<Bit;
+        Data[Idx]^=Err[Idx]&Rnd.Next(); }          // erased bits are random
+      DecodeBoth(&Pkt.Header, 0, Data, Err, Old, New); }
+    printf(" erased=%2d%%     ", Erase); Old.Print("old"); New.Print("min-sum"); printf("\n"); }
+}
+
+// producer and consumer threads hammering a ring buffer: every record carries its sequence number, its own address
+// (the consumer must get the very span the producer filled) and a pattern, the consumer checks all of it
+static int RingStress(cir_buf_num BufNum, const char *Name, int Records, uint64_t Seed)
+{ cir_buf_str *Buf=init_cir_buf(BufNum);
+  std::atomic<int> Errors(0);
+  uint64_t Start=Host_Time_ns();
+  std::thread Producer([&]()
+  { HostRandom Rnd(Seed);
+    uint16_t Len=Rnd.Range(12, 120);
+    for(int Seq=0; Seq<Records; )
+    { uint8_t *Data=cir_reserve(Buf, Len);
+      if(Data==0) { std::this_thread::yield(); continue; }       // consumer is behind
+      uint32_t Word=Seq; memcpy(Data, &Word, 4); memcpy(Data+4, &Data, sizeof(Data));
+      for(int Idx=12; Idx<Len; Idx++) Data[Idx]=Seq*31+Idx;
+      cir_commit(Buf);
+      Seq++; Len=Rnd.Range(12, 120); }
+  });
+  for(int Seq=0; Seq<Records; )
+  { uint16_t Len; uint8_t *Data=cir_peek(Buf, &Len);
+    if(Data==0) { std::this_thread::yield(); continue; }
+    uint32_t Word; memcpy(&Word, Data, 4); uint8_t *Self; memcpy(&Self, Data+4, sizeof(Self));
+    if( (Word!=(uint32_t)Seq) || (Self!=Data) || (Len<12) || (Len>120) || (((uintptr_t)Data)&3) ) Errors++;
+    for(int Idx=12; Idx<Len; Idx++) if(Data[Idx]!=(uint8_t)(Seq*31+Idx)) { Errors++; break; }
+    cir_release(Buf); Seq++; }
+  Producer.join();
+  uint64_t Time=Host_Time_ns()-Start;
+  if(cir_used(Buf)!=0) Errors++;
+  printf("%-28s %9d records %7.1f ns/record  high-water %4d/%d  overruns %lu  errors %d\n",
+         Name, Records, (double)Time/Records, Buf->high_water, Buf->buf_len, (unsigned long)Buf->overruns, (int)Errors);
+  return Errors; }
+
+// several producers (tasks and interrupts on the tracker) and one consumer (the DMA drain) on the log ring:
+// producers never wait, they drop a record when there is no space. Every record carries the producer number,
+// its sequence number and a pattern: the consumer checks the content and that every producer's records come in order,
+// in the end received + dropped must match what each producer has sent.
+static int LogStress(int Producers, int Records, uint64_t Seed)
+{ log_buf_str *Buf=get_log_buf();
+  uint32_t Drops0=Buf->drops;
+  std::atomic<int> Errors(0), Running(Producers);
+  std::vector<int> Dropped(Producers, 0), Received(Producers, 0), Next(Producers, 0);
+  std::vector<std::thread> Threads;
+  uint64_t Start=Host_Time_ns();
+  for(int Prod=0; Prod<Producers; Prod++)
+    Threads.emplace_back([&, Prod]()
+    { HostRandom Rnd(Seed+Prod);
+      for(int Seq=0; Seq<Records; Seq++)
+      { uint16_t Len=Rnd.Range(8, 120);
+        uint8_t *Data=log_reserve(Len);
+        if(Data==0) { log_drop(); Dropped[Prod]++; std::this_thread::yield(); continue; }
+        uint32_t Word[2] = { (uint32_t)Prod, (uint32_t)Seq }; memcpy(Data, Word, 8);
+        for(int Idx=8; Idx<Len; Idx++) Data[Idx]=Seq*31+Prod+Idx;
+        log_commit(Data); }
+      Running--; });
+  for( ; ; )
+  { uint16_t Len; uint8_t *Data=log_peek(&Len);
+    if(Data==0)
+    { if(Running==0 && log_peek(&Len)==0) break;
+      std::this_thread::yield(); continue; }
+    uint32_t Word[2]; memcpy(Word, Data, 8);
+    int Prod=Word[0], Seq=Word[1];
+    if( (Prod<0) || (Prod>=Producers) || (Len<8) || (Len>120) ) { Errors++; log_release(); continue; }
+    if(Seq<Next[Prod]) Errors++;                          // out of order or repeated
+    for(int Idx=8; Idx<Len; Idx++) if(Data[Idx]!=(uint8_t)(Seq*31+Prod+Idx)) { Errors++; break; }
+    Next[Prod]=Seq+1; Received[Prod]++;
+    log_release(); }
+  for(auto &Thread: Threads) Thread.join();
+  uint64_t Time=Host_Time_ns()-Start;
+  int Drops=0;
+  for(int Prod=0; Prod<Producers; Prod++)
+  { if(Received[Prod]+Dropped[Prod]!=Records) Errors++;
+    Drops+=Dropped[Prod]; }
+  if(Buf->drops-Drops0!=(uint32_t)Drops) Errors++;
+  if(log_used()!=0) Errors++;
+  char Name[32]; snprintf(Name, sizeof(Name), "log:mpsc:%dx%d", Producers, LOG_BUF_LEN);
+  printf("%-28s %9d records %7.1f ns/record  high-water %4d/%d  drops %d  errors %d\n",
+         Name, Producers*Records, (double)Time/(Producers*Records), Buf->high_water, LOG_BUF_LEN, Drops, (int)Errors);
+  return Errors; }
+
+// the GPS side parses NMEA and publishes every position, readers (the console on the tracker) take copies:
+// with the mutex the lock is held over the parsing as OGN_Parse_NMEA() does, the snapshot is written after it.
+// Every published position is self-consistent and numbered: readers check both and time every read.
+static int SnapStress(bool Mutex, int Readers, int Reads)
+{ Snapshot<OgnPosition> Snap; std::mutex Lock; OgnPosition Locked;
+  std::atomic<int> Errors(0), Running(Readers); std::atomic<uint64_t> Retries(0), SumWait(0);
+  std::vector<uint32_t> Waits(Readers*Reads);
+  std::thread Writer([&]()
+  { OgnPosition Work;
+    for(int32_t Seq=1; Running>0; Seq++)
+    { const char *Sentence=NMEA[Seq&(Inputs-1)][Seq%3];
+      if(Mutex) Lock.lock();
+      Work.ReadNMEA(Sentence);                              // the work done under the lock before the snapshot
+      Work.Latitude=Seq; Work.Longitude=~Seq; Work.Altitude=3*Seq; Work.Heading=Seq%3600;
+      if(Mutex) { Locked=Work; Lock.unlock(); }
+           else Snap.Write(Work); }
+  });
+  std::vector<std::thread> Threads;
+  for(int Rdr=0; Rdr<Readers; Rdr++)
+    Threads.emplace_back([&, Rdr]()
+    { int32_t Last=0; uint64_t Sum=0, Retry=0; OgnPosition Pos;
+      for(int Read=0; Read<Reads; Read++)
+      { uint64_t Start=Host_Time_ns();
+        if(Mutex) { Lock.lock(); Pos=Locked; Lock.unlock(); }
+             else Retry+=Snap.Read(Pos);
+        uint64_t Wait=Host_Time_ns()-Start; Sum+=Wait; Waits[Rdr*Reads+Read]=Wait;
+        if( Pos.Longitude!=~Pos.Latitude || Pos.Altitude!=3*Pos.Latitude || Pos.Heading!=Pos.Latitude%3600 ) Errors++; // torn
+        if(Pos.Latitude<Last) Errors++;                     // went back in time
+        Last=Pos.Latitude; }
+      Retries+=Retry; SumWait+=Sum;
+      Running--; });
+  for(auto &Thread: Threads) Thread.join();
+  Writer.join();
+  std::sort(Waits.begin(), Waits.end());                    // the tail: on a single core it is the readers preempted while holding the lock
+  char Name[32]; snprintf(Name, sizeof(Name), "snap:%s:%dr", Mutex ? "mutex":"lock-free", Readers);
+  printf("%-28s %9d reads %7.1f ns/read  wait p99.9 %8.1f us  max %8.1f us  retries %llu  errors %d\n",
+         Name, Readers*Reads, (double)SumWait/(Readers*Reads), Waits[Waits.size()*999/1000]*1e-3, Waits.back()*1e-3,
+         (unsigned long long)Retries, (int)Errors);
+  return Errors; }
+
+int main(int argc, char *argv[])
+{ int Ops=200000; uint64_t Seed=1;
+  for(int Arg=1; Arg<argc; Arg++)
+  {      if(strcmp(argv[Arg], "-n")==0 && Arg+1<argc) Ops=atoi(argv[++Arg]);
+    else if(strcmp(argv[Arg], "-s")==0 && Arg+1<argc) Seed=strtoull(argv[++Arg], 0, 0);
+    else Filter=argv[Arg]; }
+
+  HostRandom Rnd(Seed);
+  for(int Idx=0; Idx<Inputs; Idx++)
+  { Host_RandomPosition(Pos[Idx], Rnd);
+    Host_PreparePacket(Packet[Idx], Pos[Idx], Rnd.Next());
+    Corrupt[Idx]=Packet[Idx]; Host_FlipBits(&Corrupt[Idx].Header, Rnd.Range(1, 6), Rnd);
+    Host_FormatGGA(NMEA[Idx][0], Pos[Idx]);
+    Host_FormatRMC(NMEA[Idx][1], Pos[Idx]);
+    Host_FormatGSA(NMEA[Idx][2], Pos[Idx]); }
+
+  if(Verify()) return 1;
+
+  HostBench::PrintHeader("OGN codec", Seed);
+
+  if(Selected("encode"))
+  { OGN_Packet Pkt;
+    HostBench("encode:position", Ops).Run([&](int Idx) { Pos[Idx&(Inputs-1)].Encode(Pkt); Host_Sink+=Pkt.Position[2]; }); }
+
+  if(Selected("whiten"))
+  { OGN_Packet Pkt=Packet[0];
+    HostBench("whiten", Ops).Run([&](int Idx) { Pkt.Whiten(); Host_Sink+=Pkt.Position[0]; });
+    HostBench("dewhiten", Ops).Run([&](int Idx) { Pkt.Dewhiten(); Host_Sink+=Pkt.Position[0]; }); }
+
+  if(Selected("fec"))
+  { OGN_Packet Pkt;
+    HostBench("fec:encode", Ops).Run([&](int Idx) { Pkt=Packet[Idx&(Inputs-1)]; Pkt.setFEC(); Host_Sink+=Pkt.FEC[0]; });
+    uint32_t Par[2];
+    HostBench("fec:encode:popcount", Ops).Run([&](int Idx) { LDPC_Encode(&Packet[Idx&(Inputs-1)].Header, Par, LDPC_ParityGen); Host_Sink+=Par[0]; });
+    HostBench("fec:encode:parity", Ops).Run([&](int Idx) { LDPC_Encode_Parity(&Packet[Idx&(Inputs-1)].Header, Par, LDPC_ParityGen); Host_Sink+=Par[0]; });
+#if LDPC_ENCODER==LDPC_ENCODER_TABLE
+    HostBench("fec:encode:table", Ops).Run([&](int Idx) { LDPC_Encode_Table(&Packet[Idx&(Inputs-1)].Header, Par); Host_Sink+=Par[0]; });
+#endif
+    HostBench("fec:check", Ops).Run([&](int Idx) { Host_Sink+=Packet[Idx&(Inputs-1)].checkFEC(); });
+    uint8_t Bytes[Inputs][26];
+    for(int Idx=0; Idx<Inputs; Idx++) Packet[Idx].sendBytes(Bytes[Idx]);
+    HostBench("fec:check:bytes", Ops).Run([&](int Idx) { Host_Sink+=LDPC_Check(Bytes[Idx&(Inputs-1)]); });
+    static uint64_t Syndrome[Inputs];              // batch check: timing is per packet
+    HostBench Batch32("fec:check:batch32", (Ops/Inputs+1)*Inputs);
+    Batch32.Run([&](int Idx) { if((Idx&(Inputs-1))==0) Host_Sink+=LDPC_CheckBatch<uint32_t>(&Corrupt[0].Header, Inputs, Syndrome, PacketStride); });
+    HostBench Batch64("fec:check:batch64", (Ops/Inputs+1)*Inputs);
+    Batch64.Run([&](int Idx) { if((Idx&(Inputs-1))==0) Host_Sink+=LDPC_CheckBatch<uint64_t>(&Corrupt[0].Header, Inputs, Syndrome, PacketStride); }); }
+
+  if(Selected("decode"))
+  { LDPC_Decoder Decoder; int Good=0;
+    int DecOps=Ops/10;
+    HostBench("decode:soft", DecOps).Run([&](int Idx)
+    { const OGN_Packet &Pkt=Corrupt[Idx&(Inputs-1)];
+      Decoder.Input(&Pkt.Header);
+      for(int Iter=0; Iter<32; Iter++) { if(Decoder.ProcessChecks()==0) break; }
+      uint32_t Out[7]; Decoder.Output(Out);
+      if(LDPC_Check(Out)==0) Good++; });
+    printf("%-28s %9d/%d packets (1..6 bit errors) corrected\n", "decode:soft", Good, DecOps);
+    LDPC_MinSumDecoder MinSum; Good=0; int Iter=0;
+    HostBench("decode:minsum", DecOps).Run([&](int Idx)
+    { const OGN_Packet &Pkt=Corrupt[Idx&(Inputs-1)];
+      MinSum.Input(&Pkt.Header);
+      if(MinSum.Decode()>=0) Iter+=MinSum.Iterations;
+      uint32_t Out[7]; MinSum.Output(Out);
+      if(SameCode(Out, &Packet[Idx&(Inputs-1)].Header)) Good++; });
+    printf("%-28s %9d/%d packets (1..6 bit errors) corrected, %4.2f iterations on average\n", "decode:minsum", Good, DecOps, (double)Iter/DecOps);
+    static OGN_Packet Few[Inputs];                 // one or two bit errors: syndrome table against the min-sum decoder
+    HostRandom FewRnd(Seed);
+    for(int Idx=0; Idx<Inputs; Idx++)
+    { Few[Idx]=Packet[Idx];
+      for(int Err=1+(Idx&1); Err; Err--) { int Bit=FewRnd.Range(0, 207); (&Few[Idx].Header)[Bit>>5]^=(uint32_t)1<<(Bit&31); } }
+    Good=0;
+    HostBench("decode:syndrome", Ops).Run([&](int Idx)
+    { uint32_t Code[7]; memcpy(Code, &Few[Idx&(Inputs-1)].Header, sizeof(Code));
+      uint64_t Syndrome=LDPC_Syndrome(Code);
+      if(Syndrome && LDPC_SyndromeCorrect(Code, Syndrome)>0 && SameCode(Code, &Packet[Idx&(Inputs-1)].Header)) Good++; });
+    printf("%-28s %9d/%d packets (1..2 bit errors) corrected\n", "decode:syndrome", Good, Ops);
+    Good=0;
+    HostBench("decode:minsum:1-2", DecOps).Run([&](int Idx)
+    { MinSum.Input(&Few[Idx&(Inputs-1)].Header); MinSum.Decode();
+      uint32_t Out[7]; MinSum.Output(Out);
+      if(SameCode(Out, &Packet[Idx&(Inputs-1)].Header)) Good++; });
+    printf("%-28s %9d/%d packets (1..2 bit errors) corrected\n", "decode:minsum:1-2", Good, DecOps);
+    LDPC_BitFlipDecoder BitFlip; Good=0; int Flips=0, Wrong=0;
+    HostBench("decode:bitflip", Ops).Run([&](int Idx)
+    { BitFlip.Input(&Corrupt[Idx&(Inputs-1)].Header);
+      if(BitFlip.Decode()<0) return;
+      uint32_t Out[7]; BitFlip.Output(Out);
+      if(SameCode(Out, &Packet[Idx&(Inputs-1)].Header)) { Good++; Flips+=BitFlip.Iterations; }
+                                                   else Wrong++; });
+    printf("%-28s %9d/%d packets (1..6 bit errors) corrected, %4.2f flips on average, %d miscorrected\n",
+           "decode:bitflip", Good, Ops, Good ? (double)Flips/Good:0.0, Wrong);
+    static OGN_Packet Batch[Inputs]; static uint64_t Syndrome[Inputs];  // batch: check all, soft-decode only the failing ones
+    int Corrected=0, Failed=0;
+    HostBench BatchDec("decode:batch", (DecOps/Inputs+1)*Inputs);
+    BatchDec.Run([&](int Idx)
+    { if(Idx&(Inputs-1)) return;
+      memcpy(Batch, Corrupt, sizeof(Batch));
+      Failed+=LDPC_CheckBatch<uint64_t>(&Batch[0].Header, Inputs, Syndrome, PacketStride);
+      Corrected+=LDPC_DecodeBatch(&Batch[0].Header, Inputs, Syndrome, Decoder, 32, PacketStride); });
+    printf("%-28s %9d/%d failing packets corrected\n", "decode:batch", Corrected, Failed); }
+
+  if(Selected("simd"))                             // frames/s: scalar against every SIMD instruction set, packets with errors and pure noise
+  { static OGN_Packet Noise[Inputs], Batch[Inputs]; static uint64_t Syndrome[Inputs], NoiseSyndrome[Inputs];
+    HostRandom NoiseRnd(Seed);
+    for(int Idx=0; Idx<Inputs; Idx++)
+      for(int Word=0; Word<7; Word++) (&Noise[Idx].Header)[Word]=NoiseRnd.Next();
+    LDPC_CheckBatch<uint64_t>(&Corrupt[0].Header, Inputs, Syndrome, PacketStride);
+    LDPC_CheckBatch<uint64_t>(&Noise[0].Header, Inputs, NoiseSyndrome, PacketStride);
+    int Frames=(Ops/20/Inputs+1)*Inputs;
+    for(int ISA=LDPC_ISA_SCALAR; ISA<=LDPC_ISA_NEON; ISA++)
+    { if(!LDPC_SIMD_Supported((LDPC_SIMD_ISA)ISA)) continue;
+      char Name[32]; int Corrected=0;
+      sprintf(Name, "decode:simd:%s", LDPC_SIMD_Name((LDPC_SIMD_ISA)ISA));
+      HostBench(Name, Frames).Run([&](int Idx)
+      { if(Idx&(Inputs-1)) return;
+        memcpy(Batch, Corrupt, sizeof(Batch));
+        Corrected+=LDPC_DecodeBatchSIMD(&Batch[0].Header, Inputs, Syndrome, 32, PacketStride, (LDPC_SIMD_ISA)ISA); });
+      printf("%-28s %9d/%d frames (1..6 bit errors) corrected\n", Name, Corrected, Frames);
+      sprintf(Name, "decode:simd:noise:%s", LDPC_SIMD_Name((LDPC_SIMD_ISA)ISA));
+      HostBench(Name, Frames/4).Run([&](int Idx)
+      { if(Idx&(Inputs-1)) return;
+        memcpy(Batch, Noise, sizeof(Batch));
+        LDPC_DecodeBatchSIMD(&Batch[0].Header, Inputs, NoiseSyndrome, 32, PacketStride, (LDPC_SIMD_ISA)ISA); }); }
+  }
+
+  if(Selected("sweep"))
+  { HostRandom SweepRnd(Seed); Sweep(Ops/50, SweepRnd); }
+
+  if(Selected("ring"))
+  { RingStress(CIR_BUF_CONSOLE, "ring:spsc:256", Ops*5, Seed);
+    RingStress(CIR_BUF_NMEA, "ring:spsc:1024", Ops*5, Seed); }
+
+  if(Selected("log"))
+  { LogStress(1, Ops*2, Seed);
+    LogStress(4, Ops, Seed); }
+
+  if(Selected("snap"))
+  { SnapStress(true, 2, Ops*2);
+    SnapStress(false, 2, Ops*2); }
+
+  if(Selected("manch"))                            // Manchester emulation of the Spirit1: old nibble tables against the byte table and the any-offset decode
+  { uint8_t Fifo[64], Data[26], Err[26];
+    HostBench("manch:encode:nibble", Ops).Run([&](int Idx)
+    { Corrupt[Idx&(Inputs-1)].sendBytes(Data); Host_Sink+=RefManchEncode(Fifo, Data, 26); });
+    HostBench("manch:encode:table", Ops).Run([&](int Idx)
+    { Corrupt[Idx&(Inputs-1)].sendBytes(Data); Host_Sink+=ManchEncode(Fifo, Data, 26); });
+    HostBench("manch:decode:nibble", Ops).Run([&](int Idx)
+    { Fifo[Idx&63]^=Idx; RefManchDecode(Data, Err, Fifo, 26); Host_Sink+=Data[Idx%26]+Err[Idx%26]; });
+    HostBench("manch:decode:table", Ops).Run([&](int Idx)
+    { Fifo[Idx&63]^=Idx; Manch_Decode(Data, Err, Fifo+2, 26, ManchOfs); Host_Sink+=Data[Idx%26]+Err[Idx%26]; }); }
+
+  if(Selected("field"))                            // altitude, DOP, speed, turn rate, climb rate and temperature: compare chains against CLZ
+  { OGN_Packet New; RefFields Old; memset(&Old, 0, sizeof(Old)); memcpy(New.Position, Old.Position, sizeof(Old.Position));
+    static int16_t Wide[Inputs][6]; HostRandom FieldRnd(Seed);  // values spread over all the ranges: the compare chains mispredict
+    for(int Idx=0; Idx<Inputs; Idx++)
+      for(int Field=0; Field<6; Field++) Wide[Idx][Field]=FieldRnd.Range(-4000, 16000)>>(FieldRnd.Range(0, 3)*3);
+    HostBench("field:encode:chain:wide", Ops).Run([&](int Idx)
+    { const int16_t *V=Wide[Idx&(Inputs-1)];
+      Old.EncodeAltitude(4*V[0]); Old.EncodeDOP(V[1]); Old.EncodeSpeed(V[2]);
+      Old.EncodeTurnRate(V[3]>>3); Old.EncodeClimbRate(V[4]>>2); Old.EncodeTemperature(V[5]>>3);
+      Host_Sink+=Old.Position[2]^Old.Position[3]; });
+    HostBench("field:encode:clz:wide", Ops).Run([&](int Idx)
+    { const int16_t *V=Wide[Idx&(Inputs-1)];
+      New.EncodeAltitude(4*V[0]); New.EncodeDOP(V[1]); New.EncodeSpeed(V[2]);
+      New.EncodeTurnRate(V[3]>>3); New.EncodeClimbRate(V[4]>>2); New.EncodeTemperature(V[5]>>3);
+      Host_Sink+=New.Position[2]^New.Position[3]; });
+    HostBench("field:encode:chain", Ops).Run([&](int Idx)
+    { const OgnPosition &P=Pos[Idx&(Inputs-1)];
+      Old.EncodeAltitude(P.Altitude/10); Old.EncodeDOP(P.PDOP-10); Old.EncodeSpeed(P.Speed>>1);
+      Old.EncodeTurnRate(P.TurnRate); Old.EncodeClimbRate(P.ClimbRate); Old.EncodeTemperature(P.Temperature);
+      Host_Sink+=Old.Position[2]^Old.Position[3]; });
+    HostBench("field:encode:clz", Ops).Run([&](int Idx)
+    { const OgnPosition &P=Pos[Idx&(Inputs-1)];
+      New.EncodeAltitude(P.Altitude/10); New.EncodeDOP(P.PDOP-10); New.EncodeSpeed(P.Speed>>1);
+      New.EncodeTurnRate(P.TurnRate); New.EncodeClimbRate(P.ClimbRate); New.EncodeTemperature(P.Temperature);
+      Host_Sink+=New.Position[2]^New.Position[3]; });
+    HostBench("field:decode:chain", Ops).Run([&](int Idx)
+    { memcpy(Old.Position, Packet[Idx&(Inputs-1)].Position, sizeof(Old.Position));
+      Host_Sink+=Old.DecodeAltitude()+Old.DecodeDOP()+Old.DecodeSpeed()+Old.DecodeTurnRate()+Old.DecodeClimbRate()+Old.DecodeTemperature(); });
+    HostBench("field:decode:clz", Ops).Run([&](int Idx)
+    { memcpy(New.Position, Packet[Idx&(Inputs-1)].Position, sizeof(New.Position));
+      Host_Sink+=New.DecodeAltitude()+New.DecodeDOP()+New.DecodeSpeed()+New.DecodeTurnRate()+New.DecodeClimbRate()+New.DecodeTemperature(); }); }
+
+  if(Selected("tea"))                              // dewhitening of received packets and keyed TEA: one packet at a time against the batch kernels
+  { static OGN_Packet Work[Inputs]; memcpy(Work, Packet, sizeof(Work));
+    int Rounds = Ops/Inputs>0 ? Ops/Inputs:1; static volatile uint32_t KeyIn[4] = { 0x01234567, 0x89ABCDEF, 0xFEDCBA98, 0x76543210 };
+    uint32_t Key[4]; for(int Word=0; Word<4; Word++) Key[Word]=KeyIn[Word]; // as in the firmware: the key is not known to the compiler
+    char Name[40]; HostBench Bench("", Rounds);
+    Bench.Name="tea:dewhiten:single"; Bench.Run([&](int Idx) { for(int Pkt=0; Pkt<Inputs; Pkt++) Work[Pkt].Dewhiten(); });
+    printf("%-28s %9s     %10.1f ns/packet\n", "", "", Bench.nsPerOp()/Inputs);
+    for(int ISA=LDPC_ISA_SCALAR; ISA<=LDPC_ISA_NEON; ISA++)
+    { if(!LDPC_SIMD_Supported((LDPC_SIMD_ISA)ISA)) continue;
+      sprintf(Name, "tea:dewhiten:%s", LDPC_SIMD_Name((LDPC_SIMD_ISA)ISA)); Bench.Name=Name;
+      Bench.Run([&](int Idx) { OGN_DewhitenBatchSIMD(Work, Inputs, (LDPC_SIMD_ISA)ISA); });
+      printf("%-28s %9s     %10.1f ns/packet\n", "", "", Bench.nsPerOp()/Inputs); }
+    uint32_t *Words=&Work[0].Header; int Blocks=sizeof(Work)/8;
+    static volatile uint16_t StrideIn=2; uint16_t Stride=StrideIn; // with a constant stride g++ vectorizes the one-block loop by itself
+    Bench.Name="tea:encrypt:single"; Bench.Run([&](int Idx) { for(int Block=0; Block<Blocks; Block++) OGN_Packet::TEA_Encrypt(Words+Stride*Block, Key); });
+    printf("%-28s %9s     %10.1f ns/block\n", "", "", Bench.nsPerOp()/Blocks);
+    for(int ISA=LDPC_ISA_SCALAR; ISA<=LDPC_ISA_NEON; ISA++)
+    { if(!LDPC_SIMD_Supported((LDPC_SIMD_ISA)ISA)) continue;
+      sprintf(Name, "tea:encrypt:%s", LDPC_SIMD_Name((LDPC_SIMD_ISA)ISA)); Bench.Name=Name;
+      Bench.Run([&](int Idx) { TEA_EncryptBatchSIMD(Words, Blocks, Key, 4, 2, (LDPC_SIMD_ISA)ISA); });
+      printf("%-28s %9s     %10.1f ns/block\n", "", "", Bench.nsPerOp()/Blocks); }
+    Host_Sink+=Work[0].Position[0]; }
+
+  if(Selected("keys"))                             // key trial: encrypted packets against a list of known keys
+  { const int NumKeys=64; OGN_TEAKey Keys[NumKeys]; HostRandom KeyRnd(Seed);
+    for(int Key=0; Key<NumKeys; Key++)
+    { uint32_t Raw[4]; for(int Idx=0; Idx<4; Idx++) Raw[Idx]=KeyRnd.Next();
+      Keys[Key].Set(Raw); }
+    static OGN_Packet Sent[Inputs], Rx[Inputs]; int Key[Inputs]; int16_t KeyIdx[Inputs];
+    KeyTrialPackets(Sent, Key, Inputs, Keys, NumKeys, KeyRnd);
+    int Encrypted=0; for(int Idx=0; Idx<Inputs; Idx++) if(Key[Idx]>=0) Encrypted++;
+    int Rounds = Ops/(Inputs*16)>0 ? Ops/(Inputs*16):1;
+    char Name[40]; HostBench Bench("", Rounds);
+    for(int ISA=LDPC_ISA_SCALAR; ISA<=LDPC_ISA_NEON; ISA++)
+    { if(!LDPC_SIMD_Supported((LDPC_SIMD_ISA)ISA)) continue;
+      sprintf(Name, "keys:%d:%s", NumKeys, LDPC_SIMD_Name((LDPC_SIMD_ISA)ISA)); Bench.Name=Name;
+      int Matched=0;
+      Bench.Run([&](int Idx)
+      { memcpy(Rx, Sent, sizeof(Rx)); for(int Pkt=0; Pkt<Inputs; Pkt++) KeyIdx[Pkt]=-1;
+        Matched=OGN_TryKeys(Rx, Inputs, Keys, NumKeys, KeyRef, KeyIdx, (LDPC_SIMD_ISA)ISA); });
+      printf("%-28s %9d/%d matched %6.1f ns/packet\n", "", Matched, Encrypted, Bench.nsPerOp()/Encrypted); }
+  }
+
+  if(Selected("soa"))                              // dewhiten and decode all the fields of received packets: per-field accessors against the batch
+  { const int Batch=64; OGN_Packet Rx; int32_t Alt[Batch]; int16_t Climb[Batch];
+    std::vector<uint8_t> Buffer(OgnDecodedSoA::Size(Batch)); OgnDecodedSoA SoA; SoA.Assign(Buffer.data(), Batch);
+    HostBench("soa:accessors", Ops).Run([&](int Idx)
+    { Rx=Packet[Idx&(Inputs-1)]; Rx.Dewhiten();
+      int Slot=Idx&(Batch-1);
+      Host_Sink+=Rx.getAddress()+Rx.isEmergency()+Rx.getAcftType()+Rx.getFixQuality()+Rx.getTime()+Rx.DecodeDOP();
+      Host_Sink+=Rx.DecodeLatitude()+Rx.DecodeLongitude()+Rx.DecodeSpeed()+Rx.DecodeHeading()+Rx.DecodeTurnRate();
+      Alt[Slot]=Rx.DecodeAltitude(); Climb[Slot]=Rx.DecodeClimbRate(); });
+    Host_Sink+=Alt[0]+Climb[0];
+    double ns=HostBench("soa:batch:64", Ops/Batch).Run([&](int Idx)
+    { Host_Sink+=OGN_DecodeBatch(Packet+((Idx*Batch)&(Inputs-1)), Batch, &SoA); Host_Sink+=SoA.Altitude[Idx&(Batch-1)]; });
+    printf("%-28s %9s     %10.1f ns/packet\n", "soa:batch", "", ns/Batch); }
+
+  if(Selected("nmea"))
+  { OgnPosition Read;
+    HostBench("nmea:string", Ops).Run([&](int Idx) { Host_Sink+=Read.ReadNMEA(NMEA[(Idx/3)&(Inputs-1)][Idx%3]); });
+    NMEA_RxMsg RxMsg;
+    HostBench("nmea:rxmsg", Ops).Run([&](int Idx)
+    { const char *Str=NMEA[(Idx/3)&(Inputs-1)][Idx%3];
+      RxMsg.Clear();
+      for( ; *Str; Str++) RxMsg.ProcessByte(*Str);
+      if(RxMsg.isChecked()) Host_Sink+=Read.ReadNMEA(RxMsg); });
+    static NMEA_RxMsg Indexed[Inputs][3];          // GPS task side only: the ISR has already indexed the sentences
+    for(int Idx=0; Idx<Inputs; Idx++)
+      for(int Sent=0; Sent<3; Sent++)
+      { Indexed[Idx][Sent].Clear();
+        for(const char *Char=NMEA[Idx][Sent]; *Char; Char++) Indexed[Idx][Sent].ProcessByte(*Char); }
+    HostBench("nmea:rxmsg:parse", Ops).Run([&](int Idx)
+    { NMEA_RxMsg &Msg=Indexed[(Idx/3)&(Inputs-1)][Idx%3];
+      if(Msg.isChecked()) Host_Sink+=Read.ReadNMEA(Msg); }); }
+
+  if(Selected("packet"))
+  { OGN_Packet Pkt;
+    HostBench("packet:prepare", Ops).Run([&](int Idx) { Host_PreparePacket(Pkt, Pos[Idx&(Inputs-1)], Idx); Host_Sink+=Pkt.FEC[0]; });
+    static OGN_Packet Base[Inputs];                // the TX path: extrapolate, whiten and FEC a packet encoded when the fix came
+    for(int Idx=0; Idx<Inputs; Idx++) { Base[Idx].Header=0; Pos[Idx].Encode(Base[Idx]); }
+    HostBench("packet:predict", Ops).Run([&](int Idx)
+    { Pkt=Base[Idx&(Inputs-1)]; Pos[Idx&(Inputs-1)].EncodePredicted(Pkt, 400+(Idx&0x3FF));
+      Pkt.Whiten(); Pkt.setFEC(); Host_Sink+=Pkt.FEC[0]; }); }
+
+  return 0; }
@@ -0,0 +1,102 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "ogn_host.h"
+
+volatile uint32_t Host_Sink = 0;
+
+void Host_RandomPosition(OgnPosition &Pos, HostRandom &Rnd)
+{ Pos.Clear();
+  Pos.FixQuality = Rnd.Range(1, 2);
+  Pos.FixMode    = 3;
+  Pos.Satellites = Rnd.Range(4, 12);
+  Pos.Year  = Rnd.Range(15, 30); Pos.Month = Rnd.Range(1, 12); Pos.Day     = Rnd.Range(1, 28);
+  Pos.Hour  = Rnd.Range(0, 23);  Pos.Min   = Rnd.Range(0, 59); Pos.Sec     = Rnd.Range(0, 59);
+  Pos.FracSec = Rnd.Range(0, 9)*10;
+  Pos.HDOP  = Rnd.Range(10, 40); Pos.VDOP  = Rnd.Range(10, 60); Pos.PDOP    = Rnd.Range(Pos.HDOP, 80);
+  Pos.Latitude   = Rnd.Range(-80*600000, 80*600000);             // [0.0001/60 deg]
+  Pos.Longitude  = Rnd.Range(-179*600000, 179*600000);
+  Pos.Altitude   = Rnd.Range(0, 60000);                          // [0.1 m] the NMEA reader does not take negative altitudes
+  Pos.GeoidSeparation = Rnd.Range(0, 500);
+  Pos.Speed      = Rnd.Range(0, 2000);                           // [0.1 knot]
+  Pos.Heading    = Rnd.Range(0, 3599);                           // [0.1 deg]
+  Pos.ClimbRate  = Rnd.Range(-100, 100);                         // [0.1 m/s]
+  Pos.TurnRate   = Rnd.Range(-200, 200);                         // [0.1 deg/s]
+  Pos.Flags      = 0x01; }
+
+static int FormatLatitude(char *Out, int32_t Lat)                // ddmm.mmmm,N
+{ char Sign='N'; if(Lat<0) { Sign='S'; Lat=(-Lat); }
+  int Deg=Lat/600000; Lat-=Deg*600000;
+  return sprintf(Out, "%02d%02d.%04d,%c", Deg, (int)(Lat/10000), (int)(Lat%10000), Sign); }
+
+static int FormatLongitude(char *Out, int32_t Lon)               // dddmm.mmmm,E
+{ char Sign='E'; if(Lon<0) { Sign='W'; Lon=(-Lon); }
+  int Deg=Lon/600000; Lon-=Deg*600000;
+  return sprintf(Out, "%03d%02d.%04d,%c", Deg, (int)(Lon/10000), (int)(Lon%10000), Sign); }
+
+static int FormatTime(char *Out, const OgnPosition &Pos)
+{ return sprintf(Out, "%02d%02d%02d.%02d", Pos.Hour, Pos.Min, Pos.Sec, Pos.FracSec); }
+
+static int FormatFloat1(char *Out, int32_t Value)                // value in 0.1 units as "x.y"
+{ return sprintf(Out, "%d.%d", (int)(Value/10), (int)(Value%10)); }
+
+static int AppendCheck(char *Out, int Len)                       // append "*XX\r\n"
+{ uint8_t Check=NMEA_Check((uint8_t *)Out+1, Len-1);
+  return Len+sprintf(Out+Len, "*%02X\r\n", Check); }
+
+int Host_FormatGGA(char *Out, const OgnPosition &Pos)
+{ int Len=sprintf(Out, "$GPGGA,");
+  Len+=FormatTime(Out+Len, Pos); Out[Len++]=',';
+  Len+=FormatLatitude(Out+Len, Pos.Latitude); Out[Len++]=',';
+  Len+=FormatLongitude(Out+Len, Pos.Longitude);
+  Len+=sprintf(Out+Len, ",%d,%02d,", Pos.FixQuality, Pos.Satellites);
+  Len+=FormatFloat1(Out+Len, Pos.HDOP); Out[Len++]=',';
+  Len+=FormatFloat1(Out+Len, Pos.Altitude); Len+=sprintf(Out+Len, ",M,");
+  Len+=FormatFloat1(Out+Len, Pos.GeoidSeparation); Len+=sprintf(Out+Len, ",M,,");
+  return AppendCheck(Out, Len); }
+
+int Host_FormatRMC(char *Out, const OgnPosition &Pos)
+{ int Len=sprintf(Out, "$GPRMC,");
+  Len+=FormatTime(Out+Len, Pos); Len+=sprintf(Out+Len, ",A,");
+  Len+=FormatLatitude(Out+Len, Pos.Latitude); Out[Len++]=',';
+  Len+=FormatLongitude(Out+Len, Pos.Longitude); Out[Len++]=',';
+  Len+=FormatFloat1(Out+Len, Pos.Speed); Out[Len++]=',';
+  Len+=FormatFloat1(Out+Len, Pos.Heading);
+  Len+=sprintf(Out+Len, ",%02d%02d%02d,,,A", Pos.Day, Pos.Month, Pos.Year);
+  return AppendCheck(Out, Len); }
+
+int Host_FormatGSA(char *Out, const OgnPosition &Pos)
+{ int Len=sprintf(Out, "$GPGSA,A,%d,", Pos.FixMode);
+  for(int Sat=0; Sat<12; Sat++)
+  { if(Sat<Pos.Satellites) Len+=sprintf(Out+Len, "%02d", Sat+1);
+    Out[Len++]=','; }
+  Len+=FormatFloat1(Out+Len, Pos.PDOP); Out[Len++]=',';
+  Len+=FormatFloat1(Out+Len, Pos.HDOP); Out[Len++]=',';
+  Len+=FormatFloat1(Out+Len, Pos.VDOP);
+  return AppendCheck(Out, Len); }
+
+void Host_PreparePacket(OGN_Packet &Packet, const OgnPosition &Pos, uint32_t AcftID, const OGN_TEAKey *Key)
+{ bool Encrypt = Key && !Key->isZero(); uint32_t Address  =  AcftID     &0x00FFFFFF;
+  uint8_t  AddrType = (AcftID>>24)&0x03;
+  uint8_t  AcftType = (AcftID>>26)&0x1F;
+  uint8_t  Private  = (AcftID>>31)&0x01;
+  Packet.setAddress(Address); Packet.setAddrType(AddrType); Packet.clrMeteo(); Packet.calcAddrParity();
+  Packet.clrEmergency(); Packet.setRelayCount(0);
+  if(Encrypt) Packet.setEncrypted();
+         else Packet.clrEncrypted();
+  Pos.Encode(Packet);
+  Packet.setAcftType(AcftType);
+  if(Private) Packet.setPrivate();
+         else Packet.clrPrivate();
+  if(Encrypt) Packet.Encrypt(*Key);
+         else Packet.Whiten();
+  Packet.setFEC(); }
+
+void Host_FlipBits(uint32_t *Packet, int Bits, HostRandom &Rnd)
+{ uint32_t Flipped[7]; memset(Flipped, 0, sizeof(Flipped));
+  for(int Count=0; Count<Bits; )
+  { int Bit=Rnd.Range(0, 207);
+    uint32_t Mask=(uint32_t)1<<(Bit&31);
+    if(Flipped[Bit>>5]&Mask) continue;
+    Flipped[Bit>>5]|=Mask; Packet[Bit>>5]^=Mask; Count++; }
+}
@@ -0,0 +1,89 @@
+#ifndef __OGN_HOST_H__
+#define __OGN_HOST_H__
+
+// Host (PC) side support for the OGN codec headers: repeatable random inputs,
+// NMEA sentence generation and a simple timing harness for the micro-benchmarks.
+// Nothing in here is compiled into the tracker firmware.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include <math.h>
+
+#include "ogn.h"
+
+class HostRandom                 // xorshift64* generator: same seed => same inputs on every run and every machine
+{ public:
+   uint64_t State;
+
+  public:
+   HostRandom(uint64_t Seed=1) { setSeed(Seed); }
+
+   void setSeed(uint64_t Seed) { State = Seed ? Seed : 0x9E3779B97F4A7C15ULL; }
+
+   uint64_t Next64(void)
+   { State^=State>>12; State^=State<<25; State^=State>>27;
+     return State*0x2545F4914F6CDD1DULL; }
+
+   uint32_t Next(void) { return Next64()>>32; }
+
+   int32_t Range(int32_t Min, int32_t Max)           // uniform integer in [Min..Max]
+   { return Min + (int32_t)(Next()%(uint32_t)(Max-Min+1)); }
+
+   double Uniform(void)                              // uniform in [0..1)
+   { return (Next64()>>11)*(1.0/9007199254740992.0); }
+
+   double Gauss(void)                                // normal distribution: zero mean, unit variance (Box-Muller)
+   { double U1=1.0-Uniform(), U2=Uniform();
+     return sqrt(-2.0*log(U1))*cos(2*M_PI*U2); }
+} ;
+
+inline uint64_t Host_Time_ns(void)                   // monotonic time in nanoseconds
+{ struct timespec Now; clock_gettime(CLOCK_MONOTONIC, &Now);
+  return (uint64_t)Now.tv_sec*1000000000ULL + Now.tv_nsec; }
+
+extern volatile uint32_t Host_Sink;                  // results are folded here so the compiler can not drop the work
+
+class HostBench                  // time Ops calls of a given operation and print ns/op and ops/s
+{ public:
+   const char *Name;
+   int         Ops;
+   uint64_t    Time_ns;
+
+  public:
+   HostBench(const char *BenchName, int BenchOps) { Name=BenchName; Ops=BenchOps; Time_ns=0; }
+
+   template <class Operation>
+    double Run(Operation Op)                         // Op(Idx) is called for Idx=0..Ops-1, return ns/op
+    { uint64_t Start=Host_Time_ns();
+      for(int Idx=0; Idx<Ops; Idx++) Op(Idx);
+      Time_ns=Host_Time_ns()-Start;
+      return Print(); }
+
+   double nsPerOp(void) const { return Ops ? (double)Time_ns/Ops : 0.0; }
+
+   double Print(void) const
+   { double ns=nsPerOp();
+     printf("%-28s %9d ops %10.1f ns/op %12.0f ops/s\n", Name, Ops, ns, ns>0 ? 1e9/ns:0.0);
+     return ns; }
+
+   static void PrintHeader(const char *Title, uint64_t Seed)
+   { printf("=== %s (seed=%llu) ===\n", Title, (unsigned long long)Seed); }
+} ;
+
+// random, but plausible GPS fix
+void Host_RandomPosition(OgnPosition &Pos, HostRandom &Rnd);
+
+// NMEA sentences (with the "*XX\r\n" check-sum tail) describing a given position, return the length
+int  Host_FormatGGA(char *Out, const OgnPosition &Pos);
+int  Host_FormatRMC(char *Out, const OgnPosition &Pos);
+int  Host_FormatGSA(char *Out, const OgnPosition &Pos);
+
+// same steps as OGN_PreparePacket() in ogn_lib.cpp, but without the FreeRTOS mutex and the global state:
+// with a (non-zero) Key the position is encrypted instead of whitened
+void Host_PreparePacket(OGN_Packet &Packet, const OgnPosition &Pos, uint32_t AcftID, const OGN_TEAKey *Key=0);
+
+// flip given number of distinct, random bits among the 208 code bits of a packet
+void Host_FlipBits(uint32_t *Packet, int Bits, HostRandom &Rnd);
+
+#endif // of __OGN_HOST_H__
@@ -0,0 +1,251 @@
+// Simulator of the OGN radio link and the receiver front end, runs on a PC.
+//
+// rx: packet error rate vs chip S/N for the three ways to feed the LDPC decoder:
+//     hard bits, Manchester violations as erasures, soft bits (manchester.h)
+//     over a random chip error channel (non-coherent FSK) and the same channel with burst interference.
+//
+// track: position error at the transmit time for a simulated flight (straight legs and thermalling circles):
+//        the fix prepared at 950 ms and sent in the next second (the old HPT table), the latest fix as it is,
+//        and the latest fix extrapolated to the transmit time by OgnPosition::EncodePredicted() - all through the packet encoding.
+//
+// nmea: climb and turn rate as sent in the packets: the difference of two fixes (before OgnPosHistory) against the
+//       least-squares slope over OGN_FIT_WINDOW_MS, for a recorded NMEA file ($GPRMC, $GPGGA and $GPGSA) or for a simulated
+//       flight with GPS noise written out as NMEA and read back. Jumpiness is the RMS change from fix to fix,
+//       the error (simulated flight only) is against the true rates.
+//
+// usage: ogn_sim rx [-n <packets per point>] [-s <seed>] [-b <burst probability per Manchester byte>]
+//        ogn_sim track [-n <seconds of flight>] [-s <seed>]
+//        ogn_sim nmea [-n <seconds of flight>] [-r <fixes per second>] [-s <seed>] [<NMEA file>]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ogn_host.h"
+#include "manchester.h"
+#include "ogn_lib.h"
+
+static const int ManchOfs = 2;                   // packet starts two bits into a Manchester byte, as OGN_RX_MANCH_OFS
+
+// transmit the packet bytes (MSB first) as Manchester chips: 01 => 1, 10 => 0, flip chips with probability ChipErr,
+// Manchester bytes hit by a burst get the chip error probability BurstErr, return the received data and violations.
+static void Channel(uint8_t *Data, uint8_t *Err, const uint8_t *Tx, int Bytes, double ChipErr, double BurstProb, double BurstErr, HostRandom &Rnd)
+{ double Prob=ChipErr;
+  for(int Bit=0; Bit<8*Bytes; Bit++)
+  { if(((Bit+ManchOfs)&3)==0) Prob = Rnd.Uniform()<BurstProb ? BurstErr:ChipErr; // new Manchester byte
+    int Byte=Bit>>3; uint8_t Mask=0x80>>(Bit&7);
+    if((Bit&7)==0) { Data[Byte]=0; Err[Byte]=0; }
+    uint8_t One=(Tx[Byte]&Mask)!=0;
+    uint8_t Chip1=!One, Chip2=One;
+    if(Rnd.Uniform()<Prob) Chip1^=1;
+    if(Rnd.Uniform()<Prob) Chip2^=1;
+    if(Chip2) Data[Byte]|=Mask;                  // as Manch_DecTable[]: 01 => 1, 10 => 0, 00 => 0 + error, 11 => 1 + error
+    if(Chip1==Chip2) Err[Byte]|=Mask; }
+}
+
+static bool SameCode(const uint8_t *Out, const uint8_t *Ref)
+{ return memcmp(Out, Ref, 26)==0; }
+
+static int RxSweep(int Packets, uint64_t Seed, double BurstProb)
+{ HostRandom Rnd(Seed);
+  static LDPC_MinSumDecoder Decoder;
+  const double BurstErr=0.3;
+  printf("=== RX front end: %d packets per point, max. %d iterations, burst: %4.2f%% of Manchester bytes with %2.0f%% chip errors (seed=%llu) ===\n",
+         Packets, LDPC_MinSumDecoder::MaxIter, 100*BurstProb, 100*BurstErr, (unsigned long long)Seed);
+  printf(" S/N[dB] chip.err   PER:hard  PER:erasure  PER:soft\n");
+  for(int SNR=4; SNR<=14; SNR++)
+  { double ChipErr = 0.5*exp(-pow(10.0, SNR/10.0)/2);  // non-coherent FSK
+    int Fail[3] = { 0, 0, 0 };
+    for(int Pkt=0; Pkt<Packets; Pkt++)
+    { OgnPosition Pos; OGN_Packet Packet; uint8_t Tx[26], Data[26], Err[26], Zero[26], Out[26];
+      Host_RandomPosition(Pos, Rnd); Host_PreparePacket(Packet, Pos, Rnd.Next());
+      Packet.sendBytes(Tx);
+      Channel(Data, Err, Tx, 26, ChipErr, BurstProb, BurstErr, Rnd);
+      memset(Zero, 0, sizeof(Zero));
+      Decoder.Input(Data, Zero); Decoder.Decode(); Decoder.Output(Out);      // hard bits: violations ignored
+      if(!SameCode(Out, Tx)) Fail[0]++;
+      Decoder.Input(Data, Err); Decoder.Decode(); Decoder.Output(Out);       // violations as erasures
+      if(!SameCode(Out, Tx)) Fail[1]++;
+      int8_t Soft[208];                                                        // soft bits, RSSI-NoiseFloor = the simulated S/N
+      int8_t Ampl=Manch_SoftAmpl(Err, 26, SNR);
+      Manch_SoftBits(Soft, Data, Err, 26, ManchOfs, Ampl);
+      Decoder.Input(Soft); Decoder.Decode(); Decoder.Output(Out);
+      if(!SameCode(Out, Tx)) Fail[2]++; }
+    printf("  %3d     %6.4f    %7.4f   %7.4f      %7.4f\n", SNR, ChipErr,
+           (double)Fail[0]/Packets, (double)Fail[1]/Packets, (double)Fail[2]/Packets); }
+  return 0; }
+
+class SimFlight                  // true track: 1 ms steps, 1 arc minute = 1852 m as for the OGN position units
+{ public:
+   double Lat, Lon, Alt;         // [0.0001/60 deg] [0.0001/60 deg] [m]
+   double Heading, Speed;        // [deg] [m/s]
+   double Turn, Climb;           // [deg/s] [m/s]
+
+  public:
+   void Step(double Dt)
+   { const double Unit=0.1852;   // [m] per 0.0001/60 deg of latitude
+     Lat+=Speed*cos(Heading*M_PI/180)*Dt/Unit;
+     Lon+=Speed*sin(Heading*M_PI/180)*Dt/(Unit*cos(Lat*M_PI/(180*600000)));
+     Alt+=Climb*Dt;
+     Heading=fmod(Heading+Turn*Dt+360, 360); }
+
+   void NewLeg(HostRandom &Rnd)  // every 30 sec: a straight leg or a circle in a thermal
+   { if(Rnd.Uniform()<0.5) { Speed=25+25*Rnd.Uniform(); Turn=0; Climb=-1.5+Rnd.Uniform(); }
+                      else { Speed=22+6*Rnd.Uniform(); Turn=(Rnd.Uniform()<0.5 ? -1:1)*(12+10*Rnd.Uniform()); Climb=0.5+3*Rnd.Uniform(); } }
+
+   void getFix(OgnPosition &Pos, int Time) const // what the GPS reports at Time [ms]: NMEA resolution
+   { Pos.Clear(); Pos.FixQuality=1; Pos.FixMode=3; Pos.Satellites=8; Pos.PDOP=15; Pos.HDOP=10; Pos.VDOP=12; Pos.Flags=0x01;
+     Pos.Hour=(Time/3600000)%24; Pos.Min=(Time/60000)%60; Pos.Sec=(Time/1000)%60; Pos.FracSec=(Time%1000)/10;
+     Pos.Latitude=lround(Lat); Pos.Longitude=lround(Lon); Pos.Altitude=lround(10*Alt);
+     Pos.Speed=lround(Speed/0.0514444); Pos.Heading=lround(10*Heading)%3600; }
+
+   double Error(const OGN_Packet &Packet) const   // [m] horizontal distance of the decoded packet position
+   { double North=(Packet.DecodeLatitude()-Lat)*0.1852;
+     double East=(Packet.DecodeLongitude()-Lon)*0.1852*cos(Lat*M_PI/(180*600000));
+     return sqrt(North*North+East*East); }
+} ;
+
+class SimError
+{ public:
+   int Count; double Sum, Max;
+   SimError() { Count=0; Sum=0; Max=0; }
+   void Add(double Err) { Count++; Sum+=Err; if(Err>Max) Max=Err; }
+   void Print(void) const { printf("  %6.1f %6.1f", Count ? Sum/Count:0.0, Max); }
+} ;
+
+static int TrackSim(int Seconds, uint64_t Seed)
+{ HostRandom Rnd(Seed); SimFlight Acft;
+  Acft.Lat=46.5*600000; Acft.Lon=7.5*600000; Acft.Alt=1500; Acft.Heading=0; Acft.NewLeg(Rnd);
+  OgnPosition Fix[4];                                     // fix of the second Sec is Fix[Sec&3]
+  SimError Err[2][3];                                     // [straight/circling][950 ms fix/latest fix/extrapolated]
+  int TxTime[4], TxCycle[4], TxCount=0;                   // pending transmissions: the second slot runs into the next second
+  printf("=== position error [m] at the transmit time: %d seconds of flight (seed=%llu) ===\n", Seconds, (unsigned long long)Seed);
+  for(int Time=0; Time<Seconds*1000; Time++)
+  { int Sec=Time/1000;
+    if(Time%1000==0)                                      // PPS
+    { if(Sec%30==0) Acft.NewLeg(Rnd);
+      OgnPosition &Pos=Fix[Sec&3]; Acft.getFix(Pos, Time);
+      if(Sec>=2) Pos.calcDifferences(Fix[(Sec-2)&3]);     // two fixes back, as OGN_Update_Position()
+      if(Sec>=2)                                          // the two LBT slots of this HPT cycle
+      { TxTime[TxCount]=Time+Rnd.Range(400, 779);  TxCycle[TxCount++]=Sec;
+        TxTime[TxCount]=Time+Rnd.Range(800, 1179); TxCycle[TxCount++]=Sec; } }
+    for(int Tx=0; Tx<TxCount; )
+    { if(TxTime[Tx]!=Time) { Tx++; continue; }
+      int Cycle=TxCycle[Tx];
+      const OgnPosition &Latest=Fix[Cycle&3];            // the GPS sends the fix well before 400 ms
+      const OgnPosition &Old=Fix[(Cycle-1)&3];           // prepared at 950 ms of the previous cycle
+      int Circling=Acft.Turn!=0;
+      OGN_Packet Pkt; Pkt.Header=0;
+      Old.Encode(Pkt);    Err[Circling][0].Add(Acft.Error(Pkt));
+      Latest.Encode(Pkt); Err[Circling][1].Add(Acft.Error(Pkt));
+      Latest.EncodePredicted(Pkt, Time-Cycle*1000); Err[Circling][2].Add(Acft.Error(Pkt));
+      TxCount--; TxTime[Tx]=TxTime[TxCount]; TxCycle[Tx]=TxCycle[TxCount]; }
+    Acft.Step(0.001); }
+  printf("            950ms fix      latest fix     extrapolated\n");
+  printf("            mean    max    mean    max    mean    max\n");
+  const char *Name[2] = { "straight", "circling" };
+  for(int Circling=0; Circling<2; Circling++)
+  { printf("%-10s", Name[Circling]);
+    for(int Mode=0; Mode<3; Mode++) Err[Circling][Mode].Print();
+    printf("   (%d packets)\n", Err[Circling][0].Count); }
+  return 0; }
+
+class SimRate                    // climb or turn rate series: jumpiness and the error against the truth
+{ public:
+   int Count; double Step2, Err2, ErrMax, Prev;
+   SimRate() { Count=0; Step2=0; Err2=0; ErrMax=0; Prev=0; }
+   void Add(double Rate, double True)
+   { if(Count) Step2+=(Rate-Prev)*(Rate-Prev);
+     Err2+=(Rate-True)*(Rate-True); if(fabs(Rate-True)>ErrMax) ErrMax=fabs(Rate-True);
+     Prev=Rate; Count++; }
+   void Print(bool Truth) const
+   { printf("   %6.2f", Count>1 ? sqrt(Step2/(Count-1)):0.0);
+     if(Truth) printf("  %6.2f %6.2f", Count ? sqrt(Err2/Count):0.0, ErrMax);
+          else printf("               "); }
+} ;
+
+static int NmeaReplay(const char *FileName, int Seconds, int Rate, uint64_t Seed)
+{ char **Line=0; int Lines=0; double *True=0;    // the NMEA, for a simulated flight the true climb, turn and speed of each line
+  if(FileName)
+  { FILE *File=fopen(FileName, "r"); if(File==0) { perror(FileName); return 1; }
+    char Buf[128];
+    while(fgets(Buf, sizeof(Buf), File))
+    { Line=(char **)realloc(Line, (Lines+1)*sizeof(char *)); Line[Lines++]=strdup(Buf); }
+    fclose(File); }
+  else
+  { HostRandom Rnd(Seed); SimFlight Acft;
+    Acft.Lat=46.5*600000; Acft.Lon=7.5*600000; Acft.Alt=1500; Acft.Heading=0; Acft.NewLeg(Rnd);
+    int Fixes=Seconds*Rate, Period=1000/Rate;
+    Line=(char **)malloc(3*Fixes*sizeof(char *)); True=(double *)malloc(3*Fixes*3*sizeof(double));
+    for(int Time=0; Time<Seconds*1000; Time++)
+    { if(Time%30000==0) Acft.NewLeg(Rnd);
+      if(Time%Period==0)
+      { OgnPosition Pos; Acft.getFix(Pos, Time);
+        Pos.Altitude+=lround(7*Rnd.Gauss());              // GPS noise: 0.7 m vertical, 0.5 m horizontal, 1 deg track, 0.1 m/s speed
+        Pos.Latitude+=lround(2.7*Rnd.Gauss()); Pos.Longitude+=lround(3.9*Rnd.Gauss());
+        Pos.Heading=(Pos.Heading+lround(10*Rnd.Gauss())+3600)%3600; Pos.Speed+=lround(2*Rnd.Gauss());
+        char Buf[128];
+        for(int Sent=0; Sent<3; Sent++)                  // RMC, GGA then GSA, as u-blox receivers send them
+        { if(Sent==0) Host_FormatRMC(Buf, Pos); else if(Sent==1) Host_FormatGGA(Buf, Pos); else Host_FormatGSA(Buf, Pos);
+          True[3*Lines]=10*Acft.Climb; True[3*Lines+1]=10*Acft.Turn; True[3*Lines+2]=Acft.Speed/0.0514444;
+          Line[Lines++]=strdup(Buf); } }
+      Acft.Step(0.001); }
+  }
+  OgnPosition Ring[4]; int Ptr=0, Stale=0;              // as ogn_lib.cpp did: four fixes, differences to two fixes back
+  static OgnPosHistory<OGN_POS_HISTORY> Hist(OGN_FIT_WINDOW_MS);
+  SimRate Climb[2], Turn[2], Speed[2]; int Fixes=0;
+  for(int Idx=0; Idx<Lines; Idx++)
+  { double TrueClimb = True ? True[3*Idx]:0, TrueTurn = True ? True[3*Idx+1]:0, TrueSpeed = True ? True[3*Idx+2]:0;
+    int Ret=Ring[Ptr].ReadNMEA(Line[Idx]);
+    if(Ret>0 && Ring[Ptr].isComplete() && Ring[Ptr].isValid())
+    { int Prev=(Ptr+2)&3; if(!Ring[Prev].isValid()) Prev=(Ptr+3)&3;
+      int Last=(Ptr+3)&3;
+      if(Ring[Last].isValid() && Ring[Ptr].getDayTime_ms()<=Ring[Last].getDayTime_ms()) Stale++; // a reused slot completed by a GSA: a fix of 4 back sent again
+      else
+      { Ring[Ptr].calcDifferences(Ring[Prev]);
+        Climb[0].Add(0.1*Ring[Ptr].ClimbRate, 0.1*TrueClimb); Turn[0].Add(0.1*Ring[Ptr].TurnRate, 0.1*TrueTurn);
+        Speed[0].Add(0.1*Ring[Ptr].Speed, 0.1*TrueSpeed); }
+      Ptr=(Ptr+1)&3; }
+    Ret=Hist.Head().ReadNMEA(Line[Idx]);
+    if(Ret>0 && Hist.Head().isComplete() && Hist.Head().isValid())
+    { Hist.Commit(); Fixes++;
+      Climb[1].Add(0.1*Hist.Last().ClimbRate, 0.1*TrueClimb); Turn[1].Add(0.1*Hist.Last().TurnRate, 0.1*TrueTurn);
+      Speed[1].Add(0.1*Hist.getGroundSpeed(), 0.1*TrueSpeed); }
+    free(Line[Idx]); }
+  free(Line);
+  if(FileName) printf("=== NMEA replay of %s: %d fixes ===\n", FileName, Fixes);
+          else printf("=== NMEA replay of a simulated flight: %d fixes at %d Hz (seed=%llu) ===\n", Fixes, Rate, (unsigned long long)Seed);
+  bool Truth=True!=0;
+  printf("                      climb [m/s]             turn [deg/s]            speed [knot]\n");
+  printf("                      jumpy  err.rms err.max  jumpy  err.rms err.max  jumpy  err.rms err.max\n");
+  printf("two fixes (GPS speed)"); Climb[0].Print(Truth); Turn[0].Print(Truth); Speed[0].Print(Truth); printf("\n");
+  if(Stale) printf("two fixes: %d stale fixes (a GSA after the GGA completes the reused slot) left out\n", Stale);
+  printf("least squares %4dms ", OGN_FIT_WINDOW_MS); Climb[1].Print(Truth); Turn[1].Print(Truth); Speed[1].Print(Truth); printf("\n");
+  free(True);
+  return 0; }
+
+int main(int argc, char *argv[])
+{ int Packets=2000; uint64_t Seed=1; double BurstProb=0.02; int Rate=1; const char *Mode=0, *File=0;
+  for(int Arg=1; Arg<argc; Arg++)
+  {      if(strcmp(argv[Arg], "-n")==0 && Arg+1<argc) Packets=atoi(argv[++Arg]);
+    else if(strcmp(argv[Arg], "-s")==0 && Arg+1<argc) Seed=strtoull(argv[++Arg], 0, 0);
+    else if(strcmp(argv[Arg], "-b")==0 && Arg+1<argc) BurstProb=atof(argv[++Arg]);
+    else if(strcmp(argv[Arg], "-r")==0 && Arg+1<argc) Rate=atoi(argv[++Arg]);
+    else if(Mode==0) Mode=argv[Arg];
+    else File=argv[Arg]; }
+
+  if(Mode && strcmp(Mode, "nmea")==0)
+    return NmeaReplay(File, Packets, Rate<1 ? 1:Rate>10 ? 10:Rate, Seed);
+
+  if(Mode && strcmp(Mode, "track")==0)
+    return TrackSim(Packets, Seed);
+
+  if(Mode && strcmp(Mode, "rx")==0)
+  { RxSweep(Packets, Seed, 0.0);
+    return RxSweep(Packets, Seed, BurstProb); }
+
+  fprintf(stderr, "usage: %s rx [-n <packets>] [-s <seed>] [-b <burst probability>]\n"
+                  "       %s track [-n <seconds>] [-s <seed>]\n"
+                  "       %s nmea [-n <seconds>] [-r <fixes per second>] [-s <seed>] [<NMEA file>]\n", argv[0], argv[0], argv[0]);
+  return 1; }
@@ -0,0 +1,147 @@
+/**
+  ************************************
+  * @file    hpt_pll.h
+  * @author
+  * @brief   Phase lock of the HPT table cycle to the GPS PPS
+  ************************************
+  */
+
+#ifndef __HPT_PLL_H
+#define __HPT_PLL_H
+
+#include <stdint.h>
+#include "clock.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------- defines -------- */
+#define HPT_PLL_TICK_CNT   (CLOCK_TIMER_HZ/1000) /* timer counts per RTOS tick: both count the same crystal        */
+#define HPT_PLL_RESYNC_US  20000       /* [us] phase error beyond this: the table restarts at the PPS edge     */
+#define HPT_PLL_LOCK_US    1500        /* [us] within this for HPT_PLL_LOCK_COUNT seconds in a row: locked     */
+#define HPT_PLL_LOCK_COUNT 4
+#define HPT_PLL_GAIN       1           /* every second 1/2^1 of the phase error goes into the restart interval */
+#define HPT_PLL_LOST       3           /* that many cycles without PPS: holdover on the measured timer rate    */
+#define HPT_PLL_MAX_TRIM   10          /* [ticks] restart interval change per cycle: the tables leave 75 ms    */
+
+/* The PPS interrupt measures where the edge falls against the start of the table cycle: the phase       */
+/* error. Once per cycle, when the timer task schedules the interval that ends in HPT_RESTART, the loop  */
+/* lengthens or shortens it by whole ticks: the timer rate error measured by clock.c (the RTOS tick runs */
+/* on the same crystal) plus a part of the phase error. What is less than a tick is carried over, thus   */
+/* the cycle averages to the GPS second. Without PPS the rate term alone keeps the tables in the slots.  */
+/* The hardware timer backend (HPT_HW_TIMER) needs no loop: it starts every cycle on the PPS grid that   */
+/* clock.c keeps and times the events in timer counts, see hpt_pps_grid() and hpt_ms_to_cnt().         */
+
+typedef enum
+{
+   HPT_PLL_FREE = 0,                   /* no PPS yet: the table cycle runs on the MCU crystal */
+   HPT_PLL_ACQUIRE,                    /* PPS seen, phase error not yet small enough          */
+   HPT_PLL_LOCKED,
+   HPT_PLL_HOLDOVER                    /* PPS lost: trimmed by the last measured timer rate   */
+} hpt_pll_state_t;
+
+typedef struct                         /* loop state: the timer task only */
+{
+   int32_t  acc;                       /* [timer counts] correction not yet applied as whole ticks */
+   int32_t  err;                       /* [timer counts] last phase error: PPS after the cycle start is positive */
+   int32_t  drift;                     /* [timer counts per second] timer rate error used for the trim */
+   uint8_t  state;                     /* hpt_pll_state_t */
+   uint8_t  good;                      /* phase errors within HPT_PLL_LOCK_US in a row */
+   uint8_t  lost;                      /* cycles without a phase measurement */
+} hpt_pll_t;
+
+typedef struct
+{
+   uint32_t pps;                       /* phase measurements */
+   uint32_t resyncs;                   /* table restarted at the PPS edge: first edge or phase error too large */
+   uint32_t locks;                     /* times the lock was reached */
+   uint32_t holdover;                  /* cycles trimmed without PPS */
+   int32_t  max_err;                   /* [us] largest |phase error| while locked */
+   int16_t  trim_last;                 /* [ticks] last restart interval change */
+} hpt_pll_stats_t;
+
+/* -------- the arithmetic: no hardware, shared with the host tests -------- */
+
+/**
+  * @brief  Phase error of a PPS edge: against the nearer of this cycle's start and the next one's.
+  * @param  timer counts from this cycle's start to the edge (may be a little negative), timer counts in this cycle
+  * @retval [timer counts] positive - the edge came after the cycle start
+  */
+static inline int32_t hpt_pll_phase(uint32_t since, uint32_t cycle)
+{
+   int32_t err = (int32_t)since%(int32_t)cycle;
+   if (err > (int32_t)cycle/2) err -= cycle;
+   else if (err < -(int32_t)cycle/2) err += cycle;
+   return err;
+}
+
+/**
+  * @brief  One loop step: once per table cycle, when the interval ending in HPT_RESTART is scheduled.
+  * @param  pll, a phase error was measured this cycle, the phase error, timer rate error, statistics
+  * @retval [ticks] to add to the interval that ends in HPT_RESTART
+  */
+static inline int16_t hpt_pll_cycle(hpt_pll_t* pll, uint8_t measured, int32_t err, int32_t drift, hpt_pll_stats_t* stats)
+{
+   int32_t trim;
+   if (measured)
+   {
+      pll->err = err; pll->lost = 0; stats->pps++;
+      if (err < HPT_PLL_LOCK_US && err > -HPT_PLL_LOCK_US) { if (pll->good < HPT_PLL_LOCK_COUNT) pll->good++; }
+      else pll->good = 0;
+      if (pll->good >= HPT_PLL_LOCK_COUNT)
+      {
+         if (pll->state != HPT_PLL_LOCKED) stats->locks++;
+         pll->state = HPT_PLL_LOCKED;
+         if (err < 0) err = -err;
+         if (err > stats->max_err) stats->max_err = err;
+      }
+      else pll->state = HPT_PLL_ACQUIRE;
+      pll->acc += pll->err/(1<<HPT_PLL_GAIN);
+   }
+   else if (pll->state != HPT_PLL_FREE && pll->lost < HPT_PLL_LOST && ++pll->lost == HPT_PLL_LOST)
+   {
+      pll->state = HPT_PLL_HOLDOVER; pll->good = 0;
+   }
+   if (pll->state == HPT_PLL_FREE) return 0;
+   if (pll->state == HPT_PLL_HOLDOVER) stats->holdover++;
+   pll->drift = drift;
+   pll->acc += drift;
+   trim = (pll->acc + (pll->acc < 0 ? -HPT_PLL_TICK_CNT/2 : HPT_PLL_TICK_CNT/2))/HPT_PLL_TICK_CNT;
+   if (trim > HPT_PLL_MAX_TRIM) trim = HPT_PLL_MAX_TRIM;
+   if (trim < -HPT_PLL_MAX_TRIM) trim = -HPT_PLL_MAX_TRIM;
+   pll->acc -= trim*HPT_PLL_TICK_CNT;
+   stats->trim_last = trim;
+   return trim;
+}
+
+/**
+  * @brief  Table time to timer counts: at the PPS measured timer rate when there is one.
+  * @param  [ms] table time, [1/256 count] timer counts per GPS second (0 - not known)
+  * @retval [timer counts]
+  */
+static inline uint32_t hpt_ms_to_cnt(uint32_t ms, uint32_t period)
+{
+   if (period == 0) return ms*HPT_PLL_TICK_CNT;
+   return (uint32_t)(((uint64_t)ms*period + 128000)/256000);
+}
+
+/**
+  * @brief  The PPS edge nearest to a timer count: the reference edge plus whole GPS seconds.
+  * @param  ref (not older than CLOCK_HOLDOVER_S), timer count
+  * @retval timer count of that edge
+  */
+static inline uint32_t hpt_pps_grid(const clock_ref_t* ref, uint32_t cnt)
+{
+   if (ref->period == 0) return cnt;
+   int64_t d = (int64_t)(int32_t)(cnt - ref->cnt)*256;
+   int64_t n = (d + (d < 0 ? -(int64_t)ref->period/2 : (int64_t)ref->period/2))/ref->period;
+   int64_t e = n*ref->period;
+   return ref->cnt + (uint32_t)(int32_t)((e + (e < 0 ? -128 : 128))/256);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HPT_PLL_H */
@@ -12,29 +12,86 @@
 #include "messages.h"
 #include "spirit1.h"
 #include "timer_const.h"
+#include "log.h"
+#include "clock.h"
 
 /* -------- defines -------- */
 /* -------- variables -------- */
-static TimerHandle_t xHPTimer;
 static uint8_t       event_awaited;
 static HPT_Event*    current_hpt_table;
-static char          log_buf[40];
+static uint8_t       hpt_events;       /* events in the table, HPT_RESTART included */
 static char          debug_enabled = 0;
+static HPT_Jitter    hpt_jitter[HPT_MAX_EVENTS];
+static uint32_t      hpt_dropped;      /* messages not sent: the destination queue was full */
+static hpt_pll_t       pll;
+static hpt_pll_stats_t pll_stats;
+static const char* const pll_state_str[] = {
+    "HPT PPS lock: free running\r\n",
+    "HPT PPS lock: acquiring\r\n",
+    "HPT PPS lock: locked\r\n",
+    "HPT PPS lock: holdover\r\n"
+};
+
+#ifdef HPT_HW_TIMER
+/* the cycle runs in TIM5 counts: it starts on a PPS edge (clock.c reference) once there is one */
+static uint32_t      cycle_cnt;        /* timer count of this cycle's start */
+static uint32_t      cycle_period;     /* [1/256 count] timer counts per second for this cycle, 0 - nominal */
+static uint32_t      event_due;        /* timer count the awaited event is due at */
+/* no sprintf() in the interrupt: the log timestamp is the event time */
+static const char* const hpt_debug_str[] = {
+    "HPT **RSRT**\r\n",
+    "HPT GPIO_UP \r\n",
+    "HPT GPIO_DWN\r\n",
+    "HPT COPY_PKT\r\n",
+    "HPT SP1_CHAN\r\n",
+    "HPT TX_PKT  \r\n",
+    "HPT TX_LBT  \r\n",
+    "HPT IWDG_RLD\r\n"
+};
+#else
+static TimerHandle_t xHPTimer;
+static char          log_buf[56];
 static char          pps_synced = 0;
+/* phase of the table cycle: the timer task stamps the cycle start, the PPS interrupt measures against it */
+static uint32_t      cycle_cnt;        /* timer count at the latest HPT_RESTART */
+static uint32_t      cycle_len = HPT_PLL_TICK_CNT*1000; /* [timer counts] this cycle, trim included */
+static uint32_t      cycle_exact;      /* timer count of the PPS edge nearest to cycle_cnt: for the jitter */
+static uint32_t      cycle_period;     /* [1/256 count] timer counts per second, 0 - nominal: for the jitter */
+static int32_t       pps_err;          /* PPS interrupt only: latest phase error */
+static uint32_t      pps_seq;          /* PPS interrupt only: phase errors measured */
+static uint32_t      pll_seq;          /* timer task: phase errors used */
+static uint32_t      pll_resyncs;      /* timer task: resyncs seen */
+#endif
 
 const char* const hpt_opcodes_str[] = {
     "**RSRT**",
-    "GPIO_UP ",    
-    "GPIO_DWN",   
-    "PREP_PKT",  
-    "COPY_PKT",     
-    "SP1_CHAN", 
-    "TX_PKT  ",      
-    "TX_LBT  ",   
-    "IWDG_RLD"   
+    "GPIO_UP ",
+    "GPIO_DWN",
+    "COPY_PKT",
+    "SP1_CHAN",
+    "TX_PKT  ",
+    "TX_LBT  ",
+    "IWDG_RLD"
 };
 
 /* -------- interrupt handlers -------- */
+#ifdef HPT_HW_TIMER
+static void HPT_RunDue(BaseType_t* xHigherPriorityTaskWoken);
+
+/* TIM5 compare channel 1: the awaited event is due */
+void TIM5_IRQHandler(void)
+{
+   BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+   if (TIM_GetITStatus(TIM5, TIM_IT_CC1) != RESET)
+   {
+      TIM_ClearITPendingBit(TIM5, TIM_IT_CC1);
+      HPT_RunDue(&xHigherPriorityTaskWoken);
+   }
+   portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+#endif
+
 /* -------- functions -------- */
 /**
 * @brief  Control HPT logging.
@@ -47,45 +104,350 @@ void HPT_Debug(uint8_t state)
 }
 
 /**
-* @brief  Restart the current HPT table called from ISR.
+* @brief  Sorts the table by time, keeping the order of events at the same time.
+* @param  HPT Events table, ended by HPT_RESTART
+* @retval number of events, HPT_RESTART included
+*/
+static uint8_t HPT_Sort(HPT_Event* hpt_table)
+{
+    uint8_t   events, i, j;
+    HPT_Event event;
+
+    for (events = 1; events < HPT_MAX_EVENTS && hpt_table[events-1].opcode != HPT_RESTART; events++);
+    for (i = 1; i < events; i++)
+    {
+        event = hpt_table[i];
+        for (j = i; j > 0 && hpt_table[j-1].time > event.time; j--) hpt_table[j] = hpt_table[j-1];
+        hpt_table[j] = event;
+    }
+    return events;
+}
+
+/**
+* @brief  Records how late an event ran.
+* @param  event index, [us] late against the exact time
+* @retval None
+*/
+static void HPT_AddJitter(uint8_t idx, int32_t late)
+{
+    HPT_Jitter* jitter = &hpt_jitter[idx];
+
+    if (jitter->count == 0 || late < jitter->min) jitter->min = late;
+    if (jitter->count == 0 || late > jitter->max) jitter->max = late;
+    jitter->last = late;
+    jitter->count++;
+}
+
+/**
+* @brief  Sends an event message to a task, never waits.
+* @param  destination queue, message, task woken flag (interrupt only)
+* @retval None
+*/
+static void HPT_Send(xQueueHandle* dest_queue, task_message* msg, BaseType_t* xHigherPriorityTaskWoken)
+{
+#ifdef HPT_HW_TIMER
+    if (xQueueSendFromISR(*dest_queue, msg, xHigherPriorityTaskWoken) != pdPASS) hpt_dropped++;
+#else
+    /* waiting here would stop the timer task: all the software timers */
+    if (xQueueSend(*dest_queue, msg, 0) != pdPASS) hpt_dropped++;
+#endif
+}
+
+/**
+* @brief  Performs the event action.
+* @param  event opcode, event data, task woken flag (interrupt only)
+* @retval None
+*/
+static void HPT_Dispatch(hpt_opcodes opcode, uint32_t data1, BaseType_t* xHigherPriorityTaskWoken)
+{
+    task_message ctrl_msg;
+
+    ctrl_msg.msg_len = 0;
+    ctrl_msg.src_id  = HPT_SRC_ID;
+    switch (opcode)
+    {
+        case HPT_RESTART:
+            break;
+
+        case HPT_GPIO_UP:
+            //GPIO_SetBits(...);
+            break;
+
+        case HPT_GPIO_DOWN:
+            //GPIO_ResetBits(...);
+            break;
+
+        case HPT_COPY_PKT:
+            ctrl_msg.msg_data   = 0;
+            ctrl_msg.msg_opcode = HPT_COPY_PKT;
+            HPT_Send(Get_ControlQueue(), &ctrl_msg, xHigherPriorityTaskWoken);
+            break;
+
+        case HPT_SP1_CHANNEL:
+            ctrl_msg.msg_data   = data1;
+            ctrl_msg.msg_opcode = SP1_CHG_CHANNEL;
+            HPT_Send(Get_SP1Queue(), &ctrl_msg, xHigherPriorityTaskWoken);
+            break;
+
+        case HPT_TX_PKT:
+            ctrl_msg.msg_data   = 0;
+            ctrl_msg.msg_opcode = SP1_TX_PACKET;
+            HPT_Send(Get_SP1Queue(), &ctrl_msg, xHigherPriorityTaskWoken);
+            break;
+
+        case HPT_TX_PKT_LBT:
+            ctrl_msg.msg_data   = data1;
+            ctrl_msg.msg_opcode = SP1_TX_PACKET_LBT;
+            HPT_Send(Get_SP1Queue(), &ctrl_msg, xHigherPriorityTaskWoken);
+            break;
+
+        case HPT_IWDG_RELOAD:
+            IWDG_ReloadCounter();
+            break;
+
+        default:
+            break;
+    }
+}
+
+#ifdef HPT_HW_TIMER
+/**
+* @brief  Start of the next cycle: the PPS edge nearest to the end of this one.
+* @param  timer count this cycle ends at
+* @retval None
+*/
+static void HPT_NextCycle(uint32_t end)
+{
+    clock_ref_t ref;
+    uint32_t    age;
+    uint8_t     state = HPT_PLL_FREE;
+    int32_t     err = 0;
+
+    Clock_GetRef(&ref);
+    age = xTaskGetTickCountFromISR()*portTICK_PERIOD_MS - ref.tick;
+    cycle_cnt = end;
+    if (ref.period && age <= CLOCK_HOLDOVER_S*1000)
+    {
+        cycle_cnt = hpt_pps_grid(&ref, end);
+        /* far back: the table was not aligned yet, the next edge rather than events in the past */
+        if ((int32_t)(cycle_cnt - end) < -HPT_PLL_RESYNC_US) cycle_cnt += hpt_ms_to_cnt(1000, ref.period);
+        err = (int32_t)(cycle_cnt - end);
+        if (ref.rated) cycle_period = ref.period;
+        state = age < CLOCK_LOCK_MS ? HPT_PLL_LOCKED : HPT_PLL_HOLDOVER;
+    }
+    /* no PPS for too long: free running, on the last measured rate */
+    pll.err   = err;
+    pll.drift = cycle_period ? (int32_t)(cycle_period - CLOCK_TIMER_HZ*256)/256 : 0;
+    pll_stats.trim_last = err/HPT_PLL_TICK_CNT;
+    if (err > HPT_PLL_RESYNC_US || err < -HPT_PLL_RESYNC_US)
+    {
+        pll_stats.resyncs++;
+        Log_SendTime("HPTimer synced to PPS\r\n");
+    }
+    else if (state == HPT_PLL_LOCKED)
+    {
+        pll_stats.pps++;
+        if (err < 0) err = -err;
+        if (err > pll_stats.max_err) pll_stats.max_err = err;
+    }
+    if (state == HPT_PLL_HOLDOVER) pll_stats.holdover++;
+    if (state != pll.state)
+    {
+        if (state == HPT_PLL_LOCKED) pll_stats.locks++;
+        pll.state = state;
+        Log_SendTime(pll_state_str[state]);
+    }
+}
+
+/**
+* @brief  Runs every event due by now, from the TIM5 compare interrupt.
+* @param  task woken flag
+* @retval None
+*/
+static void HPT_RunDue(BaseType_t* xHigherPriorityTaskWoken)
+{
+    uint32_t    now = TIM5->CNT;
+    uint8_t     curr_event_idx;
+    hpt_opcodes curr_event_opcode;
+
+    /* a late event and the events at the same time run together: a compare value set */
+    /* after the counter passed it would only match again after the wrap              */
+    while (current_hpt_table && (int32_t)(now - event_due) >= 0)
+    {
+        curr_event_idx    = event_awaited;
+        curr_event_opcode = current_hpt_table[curr_event_idx].opcode;
+        HPT_AddJitter(curr_event_idx, (int32_t)(now - event_due));
+        if (curr_event_opcode == HPT_RESTART)
+        {
+            HPT_NextCycle(event_due);
+            event_awaited = 0;
+        }
+        else
+        {
+            HPT_Dispatch(curr_event_opcode, current_hpt_table[curr_event_idx].data1, xHigherPriorityTaskWoken);
+            event_awaited++;
+        }
+        if (debug_enabled) Log_SendTime(hpt_debug_str[curr_event_opcode]);
+        event_due = cycle_cnt + hpt_ms_to_cnt(current_hpt_table[event_awaited].time, cycle_period);
+        TIM_SetCompare1(TIM5, event_due);
+        now = TIM5->CNT;
+    }
+}
+
+/**
+* @brief  GPS PPS edge, called from ISR: nothing to do, every cycle starts on the clock.c PPS edges.
+* @param  None
+* @retval None
+*/
+BaseType_t HPT_RestartFromISR(void)
+{
+    return pdFALSE;
+}
+
+/**
+* @brief  Starts the High Precision Timer.
+* @param  HPT Events table
+* @retval None
+*/
+void HPT_Start(HPT_Event* hpt_table)
+{
+   TIM_ITConfig(TIM5, TIM_IT_CC1, DISABLE);
+   hpt_events = HPT_Sort(hpt_table);
+   current_hpt_table = hpt_table;
+   /* the first cycle from now: the next one moves to the PPS edges */
+   cycle_cnt = Clock_Count();
+   event_awaited = 0;
+   event_due = cycle_cnt + hpt_ms_to_cnt(hpt_table[0].time, cycle_period);
+   TIM_SetCompare1(TIM5, event_due);
+   TIM_ClearITPendingBit(TIM5, TIM_IT_CC1);
+   TIM_ITConfig(TIM5, TIM_IT_CC1, ENABLE);
+}
+
+/**
+* @brief  Configures the High Precision Timer: compare channel 1 of the free-running clock.c timer.
+* @param  None
+* @retval None
+*/
+void HPT_Config(void)
+{
+    TIM_OCInitTypeDef TIM_OCInitStructure;
+    NVIC_InitTypeDef  NVIC_InitStructure;
+
+    /* TIM5 runs already: Clock_Config() */
+    TIM_OCStructInit(&TIM_OCInitStructure);
+    /* no output pin, the compare interrupt only */
+    TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_Timing;
+    TIM_OC1Init(TIM5, &TIM_OCInitStructure);
+    /* a new compare value applies at once, not at the (71 minutes away) update event */
+    TIM_OC1PreloadConfig(TIM5, TIM_OCPreload_Disable);
+
+    NVIC_InitStructure.NVIC_IRQChannel = TIM5_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = configHPT_TIMER_INTERRUPT_PRIORITY;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+}
+
+#else
+/**
+* @brief  GPS PPS edge, called from ISR: measures the table cycle phase, restarts the table if it is far off.
 * @param  None
 * @retval None
 */
 BaseType_t HPT_RestartFromISR(void)
 {
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    
-    if (!pps_synced && current_hpt_table)
+    uint32_t now = Clock_Count();
+    int32_t err;
+
+    if (!current_hpt_table) return xHigherPriorityTaskWoken;
+    err = hpt_pll_phase(now - cycle_cnt, cycle_len);
+    if (!pps_synced || err > HPT_PLL_RESYNC_US || err < -HPT_PLL_RESYNC_US)
     {
        xTimerChangePeriodFromISR(xHPTimer, current_hpt_table[0].time, &xHigherPriorityTaskWoken);
        /* mark information about event number that is awaited*/
        event_awaited = 0;
+       cycle_cnt = now;
+       cycle_exact = now;
+       err = 0;
        pps_synced = 1;
-       Console_Send("HPTimer synced to PPS\r\n", 0);
+       pll_stats.resyncs++;
+       Log_SendTime("HPTimer synced to PPS\r\n");
     }
+    pps_err = err;
+    __atomic_store_n(&pps_seq, pps_seq+1, __ATOMIC_RELEASE);
     return xHigherPriorityTaskWoken;
 }
 
+/**
+* @brief  Phase lock step: the change of the interval that ends in HPT_RESTART, once per cycle.
+* @param  [ticks] cycle length from the table
+* @retval [ticks] to add to the interval
+*/
+static int16_t HPT_PllTrim(uint32_t cycle_ticks)
+{
+    clock_ref_t ref;
+    uint32_t    seq = __atomic_load_n(&pps_seq, __ATOMIC_ACQUIRE);
+    int32_t     err = pps_err;
+    uint8_t     prev_state = pll.state;
+    int16_t     trim;
+
+    if (pll_stats.resyncs != pll_resyncs)
+    {
+        /* the table was restarted at the PPS edge: what was carried over no longer applies */
+        pll_resyncs = pll_stats.resyncs;
+        pll.acc  = 0;
+        pll.good = 0;
+    }
+    /* the tick counts the same crystal as the timer: its rate error against the PPS is the tick's */
+    Clock_GetRef(&ref);
+    trim = hpt_pll_cycle(&pll, seq != pll_seq, err, ref.rated ? (int32_t)(ref.period - CLOCK_TIMER_HZ*256)/256 : 0, &pll_stats);
+    pll_seq = seq;
+    cycle_len = (cycle_ticks + trim)*HPT_PLL_TICK_CNT;
+    if (pll.state != prev_state) Log_SendTime(pll_state_str[pll.state]);
+    return trim;
+}
+
+/**
+* @brief  Where the cycle starting now should have started: the nearest PPS edge, for the jitter.
+* @param  timer count now
+* @retval None
+*/
+static void HPT_ExactStart(uint32_t now)
+{
+    clock_ref_t ref;
+    uint32_t    age;
+
+    Clock_GetRef(&ref);
+    age = xTaskGetTickCountFromISR()*portTICK_PERIOD_MS - ref.tick;
+    cycle_exact = now;
+    if (pps_synced && ref.period && age <= CLOCK_HOLDOVER_S*1000) cycle_exact = hpt_pps_grid(&ref, now);
+    cycle_period = ref.rated ? ref.period : 0;
+}
 
 /**
 * @brief  High Precision Timer Callback.
-* @param  Timer handle 
+* @param  Timer handle
 * @retval None
 */
 void vHPTimerCallback(TimerHandle_t pxTimer)
 {
-    xQueueHandle* dest_queue;
-    task_message  ctrl_msg;
-    uint32_t      curr_event_idx, curr_event_data1, current_time, wait_time;
+    uint32_t      curr_event_idx, curr_event_data1, current_time, wait_time, now;
+    int32_t       late;
     hpt_opcodes   curr_event_opcode;
-       
+
+    now               = Clock_Count();
     curr_event_idx    = event_awaited;
     curr_event_opcode = current_hpt_table[curr_event_idx].opcode;
     curr_event_data1  = current_hpt_table[curr_event_idx].data1;
-   
+    late = (int32_t)(now - cycle_exact - hpt_ms_to_cnt(current_hpt_table[curr_event_idx].time, cycle_period));
+    HPT_AddJitter(curr_event_idx, late);
+
     if (curr_event_opcode == HPT_RESTART)
     {
-        current_time = 0; 
+        cycle_cnt = now;
+        HPT_ExactStart(now);
+        current_time = 0;
         /* get first event from table */
         event_awaited = 0;
     }
@@ -95,89 +457,31 @@ void vHPTimerCallback(TimerHandle_t pxTimer)
         /* get next event from table */
         event_awaited++;
     }
-    /* calculate number of ticks to wait until next event */   
+    /* calculate number of ticks to wait until next event */
     wait_time = current_hpt_table[event_awaited].time - current_time;
-   
+    /* the cycle ends here: keep it in phase with the PPS */
+    if (current_hpt_table[event_awaited].opcode == HPT_RESTART)
+    {
+        wait_time += HPT_PllTrim(current_hpt_table[event_awaited].time);
+    }
+
     xTimerChangePeriod(xHPTimer, wait_time, 0);
     /* start the timer */
     xTimerStart(xHPTimer, 0);
 
     /* perform event action */
-    switch (curr_event_opcode)
-    {       
-        case HPT_RESTART:
-            break;
-            
-        case HPT_GPIO_UP:
-            //GPIO_SetBits(...);
-            break;
-            
-        case HPT_GPIO_DOWN:
-            //GPIO_ResetBits(...);
-            break;
-            
-        case HPT_PREPARE_PKT:            
-            dest_queue = Get_ControlQueue();
-            ctrl_msg.msg_data   = 0;
-            ctrl_msg.msg_len    = 0;
-            ctrl_msg.msg_opcode = HPT_PREPARE_PKT;
-            ctrl_msg.src_id     = HPT_SRC_ID;
-            xQueueSend(*dest_queue, &ctrl_msg, portMAX_DELAY);
-            break;
-            
-        case HPT_COPY_PKT:            
-            dest_queue = Get_ControlQueue();
-            ctrl_msg.msg_data   = 0;
-            ctrl_msg.msg_len    = 0;
-            ctrl_msg.msg_opcode = HPT_COPY_PKT;
-            ctrl_msg.src_id     = HPT_SRC_ID;
-            xQueueSend(*dest_queue, &ctrl_msg, portMAX_DELAY);
-            break;
-            
-        case HPT_SP1_CHANNEL:            
-            dest_queue = Get_SP1Queue();
-            ctrl_msg.msg_data   = curr_event_data1;
-            ctrl_msg.msg_len    = 0;
-            ctrl_msg.msg_opcode = SP1_CHG_CHANNEL;
-            ctrl_msg.src_id     = HPT_SRC_ID;
-            xQueueSend(*dest_queue, &ctrl_msg, portMAX_DELAY);
-            break;
-        
-        case HPT_TX_PKT:            
-            dest_queue = Get_SP1Queue();
-            ctrl_msg.msg_data   = 0;
-            ctrl_msg.msg_len    = 0;
-            ctrl_msg.msg_opcode = SP1_TX_PACKET;
-            ctrl_msg.src_id     = HPT_SRC_ID;
-            xQueueSend(*dest_queue, &ctrl_msg, portMAX_DELAY);
-            break;
-            
-        case HPT_TX_PKT_LBT:            
-            dest_queue = Get_SP1Queue();
-            ctrl_msg.msg_data   = curr_event_data1;
-            ctrl_msg.msg_len    = 0;
-            ctrl_msg.msg_opcode = SP1_TX_PACKET_LBT;
-            ctrl_msg.src_id     = HPT_SRC_ID;
-            xQueueSend(*dest_queue, &ctrl_msg, portMAX_DELAY);
-            break;
-            
-        case HPT_IWDG_RELOAD:            
-            IWDG_ReloadCounter();
-            break;
-            
-        default:
-            break;
-    }
-    
+    HPT_Dispatch(curr_event_opcode, curr_event_data1, NULL);
+
     if (debug_enabled)
     {
-        sprintf(log_buf, "%d(%s[%4d]), (%d)->%d \r\n", 
+        sprintf(log_buf, "%d(%s[%4d]), (%d)->%d, late %ld us\r\n",
             (int)curr_event_idx,
             hpt_opcodes_str[curr_event_opcode],
             (int)curr_event_data1,
             (int)wait_time,
-            (int)event_awaited);
-        Console_Send(log_buf, 1);
+            (int)event_awaited,
+            late);
+        Log_SendTime(log_buf);
     }
 }
 
@@ -188,7 +492,12 @@ void vHPTimerCallback(TimerHandle_t pxTimer)
 */
 void HPT_Start(HPT_Event* hpt_table)
 {
+   hpt_events = HPT_Sort(hpt_table);
    current_hpt_table = hpt_table;
+   /* a new table starts out of phase with the PPS */
+   pps_synced = 0;
+   cycle_cnt = Clock_Count();
+   cycle_exact = cycle_cnt;
    /* set timer expiration to first event in table */
    xTimerChangePeriod(xHPTimer, hpt_table[0].time, 0);
    /* mark information about event number that is awaited*/
@@ -216,3 +525,57 @@ void HPT_Config(void)
       vHPTimerCallback
     );
 }
+#endif /* HPT_HW_TIMER */
+
+/**
+* @brief  PPS phase lock state.
+* @param  None
+* @retval loop state
+*/
+const hpt_pll_t* HPT_GetPll(void)
+{
+   return &pll;
+}
+
+const hpt_pll_stats_t* HPT_GetPllStats(void)
+{
+   return &pll_stats;
+}
+
+void HPT_ClearPllStats(void)
+{
+   /* resyncs is left alone: the timer task compares it */
+   pll_stats.pps = 0;
+   pll_stats.locks = 0;
+   pll_stats.holdover = 0;
+   pll_stats.max_err = 0;
+}
+
+/**
+* @brief  The running table, sorted by time.
+* @param  None
+* @retval HPT Events table
+*/
+const HPT_Event* HPT_GetTable(void)
+{
+   return current_hpt_table;
+}
+
+/**
+* @brief  Event timing: how late each event of the table ran against its exact time.
+* @param  number of events out, messages dropped out
+* @retval statistics, one per event of the table
+*/
+const HPT_Jitter* HPT_GetJitter(uint8_t* events, uint32_t* dropped)
+{
+   *events  = hpt_events;
+   *dropped = hpt_dropped;
+   return hpt_jitter;
+}
+
+void HPT_ClearJitter(void)
+{
+   uint8_t i;
+   for (i = 0; i < HPT_MAX_EVENTS; i++) hpt_jitter[i].count = 0;
+   hpt_dropped = 0;
+}
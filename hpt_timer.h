@@ -4,19 +4,22 @@
 #include <stdint.h>
 #include <FreeRTOS.h>
 #include <queue.h>
+#include "hpt_pll.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /* -------- defines -------- */
+// #define HPT_HW_TIMER                // events on TIM5 compare interrupts (us resolution) instead of the RTOS software timer
+
+#define HPT_MAX_EVENTS     16          /* events in a table, HPT_RESTART included */
 
 typedef enum
 {
    HPT_RESTART = 0,  /* Restart the table */
    HPT_GPIO_UP,      /* Test GPIO up */
    HPT_GPIO_DOWN,    /* Test GPIO down */
-   HPT_PREPARE_PKT,  /* Prepare OGN packet */
    HPT_COPY_PKT,     /* Copy OGN packet data */
    HPT_SP1_CHANNEL,  /* Switch SP1 to selected channel */
    HPT_TX_PKT,       /* TX copied packet data */
@@ -32,11 +35,28 @@ typedef struct
    uint32_t     data1;
 } HPT_Event;
 
+typedef struct
+{
+   uint32_t     count;
+   int32_t      last;        /* [us] event run against its exact time: the PPS second plus the table time */
+   int32_t      min;
+   int32_t      max;
+} HPT_Jitter;
+
+/* -------- variables -------- */
+extern const char* const hpt_opcodes_str[];
+
 /* -------- functions -------- */
 void HPT_Config(void);
 void HPT_Start(HPT_Event* hpt_table);
 BaseType_t HPT_RestartFromISR(void);
 void HPT_Debug(uint8_t state);
+const hpt_pll_t* HPT_GetPll(void);
+const hpt_pll_stats_t* HPT_GetPllStats(void);
+void HPT_ClearPllStats(void);
+const HPT_Event* HPT_GetTable(void);
+const HPT_Jitter* HPT_GetJitter(uint8_t* events, uint32_t* dropped);
+void HPT_ClearJitter(void);
 
 #ifdef __cplusplus
 }
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "bitcount.h"
 
@@ -14,6 +15,24 @@
 #include <avr/pgmspace.h>
 #endif
 
+// Encoder behind LDPC_Encode(Data, Parity) - select at compile time with -DLDPC_ENCODER=...
+#define LDPC_ENCODER_POPCOUNT 0 // 48 rows x 5 words: AND + Count1s() through the ByteCount1s[] table
+#define LDPC_ENCODER_TABLE    1 // 20 data bytes x 256-entry parity tables (ldpc_enc.h, 40KB): XOR-accumulate
+#define LDPC_ENCODER_PARITY   2 // 48 rows x 5 words: AND + XOR then a single __builtin_parity() per row
+
+#ifdef LDPC_NO_TABLES            // building the table generator: the generated tables may not be there yet
+#undef  LDPC_ENCODER
+#define LDPC_ENCODER LDPC_ENCODER_POPCOUNT
+#endif
+
+#ifndef LDPC_ENCODER
+#ifdef __AVR__
+#define LDPC_ENCODER LDPC_ENCODER_POPCOUNT
+#else
+#define LDPC_ENCODER LDPC_ENCODER_TABLE
+#endif
+#endif
+
 // FindVectors65432bit(10,20,23, 500) => 208, Delta=2579
 
 // every row represents a parity check to be performed on the received codeword
@@ -251,7 +270,7 @@ int8_t LDPC_Check(const uint32_t *Packet)
 
 #else // if not 8-bit AVR
 
-void LDPC_Encode(const uint8_t *Data, uint8_t *Parity, const uint32_t ParityGen[48][5])
+inline void LDPC_Encode(const uint8_t *Data, uint8_t *Parity, const uint32_t ParityGen[48][5])
 { uint8_t ParIdx=0; uint8_t ParByte=0; uint8_t Mask=1;
   for(uint8_t Row=0; Row<48; Row++)
   { uint8_t Count=0;
@@ -264,14 +283,9 @@ void LDPC_Encode(const uint8_t *Data, uint8_t *Parity, const uint32_t ParityGen[
   // if(Mask!=1) Parity[ParIdx]=ParByte;
 }
 
-void LDPC_Encode(const uint8_t *Data, uint8_t *Parity)
-{ LDPC_Encode(Data, Parity, LDPC_ParityGen); }
-
-void LDPC_Encode(uint8_t *Data)
-{ LDPC_Encode(Data, Data+20); }
 
 // encode Parity from Data: Data is 5x 32-bit words = 160 bits, Parity is 1.5x 32-bit word = 48 bits
-void LDPC_Encode(const uint32_t *Data, uint32_t *Parity, const uint32_t ParityGen[48][5])
+inline void LDPC_Encode(const uint32_t *Data, uint32_t *Parity, const uint32_t ParityGen[48][5])
 { // printf("LDPC_Encode: %08X %08X %08X %08X %08X", Data[0], Data[1], Data[2], Data[3], Data[4] );
   uint8_t ParIdx=0; Parity[ParIdx]=0; uint32_t Mask=1;
   for(uint8_t Row=0; Row<48; Row++)
@@ -285,11 +299,81 @@ void LDPC_Encode(const uint32_t *Data, uint32_t *Parity, const uint32_t ParityGe
   // printf(" => %08X %08X\n", Parity[0], Parity[1] );
 }
 
-void LDPC_Encode(const uint32_t *Data, uint32_t *Parity)
-{ LDPC_Encode(Data, Parity, LDPC_ParityGen); }
+inline uint8_t LDPC_Parity(uint32_t Word)         // parity of a 32-bit word
+{
+#ifdef __GNUC__
+  return __builtin_parity(Word);
+#else
+  return Count1s(Word)&1;
+#endif
+}
+
+// same as above, but the five words are first folded, thus there is only one parity evaluation per row
+inline void LDPC_Encode_Parity(const uint32_t *Data, uint32_t *Parity, const uint32_t ParityGen[48][5])
+{ uint32_t Par=0;
+  for(uint8_t Row=0; Row<32; Row++)
+  { const uint32_t *Gen=ParityGen[Row];
+    uint32_t Word = (Data[0]&Gen[0]) ^ (Data[1]&Gen[1]) ^ (Data[2]&Gen[2]) ^ (Data[3]&Gen[3]) ^ (Data[4]&Gen[4]);
+    Par |= (uint32_t)LDPC_Parity(Word)<<Row; }
+  Parity[0]=Par; Par=0;
+  for(uint8_t Row=32; Row<48; Row++)
+  { const uint32_t *Gen=ParityGen[Row];
+    uint32_t Word = (Data[0]&Gen[0]) ^ (Data[1]&Gen[1]) ^ (Data[2]&Gen[2]) ^ (Data[3]&Gen[3]) ^ (Data[4]&Gen[4]);
+    Par |= (uint32_t)LDPC_Parity(Word)<<(Row-32); }
+  Parity[1]=Par; }
+
+#if LDPC_ENCODER==LDPC_ENCODER_TABLE
+
+#include "ldpc_enc.h"
+
+// the code is linear: parity of the packet is the XOR of the parities of every data byte taken alone
+inline void LDPC_Encode_Table(const uint32_t *Data, uint32_t *Parity)
+{ uint32_t Par0=0, Par1=0;
+  const uint32_t (*Table)[2] = LDPC_ParityTable[0];
+  for(uint8_t Idx=0; Idx<5; Idx++)
+  { uint32_t Word=Data[Idx];
+    for(uint8_t Byte=0; Byte<4; Byte++)
+    { const uint32_t *Entry = Table[Word&0xFF];
+      Par0^=Entry[0]; Par1^=Entry[1];
+      Word>>=8; Table+=256; }
+  }
+  Parity[0]=Par0; Parity[1]=Par1; }
+
+inline void LDPC_Encode_Table(const uint8_t *Data, uint8_t *Parity)
+{ uint32_t Par0=0, Par1=0;
+  for(uint8_t Idx=0; Idx<20; Idx++)
+  { const uint32_t *Entry = LDPC_ParityTable[Idx][Data[Idx]];
+    Par0^=Entry[0]; Par1^=Entry[1]; }
+  Parity[0]=Par0; Parity[1]=Par0>>8; Parity[2]=Par0>>16; Parity[3]=Par0>>24;
+  Parity[4]=Par1; Parity[5]=Par1>>8; }
+
+#endif // LDPC_ENCODER_TABLE
+
+inline void LDPC_Encode(const uint32_t *Data, uint32_t *Parity)
+{
+#if   LDPC_ENCODER==LDPC_ENCODER_TABLE
+  LDPC_Encode_Table(Data, Parity);
+#elif LDPC_ENCODER==LDPC_ENCODER_PARITY
+  LDPC_Encode_Parity(Data, Parity, LDPC_ParityGen);
+#else
+  LDPC_Encode(Data, Parity, LDPC_ParityGen);
+#endif
+}
+
+inline void LDPC_Encode(const uint8_t *Data, uint8_t *Parity)
+{
+#if LDPC_ENCODER==LDPC_ENCODER_TABLE
+  LDPC_Encode_Table(Data, Parity);
+#else
+  LDPC_Encode(Data, Parity, LDPC_ParityGen);
+#endif
+}
+
+inline void LDPC_Encode(uint8_t *Data)
+{ LDPC_Encode(Data, Data+20); }
 
 // check Data against Parity (run 48 parity checks) - return number of failed checks
-int LDPC_Check(const uint32_t *Data, const uint32_t *Parity) // Data and Parity are 32-bit words
+inline int LDPC_Check(const uint32_t *Data, const uint32_t *Parity) // Data and Parity are 32-bit words
 { int Errors=0;
   for(int Row=0; Row<48; Row++)
   { int Count=0;
@@ -302,9 +386,9 @@ int LDPC_Check(const uint32_t *Data, const uint32_t *Parity) // Data and Parity
     if(Count&1) Errors++; }
   return Errors; }
 
-int LDPC_Check(const uint32_t *Packet) { return LDPC_Check(Packet, Packet+5); }
+inline int LDPC_Check(const uint32_t *Packet) { return LDPC_Check(Packet, Packet+5); }
 
-int LDPC_Check(const uint8_t *Data) // Data and Parity are 8-bit bytes
+inline int LDPC_Check(const uint8_t *Data) // Data and Parity are 8-bit bytes
 { int Errors=0;
   for(int Row=0; Row<48; Row++)
   { int Count=0;
@@ -317,6 +401,88 @@ int LDPC_Check(const uint8_t *Data) // Data and Parity are 8-bit bytes
     if(Count&1) Errors++; }
   return Errors; }
 
+// batch check: many codewords at once, transposed into bit-planes, so every parity check
+// becomes a few word-wide XOR's for 32 (uint32_t) or 64 (uint64_t) codewords together
+
+inline void LDPC_Transpose32(uint32_t Block[32])   // transpose a 32x32 bit matrix: bit #j of Block[i] <=> bit #i of Block[j]
+{ uint32_t Mask=0x0000FFFF;
+  for(uint8_t Step=16; Step; Step>>=1, Mask^=Mask<<Step)
+  { for(uint8_t Idx=0; Idx<32; Idx=(Idx+Step+1)&(~Step))
+    { uint32_t Swap = ((Block[Idx]>>Step) ^ Block[Idx+Step]) & Mask;
+      Block[Idx+Step] ^= Swap; Block[Idx] ^= Swap<<Step; }
+  }
+}
+
+template <class Word>                              // Word = uint32_t or uint64_t: number of codewords (lanes) processed together
+ class LDPC_BatchCheck
+{ public:
+   static const uint8_t Lanes     = 8*sizeof(Word);
+   static const uint8_t CodeBits  = 208;
+   static const uint8_t CodeWords = 7;
+   static const uint8_t ParityBits= 48;
+
+   Word Plane[CodeWords*32];                       // bit #Lane of Plane[Bit] is the code bit #Bit of the codeword #Lane
+   Word Check[ParityBits];                         // bit #Lane of Check[Row] is set when parity check #Row fails for the codeword #Lane
+
+  public:
+   // load up to Lanes codewords, each is 7 words (208 bits): Packet[Lane*Stride] for Lane=0..Packets-1
+   void Load(const uint32_t *Packet, uint8_t Packets, uint16_t Stride=CodeWords)
+   { uint32_t Block[32];
+     for(uint8_t Base=0; Base<Lanes; Base+=32)                    // 32 codewords at a time
+     { for(uint8_t Idx=0; Idx<CodeWords; Idx++)
+       { for(uint8_t Lane=0; Lane<32; Lane++)
+         { uint8_t Pkt=Base+Lane;
+           Block[Lane] = Pkt<Packets ? Packet[Pkt*Stride+Idx]:0; } // missing codewords are all-zero thus valid
+         LDPC_Transpose32(Block);
+         Word *Bit = Plane+32*Idx;
+         for(uint8_t Lane=0; Lane<32; Lane++)
+         { if(Base==0) Bit[Lane]=Block[Lane];
+                  else Bit[Lane]|=(Word)Block[Lane]<<Base; }
+       }
+     }
+   }
+
+   Word CheckAll(void)                             // run all 48 parity checks, return the mask of the failing codewords
+   { Word Fail=0;
+     for(uint8_t Row=0; Row<ParityBits; Row++)
+     { const uint8_t *CheckIndex = LDPC_ParityCheckIndex[Row];
+       uint8_t CheckWeight = *CheckIndex++;
+       Word Parity=0;
+       for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+         Parity^=Plane[CheckIndex[Bit]];
+       Check[Row]=Parity; Fail|=Parity; }
+     return Fail; }
+
+   void getSyndrome(uint64_t *Syndrome, uint8_t Packets) const // syndrome (48 bits) for every codeword: bit #Row set when check #Row fails
+   { uint32_t Low[32], High[32];
+     for(uint8_t Base=0; Base<Lanes; Base+=32)
+     { for(uint8_t Row=0; Row<32; Row++)
+       { Low[Row]  = Check[Row]>>Base;
+         High[Row] = Row<(ParityBits-32) ? (uint32_t)(Check[Row+32]>>Base):0; }
+       LDPC_Transpose32(Low); LDPC_Transpose32(High);
+       for(uint8_t Lane=0; Lane<32; Lane++)
+       { uint8_t Pkt=Base+Lane; if(Pkt>=Packets) return;
+         Syndrome[Pkt] = ((uint64_t)High[Lane]<<32) | Low[Lane]; }
+     }
+   }
+
+} ;
+
+// check any number of codewords: fill the Syndrome[] for each of them and return the number of failing codewords
+template <class Word>
+ int LDPC_CheckBatch(const uint32_t *Packet, int Packets, uint64_t *Syndrome, uint16_t Stride=7)
+{ LDPC_BatchCheck<Word> Batch; int Errors=0;
+  for( ; Packets>0; )
+  { uint8_t Count = Packets<Batch.Lanes ? Packets:Batch.Lanes;
+    Batch.Load(Packet, Count, Stride);
+    Word Fail=Batch.CheckAll();
+    if(Fail)
+    { Batch.getSyndrome(Syndrome, Count); Errors+=Count1s(Fail); }
+    else
+    { for(uint8_t Pkt=0; Pkt<Count; Pkt++) Syndrome[Pkt]=0; }
+    Packet+=Count*Stride; Syndrome+=Count; Packets-=Count; }
+  return Errors; }
+
 #endif // __AVR__
 
 #ifndef __AVR__
@@ -484,6 +650,294 @@ class LDPC_Decoder
 
 } ;
 
+#ifndef LDPC_NO_TABLES
+
+#include "ldpc_dec.h"
+
+// syndrome decoding of one and two bit errors: the syndrome (48 bits) of a single error is a column
+// of the parity check matrix, looked up in LDPC_SyndromeHash[]. For a double error the lowest failing check
+// holds exactly one of the two bits: try every bit of that check and look up what remains as a single error.
+
+inline uint64_t LDPC_Syndrome(const uint32_t *Packet)     // bit #Row set when parity check #Row fails
+{ uint64_t Syndrome=0;
+  for(uint8_t Row=0; Row<48; Row++)
+  { const uint32_t *Check=LDPC_ParityCheck[Row];
+    uint32_t Word = Packet[0]&Check[0];
+    for(uint8_t Idx=1; Idx<6; Idx++) Word ^= Packet[Idx]&Check[Idx];
+    Word ^= Packet[6]&Check[6]&0xFFFF;
+    if(LDPC_Parity(Word)) Syndrome |= (uint64_t)1<<Row; }
+  return Syndrome; }
+
+inline uint16_t LDPC_SyndromeHashIdx(uint64_t Syndrome)  // same hash as host/ldpc_gen
+{ uint32_t Hash = (uint32_t)Syndrome*0x9E3779B1 + (uint32_t)(Syndrome>>32)*0x85EBCA6B;
+  return Hash>>(32-9); }
+
+inline int16_t LDPC_SyndromeBit(uint64_t Syndrome)       // codeword bit whose single error gives this syndrome, -1 if none
+{ for(uint16_t Idx=LDPC_SyndromeHashIdx(Syndrome); ; Idx=(Idx+1)&(LDPC_SyndromeHashSize-1))
+  { uint8_t Bit=LDPC_SyndromeHash[Idx];
+    if(Bit==0xFF) return -1;
+    if(LDPC_BitSyndrome[Bit]==Syndrome) return Bit; }
+}
+
+// correct the Packet from its (non-zero) syndrome alone: return the number of bits flipped (1 or 2)
+// or -1 when the syndrome is neither a single error nor a double error which no other double error shares
+inline int8_t LDPC_SyndromeCorrect(uint32_t *Packet, uint64_t Syndrome)
+{ int16_t Bit=LDPC_SyndromeBit(Syndrome);
+  if(Bit>=0) { Packet[Bit>>5] ^= (uint32_t)1<<(Bit&31); return 1; }
+  const uint8_t *CheckIndex = LDPC_ParityCheckIndex[__builtin_ctzll(Syndrome)];
+  uint8_t CheckWeight = *CheckIndex++;
+  int16_t First=-1, Second=-1;
+  for(uint8_t Idx=0; Idx<CheckWeight; Idx++)
+  { int16_t Other=LDPC_SyndromeBit(Syndrome^LDPC_BitSyndrome[CheckIndex[Idx]]);
+    if(Other<0) continue;
+    if(First>=0) return -1;                                 // two pairs give this syndrome
+    First=CheckIndex[Idx]; Second=Other; }
+  if(First<0) return -1;
+  Packet[First>>5]  ^= (uint32_t)1<<(First&31);
+  Packet[Second>>5] ^= (uint32_t)1<<(Second&31);
+  return 2; }
+
+inline uint64_t LDPC_SparseSyndrome(const uint32_t *Packet) // same as LDPC_Syndrome(): XOR of the columns of the bits which are set
+{ uint64_t Syndrome=0;
+  for(uint8_t Idx=0; Idx<7; Idx++)
+  { uint32_t Word = Idx<6 ? Packet[Idx] : Packet[Idx]&0xFFFF;
+    for( ; Word; Word&=Word-1)
+      Syndrome ^= LDPC_BitSyndrome[32*Idx+__builtin_ctz(Word)]; }
+  return Syndrome; }
+
+#ifndef LDPC_BITFLIP_MAX_ITER
+#define LDPC_BITFLIP_MAX_ITER 4                       // flips allowed to LDPC_BitFlipDecoder: more flips risk converging to a wrong codeword
+#endif
+
+// Hard decision, weighted bit-flipping decoder: a cheap first stage for a few bit errors.
+// Flipping a bit updates the syndrome with its column (LDPC_BitSyndrome), the number of failing checks
+// of a bit is the popcount of its column masked by the syndrome. Every step flips the one bit with the most
+// failing checks, and only when more than half of its checks fail (Gallager-B majority): bits marked as erased
+// (Manchester violations) need only half. Only the bits of the failing checks are visited, thus the cost of a step
+// grows with the number of errors: the firmware counts its cycles (rx_stat). Returns -1 when no bit qualifies: leave it to the soft decoder.
+
+class LDPC_BitFlipDecoder
+{ public:
+   const static uint8_t  CodeBits   = 208;
+   const static uint8_t  CodeBytes  = (CodeBits+ 7)/ 8;
+   const static uint8_t  CodeWords  = (CodeBits+31)/32;
+   const static uint8_t  MaxIter    = LDPC_BITFLIP_MAX_ITER;
+
+   uint32_t Code[CodeWords];                          // hard decisions
+   uint32_t Erased[CodeWords];                        // bits with a Manchester violation
+   uint64_t Syndrome;                                 // bit #Row set when parity check #Row fails
+   uint8_t  Iterations;                               // bits flipped by the last Decode()
+
+  public:
+   void Input(const uint32_t Data[CodeWords], const uint32_t *Erase=0)
+   { for(uint8_t Idx=0; Idx<CodeWords; Idx++)
+     { Code[Idx]=Data[Idx]; Erased[Idx] = Erase ? Erase[Idx]:0; }
+     Code[CodeWords-1]&=0xFFFF; Erased[CodeWords-1]&=0xFFFF;
+     Syndrome=LDPC_SparseSyndrome(Code); }
+
+   void Input(const uint8_t *Data, const uint8_t *Err=0)  // bytes as received: bit #0 = LSB of the first byte
+   { Code[CodeWords-1]=0; Erased[CodeWords-1]=0;
+     memcpy(Code, Data, CodeBytes);
+     if(Err) memcpy(Erased, Err, CodeBytes);
+        else memset(Erased, 0, CodeBytes);
+     Syndrome=LDPC_SparseSyndrome(Code); }
+
+   void Output(uint32_t Data[CodeWords]) const
+   { for(uint8_t Idx=0; Idx<CodeWords; Idx++) Data[Idx]=Code[Idx]; }
+
+   void Output(uint8_t Data[CodeBytes]) const
+   { memcpy(Data, Code, CodeBytes); }
+
+   bool isValid(void) const { return Syndrome==0; }
+
+   void Flip(uint8_t Bit)
+   { Code[Bit>>5] ^= (uint32_t)1<<(Bit&31);
+     Syndrome ^= LDPC_BitSyndrome[Bit]; }
+
+   uint8_t FailedChecks(uint8_t Bit) const            // failing checks the bit takes part in
+   { uint64_t Fail = Syndrome & LDPC_BitSyndrome[Bit];
+     return Count1s((uint32_t)Fail) + Count1s((uint32_t)(Fail>>32)); }
+
+   int8_t Decode(void)                                // return the number of flipped bits (0 => no errors) or -1 when failed
+   { for(Iterations=0; Iterations<MaxIter; Iterations++)
+     { if(isValid()) return Iterations;
+       int16_t Best=-1; int8_t BestMetric=0;
+       for(uint64_t Rows=Syndrome; Rows; Rows&=Rows-1)   // visit the bits of the failing checks
+       { const uint8_t *CheckIndex = LDPC_ParityCheckIndex[__builtin_ctzll(Rows)];
+         uint8_t CheckWeight = *CheckIndex++;
+         for(uint8_t Idx=0; Idx<CheckWeight; Idx++)
+         { uint8_t Bit=CheckIndex[Idx];
+           int8_t Metric = 2*FailedChecks(Bit) - LDPC_BitCheckIndex[Bit][0];  // failing minus passing checks
+           if((Erased[Bit>>5]>>(Bit&31))&1) Metric++;
+           if(Metric>BestMetric || (Metric==BestMetric && Bit<Best)) { Best=Bit; BestMetric=Metric; } }
+       }
+       if(Best<0) return -1;
+       Flip(Best); }
+     if(isValid()) return Iterations;
+     return -1; }
+
+} ;
+
+#ifndef LDPC_MINSUM_MAX_ITER
+#define LDPC_MINSUM_MAX_ITER 16                       // iteration cap of LDPC_MinSumDecoder: can be set at compile time
+#endif
+
+// Layered, normalized min-sum decoder: the checks are processed one by one (layers) and every check
+// updates the a-posteriori bits at once, thus it converges in about half the iterations of the flooding
+// schedule. Check-to-bit messages are int8 and kept for every check, the syndrome (of the hard decisions)
+// is updated only when a bit changes sign, thus the decoder stops right after the layer which made the codeword valid.
+
+class LDPC_MinSumDecoder
+{ public:
+   const static uint8_t  UserBits   = 160;
+   const static uint8_t  ParityBits =  48;
+   const static uint8_t  CodeBits   = UserBits+ParityBits;
+   const static uint8_t  CodeBytes  = (CodeBits+ 7)/ 8;
+   const static uint8_t  CodeWords  = (CodeBits+31)/32;
+   const static uint8_t  MaxCheckWeight = 24;
+   const static uint8_t  MaxIter    = LDPC_MINSUM_MAX_ITER;
+   const static int8_t   InpAmpl    = 32;              // amplitude for the hard input bits
+
+   int8_t   Bit[CodeBits];                            // a-posteriori bits: positive => 1, negative => 0, zero => erasure
+   int8_t   Msg[LDPC_Edges];                          // check-to-bit messages, for check #0, then check #1, etc.
+   uint32_t Syndrome[2];                              // bit #Row set when parity check #Row fails: 32+16 bits
+   uint8_t  Iterations;                               // iterations used by the last Decode()
+
+  public:
+   static int8_t Limit(int16_t Value)                 // keep the amplitudes symmetric: -127..+127
+   { if(Value>127) return 127;
+     if(Value<(-127)) return -127;
+     return Value; }
+
+   void Input(const int8_t *Data)                     // soft bits: positive => 1
+   { for(uint8_t Idx=0; Idx<CodeBits; Idx++)
+       Bit[Idx] = Limit(Data[Idx]);
+     Reset(); }
+
+   void Input(const uint32_t Data[CodeWords], int8_t Ampl=InpAmpl) // hard bits
+   { uint32_t Mask=1; uint8_t WordIdx=0; uint32_t Word=Data[WordIdx];
+     for(uint8_t Idx=0; Idx<CodeBits; Idx++)
+     { Bit[Idx] = (Word&Mask) ? Ampl:-Ampl;
+       Mask<<=1; if(Mask==0) { Word=Data[++WordIdx]; Mask=1; }
+     }
+     Reset(); }
+
+   void Input(const uint8_t *Data, const uint8_t *Err, int8_t Ampl=InpAmpl) // hard bits with erasures (Manchester errors)
+   { uint8_t Mask=1; uint8_t ByteIdx=0; uint8_t DataByte=Data[0]; uint8_t ErrByte=Err[0];
+     for(uint8_t Idx=0; Idx<CodeBits; Idx++)
+     { if(ErrByte&Mask) Bit[Idx]=0;
+                   else Bit[Idx] = (DataByte&Mask) ? Ampl:-Ampl;
+       Mask<<=1; if(Mask==0) { ByteIdx++; if(ByteIdx<CodeBytes) { DataByte=Data[ByteIdx]; ErrByte=Err[ByteIdx]; } Mask=1; }
+     }
+     Reset(); }
+
+   void Input(const float *Data, float RefAmpl=1.0)   // soft bits: RefAmpl => InpAmpl
+   { for(uint8_t Idx=0; Idx<CodeBits; Idx++)
+     { float Ampl=floor(InpAmpl*Data[Idx]/RefAmpl+0.5);
+       Bit[Idx] = Ampl>127 ? 127 : Ampl<(-127) ? -127 : (int8_t)Ampl; }
+     Reset(); }
+
+   void Output(uint32_t Data[CodeWords]) const
+   { uint32_t Mask=1; uint8_t WordIdx=0; uint32_t Word=0;
+     for(uint8_t Idx=0; Idx<CodeBits; Idx++)
+     { if(Bit[Idx]>0) Word|=Mask;
+       Mask<<=1; if(Mask==0) { Data[WordIdx++]=Word; Word=0; Mask=1; }
+     } if(Mask>1) Data[WordIdx++]=Word;
+   }
+
+   void Output(uint8_t Data[CodeBytes]) const
+   { uint8_t Mask=1; uint8_t ByteIdx=0; uint8_t Byte=0;
+     for(uint8_t Idx=0; Idx<CodeBits; Idx++)
+     { if(Bit[Idx]>0) Byte|=Mask;
+       Mask<<=1; if(Mask==0) { Data[ByteIdx++]=Byte; Byte=0; Mask=1; }
+     } if(Mask>1) Data[ByteIdx++]=Byte;
+   }
+
+   bool isValid(void) const { return (Syndrome[0]|Syndrome[1])==0; } // all parity checks satisfied ?
+
+   uint8_t FailedChecks(void) const { return Count1s(Syndrome[0])+Count1s(Syndrome[1]); }
+
+   int8_t Decode(void)                                // return the number of iterations used (0 => no errors) or -1 when failed
+   { Iterations=0;
+     if(isValid()) return 0;
+     for(Iterations=1; Iterations<=MaxIter; Iterations++)
+     { int8_t *RowMsg=Msg;
+       for(uint8_t Row=0; Row<ParityBits; Row++)
+       { RowMsg+=ProcessLayer(Row, RowMsg);
+         if(isValid()) return Iterations; }           // stop as soon as all the checks are satisfied
+     }
+     Iterations=MaxIter;
+     return -1; }
+
+  private:
+
+   void Reset(void)                                   // clear messages, compute the syndrome of the input
+   { for(uint16_t Idx=0; Idx<LDPC_Edges; Idx++)
+       Msg[Idx]=0;
+     Syndrome[0]=0; Syndrome[1]=0;
+     for(uint8_t Row=0; Row<ParityBits; Row++)
+     { const uint8_t *CheckIndex = LDPC_ParityCheckIndex[Row];
+       uint8_t CheckWeight = *CheckIndex++;
+       uint8_t Parity=0;
+       for(uint8_t Idx=0; Idx<CheckWeight; Idx++)
+         Parity ^= Bit[CheckIndex[Idx]]>0;
+       if(Parity) Syndrome[Row>>5] |= (uint32_t)1<<(Row&31); }
+   }
+
+   void FlipBit(uint8_t BitIdx)                       // hard decision of a bit changed: flip the syndrome of all checks it takes part in
+   { const uint8_t *CheckIndex = LDPC_BitCheckIndex[BitIdx];
+     uint8_t BitWeight = *CheckIndex++;
+     for(uint8_t Idx=0; Idx<BitWeight; Idx++)
+     { uint8_t Row=CheckIndex[Idx]; Syndrome[Row>>5] ^= (uint32_t)1<<(Row&31); }
+   }
+
+   static uint8_t Abs(int8_t Value) { return Value<0 ? -Value:Value; }
+
+   static uint8_t Normalize(uint8_t Value) { return Value-(Value>>2); } // scale min-sum messages by 3/4
+
+   uint8_t ProcessLayer(uint8_t Row, int8_t *RowMsg)  // update one parity check and the bits it covers, return the check weight
+   { const uint8_t *CheckIndex = LDPC_ParityCheckIndex[Row];
+     uint8_t CheckWeight = *CheckIndex++;
+     int8_t Ext[MaxCheckWeight];                      // bit-to-check (extrinsic) values
+     uint8_t Min1=127, Min2=127; uint8_t Parity=0;
+     for(uint8_t Idx=0; Idx<CheckWeight; Idx++)
+     { int8_t Ampl = Limit((int16_t)Bit[CheckIndex[Idx]] - RowMsg[Idx]); // remove what this check contributed last time
+       Ext[Idx]=Ampl; Parity ^= Ampl>0;
+       uint8_t Mag=Abs(Ampl);
+       if(Mag<Min1) { Min2=Min1; Min1=Mag; }
+       else if(Mag<Min2) Min2=Mag; }
+     uint8_t Out1=Normalize(Min1), Out2=Normalize(Min2);
+     for(uint8_t Idx=0; Idx<CheckWeight; Idx++)
+     { uint8_t BitIdx=CheckIndex[Idx];
+       int8_t Ampl=Ext[Idx];
+       int8_t Out = Abs(Ampl)==Min1 ? Out2:Out1;      // magnitude: smallest of the other bits
+       if((Parity^(Ampl>0))==0) Out=(-Out);           // sign: parity of the other bits
+       RowMsg[Idx]=Out;
+       int8_t New=Limit((int16_t)Ampl+Out);
+       if((New>0)!=(Bit[BitIdx]>0)) FlipBit(BitIdx);
+       Bit[BitIdx]=New; }
+     return CheckWeight; }
+
+} ;
+
+#endif // LDPC_NO_TABLES
+
+// soft-decode only those codewords which failed the batch check (non-zero Syndrome[]) - in place,
+// return the number of codewords which could be corrected
+inline int LDPC_DecodeBatch(uint32_t *Packet, int Packets, const uint64_t *Syndrome, LDPC_Decoder &Decoder, uint8_t MaxIter=32, uint16_t Stride=7)
+{ int Corrected=0;
+  for(int Pkt=0; Pkt<Packets; Pkt++, Packet+=Stride)
+  { if(Syndrome[Pkt]==0) continue;
+    Decoder.Input(Packet);
+    for(uint8_t Iter=0; Iter<MaxIter; Iter++)
+    { if(Decoder.ProcessChecks()==0) break; }
+    uint32_t Data[LDPC_Decoder::CodeWords]; Decoder.Output(Data);
+    if(LDPC_Check(Data)) continue;
+    for(uint8_t Idx=0; Idx<LDPC_Decoder::CodeWords-1; Idx++) Packet[Idx]=Data[Idx];
+    Packet[6] = (Packet[6]&0xFFFF0000) | (Data[6]&0x0000FFFF); // the upper 16 bits are not part of the codeword
+    Corrected++; }
+  return Corrected; }
+
 #endif // __AVR__
 
 #endif // of __LDPC_H__
@@ -0,0 +1,163 @@
+// generated by host/ldpc_gen from the LDPC code matrices in ldpc.h - do not edit
+
+#ifndef __LDPC_DEC_H__
+#define __LDPC_DEC_H__
+
+#include <stdint.h>
+
+static const uint16_t LDPC_Edges = 717;         // number of ones in the parity check matrix = sum of all check weights
+static const uint8_t  LDPC_MaxBitWeight = 6;   // max. number of checks a single bit takes part in
+
+// for every codeword bit: number of parity checks it takes part in, followed by the list of these checks
+static const uint8_t LDPC_BitCheckIndex[208][7] = {
+ { 6,  0,  1,  2,  3,  4,  5, }, { 3,  7, 32, 43, }, { 6,  0, 41, 42, 43, 44, 45, }, { 3, 12, 31, 44, },
+ { 3,  9, 27, 35, }, { 3,  8, 33, 42, }, { 3,  9, 40, 43, }, { 3, 13, 33, 44, },
+ { 4,  3,  9, 12, 16, }, { 3, 10, 16, 24, }, { 4,  4, 32, 39, 41, }, { 6,  0,  6,  7,  8,  9, 10, },
+ { 3, 15, 18, 33, }, { 3, 16, 29, 42, }, { 5,  2,  9, 13, 17, 21, }, { 3,  6, 36, 42, },
+ { 3, 18, 30, 45, }, { 3,  8, 28, 31, }, { 3,  5, 12, 23, }, { 3, 19, 25, 43, },
+ { 3,  5, 19, 29, }, { 3, 22, 26, 40, }, { 3, 22, 28, 43, }, { 3,  9, 28, 38, },
+ { 3,  5, 34, 37, }, { 3,  5,  8, 21, }, { 3,  6, 23, 28, }, { 3, 10, 18, 22, },
+ { 3, 19, 27, 45, }, { 3, 12, 26, 33, }, { 3,  9, 29, 32, }, { 3, 21, 27, 46, },
+ { 3, 13, 27, 40, }, { 3,  5,  6, 15, }, { 3, 19, 28, 46, }, { 3, 10, 36, 46, },
+ { 3, 11, 24, 28, }, { 6,  0, 26, 27, 28, 29, 30, }, { 3,  6, 31, 39, }, { 5,  2, 25, 29, 34, 40, },
+ { 3, 17, 24, 30, }, { 5,  3,  6, 13, 19, 22, }, { 3,  6, 38, 44, }, { 5,  1, 30, 34, 39, 44, },
+ { 3, 22, 27, 47, }, { 3, 13, 29, 37, }, { 3, 17, 28, 44, }, { 3, 11, 31, 43, },
+ { 3,  9, 15, 23, }, { 3, 10, 13, 30, }, { 3, 18, 27, 44, }, { 3,  9, 36, 45, },
+ { 3, 17, 32, 47, }, { 3, 14, 31, 46, }, { 3, 13, 28, 39, }, { 5,  1, 27, 31, 36, 41, },
+ { 5,  2, 15, 27, 32, 38, }, { 3,  6, 29, 35, }, { 3, 16, 23, 30, }, { 3, 12, 27, 39, },
+ { 3, 12, 28, 34, }, { 5,  3,  7, 14, 18, 21, }, { 3, 14, 20, 34, }, { 3,  6, 20, 27, },
+ { 3, 15, 37, 47, }, { 4,  3, 34, 38, 42, }, { 3,  7, 36, 44, }, { 3, 17, 27, 43, },
+ { 3,  7, 27, 34, }, { 4,  3,  8, 11, 17, }, { 3, 14, 26, 36, }, { 3, 11, 34, 46, },
+ { 4,  4, 24, 27, 33, }, { 3, 14, 30, 43, }, { 4,  2, 39, 42, 46, }, { 4,  4,  8, 12, 19, },
+ { 3, 17, 25, 41, }, { 3, 15, 19, 21, }, { 4,  4, 35, 37, 44, }, { 3, 12, 32, 45, },
+ { 3, 13, 26, 35, }, { 3,  8, 44, 46, }, { 3, 10, 17, 33, }, { 3, 15, 16, 31, },
+ { 3, 14, 23, 29, }, { 3, 12, 20, 21, }, { 3, 12, 38, 46, }, { 3, 11, 32, 44, },
+ { 3, 11, 33, 45, }, { 3,  7, 37, 45, }, { 6,  0, 21, 22, 23, 24, 25, }, { 3, 12, 36, 47, },
+ { 3, 11, 20, 22, }, { 3, 16, 32, 46, }, { 3, 17, 29, 45, }, { 5,  2,  8, 14, 16, 22, },
+ { 3,  5, 14, 25, }, { 3, 12, 25, 37, }, { 3,  9, 25, 33, }, { 3, 12, 35, 43, },
+ { 3, 10, 35, 39, }, { 4,  4,  6, 14, 17, }, { 3,  8, 37, 43, }, { 3, 11, 29, 39, },
+ { 3, 23, 33, 46, }, { 3,  9, 44, 47, }, { 3, 13, 31, 45, }, { 3, 19, 26, 39, },
+ { 3,  9, 31, 42, }, { 3, 13, 25, 38, }, { 3, 16, 28, 41, }, { 3, 13, 20, 32, },
+ { 3,  8, 40, 41, }, { 3,  9, 20, 30, }, { 3, 11, 30, 40, }, { 3,  8, 25, 27, },
+ { 3,  8, 29, 36, }, { 3,  7, 35, 42, }, { 3, 10, 19, 34, }, { 3, 18, 25, 42, },
+ { 3,  7, 25, 26, }, { 3, 10, 40, 47, }, { 3, 15, 17, 34, }, { 3, 14, 27, 42, },
+ { 3,  8, 34, 45, }, { 6,  0, 16, 17, 18, 19, 20, }, { 3,  5, 31, 38, }, { 3, 18, 26, 38, },
+ { 3,  7, 15, 28, }, { 3,  7, 33, 39, }, { 3, 11, 25, 36, }, { 3, 22, 30, 46, },
+ { 3, 12, 30, 42, }, { 3,  6, 25, 32, }, { 6,  0, 31, 32, 33, 34, 35, }, { 3, 11, 38, 47, },
+ { 3,  5, 39, 45, }, { 5,  2, 30, 35, 41, 47, }, { 3,  7, 24, 29, }, { 3, 13, 34, 47, },
+ { 3,  9, 26, 34, }, { 3, 10, 38, 41, }, { 3,  5, 42, 47, }, { 3, 16, 25, 39, },
+ { 3,  5, 18, 28, }, { 3,  5, 16, 27, }, { 3,  6, 33, 40, }, { 3, 18, 29, 41, },
+ { 3,  5, 32, 40, }, { 3, 17, 23, 31, }, { 3,  5, 13, 24, }, { 3, 14, 28, 40, },
+ { 3,  5, 10, 11, }, { 3, 14, 33, 47, }, { 3,  7, 31, 40, }, { 5,  2,  6, 12, 18, 24, },
+ { 3,  8, 26, 32, }, { 3,  8, 20, 24, }, { 3,  5,  9, 22, }, { 3,  6, 45, 47, },
+ { 4,  4, 25, 30, 31, }, { 3,  8, 15, 30, }, { 3,  7, 30, 38, }, { 4,  4, 20, 23, 26, },
+ { 3,  6, 43, 46, }, { 6,  0, 36, 37, 38, 39, 40, }, { 3,  4, 38, 45, }, { 3, 10, 12, 29, },
+ { 4,  4,  9, 11, 18, }, { 4,  4, 10, 21, 28, }, { 3,  5, 41, 46, }, { 3,  5, 35, 36, },
+ { 3,  9, 37, 46, }, { 3,  5, 30, 33, }, { 3,  0, 46, 47, }, { 3,  3, 40, 44, },
+ { 5,  1, 29, 33, 38, 43, }, { 3, 21, 29, 44, }, { 6,  0, 11, 12, 13, 14, 15, }, { 3, 10, 14, 32, },
+ { 3,  5, 17, 26, }, { 5,  2, 10, 26, 31, 37, }, { 4,  4, 34, 36, 43, }, { 4,  4,  7, 13, 16, },
+ { 3,  6, 30, 37, }, { 3,  6, 34, 41, }, { 4,  3, 25, 28, 35, }, { 4,  3, 33, 37, 41, },
+ { 5,  1,  9, 14, 19, 24, }, { 3,  4, 40, 42, }, { 4,  3, 10, 23, 27, }, { 4,  3, 20, 29, 31, },
+ { 5,  2, 20, 28, 33, 36, }, { 4,  3, 39, 43, 47, }, { 5,  2,  7, 11, 19, 23, }, { 5,  1, 28, 32, 37, 42, },
+ { 5,  1, 10, 15, 20, 25, }, { 4,  4, 15, 22, 29, }, { 3, 11, 27, 37, }, { 5,  1, 35, 40, 45, 46, },
+ { 3,  8, 35, 38, }, { 3, 18, 31, 47, }, { 6,  1,  6, 11, 16, 21, 26, }, { 5,  1,  8, 13, 18, 23, },
+ { 4,  3, 30, 32, 36, }, { 3,  5,  7, 20, }, { 4,  3, 15, 24, 26, }, { 5,  1,  7, 12, 17, 22, },
+} ;
+
+// syndrome of a single error at every codeword bit = the column of the parity check matrix
+static const uint64_t LDPC_BitSyndrome[208] = {
+  0x00000000003F, 0x080100000080, 0x3E0000000001, 0x100080001000,
+  0x000808000200, 0x040200000100, 0x090000000200, 0x100200002000,
+  0x000000011208, 0x000001010400, 0x028100000010, 0x0000000007C1,
+  0x000200048000, 0x040020010000, 0x000000222204, 0x041000000040,
+  0x200040040000, 0x000090000100, 0x000000801020, 0x080002080000,
+  0x000020080020, 0x010004400000, 0x080010400000, 0x004010000200,
+  0x002400000020, 0x000000200120, 0x000010800040, 0x000000440400,
+  0x200008080000, 0x000204001000, 0x000120000200, 0x400008200000,
+  0x010008002000, 0x000000008060, 0x400010080000, 0x401000000400,
+  0x000011000800, 0x00007C000001, 0x008080000040, 0x010422000004,
+  0x000041020000, 0x000000482048, 0x104000000040, 0x108440000002,
+  0x800008400000, 0x002020002000, 0x100010020000, 0x080080000800,
+  0x000000808200, 0x000040002400, 0x100008040000, 0x201000000200,
+  0x800100020000, 0x400080004000, 0x008010002000, 0x021088000002,
+  0x004108008004, 0x000820000040, 0x000040810000, 0x008008001000,
+  0x000410001000, 0x000000244088, 0x000400104000, 0x000008100040,
+  0x802000008000, 0x044400000008, 0x101000000080, 0x080008020000,
+  0x000408000080, 0x000000020908, 0x001004004000, 0x400400000800,
+  0x000209000010, 0x080040004000, 0x448000000004, 0x000000081110,
+  0x020002020000, 0x000000288000, 0x102800000010, 0x200100001000,
+  0x000804002000, 0x500000000100, 0x000200020400, 0x000080018000,
+  0x000020804000, 0x000000301000, 0x404000001000, 0x100100000800,
+  0x200200000800, 0x202000000080, 0x000003E00001, 0x801000001000,
+  0x000000500800, 0x400100010000, 0x200020020000, 0x000000414104,
+  0x000002004020, 0x002002001000, 0x000202000200, 0x080800001000,
+  0x008800000400, 0x000000024050, 0x082000000100, 0x008020000800,
+  0x400200800000, 0x900000000200, 0x200080002000, 0x008004080000,
+  0x040080000200, 0x004002002000, 0x020010010000, 0x000100102000,
+  0x030000000100, 0x000040100200, 0x010040000800, 0x00000A000100,
+  0x001020000100, 0x040800000080, 0x000400080400, 0x040002040000,
+  0x000006000080, 0x810000000400, 0x000400028000, 0x040008004000,
+  0x200400000100, 0x0000001F0001, 0x004080000020, 0x004004040000,
+  0x000010008080, 0x008200000080, 0x001002000800, 0x400040400000,
+  0x040040001000, 0x000102000040, 0x000F80000001, 0x804000000800,
+  0x208000000020, 0x820840000004, 0x000021000080, 0x800400002000,
+  0x000404000200, 0x024000000400, 0x840000000020, 0x008002010000,
+  0x000010040020, 0x000008010020, 0x010200000040, 0x020020040000,
+  0x010100000020, 0x000080820000, 0x000001002020, 0x010010004000,
+  0x000000000C20, 0x800200004000, 0x010080000080, 0x000001041044,
+  0x000104000100, 0x000001100100, 0x000000400220, 0xA00000000040,
+  0x0000C2000010, 0x000040008100, 0x004040000080, 0x000004900010,
+  0x480000000040, 0x01F000000001, 0x204000000010, 0x000020001400,
+  0x000000040A10, 0x000010200410, 0x420000000020, 0x001800000020,
+  0x402000000200, 0x000240000020, 0xC00000000001, 0x110000000008,
+  0x084220000002, 0x100020200000, 0x00000000F801, 0x000100004400,
+  0x000004020020, 0x002084000404, 0x081400000010, 0x000000012090,
+  0x002040000040, 0x020400000040, 0x000812000008, 0x022200000008,
+  0x000001084202, 0x050000000010, 0x000008800408, 0x0000A0100008,
+  0x001210100004, 0x888000000008, 0x000000880884, 0x042110000002,
+  0x000002108402, 0x000020408010, 0x002008000800, 0x610800000002,
+  0x004800000100, 0x800080040000, 0x000004210842, 0x000000842102,
+  0x001140000008, 0x0000001000A0, 0x000005008008, 0x000000421082,
+} ;
+
+// syndrome => codeword bit of a single error: open addressing on LDPC_SyndromeHashIdx(), 0xFF = empty, max. 4 extra probes
+// double errors: all 208 single errors and 21504 of the 21528 double errors have a syndrome no other single or double error has,
+// 0 double errors look like a single error and the other 24 share their syndrome with another double error
+static const uint16_t LDPC_SyndromeHashSize = 512;
+static const uint16_t LDPC_SyndromeDoubles = 21504;  // double errors corrected by LDPC_SyndromeCorrect()
+static const uint8_t LDPC_SyndromeHash[512] = {
+  0xFF, 0x0E, 0x46, 0xC6, 0xFF, 0xFF, 0x64, 0x26, 0x30, 0xFF, 0x63, 0xA0, 0xFF, 0xFF, 0x60, 0xA9,
+  0xBC, 0x09, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x6F, 0x4A, 0x69, 0x21, 0xFF, 0xAD, 0xB1, 0xFF, 0xFF, 0x1E, 0xFF, 0x7B, 0x9B, 0xCC, 0x12, 0xA5,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA3, 0x87, 0x15, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xAC, 0xFF,
+  0xFF, 0xFF, 0x73, 0xFF, 0xCB, 0xFF, 0xFF, 0xCE, 0xFF, 0xFF, 0xFF, 0x7F, 0x04, 0xFF, 0xFF, 0xFF,
+  0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0xC1, 0x5A, 0x4C, 0xBF, 0xC5, 0xFF, 0xFF, 0x23, 0xCF,
+  0x8D, 0x1B, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xA1, 0x19, 0xFF, 0xFF, 0x88, 0x0A, 0x42, 0xFF,
+  0xFF, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
+  0xFF, 0x58, 0xFF, 0x78, 0xB0, 0xB3, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x1D, 0x33,
+  0xFF, 0x0D, 0x55, 0xFF, 0x71, 0x8C, 0xFF, 0x95, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x35, 0x08, 0xFF, 0x59, 0x66, 0xFF, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xB5, 0xFF, 0xFF, 0xFF, 0x25, 0x7D, 0x8E, 0xFF, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xFF, 0x40,
+  0x4B, 0x98, 0x6E, 0xFF, 0xFF, 0xFF, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0x96, 0xFF,
+  0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0x85, 0x1A, 0x4F, 0xA7, 0xAE,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0xFF, 0xFF, 0xFF, 0x24, 0x49, 0x82, 0xB4, 0xB9, 0xBD, 0xCD,
+  0xFF, 0xFF, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0x6B, 0x9A,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xFF, 0xFF, 0x4E, 0x5E, 0x13, 0xFF, 0xC0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x3E, 0xAA, 0x3A, 0xBB, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x61, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xAF, 0xFF, 0x0F, 0x18, 0xFF, 0xFF, 0xFF, 0x6C, 0x83, 0x3C, 0xFF,
+  0x10, 0xFF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x29, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0x0C, 0xFF,
+  0xFF, 0x1F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x14, 0xFF, 0xFF, 0x74, 0x53, 0xFF, 0x07,
+  0xB6, 0xFF, 0x02, 0x06, 0xFF, 0xFF, 0x44, 0x5B, 0xFF, 0xFF, 0xFF, 0x90, 0xFF, 0x38, 0xFF, 0xFF,
+  0x2E, 0x4D, 0xFF, 0x7E, 0xFF, 0xFF, 0x5C, 0x76, 0xC7, 0xFF, 0x2A, 0xFF, 0x47, 0xFF, 0x11, 0x7A,
+  0x7C, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x2D, 0x6D, 0xFF, 0xFF, 0x1C, 0x99, 0xFF,
+  0x22, 0xFF, 0xFF, 0x67, 0x8F, 0xFF, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0x68, 0xA2,
+  0x45, 0xA6, 0x2C, 0x43, 0x97, 0x16, 0xFF, 0xFF, 0xFF, 0x62, 0x39, 0x52, 0x93, 0xA4, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC8, 0xFF, 0x50, 0xFF, 0xFF, 0x28, 0xFF, 0x56, 0xFF, 0xFF, 0x51, 0xFF, 0x72,
+  0xFF, 0x6A, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x8A, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x5D, 0xFF, 0xFF, 0xFF, 0xA8, 0x36, 0x3B, 0xC2, 0xFF, 0x86, 0x77,
+  0xFF, 0xFF, 0xFF, 0x17, 0x75, 0x70, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x27, 0x57, 0xFF, 0x01,
+} ;
+
+#endif // of __LDPC_DEC_H__
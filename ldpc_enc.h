@@ -0,0 +1,1333 @@
+// generated by host/ldpc_gen from the LDPC code matrices in ldpc.h - do not edit
+
+#ifndef __LDPC_ENC_H__
+#define __LDPC_ENC_H__
+
+#include <stdint.h>
+
+// parity contribution of every data byte value at every byte position:
+// 20 data bytes x 256 values x 48 parity bits (32 bits in [0], 16 bits in [1])
+static const uint32_t LDPC_ParityTable[20][256][2] = {
+ { // data byte #0
+  { 0x00000000, 0x0000 },{ 0x15885A03, 0x5E04 },{ 0xB8141426, 0xCA2F },{ 0xAD9C4E25, 0x942B },
+  { 0xFEF4BE44, 0xC474 },{ 0xEB7CE447, 0x9A70 },{ 0x46E0AA62, 0x0E5B },{ 0x5368F061, 0x505F },
+  { 0xBA667250, 0x7B8C },{ 0xAFEE2853, 0x2588 },{ 0x02726676, 0xB1A3 },{ 0x17FA3C75, 0xEFA7 },
+  { 0x4492CC14, 0xBFF8 },{ 0x511A9617, 0xE1FC },{ 0xFC86D832, 0x75D7 },{ 0xE90E8231, 0x2BD3 },
+  { 0xE8A2CD74, 0x1D8B },{ 0xFD2A9777, 0x438F },{ 0x50B6D952, 0xD7A4 },{ 0x453E8351, 0x89A0 },
+  { 0x16567330, 0xD9FF },{ 0x03DE2933, 0x87FB },{ 0xAE426716, 0x13D0 },{ 0xBBCA3D15, 0x4DD4 },
+  { 0x52C4BF24, 0x6607 },{ 0x474CE527, 0x3803 },{ 0xEAD0AB02, 0xAC28 },{ 0xFF58F101, 0xF22C },
+  { 0xAC300160, 0xA273 },{ 0xB9B85B63, 0xFC77 },{ 0x14241546, 0x685C },{ 0x01AC4F45, 0x3658 },
+  { 0xC74C24E0, 0x0ADA },{ 0xD2C47EE3, 0x54DE },{ 0x7F5830C6, 0xC0F5 },{ 0x6AD06AC5, 0x9EF1 },
+  { 0x39B89AA4, 0xCEAE },{ 0x2C30C0A7, 0x90AA },{ 0x81AC8E82, 0x0481 },{ 0x9424D481, 0x5A85 },
+  { 0x7D2A56B0, 0x7156 },{ 0x68A20CB3, 0x2F52 },{ 0xC53E4296, 0xBB79 },{ 0xD0B61895, 0xE57D },
+  { 0x83DEE8F4, 0xB522 },{ 0x9656B2F7, 0xEB26 },{ 0x3BCAFCD2, 0x7F0D },{ 0x2E42A6D1, 0x2109 },
+  { 0x2FEEE994, 0x1751 },{ 0x3A66B397, 0x4955 },{ 0x97FAFDB2, 0xDD7E },{ 0x8272A7B1, 0x837A },
+  { 0xD11A57D0, 0xD325 },{ 0xC4920DD3, 0x8D21 },{ 0x690E43F6, 0x190A },{ 0x7C8619F5, 0x470E },
+  { 0x95889BC4, 0x6CDD },{ 0x8000C1C7, 0x32D9 },{ 0x2D9C8FE2, 0xA6F2 },{ 0x3814D5E1, 0xF8F6 },
+  { 0x6B7C2580, 0xA8A9 },{ 0x7EF47F83, 0xF6AD },{ 0xD36831A6, 0x6286 },{ 0xC6E06BA5, 0x3C82 },
+  { 0xE2CC4F8E, 0x0748 },{ 0xF744158D, 0x594C },{ 0x5AD85BA8, 0xCD67 },{ 0x4F5001AB, 0x9363 },
+  { 0x1C38F1CA, 0xC33C },{ 0x09B0ABC9, 0x9D38 },{ 0xA42CE5EC, 0x0913 },{ 0xB1A4BFEF, 0x5717 },
+  { 0x58AA3DDE, 0x7CC4 },{ 0x4D2267DD, 0x22C0 },{ 0xE0BE29F8, 0xB6EB },{ 0xF53673FB, 0xE8EF },
+  { 0xA65E839A, 0xB8B0 },{ 0xB3D6D999, 0xE6B4 },{ 0x1E4A97BC, 0x729F },{ 0x0BC2CDBF, 0x2C9B },
+  { 0x0A6E82FA, 0x1AC3 },{ 0x1FE6D8F9, 0x44C7 },{ 0xB27A96DC, 0xD0EC },{ 0xA7F2CCDF, 0x8EE8 },
+  { 0xF49A3CBE, 0xDEB7 },{ 0xE11266BD, 0x80B3 },{ 0x4C8E2898, 0x1498 },{ 0x5906729B, 0x4A9C },
+  { 0xB008F0AA, 0x614F },{ 0xA580AAA9, 0x3F4B },{ 0x081CE48C, 0xAB60 },{ 0x1D94BE8F, 0xF564 },
+  { 0x4EFC4EEE, 0xA53B },{ 0x5B7414ED, 0xFB3F },{ 0xF6E85AC8, 0x6F14 },{ 0xE36000CB, 0x3110 },
+  { 0x25806B6E, 0x0D92 },{ 0x3008316D, 0x5396 },{ 0x9D947F48, 0xC7BD },{ 0x881C254B, 0x99B9 },
+  { 0xDB74D52A, 0xC9E6 },{ 0xCEFC8F29, 0x97E2 },{ 0x6360C10C, 0x03C9 },{ 0x76E89B0F, 0x5DCD },
+  { 0x9FE6193E, 0x761E },{ 0x8A6E433D, 0x281A },{ 0x27F20D18, 0xBC31 },{ 0x327A571B, 0xE235 },
+  { 0x6112A77A, 0xB26A },{ 0x749AFD79, 0xEC6E },{ 0xD906B35C, 0x7845 },{ 0xCC8EE95F, 0x2641 },
+  { 0xCD22A61A, 0x1019 },{ 0xD8AAFC19, 0x4E1D },{ 0x7536B23C, 0xDA36 },{ 0x60BEE83F, 0x8432 },
+  { 0x33D6185E, 0xD46D },{ 0x265E425D, 0x8A69 },{ 0x8BC20C78, 0x1E42 },{ 0x9E4A567B, 0x4046 },
+  { 0x7744D44A, 0x6B95 },{ 0x62CC8E49, 0x3591 },{ 0xCF50C06C, 0xA1BA },{ 0xDAD89A6F, 0xFFBE },
+  { 0x89B06A0E, 0xAFE1 },{ 0x9C38300D, 0xF1E5 },{ 0x31A47E28, 0x65CE },{ 0x242C242B, 0x3BCA },
+  { 0xCB41B943, 0x08D0 },{ 0xDEC9E340, 0x56D4 },{ 0x7355AD65, 0xC2FF },{ 0x66DDF766, 0x9CFB },
+  { 0x35B50707, 0xCCA4 },{ 0x203D5D04, 0x92A0 },{ 0x8DA11321, 0x068B },{ 0x98294922, 0x588F },
+  { 0x7127CB13, 0x735C },{ 0x64AF9110, 0x2D58 },{ 0xC933DF35, 0xB973 },{ 0xDCBB8536, 0xE777 },
+  { 0x8FD37557, 0xB728 },{ 0x9A5B2F54, 0xE92C },{ 0x37C76171, 0x7D07 },{ 0x224F3B72, 0x2303 },
+  { 0x23E37437, 0x155B },{ 0x366B2E34, 0x4B5F },{ 0x9BF76011, 0xDF74 },{ 0x8E7F3A12, 0x8170 },
+  { 0xDD17CA73, 0xD12F },{ 0xC89F9070, 0x8F2B },{ 0x6503DE55, 0x1B00 },{ 0x708B8456, 0x4504 },
+  { 0x99850667, 0x6ED7 },{ 0x8C0D5C64, 0x30D3 },{ 0x21911241, 0xA4F8 },{ 0x34194842, 0xFAFC },
+  { 0x6771B823, 0xAAA3 },{ 0x72F9E220, 0xF4A7 },{ 0xDF65AC05, 0x608C },{ 0xCAEDF606, 0x3E88 },
+  { 0x0C0D9DA3, 0x020A },{ 0x1985C7A0, 0x5C0E },{ 0xB4198985, 0xC825 },{ 0xA191D386, 0x9621 },
+  { 0xF2F923E7, 0xC67E },{ 0xE77179E4, 0x987A },{ 0x4AED37C1, 0x0C51 },{ 0x5F656DC2, 0x5255 },
+  { 0xB66BEFF3, 0x7986 },{ 0xA3E3B5F0, 0x2782 },{ 0x0E7FFBD5, 0xB3A9 },{ 0x1BF7A1D6, 0xEDAD },
+  { 0x489F51B7, 0xBDF2 },{ 0x5D170BB4, 0xE3F6 },{ 0xF08B4591, 0x77DD },{ 0xE5031F92, 0x29D9 },
+  { 0xE4AF50D7, 0x1F81 },{ 0xF1270AD4, 0x4185 },{ 0x5CBB44F1, 0xD5AE },{ 0x49331EF2, 0x8BAA },
+  { 0x1A5BEE93, 0xDBF5 },{ 0x0FD3B490, 0x85F1 },{ 0xA24FFAB5, 0x11DA },{ 0xB7C7A0B6, 0x4FDE },
+  { 0x5EC92287, 0x640D },{ 0x4B417884, 0x3A09 },{ 0xE6DD36A1, 0xAE22 },{ 0xF3556CA2, 0xF026 },
+  { 0xA03D9CC3, 0xA079 },{ 0xB5B5C6C0, 0xFE7D },{ 0x182988E5, 0x6A56 },{ 0x0DA1D2E6, 0x3452 },
+  { 0x298DF6CD, 0x0F98 },{ 0x3C05ACCE, 0x519C },{ 0x9199E2EB, 0xC5B7 },{ 0x8411B8E8, 0x9BB3 },
+  { 0xD7794889, 0xCBEC },{ 0xC2F1128A, 0x95E8 },{ 0x6F6D5CAF, 0x01C3 },{ 0x7AE506AC, 0x5FC7 },
+  { 0x93EB849D, 0x7414 },{ 0x8663DE9E, 0x2A10 },{ 0x2BFF90BB, 0xBE3B },{ 0x3E77CAB8, 0xE03F },
+  { 0x6D1F3AD9, 0xB060 },{ 0x789760DA, 0xEE64 },{ 0xD50B2EFF, 0x7A4F },{ 0xC08374FC, 0x244B },
+  { 0xC12F3BB9, 0x1213 },{ 0xD4A761BA, 0x4C17 },{ 0x793B2F9F, 0xD83C },{ 0x6CB3759C, 0x8638 },
+  { 0x3FDB85FD, 0xD667 },{ 0x2A53DFFE, 0x8863 },{ 0x87CF91DB, 0x1C48 },{ 0x9247CBD8, 0x424C },
+  { 0x7B4949E9, 0x699F },{ 0x6EC113EA, 0x379B },{ 0xC35D5DCF, 0xA3B0 },{ 0xD6D507CC, 0xFDB4 },
+  { 0x85BDF7AD, 0xADEB },{ 0x9035ADAE, 0xF3EF },{ 0x3DA9E38B, 0x67C4 },{ 0x2821B988, 0x39C0 },
+  { 0xEEC1D22D, 0x0542 },{ 0xFB49882E, 0x5B46 },{ 0x56D5C60B, 0xCF6D },{ 0x435D9C08, 0x9169 },
+  { 0x10356C69, 0xC136 },{ 0x05BD366A, 0x9F32 },{ 0xA821784F, 0x0B19 },{ 0xBDA9224C, 0x551D },
+  { 0x54A7A07D, 0x7ECE },{ 0x412FFA7E, 0x20CA },{ 0xECB3B45B, 0xB4E1 },{ 0xF93BEE58, 0xEAE5 },
+  { 0xAA531E39, 0xBABA },{ 0xBFDB443A, 0xE4BE },{ 0x12470A1F, 0x7095 },{ 0x07CF501C, 0x2E91 },
+  { 0x06631F59, 0x18C9 },{ 0x13EB455A, 0x46CD },{ 0xBE770B7F, 0xD2E6 },{ 0xABFF517C, 0x8CE2 },
+  { 0xF897A11D, 0xDCBD },{ 0xED1FFB1E, 0x82B9 },{ 0x4083B53B, 0x1692 },{ 0x550BEF38, 0x4896 },
+  { 0xBC056D09, 0x6345 },{ 0xA98D370A, 0x3D41 },{ 0x0411792F, 0xA96A },{ 0x1199232C, 0xF76E },
+  { 0x42F1D34D, 0xA731 },{ 0x5779894E, 0xF935 },{ 0xFAE5C76B, 0x6D1E },{ 0xEF6D9D68, 0x331A },
+ },
+ { // data byte #1
+  { 0x00000000, 0x0000 },{ 0xB1ABB396, 0x680C },{ 0x802C2AFB, 0x5E93 },{ 0x3187996D, 0x369F },
+  { 0xC892A8D6, 0xBEE2 },{ 0x79391B40, 0xD6EE },{ 0x48BE822D, 0xE071 },{ 0xF91531BB, 0x887D },
+  { 0xB88ACC06, 0x4F0D },{ 0x09217F90, 0x2701 },{ 0x38A6E6FD, 0x119E },{ 0x890D556B, 0x7992 },
+  { 0x701864D0, 0xF1EF },{ 0xC1B3D746, 0x99E3 },{ 0xF0344E2B, 0xAF7C },{ 0x419FFDBD, 0xC770 },
+  { 0x411079F8, 0xA0E2 },{ 0xF0BBCA6E, 0xC8EE },{ 0xC13C5303, 0xFE71 },{ 0x7097E095, 0x967D },
+  { 0x8982D12E, 0x1E00 },{ 0x382962B8, 0x760C },{ 0x09AEFBD5, 0x4093 },{ 0xB8054843, 0x289F },
+  { 0xF99AB5FE, 0xEFEF },{ 0x48310668, 0x87E3 },{ 0x79B69F05, 0xB17C },{ 0xC81D2C93, 0xD970 },
+  { 0x31081D28, 0x510D },{ 0x80A3AEBE, 0x3901 },{ 0xB12437D3, 0x0F9E },{ 0x008F8445, 0x6792 },
+  { 0x109941E0, 0xE9AF },{ 0xA132F276, 0x81A3 },{ 0x90B56B1B, 0xB73C },{ 0x211ED88D, 0xDF30 },
+  { 0xD80BE936, 0x574D },{ 0x69A05AA0, 0x3F41 },{ 0x5827C3CD, 0x09DE },{ 0xE98C705B, 0x61D2 },
+  { 0xA8138DE6, 0xA6A2 },{ 0x19B83E70, 0xCEAE },{ 0x283FA71D, 0xF831 },{ 0x9994148B, 0x903D },
+  { 0x60812530, 0x1840 },{ 0xD12A96A6, 0x704C },{ 0xE0AD0FCB, 0x46D3 },{ 0x5106BC5D, 0x2EDF },
+  { 0x51893818, 0x494D },{ 0xE0228B8E, 0x2141 },{ 0xD1A512E3, 0x17DE },{ 0x600EA175, 0x7FD2 },
+  { 0x991B90CE, 0xF7AF },{ 0x28B02358, 0x9FA3 },{ 0x1937BA35, 0xA93C },{ 0xA89C09A3, 0xC130 },
+  { 0xE903F41E, 0x0640 },{ 0x58A84788, 0x6E4C },{ 0x692FDEE5, 0x58D3 },{ 0xD8846D73, 0x30DF },
+  { 0x21915CC8, 0xB8A2 },{ 0x903AEF5E, 0xD0AE },{ 0xA1BD7633, 0xE631 },{ 0x1016C5A5, 0x8E3D },
+  { 0xDA5791B0, 0x6246 },{ 0x6BFC2226, 0x0A4A },{ 0x5A7BBB4B, 0x3CD5 },{ 0xEBD008DD, 0x54D9 },
+  { 0x12C53966, 0xDCA4 },{ 0xA36E8AF0, 0xB4A8 },{ 0x92E9139D, 0x8237 },{ 0x2342A00B, 0xEA3B },
+  { 0x62DD5DB6, 0x2D4B },{ 0xD376EE20, 0x4547 },{ 0xE2F1774D, 0x73D8 },{ 0x535AC4DB, 0x1BD4 },
+  { 0xAA4FF560, 0x93A9 },{ 0x1BE446F6, 0xFBA5 },{ 0x2A63DF9B, 0xCD3A },{ 0x9BC86C0D, 0xA536 },
+  { 0x9B47E848, 0xC2A4 },{ 0x2AEC5BDE, 0xAAA8 },{ 0x1B6BC2B3, 0x9C37 },{ 0xAAC07125, 0xF43B },
+  { 0x53D5409E, 0x7C46 },{ 0xE27EF308, 0x144A },{ 0xD3F96A65, 0x22D5 },{ 0x6252D9F3, 0x4AD9 },
+  { 0x23CD244E, 0x8DA9 },{ 0x926697D8, 0xE5A5 },{ 0xA3E10EB5, 0xD33A },{ 0x124ABD23, 0xBB36 },
+  { 0xEB5F8C98, 0x334B },{ 0x5AF43F0E, 0x5B47 },{ 0x6B73A663, 0x6DD8 },{ 0xDAD815F5, 0x05D4 },
+  { 0xCACED050, 0x8BE9 },{ 0x7B6563C6, 0xE3E5 },{ 0x4AE2FAAB, 0xD57A },{ 0xFB49493D, 0xBD76 },
+  { 0x025C7886, 0x350B },{ 0xB3F7CB10, 0x5D07 },{ 0x8270527D, 0x6B98 },{ 0x33DBE1EB, 0x0394 },
+  { 0x72441C56, 0xC4E4 },{ 0xC3EFAFC0, 0xACE8 },{ 0xF26836AD, 0x9A77 },{ 0x43C3853B, 0xF27B },
+  { 0xBAD6B480, 0x7A06 },{ 0x0B7D0716, 0x120A },{ 0x3AFA9E7B, 0x2495 },{ 0x8B512DED, 0x4C99 },
+  { 0x8BDEA9A8, 0x2B0B },{ 0x3A751A3E, 0x4307 },{ 0x0BF28353, 0x7598 },{ 0xBA5930C5, 0x1D94 },
+  { 0x434C017E, 0x95E9 },{ 0xF2E7B2E8, 0xFDE5 },{ 0xC3602B85, 0xCB7A },{ 0x72CB9813, 0xA376 },
+  { 0x335465AE, 0x6406 },{ 0x82FFD638, 0x0C0A },{ 0xB3784F55, 0x3A95 },{ 0x02D3FCC3, 0x5299 },
+  { 0xFBC6CD78, 0xDAE4 },{ 0x4A6D7EEE, 0xB2E8 },{ 0x7BEAE783, 0x8477 },{ 0xCA415415, 0xEC7B },
+  { 0xD4293814, 0x405C },{ 0x65828B82, 0x2850 },{ 0x540512EF, 0x1ECF },{ 0xE5AEA179, 0x76C3 },
+  { 0x1CBB90C2, 0xFEBE },{ 0xAD102354, 0x96B2 },{ 0x9C97BA39, 0xA02D },{ 0x2D3C09AF, 0xC821 },
+  { 0x6CA3F412, 0x0F51 },{ 0xDD084784, 0x675D },{ 0xEC8FDEE9, 0x51C2 },{ 0x5D246D7F, 0x39CE },
+  { 0xA4315CC4, 0xB1B3 },{ 0x159AEF52, 0xD9BF },{ 0x241D763F, 0xEF20 },{ 0x95B6C5A9, 0x872C },
+  { 0x953941EC, 0xE0BE },{ 0x2492F27A, 0x88B2 },{ 0x15156B17, 0xBE2D },{ 0xA4BED881, 0xD621 },
+  { 0x5DABE93A, 0x5E5C },{ 0xEC005AAC, 0x3650 },{ 0xDD87C3C1, 0x00CF },{ 0x6C2C7057, 0x68C3 },
+  { 0x2DB38DEA, 0xAFB3 },{ 0x9C183E7C, 0xC7BF },{ 0xAD9FA711, 0xF120 },{ 0x1C341487, 0x992C },
+  { 0xE521253C, 0x1151 },{ 0x548A96AA, 0x795D },{ 0x650D0FC7, 0x4FC2 },{ 0xD4A6BC51, 0x27CE },
+  { 0xC4B079F4, 0xA9F3 },{ 0x751BCA62, 0xC1FF },{ 0x449C530F, 0xF760 },{ 0xF537E099, 0x9F6C },
+  { 0x0C22D122, 0x1711 },{ 0xBD8962B4, 0x7F1D },{ 0x8C0EFBD9, 0x4982 },{ 0x3DA5484F, 0x218E },
+  { 0x7C3AB5F2, 0xE6FE },{ 0xCD910664, 0x8EF2 },{ 0xFC169F09, 0xB86D },{ 0x4DBD2C9F, 0xD061 },
+  { 0xB4A81D24, 0x581C },{ 0x0503AEB2, 0x3010 },{ 0x348437DF, 0x068F },{ 0x852F8449, 0x6E83 },
+  { 0x85A0000C, 0x0911 },{ 0x340BB39A, 0x611D },{ 0x058C2AF7, 0x5782 },{ 0xB4279961, 0x3F8E },
+  { 0x4D32A8DA, 0xB7F3 },{ 0xFC991B4C, 0xDFFF },{ 0xCD1E8221, 0xE960 },{ 0x7CB531B7, 0x816C },
+  { 0x3D2ACC0A, 0x461C },{ 0x8C817F9C, 0x2E10 },{ 0xBD06E6F1, 0x188F },{ 0x0CAD5567, 0x7083 },
+  { 0xF5B864DC, 0xF8FE },{ 0x4413D74A, 0x90F2 },{ 0x75944E27, 0xA66D },{ 0xC43FFDB1, 0xCE61 },
+  { 0x0E7EA9A4, 0x221A },{ 0xBFD51A32, 0x4A16 },{ 0x8E52835F, 0x7C89 },{ 0x3FF930C9, 0x1485 },
+  { 0xC6EC0172, 0x9CF8 },{ 0x7747B2E4, 0xF4F4 },{ 0x46C02B89, 0xC26B },{ 0xF76B981F, 0xAA67 },
+  { 0xB6F465A2, 0x6D17 },{ 0x075FD634, 0x051B },{ 0x36D84F59, 0x3384 },{ 0x8773FCCF, 0x5B88 },
+  { 0x7E66CD74, 0xD3F5 },{ 0xCFCD7EE2, 0xBBF9 },{ 0xFE4AE78F, 0x8D66 },{ 0x4FE15419, 0xE56A },
+  { 0x4F6ED05C, 0x82F8 },{ 0xFEC563CA, 0xEAF4 },{ 0xCF42FAA7, 0xDC6B },{ 0x7EE94931, 0xB467 },
+  { 0x87FC788A, 0x3C1A },{ 0x3657CB1C, 0x5416 },{ 0x07D05271, 0x6289 },{ 0xB67BE1E7, 0x0A85 },
+  { 0xF7E41C5A, 0xCDF5 },{ 0x464FAFCC, 0xA5F9 },{ 0x77C836A1, 0x9366 },{ 0xC6638537, 0xFB6A },
+  { 0x3F76B48C, 0x7317 },{ 0x8EDD071A, 0x1B1B },{ 0xBF5A9E77, 0x2D84 },{ 0x0EF12DE1, 0x4588 },
+  { 0x1EE7E844, 0xCBB5 },{ 0xAF4C5BD2, 0xA3B9 },{ 0x9ECBC2BF, 0x9526 },{ 0x2F607129, 0xFD2A },
+  { 0xD6754092, 0x7557 },{ 0x67DEF304, 0x1D5B },{ 0x56596A69, 0x2BC4 },{ 0xE7F2D9FF, 0x43C8 },
+  { 0xA66D2442, 0x84B8 },{ 0x17C697D4, 0xECB4 },{ 0x26410EB9, 0xDA2B },{ 0x97EABD2F, 0xB227 },
+  { 0x6EFF8C94, 0x3A5A },{ 0xDF543F02, 0x5256 },{ 0xEED3A66F, 0x64C9 },{ 0x5F7815F9, 0x0CC5 },
+  { 0x5FF791BC, 0x6B57 },{ 0xEE5C222A, 0x035B },{ 0xDFDBBB47, 0x35C4 },{ 0x6E7008D1, 0x5DC8 },
+  { 0x9765396A, 0xD5B5 },{ 0x26CE8AFC, 0xBDB9 },{ 0x17491391, 0x8B26 },{ 0xA6E2A007, 0xE32A },
+  { 0xE77D5DBA, 0x245A },{ 0x56D6EE2C, 0x4C56 },{ 0x67517741, 0x7AC9 },{ 0xD6FAC4D7, 0x12C5 },
+  { 0x2FEFF56C, 0x9AB8 },{ 0x9E4446FA, 0xF2B4 },{ 0xAFC3DF97, 0xC42B },{ 0x1E686C01, 0xAC27 },
+ },
+ { // data byte #2
+  { 0x00000000, 0x0000 },{ 0x177BA78D, 0xF0A4 },{ 0xB0A7E998, 0x570C },{ 0xA7DC4E15, 0xA7A8 },
+  { 0xED1D44DA, 0xAAF8 },{ 0xFA66E357, 0x5A5C },{ 0x5DBAAD42, 0xFDF4 },{ 0x4AC10ACF, 0x0D50 },
+  { 0x8F7F8A23, 0x9A36 },{ 0x98042DAE, 0x6A92 },{ 0x3FD863BB, 0xCD3A },{ 0x28A3C436, 0x3D9E },
+  { 0x6262CEF9, 0x30CE },{ 0x75196974, 0xC06A },{ 0xD2C52761, 0x67C2 },{ 0xC5BE80EC, 0x9766 },
+  { 0xBB685822, 0x410B },{ 0xAC13FFAF, 0xB1AF },{ 0x0BCFB1BA, 0x1607 },{ 0x1CB41637, 0xE6A3 },
+  { 0x56751CF8, 0xEBF3 },{ 0x410EBB75, 0x1B57 },{ 0xE6D2F560, 0xBCFF },{ 0xF1A952ED, 0x4C5B },
+  { 0x3417D201, 0xDB3D },{ 0x236C758C, 0x2B99 },{ 0x84B03B99, 0x8C31 },{ 0x93CB9C14, 0x7C95 },
+  { 0xD90A96DB, 0x71C5 },{ 0xCE713156, 0x8161 },{ 0x69AD7F43, 0x26C9 },{ 0x7ED6D8CE, 0xD66D },
+  { 0x3C07BEA3, 0x7A2F },{ 0x2B7C192E, 0x8A8B },{ 0x8CA0573B, 0x2D23 },{ 0x9BDBF0B6, 0xDD87 },
+  { 0xD11AFA79, 0xD0D7 },{ 0xC6615DF4, 0x2073 },{ 0x61BD13E1, 0x87DB },{ 0x76C6B46C, 0x777F },
+  { 0xB3783480, 0xE019 },{ 0xA403930D, 0x10BD },{ 0x03DFDD18, 0xB715 },{ 0x14A47A95, 0x47B1 },
+  { 0x5E65705A, 0x4AE1 },{ 0x491ED7D7, 0xBA45 },{ 0xEEC299C2, 0x1DED },{ 0xF9B93E4F, 0xED49 },
+  { 0x876FE681, 0x3B24 },{ 0x9014410C, 0xCB80 },{ 0x37C80F19, 0x6C28 },{ 0x20B3A894, 0x9C8C },
+  { 0x6A72A25B, 0x91DC },{ 0x7D0905D6, 0x6178 },{ 0xDAD54BC3, 0xC6D0 },{ 0xCDAEEC4E, 0x3674 },
+  { 0x08106CA2, 0xA112 },{ 0x1F6BCB2F, 0x51B6 },{ 0xB8B7853A, 0xF61E },{ 0xAFCC22B7, 0x06BA },
+  { 0xE50D2878, 0x0BEA },{ 0xF2768FF5, 0xFB4E },{ 0x55AAC1E0, 0x5CE6 },{ 0x42D1666D, 0xAC42 },
+  { 0x8AF3F9AC, 0xAD03 },{ 0x9D885E21, 0x5DA7 },{ 0x3A541034, 0xFA0F },{ 0x2D2FB7B9, 0x0AAB },
+  { 0x67EEBD76, 0x07FB },{ 0x70951AFB, 0xF75F },{ 0xD74954EE, 0x50F7 },{ 0xC032F363, 0xA053 },
+  { 0x058C738F, 0x3735 },{ 0x12F7D402, 0xC791 },{ 0xB52B9A17, 0x6039 },{ 0xA2503D9A, 0x909D },
+  { 0xE8913755, 0x9DCD },{ 0xFFEA90D8, 0x6D69 },{ 0x5836DECD, 0xCAC1 },{ 0x4F4D7940, 0x3A65 },
+  { 0x319BA18E, 0xEC08 },{ 0x26E00603, 0x1CAC },{ 0x813C4816, 0xBB04 },{ 0x9647EF9B, 0x4BA0 },
+  { 0xDC86E554, 0x46F0 },{ 0xCBFD42D9, 0xB654 },{ 0x6C210CCC, 0x11FC },{ 0x7B5AAB41, 0xE158 },
+  { 0xBEE42BAD, 0x763E },{ 0xA99F8C20, 0x869A },{ 0x0E43C235, 0x2132 },{ 0x193865B8, 0xD196 },
+  { 0x53F96F77, 0xDCC6 },{ 0x4482C8FA, 0x2C62 },{ 0xE35E86EF, 0x8BCA },{ 0xF4252162, 0x7B6E },
+  { 0xB6F4470F, 0xD72C },{ 0xA18FE082, 0x2788 },{ 0x0653AE97, 0x8020 },{ 0x1128091A, 0x7084 },
+  { 0x5BE903D5, 0x7DD4 },{ 0x4C92A458, 0x8D70 },{ 0xEB4EEA4D, 0x2AD8 },{ 0xFC354DC0, 0xDA7C },
+  { 0x398BCD2C, 0x4D1A },{ 0x2EF06AA1, 0xBDBE },{ 0x892C24B4, 0x1A16 },{ 0x9E578339, 0xEAB2 },
+  { 0xD49689F6, 0xE7E2 },{ 0xC3ED2E7B, 0x1746 },{ 0x6431606E, 0xB0EE },{ 0x734AC7E3, 0x404A },
+  { 0x0D9C1F2D, 0x9627 },{ 0x1AE7B8A0, 0x6683 },{ 0xBD3BF6B5, 0xC12B },{ 0xAA405138, 0x318F },
+  { 0xE0815BF7, 0x3CDF },{ 0xF7FAFC7A, 0xCC7B },{ 0x5026B26F, 0x6BD3 },{ 0x475D15E2, 0x9B77 },
+  { 0x82E3950E, 0x0C11 },{ 0x95983283, 0xFCB5 },{ 0x32447C96, 0x5B1D },{ 0x253FDB1B, 0xABB9 },
+  { 0x6FFED1D4, 0xA6E9 },{ 0x78857659, 0x564D },{ 0xDF59384C, 0xF1E5 },{ 0xC8229FC1, 0x0141 },
+  { 0x27F3C5FB, 0x9CAB },{ 0x30886276, 0x6C0F },{ 0x97542C63, 0xCBA7 },{ 0x802F8BEE, 0x3B03 },
+  { 0xCAEE8121, 0x3653 },{ 0xDD9526AC, 0xC6F7 },{ 0x7A4968B9, 0x615F },{ 0x6D32CF34, 0x91FB },
+  { 0xA88C4FD8, 0x069D },{ 0xBFF7E855, 0xF639 },{ 0x182BA640, 0x5191 },{ 0x0F5001CD, 0xA135 },
+  { 0x45910B02, 0xAC65 },{ 0x52EAAC8F, 0x5CC1 },{ 0xF536E29A, 0xFB69 },{ 0xE24D4517, 0x0BCD },
+  { 0x9C9B9DD9, 0xDDA0 },{ 0x8BE03A54, 0x2D04 },{ 0x2C3C7441, 0x8AAC },{ 0x3B47D3CC, 0x7A08 },
+  { 0x7186D903, 0x7758 },{ 0x66FD7E8E, 0x87FC },{ 0xC121309B, 0x2054 },{ 0xD65A9716, 0xD0F0 },
+  { 0x13E417FA, 0x4796 },{ 0x049FB077, 0xB732 },{ 0xA343FE62, 0x109A },{ 0xB43859EF, 0xE03E },
+  { 0xFEF95320, 0xED6E },{ 0xE982F4AD, 0x1DCA },{ 0x4E5EBAB8, 0xBA62 },{ 0x59251D35, 0x4AC6 },
+  { 0x1BF47B58, 0xE684 },{ 0x0C8FDCD5, 0x1620 },{ 0xAB5392C0, 0xB188 },{ 0xBC28354D, 0x412C },
+  { 0xF6E93F82, 0x4C7C },{ 0xE192980F, 0xBCD8 },{ 0x464ED61A, 0x1B70 },{ 0x51357197, 0xEBD4 },
+  { 0x948BF17B, 0x7CB2 },{ 0x83F056F6, 0x8C16 },{ 0x242C18E3, 0x2BBE },{ 0x3357BF6E, 0xDB1A },
+  { 0x7996B5A1, 0xD64A },{ 0x6EED122C, 0x26EE },{ 0xC9315C39, 0x8146 },{ 0xDE4AFBB4, 0x71E2 },
+  { 0xA09C237A, 0xA78F },{ 0xB7E784F7, 0x572B },{ 0x103BCAE2, 0xF083 },{ 0x07406D6F, 0x0027 },
+  { 0x4D8167A0, 0x0D77 },{ 0x5AFAC02D, 0xFDD3 },{ 0xFD268E38, 0x5A7B },{ 0xEA5D29B5, 0xAADF },
+  { 0x2FE3A959, 0x3DB9 },{ 0x38980ED4, 0xCD1D },{ 0x9F4440C1, 0x6AB5 },{ 0x883FE74C, 0x9A11 },
+  { 0xC2FEED83, 0x9741 },{ 0xD5854A0E, 0x67E5 },{ 0x7259041B, 0xC04D },{ 0x6522A396, 0x30E9 },
+  { 0xAD003C57, 0x31A8 },{ 0xBA7B9BDA, 0xC10C },{ 0x1DA7D5CF, 0x66A4 },{ 0x0ADC7242, 0x9600 },
+  { 0x401D788D, 0x9B50 },{ 0x5766DF00, 0x6BF4 },{ 0xF0BA9115, 0xCC5C },{ 0xE7C13698, 0x3CF8 },
+  { 0x227FB674, 0xAB9E },{ 0x350411F9, 0x5B3A },{ 0x92D85FEC, 0xFC92 },{ 0x85A3F861, 0x0C36 },
+  { 0xCF62F2AE, 0x0166 },{ 0xD8195523, 0xF1C2 },{ 0x7FC51B36, 0x566A },{ 0x68BEBCBB, 0xA6CE },
+  { 0x16686475, 0x70A3 },{ 0x0113C3F8, 0x8007 },{ 0xA6CF8DED, 0x27AF },{ 0xB1B42A60, 0xD70B },
+  { 0xFB7520AF, 0xDA5B },{ 0xEC0E8722, 0x2AFF },{ 0x4BD2C937, 0x8D57 },{ 0x5CA96EBA, 0x7DF3 },
+  { 0x9917EE56, 0xEA95 },{ 0x8E6C49DB, 0x1A31 },{ 0x29B007CE, 0xBD99 },{ 0x3ECBA043, 0x4D3D },
+  { 0x740AAA8C, 0x406D },{ 0x63710D01, 0xB0C9 },{ 0xC4AD4314, 0x1761 },{ 0xD3D6E499, 0xE7C5 },
+  { 0x910782F4, 0x4B87 },{ 0x867C2579, 0xBB23 },{ 0x21A06B6C, 0x1C8B },{ 0x36DBCCE1, 0xEC2F },
+  { 0x7C1AC62E, 0xE17F },{ 0x6B6161A3, 0x11DB },{ 0xCCBD2FB6, 0xB673 },{ 0xDBC6883B, 0x46D7 },
+  { 0x1E7808D7, 0xD1B1 },{ 0x0903AF5A, 0x2115 },{ 0xAEDFE14F, 0x86BD },{ 0xB9A446C2, 0x7619 },
+  { 0xF3654C0D, 0x7B49 },{ 0xE41EEB80, 0x8BED },{ 0x43C2A595, 0x2C45 },{ 0x54B90218, 0xDCE1 },
+  { 0x2A6FDAD6, 0x0A8C },{ 0x3D147D5B, 0xFA28 },{ 0x9AC8334E, 0x5D80 },{ 0x8DB394C3, 0xAD24 },
+  { 0xC7729E0C, 0xA074 },{ 0xD0093981, 0x50D0 },{ 0x77D57794, 0xF778 },{ 0x60AED019, 0x07DC },
+  { 0xA51050F5, 0x90BA },{ 0xB26BF778, 0x601E },{ 0x15B7B96D, 0xC7B6 },{ 0x02CC1EE0, 0x3712 },
+  { 0x480D142F, 0x3A42 },{ 0x5F76B3A2, 0xCAE6 },{ 0xF8AAFDB7, 0x6D4E },{ 0xEFD15A3A, 0x9DEA },
+ },
+ { // data byte #3
+  { 0x00000000, 0x0000 },{ 0x423EAE30, 0xBB63 },{ 0xF52AD874, 0x41DE },{ 0xB7147644, 0xFABD },
+  { 0xFD3AB68E, 0xE17C },{ 0xBF0418BE, 0x5A1F },{ 0x08106EFA, 0xA0A2 },{ 0x4A2EC0CA, 0x1BC1 },
+  { 0xD18512E2, 0x47E7 },{ 0x93BBBCD2, 0xFC84 },{ 0x24AFCA96, 0x0639 },{ 0x669164A6, 0xBD5A },
+  { 0x2CBFA46C, 0xA69B },{ 0x6E810A5C, 0x1DF8 },{ 0xD9957C18, 0xE745 },{ 0x9BABD228, 0x5C26 },
+  { 0xF8BAC5B0, 0xCDAB },{ 0xBA846B80, 0x76C8 },{ 0x0D901DC4, 0x8C75 },{ 0x4FAEB3F4, 0x3716 },
+  { 0x0580733E, 0x2CD7 },{ 0x47BEDD0E, 0x97B4 },{ 0xF0AAAB4A, 0x6D09 },{ 0xB294057A, 0xD66A },
+  { 0x293FD752, 0x8A4C },{ 0x6B017962, 0x312F },{ 0xDC150F26, 0xCB92 },{ 0x9E2BA116, 0x70F1 },
+  { 0xD40561DC, 0x6B30 },{ 0x963BCFEC, 0xD053 },{ 0x212FB9A8, 0x2AEE },{ 0x63111798, 0x918D },
+  { 0x5E4950F4, 0x50D7 },{ 0x1C77FEC4, 0xEBB4 },{ 0xAB638880, 0x1109 },{ 0xE95D26B0, 0xAA6A },
+  { 0xA373E67A, 0xB1AB },{ 0xE14D484A, 0x0AC8 },{ 0x56593E0E, 0xF075 },{ 0x1467903E, 0x4B16 },
+  { 0x8FCC4216, 0x1730 },{ 0xCDF2EC26, 0xAC53 },{ 0x7AE69A62, 0x56EE },{ 0x38D83452, 0xED8D },
+  { 0x72F6F498, 0xF64C },{ 0x30C85AA8, 0x4D2F },{ 0x87DC2CEC, 0xB792 },{ 0xC5E282DC, 0x0CF1 },
+  { 0xA6F39544, 0x9D7C },{ 0xE4CD3B74, 0x261F },{ 0x53D94D30, 0xDCA2 },{ 0x11E7E300, 0x67C1 },
+  { 0x5BC923CA, 0x7C00 },{ 0x19F78DFA, 0xC763 },{ 0xAEE3FBBE, 0x3DDE },{ 0xECDD558E, 0x86BD },
+  { 0x777687A6, 0xDA9B },{ 0x35482996, 0x61F8 },{ 0x825C5FD2, 0x9B45 },{ 0xC062F1E2, 0x2026 },
+  { 0x8A4C3128, 0x3BE7 },{ 0xC8729F18, 0x8084 },{ 0x7F66E95C, 0x7A39 },{ 0x3D58476C, 0xC15A },
+  { 0x1FD7B13F, 0xD727 },{ 0x5DE91F0F, 0x6C44 },{ 0xEAFD694B, 0x96F9 },{ 0xA8C3C77B, 0x2D9A },
+  { 0xE2ED07B1, 0x365B },{ 0xA0D3A981, 0x8D38 },{ 0x17C7DFC5, 0x7785 },{ 0x55F971F5, 0xCCE6 },
+  { 0xCE52A3DD, 0x90C0 },{ 0x8C6C0DED, 0x2BA3 },{ 0x3B787BA9, 0xD11E },{ 0x7946D599, 0x6A7D },
+  { 0x33681553, 0x71BC },{ 0x7156BB63, 0xCADF },{ 0xC642CD27, 0x3062 },{ 0x847C6317, 0x8B01 },
+  { 0xE76D748F, 0x1A8C },{ 0xA553DABF, 0xA1EF },{ 0x1247ACFB, 0x5B52 },{ 0x507902CB, 0xE031 },
+  { 0x1A57C201, 0xFBF0 },{ 0x58696C31, 0x4093 },{ 0xEF7D1A75, 0xBA2E },{ 0xAD43B445, 0x014D },
+  { 0x36E8666D, 0x5D6B },{ 0x74D6C85D, 0xE608 },{ 0xC3C2BE19, 0x1CB5 },{ 0x81FC1029, 0xA7D6 },
+  { 0xCBD2D0E3, 0xBC17 },{ 0x89EC7ED3, 0x0774 },{ 0x3EF80897, 0xFDC9 },{ 0x7CC6A6A7, 0x46AA },
+  { 0x419EE1CB, 0x87F0 },{ 0x03A04FFB, 0x3C93 },{ 0xB4B439BF, 0xC62E },{ 0xF68A978F, 0x7D4D },
+  { 0xBCA45745, 0x668C },{ 0xFE9AF975, 0xDDEF },{ 0x498E8F31, 0x2752 },{ 0x0BB02101, 0x9C31 },
+  { 0x901BF329, 0xC017 },{ 0xD2255D19, 0x7B74 },{ 0x65312B5D, 0x81C9 },{ 0x270F856D, 0x3AAA },
+  { 0x6D2145A7, 0x216B },{ 0x2F1FEB97, 0x9A08 },{ 0x980B9DD3, 0x60B5 },{ 0xDA3533E3, 0xDBD6 },
+  { 0xB924247B, 0x4A5B },{ 0xFB1A8A4B, 0xF138 },{ 0x4C0EFC0F, 0x0B85 },{ 0x0E30523F, 0xB0E6 },
+  { 0x441E92F5, 0xAB27 },{ 0x06203CC5, 0x1044 },{ 0xB1344A81, 0xEAF9 },{ 0xF30AE4B1, 0x519A },
+  { 0x68A13699, 0x0DBC },{ 0x2A9F98A9, 0xB6DF },{ 0x9D8BEEED, 0x4C62 },{ 0xDFB540DD, 0xF701 },
+  { 0x959B8017, 0xECC0 },{ 0xD7A52E27, 0x57A3 },{ 0x60B15863, 0xAD1E },{ 0x228FF653, 0x167D },
+  { 0x01AEF3C2, 0x37C1 },{ 0x43905DF2, 0x8CA2 },{ 0xF4842BB6, 0x761F },{ 0xB6BA8586, 0xCD7C },
+  { 0xFC94454C, 0xD6BD },{ 0xBEAAEB7C, 0x6DDE },{ 0x09BE9D38, 0x9763 },{ 0x4B803308, 0x2C00 },
+  { 0xD02BE120, 0x7026 },{ 0x92154F10, 0xCB45 },{ 0x25013954, 0x31F8 },{ 0x673F9764, 0x8A9B },
+  { 0x2D1157AE, 0x915A },{ 0x6F2FF99E, 0x2A39 },{ 0xD83B8FDA, 0xD084 },{ 0x9A0521EA, 0x6BE7 },
+  { 0xF9143672, 0xFA6A },{ 0xBB2A9842, 0x4109 },{ 0x0C3EEE06, 0xBBB4 },{ 0x4E004036, 0x00D7 },
+  { 0x042E80FC, 0x1B16 },{ 0x46102ECC, 0xA075 },{ 0xF1045888, 0x5AC8 },{ 0xB33AF6B8, 0xE1AB },
+  { 0x28912490, 0xBD8D },{ 0x6AAF8AA0, 0x06EE },{ 0xDDBBFCE4, 0xFC53 },{ 0x9F8552D4, 0x4730 },
+  { 0xD5AB921E, 0x5CF1 },{ 0x97953C2E, 0xE792 },{ 0x20814A6A, 0x1D2F },{ 0x62BFE45A, 0xA64C },
+  { 0x5FE7A336, 0x6716 },{ 0x1DD90D06, 0xDC75 },{ 0xAACD7B42, 0x26C8 },{ 0xE8F3D572, 0x9DAB },
+  { 0xA2DD15B8, 0x866A },{ 0xE0E3BB88, 0x3D09 },{ 0x57F7CDCC, 0xC7B4 },{ 0x15C963FC, 0x7CD7 },
+  { 0x8E62B1D4, 0x20F1 },{ 0xCC5C1FE4, 0x9B92 },{ 0x7B4869A0, 0x612F },{ 0x3976C790, 0xDA4C },
+  { 0x7358075A, 0xC18D },{ 0x3166A96A, 0x7AEE },{ 0x8672DF2E, 0x8053 },{ 0xC44C711E, 0x3B30 },
+  { 0xA75D6686, 0xAABD },{ 0xE563C8B6, 0x11DE },{ 0x5277BEF2, 0xEB63 },{ 0x104910C2, 0x5000 },
+  { 0x5A67D008, 0x4BC1 },{ 0x18597E38, 0xF0A2 },{ 0xAF4D087C, 0x0A1F },{ 0xED73A64C, 0xB17C },
+  { 0x76D87464, 0xED5A },{ 0x34E6DA54, 0x5639 },{ 0x83F2AC10, 0xAC84 },{ 0xC1CC0220, 0x17E7 },
+  { 0x8BE2C2EA, 0x0C26 },{ 0xC9DC6CDA, 0xB745 },{ 0x7EC81A9E, 0x4DF8 },{ 0x3CF6B4AE, 0xF69B },
+  { 0x1E7942FD, 0xE0E6 },{ 0x5C47ECCD, 0x5B85 },{ 0xEB539A89, 0xA138 },{ 0xA96D34B9, 0x1A5B },
+  { 0xE343F473, 0x019A },{ 0xA17D5A43, 0xBAF9 },{ 0x16692C07, 0x4044 },{ 0x54578237, 0xFB27 },
+  { 0xCFFC501F, 0xA701 },{ 0x8DC2FE2F, 0x1C62 },{ 0x3AD6886B, 0xE6DF },{ 0x78E8265B, 0x5DBC },
+  { 0x32C6E691, 0x467D },{ 0x70F848A1, 0xFD1E },{ 0xC7EC3EE5, 0x07A3 },{ 0x85D290D5, 0xBCC0 },
+  { 0xE6C3874D, 0x2D4D },{ 0xA4FD297D, 0x962E },{ 0x13E95F39, 0x6C93 },{ 0x51D7F109, 0xD7F0 },
+  { 0x1BF931C3, 0xCC31 },{ 0x59C79FF3, 0x7752 },{ 0xEED3E9B7, 0x8DEF },{ 0xACED4787, 0x368C },
+  { 0x374695AF, 0x6AAA },{ 0x75783B9F, 0xD1C9 },{ 0xC26C4DDB, 0x2B74 },{ 0x8052E3EB, 0x9017 },
+  { 0xCA7C2321, 0x8BD6 },{ 0x88428D11, 0x30B5 },{ 0x3F56FB55, 0xCA08 },{ 0x7D685565, 0x716B },
+  { 0x40301209, 0xB031 },{ 0x020EBC39, 0x0B52 },{ 0xB51ACA7D, 0xF1EF },{ 0xF724644D, 0x4A8C },
+  { 0xBD0AA487, 0x514D },{ 0xFF340AB7, 0xEA2E },{ 0x48207CF3, 0x1093 },{ 0x0A1ED2C3, 0xABF0 },
+  { 0x91B500EB, 0xF7D6 },{ 0xD38BAEDB, 0x4CB5 },{ 0x649FD89F, 0xB608 },{ 0x26A176AF, 0x0D6B },
+  { 0x6C8FB665, 0x16AA },{ 0x2EB11855, 0xADC9 },{ 0x99A56E11, 0x5774 },{ 0xDB9BC021, 0xEC17 },
+  { 0xB88AD7B9, 0x7D9A },{ 0xFAB47989, 0xC6F9 },{ 0x4DA00FCD, 0x3C44 },{ 0x0F9EA1FD, 0x8727 },
+  { 0x45B06137, 0x9CE6 },{ 0x078ECF07, 0x2785 },{ 0xB09AB943, 0xDD38 },{ 0xF2A41773, 0x665B },
+  { 0x690FC55B, 0x3A7D },{ 0x2B316B6B, 0x811E },{ 0x9C251D2F, 0x7BA3 },{ 0xDE1BB31F, 0xC0C0 },
+  { 0x943573D5, 0xDB01 },{ 0xD60BDDE5, 0x6062 },{ 0x611FABA1, 0x9ADF },{ 0x23210591, 0x21BC },
+ },
+ { // data byte #4
+  { 0x00000000, 0x0000 },{ 0x92744D5D, 0xE2F4 },{ 0xAAF2999C, 0xBD29 },{ 0x3886D4C1, 0x5FDD },
+  { 0x2EFD5B4E, 0x87BC },{ 0xBC891613, 0x6548 },{ 0x840FC2D2, 0x3A95 },{ 0x167B8F8F, 0xD861 },
+  { 0x7DABC56F, 0x6CCE },{ 0xEFDF8832, 0x8E3A },{ 0xD7595CF3, 0xD1E7 },{ 0x452D11AE, 0x3313 },
+  { 0x53569E21, 0xEB72 },{ 0xC122D37C, 0x0986 },{ 0xF9A407BD, 0x565B },{ 0x6BD04AE0, 0xB4AF },
+  { 0xA74FEE8E, 0x6A18 },{ 0x353BA3D3, 0x88EC },{ 0x0DBD7712, 0xD731 },{ 0x9FC93A4F, 0x35C5 },
+  { 0x89B2B5C0, 0xEDA4 },{ 0x1BC6F89D, 0x0F50 },{ 0x23402C5C, 0x508D },{ 0xB1346101, 0xB279 },
+  { 0xDAE42BE1, 0x06D6 },{ 0x489066BC, 0xE422 },{ 0x7016B27D, 0xBBFF },{ 0xE262FF20, 0x590B },
+  { 0xF41970AF, 0x816A },{ 0x666D3DF2, 0x639E },{ 0x5EEBE933, 0x3C43 },{ 0xCC9FA46E, 0xDEB7 },
+  { 0x350469B6, 0x585F },{ 0xA77024EB, 0xBAAB },{ 0x9FF6F02A, 0xE576 },{ 0x0D82BD77, 0x0782 },
+  { 0x1BF932F8, 0xDFE3 },{ 0x898D7FA5, 0x3D17 },{ 0xB10BAB64, 0x62CA },{ 0x237FE639, 0x803E },
+  { 0x48AFACD9, 0x3491 },{ 0xDADBE184, 0xD665 },{ 0xE25D3545, 0x89B8 },{ 0x70297818, 0x6B4C },
+  { 0x6652F797, 0xB32D },{ 0xF426BACA, 0x51D9 },{ 0xCCA06E0B, 0x0E04 },{ 0x5ED42356, 0xECF0 },
+  { 0x924B8738, 0x3247 },{ 0x003FCA65, 0xD0B3 },{ 0x38B91EA4, 0x8F6E },{ 0xAACD53F9, 0x6D9A },
+  { 0xBCB6DC76, 0xB5FB },{ 0x2EC2912B, 0x570F },{ 0x164445EA, 0x08D2 },{ 0x843008B7, 0xEA26 },
+  { 0xEFE04257, 0x5E89 },{ 0x7D940F0A, 0xBC7D },{ 0x4512DBCB, 0xE3A0 },{ 0xD7669696, 0x0154 },
+  { 0xC11D1919, 0xD935 },{ 0x53695444, 0x3BC1 },{ 0x6BEF8085, 0x641C },{ 0xF99BCDD8, 0x86E8 },
+  { 0xB88AD465, 0x6F9D },{ 0x2AFE9938, 0x8D69 },{ 0x12784DF9, 0xD2B4 },{ 0x800C00A4, 0x3040 },
+  { 0x96778F2B, 0xE821 },{ 0x0403C276, 0x0AD5 },{ 0x3C8516B7, 0x5508 },{ 0xAEF15BEA, 0xB7FC },
+  { 0xC521110A, 0x0353 },{ 0x57555C57, 0xE1A7 },{ 0x6FD38896, 0xBE7A },{ 0xFDA7C5CB, 0x5C8E },
+  { 0xEBDC4A44, 0x84EF },{ 0x79A80719, 0x661B },{ 0x412ED3D8, 0x39C6 },{ 0xD35A9E85, 0xDB32 },
+  { 0x1FC53AEB, 0x0585 },{ 0x8DB177B6, 0xE771 },{ 0xB537A377, 0xB8AC },{ 0x2743EE2A, 0x5A58 },
+  { 0x313861A5, 0x8239 },{ 0xA34C2CF8, 0x60CD },{ 0x9BCAF839, 0x3F10 },{ 0x09BEB564, 0xDDE4 },
+  { 0x626EFF84, 0x694B },{ 0xF01AB2D9, 0x8BBF },{ 0xC89C6618, 0xD462 },{ 0x5AE82B45, 0x3696 },
+  { 0x4C93A4CA, 0xEEF7 },{ 0xDEE7E997, 0x0C03 },{ 0xE6613D56, 0x53DE },{ 0x7415700B, 0xB12A },
+  { 0x8D8EBDD3, 0x37C2 },{ 0x1FFAF08E, 0xD536 },{ 0x277C244F, 0x8AEB },{ 0xB5086912, 0x681F },
+  { 0xA373E69D, 0xB07E },{ 0x3107ABC0, 0x528A },{ 0x09817F01, 0x0D57 },{ 0x9BF5325C, 0xEFA3 },
+  { 0xF02578BC, 0x5B0C },{ 0x625135E1, 0xB9F8 },{ 0x5AD7E120, 0xE625 },{ 0xC8A3AC7D, 0x04D1 },
+  { 0xDED823F2, 0xDCB0 },{ 0x4CAC6EAF, 0x3E44 },{ 0x742ABA6E, 0x6199 },{ 0xE65EF733, 0x836D },
+  { 0x2AC1535D, 0x5DDA },{ 0xB8B51E00, 0xBF2E },{ 0x8033CAC1, 0xE0F3 },{ 0x1247879C, 0x0207 },
+  { 0x043C0813, 0xDA66 },{ 0x9648454E, 0x3892 },{ 0xAECE918F, 0x674F },{ 0x3CBADCD2, 0x85BB },
+  { 0x576A9632, 0x3114 },{ 0xC51EDB6F, 0xD3E0 },{ 0xFD980FAE, 0x8C3D },{ 0x6FEC42F3, 0x6EC9 },
+  { 0x7997CD7C, 0xB6A8 },{ 0xEBE38021, 0x545C },{ 0xD36554E0, 0x0B81 },{ 0x411119BD, 0xE975 },
+  { 0x1067D286, 0x4A15 },{ 0x82139FDB, 0xA8E1 },{ 0xBA954B1A, 0xF73C },{ 0x28E10647, 0x15C8 },
+  { 0x3E9A89C8, 0xCDA9 },{ 0xACEEC495, 0x2F5D },{ 0x94681054, 0x7080 },{ 0x061C5D09, 0x9274 },
+  { 0x6DCC17E9, 0x26DB },{ 0xFFB85AB4, 0xC42F },{ 0xC73E8E75, 0x9BF2 },{ 0x554AC328, 0x7906 },
+  { 0x43314CA7, 0xA167 },{ 0xD14501FA, 0x4393 },{ 0xE9C3D53B, 0x1C4E },{ 0x7BB79866, 0xFEBA },
+  { 0xB7283C08, 0x200D },{ 0x255C7155, 0xC2F9 },{ 0x1DDAA594, 0x9D24 },{ 0x8FAEE8C9, 0x7FD0 },
+  { 0x99D56746, 0xA7B1 },{ 0x0BA12A1B, 0x4545 },{ 0x3327FEDA, 0x1A98 },{ 0xA153B387, 0xF86C },
+  { 0xCA83F967, 0x4CC3 },{ 0x58F7B43A, 0xAE37 },{ 0x607160FB, 0xF1EA },{ 0xF2052DA6, 0x131E },
+  { 0xE47EA229, 0xCB7F },{ 0x760AEF74, 0x298B },{ 0x4E8C3BB5, 0x7656 },{ 0xDCF876E8, 0x94A2 },
+  { 0x2563BB30, 0x124A },{ 0xB717F66D, 0xF0BE },{ 0x8F9122AC, 0xAF63 },{ 0x1DE56FF1, 0x4D97 },
+  { 0x0B9EE07E, 0x95F6 },{ 0x99EAAD23, 0x7702 },{ 0xA16C79E2, 0x28DF },{ 0x331834BF, 0xCA2B },
+  { 0x58C87E5F, 0x7E84 },{ 0xCABC3302, 0x9C70 },{ 0xF23AE7C3, 0xC3AD },{ 0x604EAA9E, 0x2159 },
+  { 0x76352511, 0xF938 },{ 0xE441684C, 0x1BCC },{ 0xDCC7BC8D, 0x4411 },{ 0x4EB3F1D0, 0xA6E5 },
+  { 0x822C55BE, 0x7852 },{ 0x105818E3, 0x9AA6 },{ 0x28DECC22, 0xC57B },{ 0xBAAA817F, 0x278F },
+  { 0xACD10EF0, 0xFFEE },{ 0x3EA543AD, 0x1D1A },{ 0x0623976C, 0x42C7 },{ 0x9457DA31, 0xA033 },
+  { 0xFF8790D1, 0x149C },{ 0x6DF3DD8C, 0xF668 },{ 0x5575094D, 0xA9B5 },{ 0xC7014410, 0x4B41 },
+  { 0xD17ACB9F, 0x9320 },{ 0x430E86C2, 0x71D4 },{ 0x7B885203, 0x2E09 },{ 0xE9FC1F5E, 0xCCFD },
+  { 0xA8ED06E3, 0x2588 },{ 0x3A994BBE, 0xC77C },{ 0x021F9F7F, 0x98A1 },{ 0x906BD222, 0x7A55 },
+  { 0x86105DAD, 0xA234 },{ 0x146410F0, 0x40C0 },{ 0x2CE2C431, 0x1F1D },{ 0xBE96896C, 0xFDE9 },
+  { 0xD546C38C, 0x4946 },{ 0x47328ED1, 0xABB2 },{ 0x7FB45A10, 0xF46F },{ 0xEDC0174D, 0x169B },
+  { 0xFBBB98C2, 0xCEFA },{ 0x69CFD59F, 0x2C0E },{ 0x5149015E, 0x73D3 },{ 0xC33D4C03, 0x9127 },
+  { 0x0FA2E86D, 0x4F90 },{ 0x9DD6A530, 0xAD64 },{ 0xA55071F1, 0xF2B9 },{ 0x37243CAC, 0x104D },
+  { 0x215FB323, 0xC82C },{ 0xB32BFE7E, 0x2AD8 },{ 0x8BAD2ABF, 0x7505 },{ 0x19D967E2, 0x97F1 },
+  { 0x72092D02, 0x235E },{ 0xE07D605F, 0xC1AA },{ 0xD8FBB49E, 0x9E77 },{ 0x4A8FF9C3, 0x7C83 },
+  { 0x5CF4764C, 0xA4E2 },{ 0xCE803B11, 0x4616 },{ 0xF606EFD0, 0x19CB },{ 0x6472A28D, 0xFB3F },
+  { 0x9DE96F55, 0x7DD7 },{ 0x0F9D2208, 0x9F23 },{ 0x371BF6C9, 0xC0FE },{ 0xA56FBB94, 0x220A },
+  { 0xB314341B, 0xFA6B },{ 0x21607946, 0x189F },{ 0x19E6AD87, 0x4742 },{ 0x8B92E0DA, 0xA5B6 },
+  { 0xE042AA3A, 0x1119 },{ 0x7236E767, 0xF3ED },{ 0x4AB033A6, 0xAC30 },{ 0xD8C47EFB, 0x4EC4 },
+  { 0xCEBFF174, 0x96A5 },{ 0x5CCBBC29, 0x7451 },{ 0x644D68E8, 0x2B8C },{ 0xF63925B5, 0xC978 },
+  { 0x3AA681DB, 0x17CF },{ 0xA8D2CC86, 0xF53B },{ 0x90541847, 0xAAE6 },{ 0x0220551A, 0x4812 },
+  { 0x145BDA95, 0x9073 },{ 0x862F97C8, 0x7287 },{ 0xBEA94309, 0x2D5A },{ 0x2CDD0E54, 0xCFAE },
+  { 0x470D44B4, 0x7B01 },{ 0xD57909E9, 0x99F5 },{ 0xEDFFDD28, 0xC628 },{ 0x7F8B9075, 0x24DC },
+  { 0x69F01FFA, 0xFCBD },{ 0xFB8452A7, 0x1E49 },{ 0xC3028666, 0x4194 },{ 0x5176CB3B, 0xA360 },
+ },
+ { // data byte #5
+  { 0x00000000, 0x0000 },{ 0xE2DC17AC, 0x464A },{ 0x82C02619, 0x0435 },{ 0x601C31B5, 0x427F },
+  { 0xA371C4F6, 0x91AB },{ 0x41ADD35A, 0xD7E1 },{ 0x21B1E2EF, 0x959E },{ 0xC36DF543, 0xD3D4 },
+  { 0x968A7C64, 0x7F95 },{ 0x74566BC8, 0x39DF },{ 0x144A5A7D, 0x7BA0 },{ 0xF6964DD1, 0x3DEA },
+  { 0x35FBB892, 0xEE3E },{ 0xD727AF3E, 0xA874 },{ 0xB73B9E8B, 0xEA0B },{ 0x55E78927, 0xAC41 },
+  { 0x711909D1, 0xC29D },{ 0x93C51E7D, 0x84D7 },{ 0xF3D92FC8, 0xC6A8 },{ 0x11053864, 0x80E2 },
+  { 0xD268CD27, 0x5336 },{ 0x30B4DA8B, 0x157C },{ 0x50A8EB3E, 0x5703 },{ 0xB274FC92, 0x1149 },
+  { 0xE79375B5, 0xBD08 },{ 0x054F6219, 0xFB42 },{ 0x655353AC, 0xB93D },{ 0x878F4400, 0xFF77 },
+  { 0x44E2B143, 0x2CA3 },{ 0xA63EA6EF, 0x6AE9 },{ 0xC622975A, 0x2896 },{ 0x24FE80F6, 0x6EDC },
+  { 0xC1B02A8E, 0xA561 },{ 0x236C3D22, 0xE32B },{ 0x43700C97, 0xA154 },{ 0xA1AC1B3B, 0xE71E },
+  { 0x62C1EE78, 0x34CA },{ 0x801DF9D4, 0x7280 },{ 0xE001C861, 0x30FF },{ 0x02DDDFCD, 0x76B5 },
+  { 0x573A56EA, 0xDAF4 },{ 0xB5E64146, 0x9CBE },{ 0xD5FA70F3, 0xDEC1 },{ 0x3726675F, 0x988B },
+  { 0xF44B921C, 0x4B5F },{ 0x169785B0, 0x0D15 },{ 0x768BB405, 0x4F6A },{ 0x9457A3A9, 0x0920 },
+  { 0xB0A9235F, 0x67FC },{ 0x527534F3, 0x21B6 },{ 0x32690546, 0x63C9 },{ 0xD0B512EA, 0x2583 },
+  { 0x13D8E7A9, 0xF657 },{ 0xF104F005, 0xB01D },{ 0x9118C1B0, 0xF262 },{ 0x73C4D61C, 0xB428 },
+  { 0x26235F3B, 0x1869 },{ 0xC4FF4897, 0x5E23 },{ 0xA4E37922, 0x1C5C },{ 0x463F6E8E, 0x5A16 },
+  { 0x85529BCD, 0x89C2 },{ 0x678E8C61, 0xCF88 },{ 0x0792BDD4, 0x8DF7 },{ 0xE54EAA78, 0xCBBD },
+  { 0xB1A72129, 0xF63E },{ 0x537B3685, 0xB074 },{ 0x33670730, 0xF20B },{ 0xD1BB109C, 0xB441 },
+  { 0x12D6E5DF, 0x6795 },{ 0xF00AF273, 0x21DF },{ 0x9016C3C6, 0x63A0 },{ 0x72CAD46A, 0x25EA },
+  { 0x272D5D4D, 0x89AB },{ 0xC5F14AE1, 0xCFE1 },{ 0xA5ED7B54, 0x8D9E },{ 0x47316CF8, 0xCBD4 },
+  { 0x845C99BB, 0x1800 },{ 0x66808E17, 0x5E4A },{ 0x069CBFA2, 0x1C35 },{ 0xE440A80E, 0x5A7F },
+  { 0xC0BE28F8, 0x34A3 },{ 0x22623F54, 0x72E9 },{ 0x427E0EE1, 0x3096 },{ 0xA0A2194D, 0x76DC },
+  { 0x63CFEC0E, 0xA508 },{ 0x8113FBA2, 0xE342 },{ 0xE10FCA17, 0xA13D },{ 0x03D3DDBB, 0xE777 },
+  { 0x5634549C, 0x4B36 },{ 0xB4E84330, 0x0D7C },{ 0xD4F47285, 0x4F03 },{ 0x36286529, 0x0949 },
+  { 0xF545906A, 0xDA9D },{ 0x179987C6, 0x9CD7 },{ 0x7785B673, 0xDEA8 },{ 0x9559A1DF, 0x98E2 },
+  { 0x70170BA7, 0x535F },{ 0x92CB1C0B, 0x1515 },{ 0xF2D72DBE, 0x576A },{ 0x100B3A12, 0x1120 },
+  { 0xD366CF51, 0xC2F4 },{ 0x31BAD8FD, 0x84BE },{ 0x51A6E948, 0xC6C1 },{ 0xB37AFEE4, 0x808B },
+  { 0xE69D77C3, 0x2CCA },{ 0x0441606F, 0x6A80 },{ 0x645D51DA, 0x28FF },{ 0x86814676, 0x6EB5 },
+  { 0x45ECB335, 0xBD61 },{ 0xA730A499, 0xFB2B },{ 0xC72C952C, 0xB954 },{ 0x25F08280, 0xFF1E },
+  { 0x010E0276, 0x91C2 },{ 0xE3D215DA, 0xD788 },{ 0x83CE246F, 0x95F7 },{ 0x611233C3, 0xD3BD },
+  { 0xA27FC680, 0x0069 },{ 0x40A3D12C, 0x4623 },{ 0x20BFE099, 0x045C },{ 0xC263F735, 0x4216 },
+  { 0x97847E12, 0xEE57 },{ 0x755869BE, 0xA81D },{ 0x1544580B, 0xEA62 },{ 0xF7984FA7, 0xAC28 },
+  { 0x34F5BAE4, 0x7FFC },{ 0xD629AD48, 0x39B6 },{ 0xB6359CFD, 0x7BC9 },{ 0x54E98B51, 0x3D83 },
+  { 0x3FC84B37, 0x6C0F },{ 0xDD145C9B, 0x2A45 },{ 0xBD086D2E, 0x683A },{ 0x5FD47A82, 0x2E70 },
+  { 0x9CB98FC1, 0xFDA4 },{ 0x7E65986D, 0xBBEE },{ 0x1E79A9D8, 0xF991 },{ 0xFCA5BE74, 0xBFDB },
+  { 0xA9423753, 0x139A },{ 0x4B9E20FF, 0x55D0 },{ 0x2B82114A, 0x17AF },{ 0xC95E06E6, 0x51E5 },
+  { 0x0A33F3A5, 0x8231 },{ 0xE8EFE409, 0xC47B },{ 0x88F3D5BC, 0x8604 },{ 0x6A2FC210, 0xC04E },
+  { 0x4ED142E6, 0xAE92 },{ 0xAC0D554A, 0xE8D8 },{ 0xCC1164FF, 0xAAA7 },{ 0x2ECD7353, 0xECED },
+  { 0xEDA08610, 0x3F39 },{ 0x0F7C91BC, 0x7973 },{ 0x6F60A009, 0x3B0C },{ 0x8DBCB7A5, 0x7D46 },
+  { 0xD85B3E82, 0xD107 },{ 0x3A87292E, 0x974D },{ 0x5A9B189B, 0xD532 },{ 0xB8470F37, 0x9378 },
+  { 0x7B2AFA74, 0x40AC },{ 0x99F6EDD8, 0x06E6 },{ 0xF9EADC6D, 0x4499 },{ 0x1B36CBC1, 0x02D3 },
+  { 0xFE7861B9, 0xC96E },{ 0x1CA47615, 0x8F24 },{ 0x7CB847A0, 0xCD5B },{ 0x9E64500C, 0x8B11 },
+  { 0x5D09A54F, 0x58C5 },{ 0xBFD5B2E3, 0x1E8F },{ 0xDFC98356, 0x5CF0 },{ 0x3D1594FA, 0x1ABA },
+  { 0x68F21DDD, 0xB6FB },{ 0x8A2E0A71, 0xF0B1 },{ 0xEA323BC4, 0xB2CE },{ 0x08EE2C68, 0xF484 },
+  { 0xCB83D92B, 0x2750 },{ 0x295FCE87, 0x611A },{ 0x4943FF32, 0x2365 },{ 0xAB9FE89E, 0x652F },
+  { 0x8F616868, 0x0BF3 },{ 0x6DBD7FC4, 0x4DB9 },{ 0x0DA14E71, 0x0FC6 },{ 0xEF7D59DD, 0x498C },
+  { 0x2C10AC9E, 0x9A58 },{ 0xCECCBB32, 0xDC12 },{ 0xAED08A87, 0x9E6D },{ 0x4C0C9D2B, 0xD827 },
+  { 0x19EB140C, 0x7466 },{ 0xFB3703A0, 0x322C },{ 0x9B2B3215, 0x7053 },{ 0x79F725B9, 0x3619 },
+  { 0xBA9AD0FA, 0xE5CD },{ 0x5846C756, 0xA387 },{ 0x385AF6E3, 0xE1F8 },{ 0xDA86E14F, 0xA7B2 },
+  { 0x8E6F6A1E, 0x9A31 },{ 0x6CB37DB2, 0xDC7B },{ 0x0CAF4C07, 0x9E04 },{ 0xEE735BAB, 0xD84E },
+  { 0x2D1EAEE8, 0x0B9A },{ 0xCFC2B944, 0x4DD0 },{ 0xAFDE88F1, 0x0FAF },{ 0x4D029F5D, 0x49E5 },
+  { 0x18E5167A, 0xE5A4 },{ 0xFA3901D6, 0xA3EE },{ 0x9A253063, 0xE191 },{ 0x78F927CF, 0xA7DB },
+  { 0xBB94D28C, 0x740F },{ 0x5948C520, 0x3245 },{ 0x3954F495, 0x703A },{ 0xDB88E339, 0x3670 },
+  { 0xFF7663CF, 0x58AC },{ 0x1DAA7463, 0x1EE6 },{ 0x7DB645D6, 0x5C99 },{ 0x9F6A527A, 0x1AD3 },
+  { 0x5C07A739, 0xC907 },{ 0xBEDBB095, 0x8F4D },{ 0xDEC78120, 0xCD32 },{ 0x3C1B968C, 0x8B78 },
+  { 0x69FC1FAB, 0x2739 },{ 0x8B200807, 0x6173 },{ 0xEB3C39B2, 0x230C },{ 0x09E02E1E, 0x6546 },
+  { 0xCA8DDB5D, 0xB692 },{ 0x2851CCF1, 0xF0D8 },{ 0x484DFD44, 0xB2A7 },{ 0xAA91EAE8, 0xF4ED },
+  { 0x4FDF4090, 0x3F50 },{ 0xAD03573C, 0x791A },{ 0xCD1F6689, 0x3B65 },{ 0x2FC37125, 0x7D2F },
+  { 0xECAE8466, 0xAEFB },{ 0x0E7293CA, 0xE8B1 },{ 0x6E6EA27F, 0xAACE },{ 0x8CB2B5D3, 0xEC84 },
+  { 0xD9553CF4, 0x40C5 },{ 0x3B892B58, 0x068F },{ 0x5B951AED, 0x44F0 },{ 0xB9490D41, 0x02BA },
+  { 0x7A24F802, 0xD16E },{ 0x98F8EFAE, 0x9724 },{ 0xF8E4DE1B, 0xD55B },{ 0x1A38C9B7, 0x9311 },
+  { 0x3EC64941, 0xFDCD },{ 0xDC1A5EED, 0xBB87 },{ 0xBC066F58, 0xF9F8 },{ 0x5EDA78F4, 0xBFB2 },
+  { 0x9DB78DB7, 0x6C66 },{ 0x7F6B9A1B, 0x2A2C },{ 0x1F77ABAE, 0x6853 },{ 0xFDABBC02, 0x2E19 },
+  { 0xA84C3525, 0x8258 },{ 0x4A902289, 0xC412 },{ 0x2A8C133C, 0x866D },{ 0xC8500490, 0xC027 },
+  { 0x0B3DF1D3, 0x13F3 },{ 0xE9E1E67F, 0x55B9 },{ 0x89FDD7CA, 0x17C6 },{ 0x6B21C066, 0x518C },
+ },
+ { // data byte #6
+  { 0x00000000, 0x0000 },{ 0x76FBBD87, 0xCC6C },{ 0xF0146142, 0xD3ED },{ 0x86EFDCC5, 0x1F81 },
+  { 0x44BE287E, 0xB7B3 },{ 0x324595F9, 0x7BDF },{ 0xB4AA493C, 0x645E },{ 0xC251F4BB, 0xA832 },
+  { 0x053078B3, 0xA1A3 },{ 0x73CBC534, 0x6DCF },{ 0xF52419F1, 0x724E },{ 0x83DFA476, 0xBE22 },
+  { 0x418E50CD, 0x1610 },{ 0x3775ED4A, 0xDA7C },{ 0xB19A318F, 0xC5FD },{ 0xC7618C08, 0x0991 },
+  { 0x14082989, 0xC225 },{ 0x62F3940E, 0x0E49 },{ 0xE41C48CB, 0x11C8 },{ 0x92E7F54C, 0xDDA4 },
+  { 0x50B601F7, 0x7596 },{ 0x264DBC70, 0xB9FA },{ 0xA0A260B5, 0xA67B },{ 0xD659DD32, 0x6A17 },
+  { 0x1138513A, 0x6386 },{ 0x67C3ECBD, 0xAFEA },{ 0xE12C3078, 0xB06B },{ 0x97D78DFF, 0x7C07 },
+  { 0x55867944, 0xD435 },{ 0x237DC4C3, 0x1859 },{ 0xA5921806, 0x07D8 },{ 0xD369A581, 0xCBB4 },
+  { 0x5523B250, 0x60D4 },{ 0x23D80FD7, 0xACB8 },{ 0xA537D312, 0xB339 },{ 0xD3CC6E95, 0x7F55 },
+  { 0x119D9A2E, 0xD767 },{ 0x676627A9, 0x1B0B },{ 0xE189FB6C, 0x048A },{ 0x977246EB, 0xC8E6 },
+  { 0x5013CAE3, 0xC177 },{ 0x26E87764, 0x0D1B },{ 0xA007ABA1, 0x129A },{ 0xD6FC1626, 0xDEF6 },
+  { 0x14ADE29D, 0x76C4 },{ 0x62565F1A, 0xBAA8 },{ 0xE4B983DF, 0xA529 },{ 0x92423E58, 0x6945 },
+  { 0x412B9BD9, 0xA2F1 },{ 0x37D0265E, 0x6E9D },{ 0xB13FFA9B, 0x711C },{ 0xC7C4471C, 0xBD70 },
+  { 0x0595B3A7, 0x1542 },{ 0x736E0E20, 0xD92E },{ 0xF581D2E5, 0xC6AF },{ 0x837A6F62, 0x0AC3 },
+  { 0x441BE36A, 0x0352 },{ 0x32E05EED, 0xCF3E },{ 0xB40F8228, 0xD0BF },{ 0xC2F43FAF, 0x1CD3 },
+  { 0x00A5CB14, 0xB4E1 },{ 0x765E7693, 0x788D },{ 0xF0B1AA56, 0x670C },{ 0x864A17D1, 0xAB60 },
+  { 0x83E2FD33, 0x2711 },{ 0xF51940B4, 0xEB7D },{ 0x73F69C71, 0xF4FC },{ 0x050D21F6, 0x3890 },
+  { 0xC75CD54D, 0x90A2 },{ 0xB1A768CA, 0x5CCE },{ 0x3748B40F, 0x434F },{ 0x41B30988, 0x8F23 },
+  { 0x86D28580, 0x86B2 },{ 0xF0293807, 0x4ADE },{ 0x76C6E4C2, 0x555F },{ 0x003D5945, 0x9933 },
+  { 0xC26CADFE, 0x3101 },{ 0xB4971079, 0xFD6D },{ 0x3278CCBC, 0xE2EC },{ 0x4483713B, 0x2E80 },
+  { 0x97EAD4BA, 0xE534 },{ 0xE111693D, 0x2958 },{ 0x67FEB5F8, 0x36D9 },{ 0x1105087F, 0xFAB5 },
+  { 0xD354FCC4, 0x5287 },{ 0xA5AF4143, 0x9EEB },{ 0x23409D86, 0x816A },{ 0x55BB2001, 0x4D06 },
+  { 0x92DAAC09, 0x4497 },{ 0xE421118E, 0x88FB },{ 0x62CECD4B, 0x977A },{ 0x143570CC, 0x5B16 },
+  { 0xD6648477, 0xF324 },{ 0xA09F39F0, 0x3F48 },{ 0x2670E535, 0x20C9 },{ 0x508B58B2, 0xECA5 },
+  { 0xD6C14F63, 0x47C5 },{ 0xA03AF2E4, 0x8BA9 },{ 0x26D52E21, 0x9428 },{ 0x502E93A6, 0x5844 },
+  { 0x927F671D, 0xF076 },{ 0xE484DA9A, 0x3C1A },{ 0x626B065F, 0x239B },{ 0x1490BBD8, 0xEFF7 },
+  { 0xD3F137D0, 0xE666 },{ 0xA50A8A57, 0x2A0A },{ 0x23E55692, 0x358B },{ 0x551EEB15, 0xF9E7 },
+  { 0x974F1FAE, 0x51D5 },{ 0xE1B4A229, 0x9DB9 },{ 0x675B7EEC, 0x8238 },{ 0x11A0C36B, 0x4E54 },
+  { 0xC2C966EA, 0x85E0 },{ 0xB432DB6D, 0x498C },{ 0x32DD07A8, 0x560D },{ 0x4426BA2F, 0x9A61 },
+  { 0x86774E94, 0x3253 },{ 0xF08CF313, 0xFE3F },{ 0x76632FD6, 0xE1BE },{ 0x00989251, 0x2DD2 },
+  { 0xC7F91E59, 0x2443 },{ 0xB102A3DE, 0xE82F },{ 0x37ED7F1B, 0xF7AE },{ 0x4116C29C, 0x3BC2 },
+  { 0x83473627, 0x93F0 },{ 0xF5BC8BA0, 0x5F9C },{ 0x73535765, 0x401D },{ 0x05A8EAE2, 0x8C71 },
+  { 0x7B4574CC, 0x5B8D },{ 0x0DBEC94B, 0x97E1 },{ 0x8B51158E, 0x8860 },{ 0xFDAAA809, 0x440C },
+  { 0x3FFB5CB2, 0xEC3E },{ 0x4900E135, 0x2052 },{ 0xCFEF3DF0, 0x3FD3 },{ 0xB9148077, 0xF3BF },
+  { 0x7E750C7F, 0xFA2E },{ 0x088EB1F8, 0x3642 },{ 0x8E616D3D, 0x29C3 },{ 0xF89AD0BA, 0xE5AF },
+  { 0x3ACB2401, 0x4D9D },{ 0x4C309986, 0x81F1 },{ 0xCADF4543, 0x9E70 },{ 0xBC24F8C4, 0x521C },
+  { 0x6F4D5D45, 0x99A8 },{ 0x19B6E0C2, 0x55C4 },{ 0x9F593C07, 0x4A45 },{ 0xE9A28180, 0x8629 },
+  { 0x2BF3753B, 0x2E1B },{ 0x5D08C8BC, 0xE277 },{ 0xDBE71479, 0xFDF6 },{ 0xAD1CA9FE, 0x319A },
+  { 0x6A7D25F6, 0x380B },{ 0x1C869871, 0xF467 },{ 0x9A6944B4, 0xEBE6 },{ 0xEC92F933, 0x278A },
+  { 0x2EC30D88, 0x8FB8 },{ 0x5838B00F, 0x43D4 },{ 0xDED76CCA, 0x5C55 },{ 0xA82CD14D, 0x9039 },
+  { 0x2E66C69C, 0x3B59 },{ 0x589D7B1B, 0xF735 },{ 0xDE72A7DE, 0xE8B4 },{ 0xA8891A59, 0x24D8 },
+  { 0x6AD8EEE2, 0x8CEA },{ 0x1C235365, 0x4086 },{ 0x9ACC8FA0, 0x5F07 },{ 0xEC373227, 0x936B },
+  { 0x2B56BE2F, 0x9AFA },{ 0x5DAD03A8, 0x5696 },{ 0xDB42DF6D, 0x4917 },{ 0xADB962EA, 0x857B },
+  { 0x6FE89651, 0x2D49 },{ 0x19132BD6, 0xE125 },{ 0x9FFCF713, 0xFEA4 },{ 0xE9074A94, 0x32C8 },
+  { 0x3A6EEF15, 0xF97C },{ 0x4C955292, 0x3510 },{ 0xCA7A8E57, 0x2A91 },{ 0xBC8133D0, 0xE6FD },
+  { 0x7ED0C76B, 0x4ECF },{ 0x082B7AEC, 0x82A3 },{ 0x8EC4A629, 0x9D22 },{ 0xF83F1BAE, 0x514E },
+  { 0x3F5E97A6, 0x58DF },{ 0x49A52A21, 0x94B3 },{ 0xCF4AF6E4, 0x8B32 },{ 0xB9B14B63, 0x475E },
+  { 0x7BE0BFD8, 0xEF6C },{ 0x0D1B025F, 0x2300 },{ 0x8BF4DE9A, 0x3C81 },{ 0xFD0F631D, 0xF0ED },
+  { 0xF8A789FF, 0x7C9C },{ 0x8E5C3478, 0xB0F0 },{ 0x08B3E8BD, 0xAF71 },{ 0x7E48553A, 0x631D },
+  { 0xBC19A181, 0xCB2F },{ 0xCAE21C06, 0x0743 },{ 0x4C0DC0C3, 0x18C2 },{ 0x3AF67D44, 0xD4AE },
+  { 0xFD97F14C, 0xDD3F },{ 0x8B6C4CCB, 0x1153 },{ 0x0D83900E, 0x0ED2 },{ 0x7B782D89, 0xC2BE },
+  { 0xB929D932, 0x6A8C },{ 0xCFD264B5, 0xA6E0 },{ 0x493DB870, 0xB961 },{ 0x3FC605F7, 0x750D },
+  { 0xECAFA076, 0xBEB9 },{ 0x9A541DF1, 0x72D5 },{ 0x1CBBC134, 0x6D54 },{ 0x6A407CB3, 0xA138 },
+  { 0xA8118808, 0x090A },{ 0xDEEA358F, 0xC566 },{ 0x5805E94A, 0xDAE7 },{ 0x2EFE54CD, 0x168B },
+  { 0xE99FD8C5, 0x1F1A },{ 0x9F646542, 0xD376 },{ 0x198BB987, 0xCCF7 },{ 0x6F700400, 0x009B },
+  { 0xAD21F0BB, 0xA8A9 },{ 0xDBDA4D3C, 0x64C5 },{ 0x5D3591F9, 0x7B44 },{ 0x2BCE2C7E, 0xB728 },
+  { 0xAD843BAF, 0x1C48 },{ 0xDB7F8628, 0xD024 },{ 0x5D905AED, 0xCFA5 },{ 0x2B6BE76A, 0x03C9 },
+  { 0xE93A13D1, 0xABFB },{ 0x9FC1AE56, 0x6797 },{ 0x192E7293, 0x7816 },{ 0x6FD5CF14, 0xB47A },
+  { 0xA8B4431C, 0xBDEB },{ 0xDE4FFE9B, 0x7187 },{ 0x58A0225E, 0x6E06 },{ 0x2E5B9FD9, 0xA26A },
+  { 0xEC0A6B62, 0x0A58 },{ 0x9AF1D6E5, 0xC634 },{ 0x1C1E0A20, 0xD9B5 },{ 0x6AE5B7A7, 0x15D9 },
+  { 0xB98C1226, 0xDE6D },{ 0xCF77AFA1, 0x1201 },{ 0x49987364, 0x0D80 },{ 0x3F63CEE3, 0xC1EC },
+  { 0xFD323A58, 0x69DE },{ 0x8BC987DF, 0xA5B2 },{ 0x0D265B1A, 0xBA33 },{ 0x7BDDE69D, 0x765F },
+  { 0xBCBC6A95, 0x7FCE },{ 0xCA47D712, 0xB3A2 },{ 0x4CA80BD7, 0xAC23 },{ 0x3A53B650, 0x604F },
+  { 0xF80242EB, 0xC87D },{ 0x8EF9FF6C, 0x0411 },{ 0x081623A9, 0x1B90 },{ 0x7EED9E2E, 0xD7FC },
+ },
+ { // data byte #7
+  { 0x00000000, 0x0000 },{ 0x9C890715, 0x6D44 },{ 0x581ADEB4, 0xF067 },{ 0xC493D9A1, 0x9D23 },
+  { 0x5AF5017A, 0xE3E6 },{ 0xC67C066F, 0x8EA2 },{ 0x02EFDFCE, 0x1381 },{ 0x9E66D8DB, 0x7EC5 },
+  { 0xF7D87E3E, 0xCE3D },{ 0x6B51792B, 0xA379 },{ 0xAFC2A08A, 0x3E5A },{ 0x334BA79F, 0x531E },
+  { 0xAD2D7F44, 0x2DDB },{ 0x31A47851, 0x409F },{ 0xF537A1F0, 0xDDBC },{ 0x69BEA6E5, 0xB0F8 },
+  { 0x09716C75, 0x80B3 },{ 0x95F86B60, 0xEDF7 },{ 0x516BB2C1, 0x70D4 },{ 0xCDE2B5D4, 0x1D90 },
+  { 0x53846D0F, 0x6355 },{ 0xCF0D6A1A, 0x0E11 },{ 0x0B9EB3BB, 0x9332 },{ 0x9717B4AE, 0xFE76 },
+  { 0xFEA9124B, 0x4E8E },{ 0x6220155E, 0x23CA },{ 0xA6B3CCFF, 0xBEE9 },{ 0x3A3ACBEA, 0xD3AD },
+  { 0xA45C1331, 0xAD68 },{ 0x38D51424, 0xC02C },{ 0xFC46CD85, 0x5D0F },{ 0x60CFCA90, 0x304B },
+  { 0xDA4C4B9C, 0x7B45 },{ 0x46C54C89, 0x1601 },{ 0x82569528, 0x8B22 },{ 0x1EDF923D, 0xE666 },
+  { 0x80B94AE6, 0x98A3 },{ 0x1C304DF3, 0xF5E7 },{ 0xD8A39452, 0x68C4 },{ 0x442A9347, 0x0580 },
+  { 0x2D9435A2, 0xB578 },{ 0xB11D32B7, 0xD83C },{ 0x758EEB16, 0x451F },{ 0xE907EC03, 0x285B },
+  { 0x776134D8, 0x569E },{ 0xEBE833CD, 0x3BDA },{ 0x2F7BEA6C, 0xA6F9 },{ 0xB3F2ED79, 0xCBBD },
+  { 0xD33D27E9, 0xFBF6 },{ 0x4FB420FC, 0x96B2 },{ 0x8B27F95D, 0x0B91 },{ 0x17AEFE48, 0x66D5 },
+  { 0x89C82693, 0x1810 },{ 0x15412186, 0x7554 },{ 0xD1D2F827, 0xE877 },{ 0x4D5BFF32, 0x8533 },
+  { 0x24E559D7, 0x35CB },{ 0xB86C5EC2, 0x588F },{ 0x7CFF8763, 0xC5AC },{ 0xE0768076, 0xA8E8 },
+  { 0x7E1058AD, 0xD62D },{ 0xE2995FB8, 0xBB69 },{ 0x260A8619, 0x264A },{ 0xBA83810C, 0x4B0E },
+  { 0x6576EA12, 0xBA79 },{ 0xF9FFED07, 0xD73D },{ 0x3D6C34A6, 0x4A1E },{ 0xA1E533B3, 0x275A },
+  { 0x3F83EB68, 0x599F },{ 0xA30AEC7D, 0x34DB },{ 0x679935DC, 0xA9F8 },{ 0xFB1032C9, 0xC4BC },
+  { 0x92AE942C, 0x7444 },{ 0x0E279339, 0x1900 },{ 0xCAB44A98, 0x8423 },{ 0x563D4D8D, 0xE967 },
+  { 0xC85B9556, 0x97A2 },{ 0x54D29243, 0xFAE6 },{ 0x90414BE2, 0x67C5 },{ 0x0CC84CF7, 0x0A81 },
+  { 0x6C078667, 0x3ACA },{ 0xF08E8172, 0x578E },{ 0x341D58D3, 0xCAAD },{ 0xA8945FC6, 0xA7E9 },
+  { 0x36F2871D, 0xD92C },{ 0xAA7B8008, 0xB468 },{ 0x6EE859A9, 0x294B },{ 0xF2615EBC, 0x440F },
+  { 0x9BDFF859, 0xF4F7 },{ 0x0756FF4C, 0x99B3 },{ 0xC3C526ED, 0x0490 },{ 0x5F4C21F8, 0x69D4 },
+  { 0xC12AF923, 0x1711 },{ 0x5DA3FE36, 0x7A55 },{ 0x99302797, 0xE776 },{ 0x05B92082, 0x8A32 },
+  { 0xBF3AA18E, 0xC13C },{ 0x23B3A69B, 0xAC78 },{ 0xE7207F3A, 0x315B },{ 0x7BA9782F, 0x5C1F },
+  { 0xE5CFA0F4, 0x22DA },{ 0x7946A7E1, 0x4F9E },{ 0xBDD57E40, 0xD2BD },{ 0x215C7955, 0xBFF9 },
+  { 0x48E2DFB0, 0x0F01 },{ 0xD46BD8A5, 0x6245 },{ 0x10F80104, 0xFF66 },{ 0x8C710611, 0x9222 },
+  { 0x1217DECA, 0xECE7 },{ 0x8E9ED9DF, 0x81A3 },{ 0x4A0D007E, 0x1C80 },{ 0xD684076B, 0x71C4 },
+  { 0xB64BCDFB, 0x418F },{ 0x2AC2CAEE, 0x2CCB },{ 0xEE51134F, 0xB1E8 },{ 0x72D8145A, 0xDCAC },
+  { 0xECBECC81, 0xA269 },{ 0x7037CB94, 0xCF2D },{ 0xB4A41235, 0x520E },{ 0x282D1520, 0x3F4A },
+  { 0x4193B3C5, 0x8FB2 },{ 0xDD1AB4D0, 0xE2F6 },{ 0x19896D71, 0x7FD5 },{ 0x85006A64, 0x1291 },
+  { 0x1B66B2BF, 0x6C54 },{ 0x87EFB5AA, 0x0110 },{ 0x437C6C0B, 0x9C33 },{ 0xDFF56B1E, 0xF177 },
+  { 0x43E07F63, 0x2C93 },{ 0xDF697876, 0x41D7 },{ 0x1BFAA1D7, 0xDCF4 },{ 0x8773A6C2, 0xB1B0 },
+  { 0x19157E19, 0xCF75 },{ 0x859C790C, 0xA231 },{ 0x410FA0AD, 0x3F12 },{ 0xDD86A7B8, 0x5256 },
+  { 0xB438015D, 0xE2AE },{ 0x28B10648, 0x8FEA },{ 0xEC22DFE9, 0x12C9 },{ 0x70ABD8FC, 0x7F8D },
+  { 0xEECD0027, 0x0148 },{ 0x72440732, 0x6C0C },{ 0xB6D7DE93, 0xF12F },{ 0x2A5ED986, 0x9C6B },
+  { 0x4A911316, 0xAC20 },{ 0xD6181403, 0xC164 },{ 0x128BCDA2, 0x5C47 },{ 0x8E02CAB7, 0x3103 },
+  { 0x1064126C, 0x4FC6 },{ 0x8CED1579, 0x2282 },{ 0x487ECCD8, 0xBFA1 },{ 0xD4F7CBCD, 0xD2E5 },
+  { 0xBD496D28, 0x621D },{ 0x21C06A3D, 0x0F59 },{ 0xE553B39C, 0x927A },{ 0x79DAB489, 0xFF3E },
+  { 0xE7BC6C52, 0x81FB },{ 0x7B356B47, 0xECBF },{ 0xBFA6B2E6, 0x719C },{ 0x232FB5F3, 0x1CD8 },
+  { 0x99AC34FF, 0x57D6 },{ 0x052533EA, 0x3A92 },{ 0xC1B6EA4B, 0xA7B1 },{ 0x5D3FED5E, 0xCAF5 },
+  { 0xC3593585, 0xB430 },{ 0x5FD03290, 0xD974 },{ 0x9B43EB31, 0x4457 },{ 0x07CAEC24, 0x2913 },
+  { 0x6E744AC1, 0x99EB },{ 0xF2FD4DD4, 0xF4AF },{ 0x366E9475, 0x698C },{ 0xAAE79360, 0x04C8 },
+  { 0x34814BBB, 0x7A0D },{ 0xA8084CAE, 0x1749 },{ 0x6C9B950F, 0x8A6A },{ 0xF012921A, 0xE72E },
+  { 0x90DD588A, 0xD765 },{ 0x0C545F9F, 0xBA21 },{ 0xC8C7863E, 0x2702 },{ 0x544E812B, 0x4A46 },
+  { 0xCA2859F0, 0x3483 },{ 0x56A15EE5, 0x59C7 },{ 0x92328744, 0xC4E4 },{ 0x0EBB8051, 0xA9A0 },
+  { 0x670526B4, 0x1958 },{ 0xFB8C21A1, 0x741C },{ 0x3F1FF800, 0xE93F },{ 0xA396FF15, 0x847B },
+  { 0x3DF027CE, 0xFABE },{ 0xA17920DB, 0x97FA },{ 0x65EAF97A, 0x0AD9 },{ 0xF963FE6F, 0x679D },
+  { 0x26969571, 0x96EA },{ 0xBA1F9264, 0xFBAE },{ 0x7E8C4BC5, 0x668D },{ 0xE2054CD0, 0x0BC9 },
+  { 0x7C63940B, 0x750C },{ 0xE0EA931E, 0x1848 },{ 0x24794ABF, 0x856B },{ 0xB8F04DAA, 0xE82F },
+  { 0xD14EEB4F, 0x58D7 },{ 0x4DC7EC5A, 0x3593 },{ 0x895435FB, 0xA8B0 },{ 0x15DD32EE, 0xC5F4 },
+  { 0x8BBBEA35, 0xBB31 },{ 0x1732ED20, 0xD675 },{ 0xD3A13481, 0x4B56 },{ 0x4F283394, 0x2612 },
+  { 0x2FE7F904, 0x1659 },{ 0xB36EFE11, 0x7B1D },{ 0x77FD27B0, 0xE63E },{ 0xEB7420A5, 0x8B7A },
+  { 0x7512F87E, 0xF5BF },{ 0xE99BFF6B, 0x98FB },{ 0x2D0826CA, 0x05D8 },{ 0xB18121DF, 0x689C },
+  { 0xD83F873A, 0xD864 },{ 0x44B6802F, 0xB520 },{ 0x8025598E, 0x2803 },{ 0x1CAC5E9B, 0x4547 },
+  { 0x82CA8640, 0x3B82 },{ 0x1E438155, 0x56C6 },{ 0xDAD058F4, 0xCBE5 },{ 0x46595FE1, 0xA6A1 },
+  { 0xFCDADEED, 0xEDAF },{ 0x6053D9F8, 0x80EB },{ 0xA4C00059, 0x1DC8 },{ 0x3849074C, 0x708C },
+  { 0xA62FDF97, 0x0E49 },{ 0x3AA6D882, 0x630D },{ 0xFE350123, 0xFE2E },{ 0x62BC0636, 0x936A },
+  { 0x0B02A0D3, 0x2392 },{ 0x978BA7C6, 0x4ED6 },{ 0x53187E67, 0xD3F5 },{ 0xCF917972, 0xBEB1 },
+  { 0x51F7A1A9, 0xC074 },{ 0xCD7EA6BC, 0xAD30 },{ 0x09ED7F1D, 0x3013 },{ 0x95647808, 0x5D57 },
+  { 0xF5ABB298, 0x6D1C },{ 0x6922B58D, 0x0058 },{ 0xADB16C2C, 0x9D7B },{ 0x31386B39, 0xF03F },
+  { 0xAF5EB3E2, 0x8EFA },{ 0x33D7B4F7, 0xE3BE },{ 0xF7446D56, 0x7E9D },{ 0x6BCD6A43, 0x13D9 },
+  { 0x0273CCA6, 0xA321 },{ 0x9EFACBB3, 0xCE65 },{ 0x5A691212, 0x5346 },{ 0xC6E01507, 0x3E02 },
+  { 0x5886CDDC, 0x40C7 },{ 0xC40FCAC9, 0x2D83 },{ 0x009C1368, 0xB0A0 },{ 0x9C15147D, 0xDDE4 },
+ },
+ { // data byte #8
+  { 0x00000000, 0x0000 },{ 0x2EED62C1, 0x2489 },{ 0x21F07BAD, 0xAD33 },{ 0x0F1D196C, 0x89BA },
+  { 0x0100C034, 0x0002 },{ 0x2FEDA2F5, 0x248B },{ 0x20F0BB99, 0xAD31 },{ 0x0E1DD958, 0x89B8 },
+  { 0x7105183D, 0xFB3F },{ 0x5FE87AFC, 0xDFB6 },{ 0x50F56390, 0x560C },{ 0x7E180151, 0x7285 },
+  { 0x7005D809, 0xFB3D },{ 0x5EE8BAC8, 0xDFB4 },{ 0x51F5A3A4, 0x560E },{ 0x7F18C165, 0x7287 },
+  { 0x5AB6E142, 0xC7A4 },{ 0x745B8383, 0xE32D },{ 0x7B469AEF, 0x6A97 },{ 0x55ABF82E, 0x4E1E },
+  { 0x5BB62176, 0xC7A6 },{ 0x755B43B7, 0xE32F },{ 0x7A465ADB, 0x6A95 },{ 0x54AB381A, 0x4E1C },
+  { 0x2BB3F97F, 0x3C9B },{ 0x055E9BBE, 0x1812 },{ 0x0A4382D2, 0x91A8 },{ 0x24AEE013, 0xB521 },
+  { 0x2AB3394B, 0x3C99 },{ 0x045E5B8A, 0x1810 },{ 0x0B4342E6, 0x91AA },{ 0x25AE2027, 0xB523 },
+  { 0xDDB46785, 0x6744 },{ 0xF3590544, 0x43CD },{ 0xFC441C28, 0xCA77 },{ 0xD2A97EE9, 0xEEFE },
+  { 0xDCB4A7B1, 0x6746 },{ 0xF259C570, 0x43CF },{ 0xFD44DC1C, 0xCA75 },{ 0xD3A9BEDD, 0xEEFC },
+  { 0xACB17FB8, 0x9C7B },{ 0x825C1D79, 0xB8F2 },{ 0x8D410415, 0x3148 },{ 0xA3AC66D4, 0x15C1 },
+  { 0xADB1BF8C, 0x9C79 },{ 0x835CDD4D, 0xB8F0 },{ 0x8C41C421, 0x314A },{ 0xA2ACA6E0, 0x15C3 },
+  { 0x870286C7, 0xA0E0 },{ 0xA9EFE406, 0x8469 },{ 0xA6F2FD6A, 0x0DD3 },{ 0x881F9FAB, 0x295A },
+  { 0x860246F3, 0xA0E2 },{ 0xA8EF2432, 0x846B },{ 0xA7F23D5E, 0x0DD1 },{ 0x891F5F9F, 0x2958 },
+  { 0xF6079EFA, 0x5BDF },{ 0xD8EAFC3B, 0x7F56 },{ 0xD7F7E557, 0xF6EC },{ 0xF91A8796, 0xD265 },
+  { 0xF7075ECE, 0x5BDD },{ 0xD9EA3C0F, 0x7F54 },{ 0xD6F72563, 0xF6EE },{ 0xF81A47A2, 0xD267 },
+  { 0xAD9ABD8B, 0x8C28 },{ 0x8377DF4A, 0xA8A1 },{ 0x8C6AC626, 0x211B },{ 0xA287A4E7, 0x0592 },
+  { 0xAC9A7DBF, 0x8C2A },{ 0x82771F7E, 0xA8A3 },{ 0x8D6A0612, 0x2119 },{ 0xA38764D3, 0x0590 },
+  { 0xDC9FA5B6, 0x7717 },{ 0xF272C777, 0x539E },{ 0xFD6FDE1B, 0xDA24 },{ 0xD382BCDA, 0xFEAD },
+  { 0xDD9F6582, 0x7715 },{ 0xF3720743, 0x539C },{ 0xFC6F1E2F, 0xDA26 },{ 0xD2827CEE, 0xFEAF },
+  { 0xF72C5CC9, 0x4B8C },{ 0xD9C13E08, 0x6F05 },{ 0xD6DC2764, 0xE6BF },{ 0xF83145A5, 0xC236 },
+  { 0xF62C9CFD, 0x4B8E },{ 0xD8C1FE3C, 0x6F07 },{ 0xD7DCE750, 0xE6BD },{ 0xF9318591, 0xC234 },
+  { 0x862944F4, 0xB0B3 },{ 0xA8C42635, 0x943A },{ 0xA7D93F59, 0x1D80 },{ 0x89345D98, 0x3909 },
+  { 0x872984C0, 0xB0B1 },{ 0xA9C4E601, 0x9438 },{ 0xA6D9FF6D, 0x1D82 },{ 0x88349DAC, 0x390B },
+  { 0x702EDA0E, 0xEB6C },{ 0x5EC3B8CF, 0xCFE5 },{ 0x51DEA1A3, 0x465F },{ 0x7F33C362, 0x62D6 },
+  { 0x712E1A3A, 0xEB6E },{ 0x5FC378FB, 0xCFE7 },{ 0x50DE6197, 0x465D },{ 0x7E330356, 0x62D4 },
+  { 0x012BC233, 0x1053 },{ 0x2FC6A0F2, 0x34DA },{ 0x20DBB99E, 0xBD60 },{ 0x0E36DB5F, 0x99E9 },
+  { 0x002B0207, 0x1051 },{ 0x2EC660C6, 0x34D8 },{ 0x21DB79AA, 0xBD62 },{ 0x0F361B6B, 0x99EB },
+  { 0x2A983B4C, 0x2CC8 },{ 0x0475598D, 0x0841 },{ 0x0B6840E1, 0x81FB },{ 0x25852220, 0xA572 },
+  { 0x2B98FB78, 0x2CCA },{ 0x057599B9, 0x0843 },{ 0x0A6880D5, 0x81F9 },{ 0x2485E214, 0xA570 },
+  { 0x5B9D2371, 0xD7F7 },{ 0x757041B0, 0xF37E },{ 0x7A6D58DC, 0x7AC4 },{ 0x54803A1D, 0x5E4D },
+  { 0x5A9DE345, 0xD7F5 },{ 0x74708184, 0xF37C },{ 0x7B6D98E8, 0x7AC6 },{ 0x5580FA29, 0x5E4F },
+  { 0x09ED7F82, 0x3701 },{ 0x27001D43, 0x1388 },{ 0x281D042F, 0x9A32 },{ 0x06F066EE, 0xBEBB },
+  { 0x08EDBFB6, 0x3703 },{ 0x2600DD77, 0x138A },{ 0x291DC41B, 0x9A30 },{ 0x07F0A6DA, 0xBEB9 },
+  { 0x78E867BF, 0xCC3E },{ 0x5605057E, 0xE8B7 },{ 0x59181C12, 0x610D },{ 0x77F57ED3, 0x4584 },
+  { 0x79E8A78B, 0xCC3C },{ 0x5705C54A, 0xE8B5 },{ 0x5818DC26, 0x610F },{ 0x76F5BEE7, 0x4586 },
+  { 0x535B9EC0, 0xF0A5 },{ 0x7DB6FC01, 0xD42C },{ 0x72ABE56D, 0x5D96 },{ 0x5C4687AC, 0x791F },
+  { 0x525B5EF4, 0xF0A7 },{ 0x7CB63C35, 0xD42E },{ 0x73AB2559, 0x5D94 },{ 0x5D464798, 0x791D },
+  { 0x225E86FD, 0x0B9A },{ 0x0CB3E43C, 0x2F13 },{ 0x03AEFD50, 0xA6A9 },{ 0x2D439F91, 0x8220 },
+  { 0x235E46C9, 0x0B98 },{ 0x0DB32408, 0x2F11 },{ 0x02AE3D64, 0xA6AB },{ 0x2C435FA5, 0x8222 },
+  { 0xD4591807, 0x5045 },{ 0xFAB47AC6, 0x74CC },{ 0xF5A963AA, 0xFD76 },{ 0xDB44016B, 0xD9FF },
+  { 0xD559D833, 0x5047 },{ 0xFBB4BAF2, 0x74CE },{ 0xF4A9A39E, 0xFD74 },{ 0xDA44C15F, 0xD9FD },
+  { 0xA55C003A, 0xAB7A },{ 0x8BB162FB, 0x8FF3 },{ 0x84AC7B97, 0x0649 },{ 0xAA411956, 0x22C0 },
+  { 0xA45CC00E, 0xAB78 },{ 0x8AB1A2CF, 0x8FF1 },{ 0x85ACBBA3, 0x064B },{ 0xAB41D962, 0x22C2 },
+  { 0x8EEFF945, 0x97E1 },{ 0xA0029B84, 0xB368 },{ 0xAF1F82E8, 0x3AD2 },{ 0x81F2E029, 0x1E5B },
+  { 0x8FEF3971, 0x97E3 },{ 0xA1025BB0, 0xB36A },{ 0xAE1F42DC, 0x3AD0 },{ 0x80F2201D, 0x1E59 },
+  { 0xFFEAE178, 0x6CDE },{ 0xD10783B9, 0x4857 },{ 0xDE1A9AD5, 0xC1ED },{ 0xF0F7F814, 0xE564 },
+  { 0xFEEA214C, 0x6CDC },{ 0xD007438D, 0x4855 },{ 0xDF1A5AE1, 0xC1EF },{ 0xF1F73820, 0xE566 },
+  { 0xA477C209, 0xBB29 },{ 0x8A9AA0C8, 0x9FA0 },{ 0x8587B9A4, 0x161A },{ 0xAB6ADB65, 0x3293 },
+  { 0xA577023D, 0xBB2B },{ 0x8B9A60FC, 0x9FA2 },{ 0x84877990, 0x1618 },{ 0xAA6A1B51, 0x3291 },
+  { 0xD572DA34, 0x4016 },{ 0xFB9FB8F5, 0x649F },{ 0xF482A199, 0xED25 },{ 0xDA6FC358, 0xC9AC },
+  { 0xD4721A00, 0x4014 },{ 0xFA9F78C1, 0x649D },{ 0xF58261AD, 0xED27 },{ 0xDB6F036C, 0xC9AE },
+  { 0xFEC1234B, 0x7C8D },{ 0xD02C418A, 0x5804 },{ 0xDF3158E6, 0xD1BE },{ 0xF1DC3A27, 0xF537 },
+  { 0xFFC1E37F, 0x7C8F },{ 0xD12C81BE, 0x5806 },{ 0xDE3198D2, 0xD1BC },{ 0xF0DCFA13, 0xF535 },
+  { 0x8FC43B76, 0x87B2 },{ 0xA12959B7, 0xA33B },{ 0xAE3440DB, 0x2A81 },{ 0x80D9221A, 0x0E08 },
+  { 0x8EC4FB42, 0x87B0 },{ 0xA0299983, 0xA339 },{ 0xAF3480EF, 0x2A83 },{ 0x81D9E22E, 0x0E0A },
+  { 0x79C3A58C, 0xDC6D },{ 0x572EC74D, 0xF8E4 },{ 0x5833DE21, 0x715E },{ 0x76DEBCE0, 0x55D7 },
+  { 0x78C365B8, 0xDC6F },{ 0x562E0779, 0xF8E6 },{ 0x59331E15, 0x715C },{ 0x77DE7CD4, 0x55D5 },
+  { 0x08C6BDB1, 0x2752 },{ 0x262BDF70, 0x03DB },{ 0x2936C61C, 0x8A61 },{ 0x07DBA4DD, 0xAEE8 },
+  { 0x09C67D85, 0x2750 },{ 0x272B1F44, 0x03D9 },{ 0x28360628, 0x8A63 },{ 0x06DB64E9, 0xAEEA },
+  { 0x237544CE, 0x1BC9 },{ 0x0D98260F, 0x3F40 },{ 0x02853F63, 0xB6FA },{ 0x2C685DA2, 0x9273 },
+  { 0x227584FA, 0x1BCB },{ 0x0C98E63B, 0x3F42 },{ 0x0385FF57, 0xB6F8 },{ 0x2D689D96, 0x9271 },
+  { 0x52705CF3, 0xE0F6 },{ 0x7C9D3E32, 0xC47F },{ 0x7380275E, 0x4DC5 },{ 0x5D6D459F, 0x694C },
+  { 0x53709CC7, 0xE0F4 },{ 0x7D9DFE06, 0xC47D },{ 0x7280E76A, 0x4DC7 },{ 0x5C6D85AB, 0x694E },
+ },
+ { // data byte #9
+  { 0x00000000, 0x0000 },{ 0x72D68567, 0x97BF },{ 0x6FF57B5E, 0xB7F9 },{ 0x1D23FE39, 0x2046 },
+  { 0x7086D090, 0x4446 },{ 0x025055F7, 0xD3F9 },{ 0x1F73ABCE, 0xF3BF },{ 0x6DA52EA9, 0x6400 },
+  { 0x6082F9F8, 0x1CCF },{ 0x12547C9F, 0x8B70 },{ 0x0F7782A6, 0xAB36 },{ 0x7DA107C1, 0x3C89 },
+  { 0x10042968, 0x5889 },{ 0x62D2AC0F, 0xCF36 },{ 0x7FF15236, 0xEF70 },{ 0x0D27D751, 0x78CF },
+  { 0xAEC2FDED, 0xBDBA },{ 0xDC14788A, 0x2A05 },{ 0xC13786B3, 0x0A43 },{ 0xB3E103D4, 0x9DFC },
+  { 0xDE442D7D, 0xF9FC },{ 0xAC92A81A, 0x6E43 },{ 0xB1B15623, 0x4E05 },{ 0xC367D344, 0xD9BA },
+  { 0xCE400415, 0xA175 },{ 0xBC968172, 0x36CA },{ 0xA1B57F4B, 0x168C },{ 0xD363FA2C, 0x8133 },
+  { 0xBEC6D485, 0xE533 },{ 0xCC1051E2, 0x728C },{ 0xD133AFDB, 0x52CA },{ 0xA3E52ABC, 0xC575 },
+  { 0xBA6A9010, 0x4009 },{ 0xC8BC1577, 0xD7B6 },{ 0xD59FEB4E, 0xF7F0 },{ 0xA7496E29, 0x604F },
+  { 0xCAEC4080, 0x044F },{ 0xB83AC5E7, 0x93F0 },{ 0xA5193BDE, 0xB3B6 },{ 0xD7CFBEB9, 0x2409 },
+  { 0xDAE869E8, 0x5CC6 },{ 0xA83EEC8F, 0xCB79 },{ 0xB51D12B6, 0xEB3F },{ 0xC7CB97D1, 0x7C80 },
+  { 0xAA6EB978, 0x1880 },{ 0xD8B83C1F, 0x8F3F },{ 0xC59BC226, 0xAF79 },{ 0xB74D4741, 0x38C6 },
+  { 0x14A86DFD, 0xFDB3 },{ 0x667EE89A, 0x6A0C },{ 0x7B5D16A3, 0x4A4A },{ 0x098B93C4, 0xDDF5 },
+  { 0x642EBD6D, 0xB9F5 },{ 0x16F8380A, 0x2E4A },{ 0x0BDBC633, 0x0E0C },{ 0x790D4354, 0x99B3 },
+  { 0x742A9405, 0xE17C },{ 0x06FC1162, 0x76C3 },{ 0x1BDFEF5B, 0x5685 },{ 0x69096A3C, 0xC13A },
+  { 0x04AC4495, 0xA53A },{ 0x767AC1F2, 0x3285 },{ 0x6B593FCB, 0x12C3 },{ 0x198FBAAC, 0x857C },
+  { 0xF2DA6DAF, 0xCC7F },{ 0x800CE8C8, 0x5BC0 },{ 0x9D2F16F1, 0x7B86 },{ 0xEFF99396, 0xEC39 },
+  { 0x825CBD3F, 0x8839 },{ 0xF08A3858, 0x1F86 },{ 0xEDA9C661, 0x3FC0 },{ 0x9F7F4306, 0xA87F },
+  { 0x92589457, 0xD0B0 },{ 0xE08E1130, 0x470F },{ 0xFDADEF09, 0x6749 },{ 0x8F7B6A6E, 0xF0F6 },
+  { 0xE2DE44C7, 0x94F6 },{ 0x9008C1A0, 0x0349 },{ 0x8D2B3F99, 0x230F },{ 0xFFFDBAFE, 0xB4B0 },
+  { 0x5C189042, 0x71C5 },{ 0x2ECE1525, 0xE67A },{ 0x33EDEB1C, 0xC63C },{ 0x413B6E7B, 0x5183 },
+  { 0x2C9E40D2, 0x3583 },{ 0x5E48C5B5, 0xA23C },{ 0x436B3B8C, 0x827A },{ 0x31BDBEEB, 0x15C5 },
+  { 0x3C9A69BA, 0x6D0A },{ 0x4E4CECDD, 0xFAB5 },{ 0x536F12E4, 0xDAF3 },{ 0x21B99783, 0x4D4C },
+  { 0x4C1CB92A, 0x294C },{ 0x3ECA3C4D, 0xBEF3 },{ 0x23E9C274, 0x9EB5 },{ 0x513F4713, 0x090A },
+  { 0x48B0FDBF, 0x8C76 },{ 0x3A6678D8, 0x1BC9 },{ 0x274586E1, 0x3B8F },{ 0x55930386, 0xAC30 },
+  { 0x38362D2F, 0xC830 },{ 0x4AE0A848, 0x5F8F },{ 0x57C35671, 0x7FC9 },{ 0x2515D316, 0xE876 },
+  { 0x28320447, 0x90B9 },{ 0x5AE48120, 0x0706 },{ 0x47C77F19, 0x2740 },{ 0x3511FA7E, 0xB0FF },
+  { 0x58B4D4D7, 0xD4FF },{ 0x2A6251B0, 0x4340 },{ 0x3741AF89, 0x6306 },{ 0x45972AEE, 0xF4B9 },
+  { 0xE6720052, 0x31CC },{ 0x94A48535, 0xA673 },{ 0x89877B0C, 0x8635 },{ 0xFB51FE6B, 0x118A },
+  { 0x96F4D0C2, 0x758A },{ 0xE42255A5, 0xE235 },{ 0xF901AB9C, 0xC273 },{ 0x8BD72EFB, 0x55CC },
+  { 0x86F0F9AA, 0x2D03 },{ 0xF4267CCD, 0xBABC },{ 0xE90582F4, 0x9AFA },{ 0x9BD30793, 0x0D45 },
+  { 0xF676293A, 0x6945 },{ 0x84A0AC5D, 0xFEFA },{ 0x99835264, 0xDEBC },{ 0xEB55D703, 0x4903 },
+  { 0x7C1A9642, 0xD17D },{ 0x0ECC1325, 0x46C2 },{ 0x13EFED1C, 0x6684 },{ 0x6139687B, 0xF13B },
+  { 0x0C9C46D2, 0x953B },{ 0x7E4AC3B5, 0x0284 },{ 0x63693D8C, 0x22C2 },{ 0x11BFB8EB, 0xB57D },
+  { 0x1C986FBA, 0xCDB2 },{ 0x6E4EEADD, 0x5A0D },{ 0x736D14E4, 0x7A4B },{ 0x01BB9183, 0xEDF4 },
+  { 0x6C1EBF2A, 0x89F4 },{ 0x1EC83A4D, 0x1E4B },{ 0x03EBC474, 0x3E0D },{ 0x713D4113, 0xA9B2 },
+  { 0xD2D86BAF, 0x6CC7 },{ 0xA00EEEC8, 0xFB78 },{ 0xBD2D10F1, 0xDB3E },{ 0xCFFB9596, 0x4C81 },
+  { 0xA25EBB3F, 0x2881 },{ 0xD0883E58, 0xBF3E },{ 0xCDABC061, 0x9F78 },{ 0xBF7D4506, 0x08C7 },
+  { 0xB25A9257, 0x7008 },{ 0xC08C1730, 0xE7B7 },{ 0xDDAFE909, 0xC7F1 },{ 0xAF796C6E, 0x504E },
+  { 0xC2DC42C7, 0x344E },{ 0xB00AC7A0, 0xA3F1 },{ 0xAD293999, 0x83B7 },{ 0xDFFFBCFE, 0x1408 },
+  { 0xC6700652, 0x9174 },{ 0xB4A68335, 0x06CB },{ 0xA9857D0C, 0x268D },{ 0xDB53F86B, 0xB132 },
+  { 0xB6F6D6C2, 0xD532 },{ 0xC42053A5, 0x428D },{ 0xD903AD9C, 0x62CB },{ 0xABD528FB, 0xF574 },
+  { 0xA6F2FFAA, 0x8DBB },{ 0xD4247ACD, 0x1A04 },{ 0xC90784F4, 0x3A42 },{ 0xBBD10193, 0xADFD },
+  { 0xD6742F3A, 0xC9FD },{ 0xA4A2AA5D, 0x5E42 },{ 0xB9815464, 0x7E04 },{ 0xCB57D103, 0xE9BB },
+  { 0x68B2FBBF, 0x2CCE },{ 0x1A647ED8, 0xBB71 },{ 0x074780E1, 0x9B37 },{ 0x75910586, 0x0C88 },
+  { 0x18342B2F, 0x6888 },{ 0x6AE2AE48, 0xFF37 },{ 0x77C15071, 0xDF71 },{ 0x0517D516, 0x48CE },
+  { 0x08300247, 0x3001 },{ 0x7AE68720, 0xA7BE },{ 0x67C57919, 0x87F8 },{ 0x1513FC7E, 0x1047 },
+  { 0x78B6D2D7, 0x7447 },{ 0x0A6057B0, 0xE3F8 },{ 0x1743A989, 0xC3BE },{ 0x65952CEE, 0x5401 },
+  { 0x8EC0FBED, 0x1D02 },{ 0xFC167E8A, 0x8ABD },{ 0xE13580B3, 0xAAFB },{ 0x93E305D4, 0x3D44 },
+  { 0xFE462B7D, 0x5944 },{ 0x8C90AE1A, 0xCEFB },{ 0x91B35023, 0xEEBD },{ 0xE365D544, 0x7902 },
+  { 0xEE420215, 0x01CD },{ 0x9C948772, 0x9672 },{ 0x81B7794B, 0xB634 },{ 0xF361FC2C, 0x218B },
+  { 0x9EC4D285, 0x458B },{ 0xEC1257E2, 0xD234 },{ 0xF131A9DB, 0xF272 },{ 0x83E72CBC, 0x65CD },
+  { 0x20020600, 0xA0B8 },{ 0x52D48367, 0x3707 },{ 0x4FF77D5E, 0x1741 },{ 0x3D21F839, 0x80FE },
+  { 0x5084D690, 0xE4FE },{ 0x225253F7, 0x7341 },{ 0x3F71ADCE, 0x5307 },{ 0x4DA728A9, 0xC4B8 },
+  { 0x4080FFF8, 0xBC77 },{ 0x32567A9F, 0x2BC8 },{ 0x2F7584A6, 0x0B8E },{ 0x5DA301C1, 0x9C31 },
+  { 0x30062F68, 0xF831 },{ 0x42D0AA0F, 0x6F8E },{ 0x5FF35436, 0x4FC8 },{ 0x2D25D151, 0xD877 },
+  { 0x34AA6BFD, 0x5D0B },{ 0x467CEE9A, 0xCAB4 },{ 0x5B5F10A3, 0xEAF2 },{ 0x298995C4, 0x7D4D },
+  { 0x442CBB6D, 0x194D },{ 0x36FA3E0A, 0x8EF2 },{ 0x2BD9C033, 0xAEB4 },{ 0x590F4554, 0x390B },
+  { 0x54289205, 0x41C4 },{ 0x26FE1762, 0xD67B },{ 0x3BDDE95B, 0xF63D },{ 0x490B6C3C, 0x6182 },
+  { 0x24AE4295, 0x0582 },{ 0x5678C7F2, 0x923D },{ 0x4B5B39CB, 0xB27B },{ 0x398DBCAC, 0x25C4 },
+  { 0x9A689610, 0xE0B1 },{ 0xE8BE1377, 0x770E },{ 0xF59DED4E, 0x5748 },{ 0x874B6829, 0xC0F7 },
+  { 0xEAEE4680, 0xA4F7 },{ 0x9838C3E7, 0x3348 },{ 0x851B3DDE, 0x130E },{ 0xF7CDB8B9, 0x84B1 },
+  { 0xFAEA6FE8, 0xFC7E },{ 0x883CEA8F, 0x6BC1 },{ 0x951F14B6, 0x4B87 },{ 0xE7C991D1, 0xDC38 },
+  { 0x8A6CBF78, 0xB838 },{ 0xF8BA3A1F, 0x2F87 },{ 0xE599C426, 0x0FC1 },{ 0x974F4141, 0x987E },
+ },
+ { // data byte #10
+  { 0x00000000, 0x0000 },{ 0xB98A9C09, 0x441D },{ 0x4E7DA036, 0x9B73 },{ 0xF7F73C3F, 0xDF6E },
+  { 0xFE5AB217, 0x414D },{ 0x47D02E1E, 0x0550 },{ 0xB0271221, 0xDA3E },{ 0x09AD8E28, 0x9E23 },
+  { 0x56E6CFD3, 0x43C4 },{ 0xEF6C53DA, 0x07D9 },{ 0x189B6FE5, 0xD8B7 },{ 0xA111F3EC, 0x9CAA },
+  { 0xA8BC7DC4, 0x0289 },{ 0x1136E1CD, 0x4694 },{ 0xE6C1DDF2, 0x99FA },{ 0x5F4B41FB, 0xDDE7 },
+  { 0x53713C8B, 0xC174 },{ 0xEAFBA082, 0x8569 },{ 0x1D0C9CBD, 0x5A07 },{ 0xA48600B4, 0x1E1A },
+  { 0xAD2B8E9C, 0x8039 },{ 0x14A11295, 0xC424 },{ 0xE3562EAA, 0x1B4A },{ 0x5ADCB2A3, 0x5F57 },
+  { 0x0597F358, 0x82B0 },{ 0xBC1D6F51, 0xC6AD },{ 0x4BEA536E, 0x19C3 },{ 0xF260CF67, 0x5DDE },
+  { 0xFBCD414F, 0xC3FD },{ 0x4247DD46, 0x87E0 },{ 0xB5B0E179, 0x588E },{ 0x0C3A7D70, 0x1C93 },
+  { 0x69BC5DCC, 0xA6E9 },{ 0xD036C1C5, 0xE2F4 },{ 0x27C1FDFA, 0x3D9A },{ 0x9E4B61F3, 0x7987 },
+  { 0x97E6EFDB, 0xE7A4 },{ 0x2E6C73D2, 0xA3B9 },{ 0xD99B4FED, 0x7CD7 },{ 0x6011D3E4, 0x38CA },
+  { 0x3F5A921F, 0xE52D },{ 0x86D00E16, 0xA130 },{ 0x71273229, 0x7E5E },{ 0xC8ADAE20, 0x3A43 },
+  { 0xC1002008, 0xA460 },{ 0x788ABC01, 0xE07D },{ 0x8F7D803E, 0x3F13 },{ 0x36F71C37, 0x7B0E },
+  { 0x3ACD6147, 0x679D },{ 0x8347FD4E, 0x2380 },{ 0x74B0C171, 0xFCEE },{ 0xCD3A5D78, 0xB8F3 },
+  { 0xC497D350, 0x26D0 },{ 0x7D1D4F59, 0x62CD },{ 0x8AEA7366, 0xBDA3 },{ 0x3360EF6F, 0xF9BE },
+  { 0x6C2BAE94, 0x2459 },{ 0xD5A1329D, 0x6044 },{ 0x22560EA2, 0xBF2A },{ 0x9BDC92AB, 0xFB37 },
+  { 0x92711C83, 0x6514 },{ 0x2BFB808A, 0x2109 },{ 0xDC0CBCB5, 0xFE67 },{ 0x658620BC, 0xBA7A },
+  { 0x62FFD588, 0x8669 },{ 0xDB754981, 0xC274 },{ 0x2C8275BE, 0x1D1A },{ 0x9508E9B7, 0x5907 },
+  { 0x9CA5679F, 0xC724 },{ 0x252FFB96, 0x8339 },{ 0xD2D8C7A9, 0x5C57 },{ 0x6B525BA0, 0x184A },
+  { 0x34191A5B, 0xC5AD },{ 0x8D938652, 0x81B0 },{ 0x7A64BA6D, 0x5EDE },{ 0xC3EE2664, 0x1AC3 },
+  { 0xCA43A84C, 0x84E0 },{ 0x73C93445, 0xC0FD },{ 0x843E087A, 0x1F93 },{ 0x3DB49473, 0x5B8E },
+  { 0x318EE903, 0x471D },{ 0x8804750A, 0x0300 },{ 0x7FF34935, 0xDC6E },{ 0xC679D53C, 0x9873 },
+  { 0xCFD45B14, 0x0650 },{ 0x765EC71D, 0x424D },{ 0x81A9FB22, 0x9D23 },{ 0x3823672B, 0xD93E },
+  { 0x676826D0, 0x04D9 },{ 0xDEE2BAD9, 0x40C4 },{ 0x291586E6, 0x9FAA },{ 0x909F1AEF, 0xDBB7 },
+  { 0x993294C7, 0x4594 },{ 0x20B808CE, 0x0189 },{ 0xD74F34F1, 0xDEE7 },{ 0x6EC5A8F8, 0x9AFA },
+  { 0x0B438844, 0x2080 },{ 0xB2C9144D, 0x649D },{ 0x453E2872, 0xBBF3 },{ 0xFCB4B47B, 0xFFEE },
+  { 0xF5193A53, 0x61CD },{ 0x4C93A65A, 0x25D0 },{ 0xBB649A65, 0xFABE },{ 0x02EE066C, 0xBEA3 },
+  { 0x5DA54797, 0x6344 },{ 0xE42FDB9E, 0x2759 },{ 0x13D8E7A1, 0xF837 },{ 0xAA527BA8, 0xBC2A },
+  { 0xA3FFF580, 0x2209 },{ 0x1A756989, 0x6614 },{ 0xED8255B6, 0xB97A },{ 0x5408C9BF, 0xFD67 },
+  { 0x5832B4CF, 0xE1F4 },{ 0xE1B828C6, 0xA5E9 },{ 0x164F14F9, 0x7A87 },{ 0xAFC588F0, 0x3E9A },
+  { 0xA66806D8, 0xA0B9 },{ 0x1FE29AD1, 0xE4A4 },{ 0xE815A6EE, 0x3BCA },{ 0x519F3AE7, 0x7FD7 },
+  { 0x0ED47B1C, 0xA230 },{ 0xB75EE715, 0xE62D },{ 0x40A9DB2A, 0x3943 },{ 0xF9234723, 0x7D5E },
+  { 0xF08EC90B, 0xE37D },{ 0x49045502, 0xA760 },{ 0xBEF3693D, 0x780E },{ 0x0779F534, 0x3C13 },
+  { 0x1E7B52FD, 0xE0A6 },{ 0xA7F1CEF4, 0xA4BB },{ 0x5006F2CB, 0x7BD5 },{ 0xE98C6EC2, 0x3FC8 },
+  { 0xE021E0EA, 0xA1EB },{ 0x59AB7CE3, 0xE5F6 },{ 0xAE5C40DC, 0x3A98 },{ 0x17D6DCD5, 0x7E85 },
+  { 0x489D9D2E, 0xA362 },{ 0xF1170127, 0xE77F },{ 0x06E03D18, 0x3811 },{ 0xBF6AA111, 0x7C0C },
+  { 0xB6C72F39, 0xE22F },{ 0x0F4DB330, 0xA632 },{ 0xF8BA8F0F, 0x795C },{ 0x41301306, 0x3D41 },
+  { 0x4D0A6E76, 0x21D2 },{ 0xF480F27F, 0x65CF },{ 0x0377CE40, 0xBAA1 },{ 0xBAFD5249, 0xFEBC },
+  { 0xB350DC61, 0x609F },{ 0x0ADA4068, 0x2482 },{ 0xFD2D7C57, 0xFBEC },{ 0x44A7E05E, 0xBFF1 },
+  { 0x1BECA1A5, 0x6216 },{ 0xA2663DAC, 0x260B },{ 0x55910193, 0xF965 },{ 0xEC1B9D9A, 0xBD78 },
+  { 0xE5B613B2, 0x235B },{ 0x5C3C8FBB, 0x6746 },{ 0xABCBB384, 0xB828 },{ 0x12412F8D, 0xFC35 },
+  { 0x77C70F31, 0x464F },{ 0xCE4D9338, 0x0252 },{ 0x39BAAF07, 0xDD3C },{ 0x8030330E, 0x9921 },
+  { 0x899DBD26, 0x0702 },{ 0x3017212F, 0x431F },{ 0xC7E01D10, 0x9C71 },{ 0x7E6A8119, 0xD86C },
+  { 0x2121C0E2, 0x058B },{ 0x98AB5CEB, 0x4196 },{ 0x6F5C60D4, 0x9EF8 },{ 0xD6D6FCDD, 0xDAE5 },
+  { 0xDF7B72F5, 0x44C6 },{ 0x66F1EEFC, 0x00DB },{ 0x9106D2C3, 0xDFB5 },{ 0x288C4ECA, 0x9BA8 },
+  { 0x24B633BA, 0x873B },{ 0x9D3CAFB3, 0xC326 },{ 0x6ACB938C, 0x1C48 },{ 0xD3410F85, 0x5855 },
+  { 0xDAEC81AD, 0xC676 },{ 0x63661DA4, 0x826B },{ 0x9491219B, 0x5D05 },{ 0x2D1BBD92, 0x1918 },
+  { 0x7250FC69, 0xC4FF },{ 0xCBDA6060, 0x80E2 },{ 0x3C2D5C5F, 0x5F8C },{ 0x85A7C056, 0x1B91 },
+  { 0x8C0A4E7E, 0x85B2 },{ 0x3580D277, 0xC1AF },{ 0xC277EE48, 0x1EC1 },{ 0x7BFD7241, 0x5ADC },
+  { 0x7C848775, 0x66CF },{ 0xC50E1B7C, 0x22D2 },{ 0x32F92743, 0xFDBC },{ 0x8B73BB4A, 0xB9A1 },
+  { 0x82DE3562, 0x2782 },{ 0x3B54A96B, 0x639F },{ 0xCCA39554, 0xBCF1 },{ 0x7529095D, 0xF8EC },
+  { 0x2A6248A6, 0x250B },{ 0x93E8D4AF, 0x6116 },{ 0x641FE890, 0xBE78 },{ 0xDD957499, 0xFA65 },
+  { 0xD438FAB1, 0x6446 },{ 0x6DB266B8, 0x205B },{ 0x9A455A87, 0xFF35 },{ 0x23CFC68E, 0xBB28 },
+  { 0x2FF5BBFE, 0xA7BB },{ 0x967F27F7, 0xE3A6 },{ 0x61881BC8, 0x3CC8 },{ 0xD80287C1, 0x78D5 },
+  { 0xD1AF09E9, 0xE6F6 },{ 0x682595E0, 0xA2EB },{ 0x9FD2A9DF, 0x7D85 },{ 0x265835D6, 0x3998 },
+  { 0x7913742D, 0xE47F },{ 0xC099E824, 0xA062 },{ 0x376ED41B, 0x7F0C },{ 0x8EE44812, 0x3B11 },
+  { 0x8749C63A, 0xA532 },{ 0x3EC35A33, 0xE12F },{ 0xC934660C, 0x3E41 },{ 0x70BEFA05, 0x7A5C },
+  { 0x1538DAB9, 0xC026 },{ 0xACB246B0, 0x843B },{ 0x5B457A8F, 0x5B55 },{ 0xE2CFE686, 0x1F48 },
+  { 0xEB6268AE, 0x816B },{ 0x52E8F4A7, 0xC576 },{ 0xA51FC898, 0x1A18 },{ 0x1C955491, 0x5E05 },
+  { 0x43DE156A, 0x83E2 },{ 0xFA548963, 0xC7FF },{ 0x0DA3B55C, 0x1891 },{ 0xB4292955, 0x5C8C },
+  { 0xBD84A77D, 0xC2AF },{ 0x040E3B74, 0x86B2 },{ 0xF3F9074B, 0x59DC },{ 0x4A739B42, 0x1DC1 },
+  { 0x4649E632, 0x0152 },{ 0xFFC37A3B, 0x454F },{ 0x08344604, 0x9A21 },{ 0xB1BEDA0D, 0xDE3C },
+  { 0xB8135425, 0x401F },{ 0x0199C82C, 0x0402 },{ 0xF66EF413, 0xDB6C },{ 0x4FE4681A, 0x9F71 },
+  { 0x10AF29E1, 0x4296 },{ 0xA925B5E8, 0x068B },{ 0x5ED289D7, 0xD9E5 },{ 0xE75815DE, 0x9DF8 },
+  { 0xEEF59BF6, 0x03DB },{ 0x577F07FF, 0x47C6 },{ 0xA0883BC0, 0x98A8 },{ 0x1902A7C9, 0xDCB5 },
+ },
+ { // data byte #11
+  { 0x00000000, 0x0000 },{ 0xAD1C0C7A, 0xAA3A },{ 0xF51AF2B5, 0xC0EF },{ 0x5806FECF, 0x6AD5 },
+  { 0xE1A06049, 0x7FE9 },{ 0x4CBC6C33, 0xD5D3 },{ 0x14BA92FC, 0xBF06 },{ 0xB9A69E86, 0x153C },
+  { 0x198976E1, 0x5F97 },{ 0xB4957A9B, 0xF5AD },{ 0xEC938454, 0x9F78 },{ 0x418F882E, 0x3542 },
+  { 0xF82916A8, 0x207E },{ 0x55351AD2, 0x8A44 },{ 0x0D33E41D, 0xE091 },{ 0xA02FE867, 0x4AAB },
+  { 0xE663C67C, 0x30FB },{ 0x4B7FCA06, 0x9AC1 },{ 0x137934C9, 0xF014 },{ 0xBE6538B3, 0x5A2E },
+  { 0x07C3A635, 0x4F12 },{ 0xAADFAA4F, 0xE528 },{ 0xF2D95480, 0x8FFD },{ 0x5FC558FA, 0x25C7 },
+  { 0xFFEAB09D, 0x6F6C },{ 0x52F6BCE7, 0xC556 },{ 0x0AF04228, 0xAF83 },{ 0xA7EC4E52, 0x05B9 },
+  { 0x1E4AD0D4, 0x1085 },{ 0xB356DCAE, 0xBABF },{ 0xEB502261, 0xD06A },{ 0x464C2E1B, 0x7A50 },
+  { 0x39984DB0, 0xF92F },{ 0x948441CA, 0x5315 },{ 0xCC82BF05, 0x39C0 },{ 0x619EB37F, 0x93FA },
+  { 0xD8382DF9, 0x86C6 },{ 0x75242183, 0x2CFC },{ 0x2D22DF4C, 0x4629 },{ 0x803ED336, 0xEC13 },
+  { 0x20113B51, 0xA6B8 },{ 0x8D0D372B, 0x0C82 },{ 0xD50BC9E4, 0x6657 },{ 0x7817C59E, 0xCC6D },
+  { 0xC1B15B18, 0xD951 },{ 0x6CAD5762, 0x736B },{ 0x34ABA9AD, 0x19BE },{ 0x99B7A5D7, 0xB384 },
+  { 0xDFFB8BCC, 0xC9D4 },{ 0x72E787B6, 0x63EE },{ 0x2AE17979, 0x093B },{ 0x87FD7503, 0xA301 },
+  { 0x3E5BEB85, 0xB63D },{ 0x9347E7FF, 0x1C07 },{ 0xCB411930, 0x76D2 },{ 0x665D154A, 0xDCE8 },
+  { 0xC672FD2D, 0x9643 },{ 0x6B6EF157, 0x3C79 },{ 0x33680F98, 0x56AC },{ 0x9E7403E2, 0xFC96 },
+  { 0x27D29D64, 0xE9AA },{ 0x8ACE911E, 0x4390 },{ 0xD2C86FD1, 0x2945 },{ 0x7FD463AB, 0x837F },
+  { 0x664C4C15, 0x8BE8 },{ 0xCB50406F, 0x21D2 },{ 0x9356BEA0, 0x4B07 },{ 0x3E4AB2DA, 0xE13D },
+  { 0x87EC2C5C, 0xF401 },{ 0x2AF02026, 0x5E3B },{ 0x72F6DEE9, 0x34EE },{ 0xDFEAD293, 0x9ED4 },
+  { 0x7FC53AF4, 0xD47F },{ 0xD2D9368E, 0x7E45 },{ 0x8ADFC841, 0x1490 },{ 0x27C3C43B, 0xBEAA },
+  { 0x9E655ABD, 0xAB96 },{ 0x337956C7, 0x01AC },{ 0x6B7FA808, 0x6B79 },{ 0xC663A472, 0xC143 },
+  { 0x802F8A69, 0xBB13 },{ 0x2D338613, 0x1129 },{ 0x753578DC, 0x7BFC },{ 0xD82974A6, 0xD1C6 },
+  { 0x618FEA20, 0xC4FA },{ 0xCC93E65A, 0x6EC0 },{ 0x94951895, 0x0415 },{ 0x398914EF, 0xAE2F },
+  { 0x99A6FC88, 0xE484 },{ 0x34BAF0F2, 0x4EBE },{ 0x6CBC0E3D, 0x246B },{ 0xC1A00247, 0x8E51 },
+  { 0x78069CC1, 0x9B6D },{ 0xD51A90BB, 0x3157 },{ 0x8D1C6E74, 0x5B82 },{ 0x2000620E, 0xF1B8 },
+  { 0x5FD401A5, 0x72C7 },{ 0xF2C80DDF, 0xD8FD },{ 0xAACEF310, 0xB228 },{ 0x07D2FF6A, 0x1812 },
+  { 0xBE7461EC, 0x0D2E },{ 0x13686D96, 0xA714 },{ 0x4B6E9359, 0xCDC1 },{ 0xE6729F23, 0x67FB },
+  { 0x465D7744, 0x2D50 },{ 0xEB417B3E, 0x876A },{ 0xB34785F1, 0xEDBF },{ 0x1E5B898B, 0x4785 },
+  { 0xA7FD170D, 0x52B9 },{ 0x0AE11B77, 0xF883 },{ 0x52E7E5B8, 0x9256 },{ 0xFFFBE9C2, 0x386C },
+  { 0xB9B7C7D9, 0x423C },{ 0x14ABCBA3, 0xE806 },{ 0x4CAD356C, 0x82D3 },{ 0xE1B13916, 0x28E9 },
+  { 0x5817A790, 0x3DD5 },{ 0xF50BABEA, 0x97EF },{ 0xAD0D5525, 0xFD3A },{ 0x0011595F, 0x5700 },
+  { 0xA03EB138, 0x1DAB },{ 0x0D22BD42, 0xB791 },{ 0x5524438D, 0xDD44 },{ 0xF8384FF7, 0x777E },
+  { 0x419ED171, 0x6242 },{ 0xEC82DD0B, 0xC878 },{ 0xB48423C4, 0xA2AD },{ 0x19982FBE, 0x0897 },
+  { 0x23C435A7, 0x123B },{ 0x8ED839DD, 0xB801 },{ 0xD6DEC712, 0xD2D4 },{ 0x7BC2CB68, 0x78EE },
+  { 0xC26455EE, 0x6DD2 },{ 0x6F785994, 0xC7E8 },{ 0x377EA75B, 0xAD3D },{ 0x9A62AB21, 0x0707 },
+  { 0x3A4D4346, 0x4DAC },{ 0x97514F3C, 0xE796 },{ 0xCF57B1F3, 0x8D43 },{ 0x624BBD89, 0x2779 },
+  { 0xDBED230F, 0x3245 },{ 0x76F12F75, 0x987F },{ 0x2EF7D1BA, 0xF2AA },{ 0x83EBDDC0, 0x5890 },
+  { 0xC5A7F3DB, 0x22C0 },{ 0x68BBFFA1, 0x88FA },{ 0x30BD016E, 0xE22F },{ 0x9DA10D14, 0x4815 },
+  { 0x24079392, 0x5D29 },{ 0x891B9FE8, 0xF713 },{ 0xD11D6127, 0x9DC6 },{ 0x7C016D5D, 0x37FC },
+  { 0xDC2E853A, 0x7D57 },{ 0x71328940, 0xD76D },{ 0x2934778F, 0xBDB8 },{ 0x84287BF5, 0x1782 },
+  { 0x3D8EE573, 0x02BE },{ 0x9092E909, 0xA884 },{ 0xC89417C6, 0xC251 },{ 0x65881BBC, 0x686B },
+  { 0x1A5C7817, 0xEB14 },{ 0xB740746D, 0x412E },{ 0xEF468AA2, 0x2BFB },{ 0x425A86D8, 0x81C1 },
+  { 0xFBFC185E, 0x94FD },{ 0x56E01424, 0x3EC7 },{ 0x0EE6EAEB, 0x5412 },{ 0xA3FAE691, 0xFE28 },
+  { 0x03D50EF6, 0xB483 },{ 0xAEC9028C, 0x1EB9 },{ 0xF6CFFC43, 0x746C },{ 0x5BD3F039, 0xDE56 },
+  { 0xE2756EBF, 0xCB6A },{ 0x4F6962C5, 0x6150 },{ 0x176F9C0A, 0x0B85 },{ 0xBA739070, 0xA1BF },
+  { 0xFC3FBE6B, 0xDBEF },{ 0x5123B211, 0x71D5 },{ 0x09254CDE, 0x1B00 },{ 0xA43940A4, 0xB13A },
+  { 0x1D9FDE22, 0xA406 },{ 0xB083D258, 0x0E3C },{ 0xE8852C97, 0x64E9 },{ 0x459920ED, 0xCED3 },
+  { 0xE5B6C88A, 0x8478 },{ 0x48AAC4F0, 0x2E42 },{ 0x10AC3A3F, 0x4497 },{ 0xBDB03645, 0xEEAD },
+  { 0x0416A8C3, 0xFB91 },{ 0xA90AA4B9, 0x51AB },{ 0xF10C5A76, 0x3B7E },{ 0x5C10560C, 0x9144 },
+  { 0x458879B2, 0x99D3 },{ 0xE89475C8, 0x33E9 },{ 0xB0928B07, 0x593C },{ 0x1D8E877D, 0xF306 },
+  { 0xA42819FB, 0xE63A },{ 0x09341581, 0x4C00 },{ 0x5132EB4E, 0x26D5 },{ 0xFC2EE734, 0x8CEF },
+  { 0x5C010F53, 0xC644 },{ 0xF11D0329, 0x6C7E },{ 0xA91BFDE6, 0x06AB },{ 0x0407F19C, 0xAC91 },
+  { 0xBDA16F1A, 0xB9AD },{ 0x10BD6360, 0x1397 },{ 0x48BB9DAF, 0x7942 },{ 0xE5A791D5, 0xD378 },
+  { 0xA3EBBFCE, 0xA928 },{ 0x0EF7B3B4, 0x0312 },{ 0x56F14D7B, 0x69C7 },{ 0xFBED4101, 0xC3FD },
+  { 0x424BDF87, 0xD6C1 },{ 0xEF57D3FD, 0x7CFB },{ 0xB7512D32, 0x162E },{ 0x1A4D2148, 0xBC14 },
+  { 0xBA62C92F, 0xF6BF },{ 0x177EC555, 0x5C85 },{ 0x4F783B9A, 0x3650 },{ 0xE26437E0, 0x9C6A },
+  { 0x5BC2A966, 0x8956 },{ 0xF6DEA51C, 0x236C },{ 0xAED85BD3, 0x49B9 },{ 0x03C457A9, 0xE383 },
+  { 0x7C103402, 0x60FC },{ 0xD10C3878, 0xCAC6 },{ 0x890AC6B7, 0xA013 },{ 0x2416CACD, 0x0A29 },
+  { 0x9DB0544B, 0x1F15 },{ 0x30AC5831, 0xB52F },{ 0x68AAA6FE, 0xDFFA },{ 0xC5B6AA84, 0x75C0 },
+  { 0x659942E3, 0x3F6B },{ 0xC8854E99, 0x9551 },{ 0x9083B056, 0xFF84 },{ 0x3D9FBC2C, 0x55BE },
+  { 0x843922AA, 0x4082 },{ 0x29252ED0, 0xEAB8 },{ 0x7123D01F, 0x806D },{ 0xDC3FDC65, 0x2A57 },
+  { 0x9A73F27E, 0x5007 },{ 0x376FFE04, 0xFA3D },{ 0x6F6900CB, 0x90E8 },{ 0xC2750CB1, 0x3AD2 },
+  { 0x7BD39237, 0x2FEE },{ 0xD6CF9E4D, 0x85D4 },{ 0x8EC96082, 0xEF01 },{ 0x23D56CF8, 0x453B },
+  { 0x83FA849F, 0x0F90 },{ 0x2EE688E5, 0xA5AA },{ 0x76E0762A, 0xCF7F },{ 0xDBFC7A50, 0x6545 },
+  { 0x625AE4D6, 0x7079 },{ 0xCF46E8AC, 0xDA43 },{ 0x97401663, 0xB096 },{ 0x3A5C1A19, 0x1AAC },
+ },
+ { // data byte #12
+  { 0x00000000, 0x0000 },{ 0xAFCAB91B, 0x2C18 },{ 0xA50040B3, 0x111A },{ 0x0ACAF9A8, 0x3D02 },
+  { 0x9B57C244, 0xEBB5 },{ 0x349D7B5F, 0xC7AD },{ 0x3E5782F7, 0xFAAF },{ 0x919D3BEC, 0xD6B7 },
+  { 0x9C26BE21, 0x6B06 },{ 0x33EC073A, 0x471E },{ 0x3926FE92, 0x7A1C },{ 0x96EC4789, 0x5604 },
+  { 0x07717C65, 0x80B3 },{ 0xA8BBC57E, 0xACAB },{ 0xA2713CD6, 0x91A9 },{ 0x0DBB85CD, 0xBDB1 },
+  { 0xB08AB812, 0x4E0F },{ 0x1F400109, 0x6217 },{ 0x158AF8A1, 0x5F15 },{ 0xBA4041BA, 0x730D },
+  { 0x2BDD7A56, 0xA5BA },{ 0x8417C34D, 0x89A2 },{ 0x8EDD3AE5, 0xB4A0 },{ 0x211783FE, 0x98B8 },
+  { 0x2CAC0633, 0x2509 },{ 0x8366BF28, 0x0911 },{ 0x89AC4680, 0x3413 },{ 0x2666FF9B, 0x180B },
+  { 0xB7FBC477, 0xCEBC },{ 0x18317D6C, 0xE2A4 },{ 0x12FB84C4, 0xDFA6 },{ 0xBD313DDF, 0xF3BE },
+  { 0xEE442826, 0x9A7A },{ 0x418E913D, 0xB662 },{ 0x4B446895, 0x8B60 },{ 0xE48ED18E, 0xA778 },
+  { 0x7513EA62, 0x71CF },{ 0xDAD95379, 0x5DD7 },{ 0xD013AAD1, 0x60D5 },{ 0x7FD913CA, 0x4CCD },
+  { 0x72629607, 0xF17C },{ 0xDDA82F1C, 0xDD64 },{ 0xD762D6B4, 0xE066 },{ 0x78A86FAF, 0xCC7E },
+  { 0xE9355443, 0x1AC9 },{ 0x46FFED58, 0x36D1 },{ 0x4C3514F0, 0x0BD3 },{ 0xE3FFADEB, 0x27CB },
+  { 0x5ECE9034, 0xD475 },{ 0xF104292F, 0xF86D },{ 0xFBCED087, 0xC56F },{ 0x5404699C, 0xE977 },
+  { 0xC5995270, 0x3FC0 },{ 0x6A53EB6B, 0x13D8 },{ 0x609912C3, 0x2EDA },{ 0xCF53ABD8, 0x02C2 },
+  { 0xC2E82E15, 0xBF73 },{ 0x6D22970E, 0x936B },{ 0x67E86EA6, 0xAE69 },{ 0xC822D7BD, 0x8271 },
+  { 0x59BFEC51, 0x54C6 },{ 0xF675554A, 0x78DE },{ 0xFCBFACE2, 0x45DC },{ 0x537515F9, 0x69C4 },
+  { 0xFF695024, 0x415E },{ 0x50A3E93F, 0x6D46 },{ 0x5A691097, 0x5044 },{ 0xF5A3A98C, 0x7C5C },
+  { 0x643E9260, 0xAAEB },{ 0xCBF42B7B, 0x86F3 },{ 0xC13ED2D3, 0xBBF1 },{ 0x6EF46BC8, 0x97E9 },
+  { 0x634FEE05, 0x2A58 },{ 0xCC85571E, 0x0640 },{ 0xC64FAEB6, 0x3B42 },{ 0x698517AD, 0x175A },
+  { 0xF8182C41, 0xC1ED },{ 0x57D2955A, 0xEDF5 },{ 0x5D186CF2, 0xD0F7 },{ 0xF2D2D5E9, 0xFCEF },
+  { 0x4FE3E836, 0x0F51 },{ 0xE029512D, 0x2349 },{ 0xEAE3A885, 0x1E4B },{ 0x4529119E, 0x3253 },
+  { 0xD4B42A72, 0xE4E4 },{ 0x7B7E9369, 0xC8FC },{ 0x71B46AC1, 0xF5FE },{ 0xDE7ED3DA, 0xD9E6 },
+  { 0xD3C55617, 0x6457 },{ 0x7C0FEF0C, 0x484F },{ 0x76C516A4, 0x754D },{ 0xD90FAFBF, 0x5955 },
+  { 0x48929453, 0x8FE2 },{ 0xE7582D48, 0xA3FA },{ 0xED92D4E0, 0x9EF8 },{ 0x42586DFB, 0xB2E0 },
+  { 0x112D7802, 0xDB24 },{ 0xBEE7C119, 0xF73C },{ 0xB42D38B1, 0xCA3E },{ 0x1BE781AA, 0xE626 },
+  { 0x8A7ABA46, 0x3091 },{ 0x25B0035D, 0x1C89 },{ 0x2F7AFAF5, 0x218B },{ 0x80B043EE, 0x0D93 },
+  { 0x8D0BC623, 0xB022 },{ 0x22C17F38, 0x9C3A },{ 0x280B8690, 0xA138 },{ 0x87C13F8B, 0x8D20 },
+  { 0x165C0467, 0x5B97 },{ 0xB996BD7C, 0x778F },{ 0xB35C44D4, 0x4A8D },{ 0x1C96FDCF, 0x6695 },
+  { 0xA1A7C010, 0x952B },{ 0x0E6D790B, 0xB933 },{ 0x04A780A3, 0x8431 },{ 0xAB6D39B8, 0xA829 },
+  { 0x3AF00254, 0x7E9E },{ 0x953ABB4F, 0x5286 },{ 0x9FF042E7, 0x6F84 },{ 0x303AFBFC, 0x439C },
+  { 0x3D817E31, 0xFE2D },{ 0x924BC72A, 0xD235 },{ 0x98813E82, 0xEF37 },{ 0x374B8799, 0xC32F },
+  { 0xA6D6BC75, 0x1598 },{ 0x091C056E, 0x3980 },{ 0x03D6FCC6, 0x0482 },{ 0xAC1C45DD, 0x289A },
+  { 0x32542536, 0xF82D },{ 0x9D9E9C2D, 0xD435 },{ 0x97546585, 0xE937 },{ 0x389EDC9E, 0xC52F },
+  { 0xA903E772, 0x1398 },{ 0x06C95E69, 0x3F80 },{ 0x0C03A7C1, 0x0282 },{ 0xA3C91EDA, 0x2E9A },
+  { 0xAE729B17, 0x932B },{ 0x01B8220C, 0xBF33 },{ 0x0B72DBA4, 0x8231 },{ 0xA4B862BF, 0xAE29 },
+  { 0x35255953, 0x789E },{ 0x9AEFE048, 0x5486 },{ 0x902519E0, 0x6984 },{ 0x3FEFA0FB, 0x459C },
+  { 0x82DE9D24, 0xB622 },{ 0x2D14243F, 0x9A3A },{ 0x27DEDD97, 0xA738 },{ 0x8814648C, 0x8B20 },
+  { 0x19895F60, 0x5D97 },{ 0xB643E67B, 0x718F },{ 0xBC891FD3, 0x4C8D },{ 0x1343A6C8, 0x6095 },
+  { 0x1EF82305, 0xDD24 },{ 0xB1329A1E, 0xF13C },{ 0xBBF863B6, 0xCC3E },{ 0x1432DAAD, 0xE026 },
+  { 0x85AFE141, 0x3691 },{ 0x2A65585A, 0x1A89 },{ 0x20AFA1F2, 0x278B },{ 0x8F6518E9, 0x0B93 },
+  { 0xDC100D10, 0x6257 },{ 0x73DAB40B, 0x4E4F },{ 0x79104DA3, 0x734D },{ 0xD6DAF4B8, 0x5F55 },
+  { 0x4747CF54, 0x89E2 },{ 0xE88D764F, 0xA5FA },{ 0xE2478FE7, 0x98F8 },{ 0x4D8D36FC, 0xB4E0 },
+  { 0x4036B331, 0x0951 },{ 0xEFFC0A2A, 0x2549 },{ 0xE536F382, 0x184B },{ 0x4AFC4A99, 0x3453 },
+  { 0xDB617175, 0xE2E4 },{ 0x74ABC86E, 0xCEFC },{ 0x7E6131C6, 0xF3FE },{ 0xD1AB88DD, 0xDFE6 },
+  { 0x6C9AB502, 0x2C58 },{ 0xC3500C19, 0x0040 },{ 0xC99AF5B1, 0x3D42 },{ 0x66504CAA, 0x115A },
+  { 0xF7CD7746, 0xC7ED },{ 0x5807CE5D, 0xEBF5 },{ 0x52CD37F5, 0xD6F7 },{ 0xFD078EEE, 0xFAEF },
+  { 0xF0BC0B23, 0x475E },{ 0x5F76B238, 0x6B46 },{ 0x55BC4B90, 0x5644 },{ 0xFA76F28B, 0x7A5C },
+  { 0x6BEBC967, 0xACEB },{ 0xC421707C, 0x80F3 },{ 0xCEEB89D4, 0xBDF1 },{ 0x612130CF, 0x91E9 },
+  { 0xCD3D7512, 0xB973 },{ 0x62F7CC09, 0x956B },{ 0x683D35A1, 0xA869 },{ 0xC7F78CBA, 0x8471 },
+  { 0x566AB756, 0x52C6 },{ 0xF9A00E4D, 0x7EDE },{ 0xF36AF7E5, 0x43DC },{ 0x5CA04EFE, 0x6FC4 },
+  { 0x511BCB33, 0xD275 },{ 0xFED17228, 0xFE6D },{ 0xF41B8B80, 0xC36F },{ 0x5BD1329B, 0xEF77 },
+  { 0xCA4C0977, 0x39C0 },{ 0x6586B06C, 0x15D8 },{ 0x6F4C49C4, 0x28DA },{ 0xC086F0DF, 0x04C2 },
+  { 0x7DB7CD00, 0xF77C },{ 0xD27D741B, 0xDB64 },{ 0xD8B78DB3, 0xE666 },{ 0x777D34A8, 0xCA7E },
+  { 0xE6E00F44, 0x1CC9 },{ 0x492AB65F, 0x30D1 },{ 0x43E04FF7, 0x0DD3 },{ 0xEC2AF6EC, 0x21CB },
+  { 0xE1917321, 0x9C7A },{ 0x4E5BCA3A, 0xB062 },{ 0x44913392, 0x8D60 },{ 0xEB5B8A89, 0xA178 },
+  { 0x7AC6B165, 0x77CF },{ 0xD50C087E, 0x5BD7 },{ 0xDFC6F1D6, 0x66D5 },{ 0x700C48CD, 0x4ACD },
+  { 0x23795D34, 0x2309 },{ 0x8CB3E42F, 0x0F11 },{ 0x86791D87, 0x3213 },{ 0x29B3A49C, 0x1E0B },
+  { 0xB82E9F70, 0xC8BC },{ 0x17E4266B, 0xE4A4 },{ 0x1D2EDFC3, 0xD9A6 },{ 0xB2E466D8, 0xF5BE },
+  { 0xBF5FE315, 0x480F },{ 0x10955A0E, 0x6417 },{ 0x1A5FA3A6, 0x5915 },{ 0xB5951ABD, 0x750D },
+  { 0x24082151, 0xA3BA },{ 0x8BC2984A, 0x8FA2 },{ 0x810861E2, 0xB2A0 },{ 0x2EC2D8F9, 0x9EB8 },
+  { 0x93F3E526, 0x6D06 },{ 0x3C395C3D, 0x411E },{ 0x36F3A595, 0x7C1C },{ 0x99391C8E, 0x5004 },
+  { 0x08A42762, 0x86B3 },{ 0xA76E9E79, 0xAAAB },{ 0xADA467D1, 0x97A9 },{ 0x026EDECA, 0xBBB1 },
+  { 0x0FD55B07, 0x0600 },{ 0xA01FE21C, 0x2A18 },{ 0xAAD51BB4, 0x171A },{ 0x051FA2AF, 0x3B02 },
+  { 0x94829943, 0xEDB5 },{ 0x3B482058, 0xC1AD },{ 0x3182D9F0, 0xFCAF },{ 0x9E4860EB, 0xD0B7 },
+ },
+ { // data byte #13
+  { 0x00000000, 0x0000 },{ 0xDD09141B, 0x7145 },{ 0x3AF8E2E4, 0xCFAE },{ 0xE7F1F6FF, 0xBEEB },
+  { 0xE9313591, 0xB9F9 },{ 0x3438218A, 0xC8BC },{ 0xD3C9D775, 0x7657 },{ 0x0EC0C36E, 0x0712 },
+  { 0xB817CF09, 0xF93A },{ 0x651EDB12, 0x887F },{ 0x82EF2DED, 0x3694 },{ 0x5FE639F6, 0x47D1 },
+  { 0x5126FA98, 0x40C3 },{ 0x8C2FEE83, 0x3186 },{ 0x6BDE187C, 0x8F6D },{ 0xB6D70C67, 0xFE28 },
+  { 0x0CB04FFC, 0xBDBB },{ 0xD1B95BE7, 0xCCFE },{ 0x3648AD18, 0x7215 },{ 0xEB41B903, 0x0350 },
+  { 0xE5817A6D, 0x0442 },{ 0x38886E76, 0x7507 },{ 0xDF799889, 0xCBEC },{ 0x02708C92, 0xBAA9 },
+  { 0xB4A780F5, 0x4481 },{ 0x69AE94EE, 0x35C4 },{ 0x8E5F6211, 0x8B2F },{ 0x5356760A, 0xFA6A },
+  { 0x5D96B564, 0xFD78 },{ 0x809FA17F, 0x8C3D },{ 0x676E5780, 0x32D6 },{ 0xBA67439B, 0x4393 },
+  { 0xB35905C1, 0xC9AD },{ 0x6E5011DA, 0xB8E8 },{ 0x89A1E725, 0x0603 },{ 0x54A8F33E, 0x7746 },
+  { 0x5A683050, 0x7054 },{ 0x8761244B, 0x0111 },{ 0x6090D2B4, 0xBFFA },{ 0xBD99C6AF, 0xCEBF },
+  { 0x0B4ECAC8, 0x3097 },{ 0xD647DED3, 0x41D2 },{ 0x31B6282C, 0xFF39 },{ 0xECBF3C37, 0x8E7C },
+  { 0xE27FFF59, 0x896E },{ 0x3F76EB42, 0xF82B },{ 0xD8871DBD, 0x46C0 },{ 0x058E09A6, 0x3785 },
+  { 0xBFE94A3D, 0x7416 },{ 0x62E05E26, 0x0553 },{ 0x8511A8D9, 0xBBB8 },{ 0x5818BCC2, 0xCAFD },
+  { 0x56D87FAC, 0xCDEF },{ 0x8BD16BB7, 0xBCAA },{ 0x6C209D48, 0x0241 },{ 0xB1298953, 0x7304 },
+  { 0x07FE8534, 0x8D2C },{ 0xDAF7912F, 0xFC69 },{ 0x3D0667D0, 0x4282 },{ 0xE00F73CB, 0x33C7 },
+  { 0xEECFB0A5, 0x34D5 },{ 0x33C6A4BE, 0x4590 },{ 0xD4375241, 0xFB7B },{ 0x093E465A, 0x8A3E },
+  { 0xA93C4A4F, 0x8EB9 },{ 0x74355E54, 0xFFFC },{ 0x93C4A8AB, 0x4117 },{ 0x4ECDBCB0, 0x3052 },
+  { 0x400D7FDE, 0x3740 },{ 0x9D046BC5, 0x4605 },{ 0x7AF59D3A, 0xF8EE },{ 0xA7FC8921, 0x89AB },
+  { 0x112B8546, 0x7783 },{ 0xCC22915D, 0x06C6 },{ 0x2BD367A2, 0xB82D },{ 0xF6DA73B9, 0xC968 },
+  { 0xF81AB0D7, 0xCE7A },{ 0x2513A4CC, 0xBF3F },{ 0xC2E25233, 0x01D4 },{ 0x1FEB4628, 0x7091 },
+  { 0xA58C05B3, 0x3302 },{ 0x788511A8, 0x4247 },{ 0x9F74E757, 0xFCAC },{ 0x427DF34C, 0x8DE9 },
+  { 0x4CBD3022, 0x8AFB },{ 0x91B42439, 0xFBBE },{ 0x7645D2C6, 0x4555 },{ 0xAB4CC6DD, 0x3410 },
+  { 0x1D9BCABA, 0xCA38 },{ 0xC092DEA1, 0xBB7D },{ 0x2763285E, 0x0596 },{ 0xFA6A3C45, 0x74D3 },
+  { 0xF4AAFF2B, 0x73C1 },{ 0x29A3EB30, 0x0284 },{ 0xCE521DCF, 0xBC6F },{ 0x135B09D4, 0xCD2A },
+  { 0x1A654F8E, 0x4714 },{ 0xC76C5B95, 0x3651 },{ 0x209DAD6A, 0x88BA },{ 0xFD94B971, 0xF9FF },
+  { 0xF3547A1F, 0xFEED },{ 0x2E5D6E04, 0x8FA8 },{ 0xC9AC98FB, 0x3143 },{ 0x14A58CE0, 0x4006 },
+  { 0xA2728087, 0xBE2E },{ 0x7F7B949C, 0xCF6B },{ 0x988A6263, 0x7180 },{ 0x45837678, 0x00C5 },
+  { 0x4B43B516, 0x07D7 },{ 0x964AA10D, 0x7692 },{ 0x71BB57F2, 0xC879 },{ 0xACB243E9, 0xB93C },
+  { 0x16D50072, 0xFAAF },{ 0xCBDC1469, 0x8BEA },{ 0x2C2DE296, 0x3501 },{ 0xF124F68D, 0x4444 },
+  { 0xFFE435E3, 0x4356 },{ 0x22ED21F8, 0x3213 },{ 0xC51CD707, 0x8CF8 },{ 0x1815C31C, 0xFDBD },
+  { 0xAEC2CF7B, 0x0395 },{ 0x73CBDB60, 0x72D0 },{ 0x943A2D9F, 0xCC3B },{ 0x49333984, 0xBD7E },
+  { 0x47F3FAEA, 0xBA6C },{ 0x9AFAEEF1, 0xCB29 },{ 0x7D0B180E, 0x75C2 },{ 0xA0020C15, 0x0487 },
+  { 0x999976EB, 0xE5B7 },{ 0x449062F0, 0x94F2 },{ 0xA361940F, 0x2A19 },{ 0x7E688014, 0x5B5C },
+  { 0x70A8437A, 0x5C4E },{ 0xADA15761, 0x2D0B },{ 0x4A50A19E, 0x93E0 },{ 0x9759B585, 0xE2A5 },
+  { 0x218EB9E2, 0x1C8D },{ 0xFC87ADF9, 0x6DC8 },{ 0x1B765B06, 0xD323 },{ 0xC67F4F1D, 0xA266 },
+  { 0xC8BF8C73, 0xA574 },{ 0x15B69868, 0xD431 },{ 0xF2476E97, 0x6ADA },{ 0x2F4E7A8C, 0x1B9F },
+  { 0x95293917, 0x580C },{ 0x48202D0C, 0x2949 },{ 0xAFD1DBF3, 0x97A2 },{ 0x72D8CFE8, 0xE6E7 },
+  { 0x7C180C86, 0xE1F5 },{ 0xA111189D, 0x90B0 },{ 0x46E0EE62, 0x2E5B },{ 0x9BE9FA79, 0x5F1E },
+  { 0x2D3EF61E, 0xA136 },{ 0xF037E205, 0xD073 },{ 0x17C614FA, 0x6E98 },{ 0xCACF00E1, 0x1FDD },
+  { 0xC40FC38F, 0x18CF },{ 0x1906D794, 0x698A },{ 0xFEF7216B, 0xD761 },{ 0x23FE3570, 0xA624 },
+  { 0x2AC0732A, 0x2C1A },{ 0xF7C96731, 0x5D5F },{ 0x103891CE, 0xE3B4 },{ 0xCD3185D5, 0x92F1 },
+  { 0xC3F146BB, 0x95E3 },{ 0x1EF852A0, 0xE4A6 },{ 0xF909A45F, 0x5A4D },{ 0x2400B044, 0x2B08 },
+  { 0x92D7BC23, 0xD520 },{ 0x4FDEA838, 0xA465 },{ 0xA82F5EC7, 0x1A8E },{ 0x75264ADC, 0x6BCB },
+  { 0x7BE689B2, 0x6CD9 },{ 0xA6EF9DA9, 0x1D9C },{ 0x411E6B56, 0xA377 },{ 0x9C177F4D, 0xD232 },
+  { 0x26703CD6, 0x91A1 },{ 0xFB7928CD, 0xE0E4 },{ 0x1C88DE32, 0x5E0F },{ 0xC181CA29, 0x2F4A },
+  { 0xCF410947, 0x2858 },{ 0x12481D5C, 0x591D },{ 0xF5B9EBA3, 0xE7F6 },{ 0x28B0FFB8, 0x96B3 },
+  { 0x9E67F3DF, 0x689B },{ 0x436EE7C4, 0x19DE },{ 0xA49F113B, 0xA735 },{ 0x79960520, 0xD670 },
+  { 0x7756C64E, 0xD162 },{ 0xAA5FD255, 0xA027 },{ 0x4DAE24AA, 0x1ECC },{ 0x90A730B1, 0x6F89 },
+  { 0x30A53CA4, 0x6B0E },{ 0xEDAC28BF, 0x1A4B },{ 0x0A5DDE40, 0xA4A0 },{ 0xD754CA5B, 0xD5E5 },
+  { 0xD9940935, 0xD2F7 },{ 0x049D1D2E, 0xA3B2 },{ 0xE36CEBD1, 0x1D59 },{ 0x3E65FFCA, 0x6C1C },
+  { 0x88B2F3AD, 0x9234 },{ 0x55BBE7B6, 0xE371 },{ 0xB24A1149, 0x5D9A },{ 0x6F430552, 0x2CDF },
+  { 0x6183C63C, 0x2BCD },{ 0xBC8AD227, 0x5A88 },{ 0x5B7B24D8, 0xE463 },{ 0x867230C3, 0x9526 },
+  { 0x3C157358, 0xD6B5 },{ 0xE11C6743, 0xA7F0 },{ 0x06ED91BC, 0x191B },{ 0xDBE485A7, 0x685E },
+  { 0xD52446C9, 0x6F4C },{ 0x082D52D2, 0x1E09 },{ 0xEFDCA42D, 0xA0E2 },{ 0x32D5B036, 0xD1A7 },
+  { 0x8402BC51, 0x2F8F },{ 0x590BA84A, 0x5ECA },{ 0xBEFA5EB5, 0xE021 },{ 0x63F34AAE, 0x9164 },
+  { 0x6D3389C0, 0x9676 },{ 0xB03A9DDB, 0xE733 },{ 0x57CB6B24, 0x59D8 },{ 0x8AC27F3F, 0x289D },
+  { 0x83FC3965, 0xA2A3 },{ 0x5EF52D7E, 0xD3E6 },{ 0xB904DB81, 0x6D0D },{ 0x640DCF9A, 0x1C48 },
+  { 0x6ACD0CF4, 0x1B5A },{ 0xB7C418EF, 0x6A1F },{ 0x5035EE10, 0xD4F4 },{ 0x8D3CFA0B, 0xA5B1 },
+  { 0x3BEBF66C, 0x5B99 },{ 0xE6E2E277, 0x2ADC },{ 0x01131488, 0x9437 },{ 0xDC1A0093, 0xE572 },
+  { 0xD2DAC3FD, 0xE260 },{ 0x0FD3D7E6, 0x9325 },{ 0xE8222119, 0x2DCE },{ 0x352B3502, 0x5C8B },
+  { 0x8F4C7699, 0x1F18 },{ 0x52456282, 0x6E5D },{ 0xB5B4947D, 0xD0B6 },{ 0x68BD8066, 0xA1F3 },
+  { 0x667D4308, 0xA6E1 },{ 0xBB745713, 0xD7A4 },{ 0x5C85A1EC, 0x694F },{ 0x818CB5F7, 0x180A },
+  { 0x375BB990, 0xE622 },{ 0xEA52AD8B, 0x9767 },{ 0x0DA35B74, 0x298C },{ 0xD0AA4F6F, 0x58C9 },
+  { 0xDE6A8C01, 0x5FDB },{ 0x0363981A, 0x2E9E },{ 0xE4926EE5, 0x9075 },{ 0x399B7AFE, 0xE130 },
+ },
+ { // data byte #14
+  { 0x00000000, 0x0000 },{ 0x13E6C99C, 0x6704 },{ 0x07707CE7, 0x81A3 },{ 0x1496B57B, 0xE6A7 },
+  { 0xA7EC7797, 0x0709 },{ 0xB40ABE0B, 0x600D },{ 0xA09C0B70, 0x86AA },{ 0xB37AC2EC, 0xE1AE },
+  { 0x2F5D484F, 0x8BF8 },{ 0x3CBB81D3, 0xECFC },{ 0x282D34A8, 0x0A5B },{ 0x3BCBFD34, 0x6D5F },
+  { 0x88B13FD8, 0x8CF1 },{ 0x9B57F644, 0xEBF5 },{ 0x8FC1433F, 0x0D52 },{ 0x9C278AA3, 0x6A56 },
+  { 0xA8807F3B, 0x3D1A },{ 0xBB66B6A7, 0x5A1E },{ 0xAFF003DC, 0xBCB9 },{ 0xBC16CA40, 0xDBBD },
+  { 0x0F6C08AC, 0x3A13 },{ 0x1C8AC130, 0x5D17 },{ 0x081C744B, 0xBBB0 },{ 0x1BFABDD7, 0xDCB4 },
+  { 0x87DD3774, 0xB6E2 },{ 0x943BFEE8, 0xD1E6 },{ 0x80AD4B93, 0x3741 },{ 0x934B820F, 0x5045 },
+  { 0x203140E3, 0xB1EB },{ 0x33D7897F, 0xD6EF },{ 0x27413C04, 0x3048 },{ 0x34A7F598, 0x574C },
+  { 0xC90FC6D2, 0x2AC8 },{ 0xDAE90F4E, 0x4DCC },{ 0xCE7FBA35, 0xAB6B },{ 0xDD9973A9, 0xCC6F },
+  { 0x6EE3B145, 0x2DC1 },{ 0x7D0578D9, 0x4AC5 },{ 0x6993CDA2, 0xAC62 },{ 0x7A75043E, 0xCB66 },
+  { 0xE6528E9D, 0xA130 },{ 0xF5B44701, 0xC634 },{ 0xE122F27A, 0x2093 },{ 0xF2C43BE6, 0x4797 },
+  { 0x41BEF90A, 0xA639 },{ 0x52583096, 0xC13D },{ 0x46CE85ED, 0x279A },{ 0x55284C71, 0x409E },
+  { 0x618FB9E9, 0x17D2 },{ 0x72697075, 0x70D6 },{ 0x66FFC50E, 0x9671 },{ 0x75190C92, 0xF175 },
+  { 0xC663CE7E, 0x10DB },{ 0xD58507E2, 0x77DF },{ 0xC113B299, 0x9178 },{ 0xD2F57B05, 0xF67C },
+  { 0x4ED2F1A6, 0x9C2A },{ 0x5D34383A, 0xFB2E },{ 0x49A28D41, 0x1D89 },{ 0x5A4444DD, 0x7A8D },
+  { 0xE93E8631, 0x9B23 },{ 0xFAD84FAD, 0xFC27 },{ 0xEE4EFAD6, 0x1A80 },{ 0xFDA8334A, 0x7D84 },
+  { 0x929A8DCF, 0xFCB0 },{ 0x817C4453, 0x9BB4 },{ 0x95EAF128, 0x7D13 },{ 0x860C38B4, 0x1A17 },
+  { 0x3576FA58, 0xFBB9 },{ 0x269033C4, 0x9CBD },{ 0x320686BF, 0x7A1A },{ 0x21E04F23, 0x1D1E },
+  { 0xBDC7C580, 0x7748 },{ 0xAE210C1C, 0x104C },{ 0xBAB7B967, 0xF6EB },{ 0xA95170FB, 0x91EF },
+  { 0x1A2BB217, 0x7041 },{ 0x09CD7B8B, 0x1745 },{ 0x1D5BCEF0, 0xF1E2 },{ 0x0EBD076C, 0x96E6 },
+  { 0x3A1AF2F4, 0xC1AA },{ 0x29FC3B68, 0xA6AE },{ 0x3D6A8E13, 0x4009 },{ 0x2E8C478F, 0x270D },
+  { 0x9DF68563, 0xC6A3 },{ 0x8E104CFF, 0xA1A7 },{ 0x9A86F984, 0x4700 },{ 0x89603018, 0x2004 },
+  { 0x1547BABB, 0x4A52 },{ 0x06A17327, 0x2D56 },{ 0x1237C65C, 0xCBF1 },{ 0x01D10FC0, 0xACF5 },
+  { 0xB2ABCD2C, 0x4D5B },{ 0xA14D04B0, 0x2A5F },{ 0xB5DBB1CB, 0xCCF8 },{ 0xA63D7857, 0xABFC },
+  { 0x5B954B1D, 0xD678 },{ 0x48738281, 0xB17C },{ 0x5CE537FA, 0x57DB },{ 0x4F03FE66, 0x30DF },
+  { 0xFC793C8A, 0xD171 },{ 0xEF9FF516, 0xB675 },{ 0xFB09406D, 0x50D2 },{ 0xE8EF89F1, 0x37D6 },
+  { 0x74C80352, 0x5D80 },{ 0x672ECACE, 0x3A84 },{ 0x73B87FB5, 0xDC23 },{ 0x605EB629, 0xBB27 },
+  { 0xD32474C5, 0x5A89 },{ 0xC0C2BD59, 0x3D8D },{ 0xD4540822, 0xDB2A },{ 0xC7B2C1BE, 0xBC2E },
+  { 0xF3153426, 0xEB62 },{ 0xE0F3FDBA, 0x8C66 },{ 0xF46548C1, 0x6AC1 },{ 0xE783815D, 0x0DC5 },
+  { 0x54F943B1, 0xEC6B },{ 0x471F8A2D, 0x8B6F },{ 0x53893F56, 0x6DC8 },{ 0x406FF6CA, 0x0ACC },
+  { 0xDC487C69, 0x609A },{ 0xCFAEB5F5, 0x079E },{ 0xDB38008E, 0xE139 },{ 0xC8DEC912, 0x863D },
+  { 0x7BA40BFE, 0x6793 },{ 0x6842C262, 0x0097 },{ 0x7CD47719, 0xE630 },{ 0x6F32BE85, 0x8134 },
+  { 0x12F856E5, 0xCDAE },{ 0x011E9F79, 0xAAAA },{ 0x15882A02, 0x4C0D },{ 0x066EE39E, 0x2B09 },
+  { 0xB5142172, 0xCAA7 },{ 0xA6F2E8EE, 0xADA3 },{ 0xB2645D95, 0x4B04 },{ 0xA1829409, 0x2C00 },
+  { 0x3DA51EAA, 0x4656 },{ 0x2E43D736, 0x2152 },{ 0x3AD5624D, 0xC7F5 },{ 0x2933ABD1, 0xA0F1 },
+  { 0x9A49693D, 0x415F },{ 0x89AFA0A1, 0x265B },{ 0x9D3915DA, 0xC0FC },{ 0x8EDFDC46, 0xA7F8 },
+  { 0xBA7829DE, 0xF0B4 },{ 0xA99EE042, 0x97B0 },{ 0xBD085539, 0x7117 },{ 0xAEEE9CA5, 0x1613 },
+  { 0x1D945E49, 0xF7BD },{ 0x0E7297D5, 0x90B9 },{ 0x1AE422AE, 0x761E },{ 0x0902EB32, 0x111A },
+  { 0x95256191, 0x7B4C },{ 0x86C3A80D, 0x1C48 },{ 0x92551D76, 0xFAEF },{ 0x81B3D4EA, 0x9DEB },
+  { 0x32C91606, 0x7C45 },{ 0x212FDF9A, 0x1B41 },{ 0x35B96AE1, 0xFDE6 },{ 0x265FA37D, 0x9AE2 },
+  { 0xDBF79037, 0xE766 },{ 0xC81159AB, 0x8062 },{ 0xDC87ECD0, 0x66C5 },{ 0xCF61254C, 0x01C1 },
+  { 0x7C1BE7A0, 0xE06F },{ 0x6FFD2E3C, 0x876B },{ 0x7B6B9B47, 0x61CC },{ 0x688D52DB, 0x06C8 },
+  { 0xF4AAD878, 0x6C9E },{ 0xE74C11E4, 0x0B9A },{ 0xF3DAA49F, 0xED3D },{ 0xE03C6D03, 0x8A39 },
+  { 0x5346AFEF, 0x6B97 },{ 0x40A06673, 0x0C93 },{ 0x5436D308, 0xEA34 },{ 0x47D01A94, 0x8D30 },
+  { 0x7377EF0C, 0xDA7C },{ 0x60912690, 0xBD78 },{ 0x740793EB, 0x5BDF },{ 0x67E15A77, 0x3CDB },
+  { 0xD49B989B, 0xDD75 },{ 0xC77D5107, 0xBA71 },{ 0xD3EBE47C, 0x5CD6 },{ 0xC00D2DE0, 0x3BD2 },
+  { 0x5C2AA743, 0x5184 },{ 0x4FCC6EDF, 0x3680 },{ 0x5B5ADBA4, 0xD027 },{ 0x48BC1238, 0xB723 },
+  { 0xFBC6D0D4, 0x568D },{ 0xE8201948, 0x3189 },{ 0xFCB6AC33, 0xD72E },{ 0xEF5065AF, 0xB02A },
+  { 0x8062DB2A, 0x311E },{ 0x938412B6, 0x561A },{ 0x8712A7CD, 0xB0BD },{ 0x94F46E51, 0xD7B9 },
+  { 0x278EACBD, 0x3617 },{ 0x34686521, 0x5113 },{ 0x20FED05A, 0xB7B4 },{ 0x331819C6, 0xD0B0 },
+  { 0xAF3F9365, 0xBAE6 },{ 0xBCD95AF9, 0xDDE2 },{ 0xA84FEF82, 0x3B45 },{ 0xBBA9261E, 0x5C41 },
+  { 0x08D3E4F2, 0xBDEF },{ 0x1B352D6E, 0xDAEB },{ 0x0FA39815, 0x3C4C },{ 0x1C455189, 0x5B48 },
+  { 0x28E2A411, 0x0C04 },{ 0x3B046D8D, 0x6B00 },{ 0x2F92D8F6, 0x8DA7 },{ 0x3C74116A, 0xEAA3 },
+  { 0x8F0ED386, 0x0B0D },{ 0x9CE81A1A, 0x6C09 },{ 0x887EAF61, 0x8AAE },{ 0x9B9866FD, 0xEDAA },
+  { 0x07BFEC5E, 0x87FC },{ 0x145925C2, 0xE0F8 },{ 0x00CF90B9, 0x065F },{ 0x13295925, 0x615B },
+  { 0xA0539BC9, 0x80F5 },{ 0xB3B55255, 0xE7F1 },{ 0xA723E72E, 0x0156 },{ 0xB4C52EB2, 0x6652 },
+  { 0x496D1DF8, 0x1BD6 },{ 0x5A8BD464, 0x7CD2 },{ 0x4E1D611F, 0x9A75 },{ 0x5DFBA883, 0xFD71 },
+  { 0xEE816A6F, 0x1CDF },{ 0xFD67A3F3, 0x7BDB },{ 0xE9F11688, 0x9D7C },{ 0xFA17DF14, 0xFA78 },
+  { 0x663055B7, 0x902E },{ 0x75D69C2B, 0xF72A },{ 0x61402950, 0x118D },{ 0x72A6E0CC, 0x7689 },
+  { 0xC1DC2220, 0x9727 },{ 0xD23AEBBC, 0xF023 },{ 0xC6AC5EC7, 0x1684 },{ 0xD54A975B, 0x7180 },
+  { 0xE1ED62C3, 0x26CC },{ 0xF20BAB5F, 0x41C8 },{ 0xE69D1E24, 0xA76F },{ 0xF57BD7B8, 0xC06B },
+  { 0x46011554, 0x21C5 },{ 0x55E7DCC8, 0x46C1 },{ 0x417169B3, 0xA066 },{ 0x5297A02F, 0xC762 },
+  { 0xCEB02A8C, 0xAD34 },{ 0xDD56E310, 0xCA30 },{ 0xC9C0566B, 0x2C97 },{ 0xDA269FF7, 0x4B93 },
+  { 0x695C5D1B, 0xAA3D },{ 0x7ABA9487, 0xCD39 },{ 0x6E2C21FC, 0x2B9E },{ 0x7DCAE860, 0x4C9A },
+ },
+ { // data byte #15
+  { 0x00000000, 0x0000 },{ 0xE76FC681, 0x2B59 },{ 0xB7FA9CD1, 0xEFAC },{ 0x50955A50, 0xC4F5 },
+  { 0xC6BF9DA9, 0x3643 },{ 0x21D05B28, 0x1D1A },{ 0x71450178, 0xD9EF },{ 0x962AC7F9, 0xF2B6 },
+  { 0x1DB3C5A5, 0xDD6E },{ 0xFADC0324, 0xF637 },{ 0xAA495974, 0x32C2 },{ 0x4D269FF5, 0x199B },
+  { 0xDB0C580C, 0xEB2D },{ 0x3C639E8D, 0xC074 },{ 0x6CF6C4DD, 0x0481 },{ 0x8B99025C, 0x2FD8 },
+  { 0x54DBC1FA, 0xFD77 },{ 0xB3B4077B, 0xD62E },{ 0xE3215D2B, 0x12DB },{ 0x044E9BAA, 0x3982 },
+  { 0x92645C53, 0xCB34 },{ 0x750B9AD2, 0xE06D },{ 0x259EC082, 0x2498 },{ 0xC2F10603, 0x0FC1 },
+  { 0x4968045F, 0x2019 },{ 0xAE07C2DE, 0x0B40 },{ 0xFE92988E, 0xCFB5 },{ 0x19FD5E0F, 0xE4EC },
+  { 0x8FD799F6, 0x165A },{ 0x68B85F77, 0x3D03 },{ 0x382D0527, 0xF9F6 },{ 0xDF42C3A6, 0xD2AF },
+  { 0x9A5798CB, 0x4C90 },{ 0x7D385E4A, 0x67C9 },{ 0x2DAD041A, 0xA33C },{ 0xCAC2C29B, 0x8865 },
+  { 0x5CE80562, 0x7AD3 },{ 0xBB87C3E3, 0x518A },{ 0xEB1299B3, 0x957F },{ 0x0C7D5F32, 0xBE26 },
+  { 0x87E45D6E, 0x91FE },{ 0x608B9BEF, 0xBAA7 },{ 0x301EC1BF, 0x7E52 },{ 0xD771073E, 0x550B },
+  { 0x415BC0C7, 0xA7BD },{ 0xA6340646, 0x8CE4 },{ 0xF6A15C16, 0x4811 },{ 0x11CE9A97, 0x6348 },
+  { 0xCE8C5931, 0xB1E7 },{ 0x29E39FB0, 0x9ABE },{ 0x7976C5E0, 0x5E4B },{ 0x9E190361, 0x7512 },
+  { 0x0833C498, 0x87A4 },{ 0xEF5C0219, 0xACFD },{ 0xBFC95849, 0x6808 },{ 0x58A69EC8, 0x4351 },
+  { 0xD33F9C94, 0x6C89 },{ 0x34505A15, 0x47D0 },{ 0x64C50045, 0x8325 },{ 0x83AAC6C4, 0xA87C },
+  { 0x1580013D, 0x5ACA },{ 0xF2EFC7BC, 0x7193 },{ 0xA27A9DEC, 0xB566 },{ 0x45155B6D, 0x9E3F },
+  { 0x27F03FDC, 0xBDB9 },{ 0xC09FF95D, 0x96E0 },{ 0x900AA30D, 0x5215 },{ 0x7765658C, 0x794C },
+  { 0xE14FA275, 0x8BFA },{ 0x062064F4, 0xA0A3 },{ 0x56B53EA4, 0x6456 },{ 0xB1DAF825, 0x4F0F },
+  { 0x3A43FA79, 0x60D7 },{ 0xDD2C3CF8, 0x4B8E },{ 0x8DB966A8, 0x8F7B },{ 0x6AD6A029, 0xA422 },
+  { 0xFCFC67D0, 0x5694 },{ 0x1B93A151, 0x7DCD },{ 0x4B06FB01, 0xB938 },{ 0xAC693D80, 0x9261 },
+  { 0x732BFE26, 0x40CE },{ 0x944438A7, 0x6B97 },{ 0xC4D162F7, 0xAF62 },{ 0x23BEA476, 0x843B },
+  { 0xB594638F, 0x768D },{ 0x52FBA50E, 0x5DD4 },{ 0x026EFF5E, 0x9921 },{ 0xE50139DF, 0xB278 },
+  { 0x6E983B83, 0x9DA0 },{ 0x89F7FD02, 0xB6F9 },{ 0xD962A752, 0x720C },{ 0x3E0D61D3, 0x5955 },
+  { 0xA827A62A, 0xABE3 },{ 0x4F4860AB, 0x80BA },{ 0x1FDD3AFB, 0x444F },{ 0xF8B2FC7A, 0x6F16 },
+  { 0xBDA7A717, 0xF129 },{ 0x5AC86196, 0xDA70 },{ 0x0A5D3BC6, 0x1E85 },{ 0xED32FD47, 0x35DC },
+  { 0x7B183ABE, 0xC76A },{ 0x9C77FC3F, 0xEC33 },{ 0xCCE2A66F, 0x28C6 },{ 0x2B8D60EE, 0x039F },
+  { 0xA01462B2, 0x2C47 },{ 0x477BA433, 0x071E },{ 0x17EEFE63, 0xC3EB },{ 0xF08138E2, 0xE8B2 },
+  { 0x66ABFF1B, 0x1A04 },{ 0x81C4399A, 0x315D },{ 0xD15163CA, 0xF5A8 },{ 0x363EA54B, 0xDEF1 },
+  { 0xE97C66ED, 0x0C5E },{ 0x0E13A06C, 0x2707 },{ 0x5E86FA3C, 0xE3F2 },{ 0xB9E93CBD, 0xC8AB },
+  { 0x2FC3FB44, 0x3A1D },{ 0xC8AC3DC5, 0x1144 },{ 0x98396795, 0xD5B1 },{ 0x7F56A114, 0xFEE8 },
+  { 0xF4CFA348, 0xD130 },{ 0x13A065C9, 0xFA69 },{ 0x43353F99, 0x3E9C },{ 0xA45AF918, 0x15C5 },
+  { 0x32703EE1, 0xE773 },{ 0xD51FF860, 0xCC2A },{ 0x858AA230, 0x08DF },{ 0x62E564B1, 0x2386 },
+  { 0x83CFACB2, 0x3702 },{ 0x64A06A33, 0x1C5B },{ 0x34353063, 0xD8AE },{ 0xD35AF6E2, 0xF3F7 },
+  { 0x4570311B, 0x0141 },{ 0xA21FF79A, 0x2A18 },{ 0xF28AADCA, 0xEEED },{ 0x15E56B4B, 0xC5B4 },
+  { 0x9E7C6917, 0xEA6C },{ 0x7913AF96, 0xC135 },{ 0x2986F5C6, 0x05C0 },{ 0xCEE93347, 0x2E99 },
+  { 0x58C3F4BE, 0xDC2F },{ 0xBFAC323F, 0xF776 },{ 0xEF39686F, 0x3383 },{ 0x0856AEEE, 0x18DA },
+  { 0xD7146D48, 0xCA75 },{ 0x307BABC9, 0xE12C },{ 0x60EEF199, 0x25D9 },{ 0x87813718, 0x0E80 },
+  { 0x11ABF0E1, 0xFC36 },{ 0xF6C43660, 0xD76F },{ 0xA6516C30, 0x139A },{ 0x413EAAB1, 0x38C3 },
+  { 0xCAA7A8ED, 0x171B },{ 0x2DC86E6C, 0x3C42 },{ 0x7D5D343C, 0xF8B7 },{ 0x9A32F2BD, 0xD3EE },
+  { 0x0C183544, 0x2158 },{ 0xEB77F3C5, 0x0A01 },{ 0xBBE2A995, 0xCEF4 },{ 0x5C8D6F14, 0xE5AD },
+  { 0x19983479, 0x7B92 },{ 0xFEF7F2F8, 0x50CB },{ 0xAE62A8A8, 0x943E },{ 0x490D6E29, 0xBF67 },
+  { 0xDF27A9D0, 0x4DD1 },{ 0x38486F51, 0x6688 },{ 0x68DD3501, 0xA27D },{ 0x8FB2F380, 0x8924 },
+  { 0x042BF1DC, 0xA6FC },{ 0xE344375D, 0x8DA5 },{ 0xB3D16D0D, 0x4950 },{ 0x54BEAB8C, 0x6209 },
+  { 0xC2946C75, 0x90BF },{ 0x25FBAAF4, 0xBBE6 },{ 0x756EF0A4, 0x7F13 },{ 0x92013625, 0x544A },
+  { 0x4D43F583, 0x86E5 },{ 0xAA2C3302, 0xADBC },{ 0xFAB96952, 0x6949 },{ 0x1DD6AFD3, 0x4210 },
+  { 0x8BFC682A, 0xB0A6 },{ 0x6C93AEAB, 0x9BFF },{ 0x3C06F4FB, 0x5F0A },{ 0xDB69327A, 0x7453 },
+  { 0x50F03026, 0x5B8B },{ 0xB79FF6A7, 0x70D2 },{ 0xE70AACF7, 0xB427 },{ 0x00656A76, 0x9F7E },
+  { 0x964FAD8F, 0x6DC8 },{ 0x71206B0E, 0x4691 },{ 0x21B5315E, 0x8264 },{ 0xC6DAF7DF, 0xA93D },
+  { 0xA43F936E, 0x8ABB },{ 0x435055EF, 0xA1E2 },{ 0x13C50FBF, 0x6517 },{ 0xF4AAC93E, 0x4E4E },
+  { 0x62800EC7, 0xBCF8 },{ 0x85EFC846, 0x97A1 },{ 0xD57A9216, 0x5354 },{ 0x32155497, 0x780D },
+  { 0xB98C56CB, 0x57D5 },{ 0x5EE3904A, 0x7C8C },{ 0x0E76CA1A, 0xB879 },{ 0xE9190C9B, 0x9320 },
+  { 0x7F33CB62, 0x6196 },{ 0x985C0DE3, 0x4ACF },{ 0xC8C957B3, 0x8E3A },{ 0x2FA69132, 0xA563 },
+  { 0xF0E45294, 0x77CC },{ 0x178B9415, 0x5C95 },{ 0x471ECE45, 0x9860 },{ 0xA07108C4, 0xB339 },
+  { 0x365BCF3D, 0x418F },{ 0xD13409BC, 0x6AD6 },{ 0x81A153EC, 0xAE23 },{ 0x66CE956D, 0x857A },
+  { 0xED579731, 0xAAA2 },{ 0x0A3851B0, 0x81FB },{ 0x5AAD0BE0, 0x450E },{ 0xBDC2CD61, 0x6E57 },
+  { 0x2BE80A98, 0x9CE1 },{ 0xCC87CC19, 0xB7B8 },{ 0x9C129649, 0x734D },{ 0x7B7D50C8, 0x5814 },
+  { 0x3E680BA5, 0xC62B },{ 0xD907CD24, 0xED72 },{ 0x89929774, 0x2987 },{ 0x6EFD51F5, 0x02DE },
+  { 0xF8D7960C, 0xF068 },{ 0x1FB8508D, 0xDB31 },{ 0x4F2D0ADD, 0x1FC4 },{ 0xA842CC5C, 0x349D },
+  { 0x23DBCE00, 0x1B45 },{ 0xC4B40881, 0x301C },{ 0x942152D1, 0xF4E9 },{ 0x734E9450, 0xDFB0 },
+  { 0xE56453A9, 0x2D06 },{ 0x020B9528, 0x065F },{ 0x529ECF78, 0xC2AA },{ 0xB5F109F9, 0xE9F3 },
+  { 0x6AB3CA5F, 0x3B5C },{ 0x8DDC0CDE, 0x1005 },{ 0xDD49568E, 0xD4F0 },{ 0x3A26900F, 0xFFA9 },
+  { 0xAC0C57F6, 0x0D1F },{ 0x4B639177, 0x2646 },{ 0x1BF6CB27, 0xE2B3 },{ 0xFC990DA6, 0xC9EA },
+  { 0x77000FFA, 0xE632 },{ 0x906FC97B, 0xCD6B },{ 0xC0FA932B, 0x099E },{ 0x279555AA, 0x22C7 },
+  { 0xB1BF9253, 0xD071 },{ 0x56D054D2, 0xFB28 },{ 0x06450E82, 0x3FDD },{ 0xE12AC803, 0x1484 },
+ },
+ { // data byte #16
+  { 0x00000000, 0x0000 },{ 0x99141474, 0xCBA7 },{ 0xDEF45A00, 0xC476 },{ 0x47E04E74, 0x0FD1 },
+  { 0x337BB68D, 0xE02C },{ 0xAA6FA2F9, 0x2B8B },{ 0xED8FEC8D, 0x245A },{ 0x749BF8F9, 0xEFFD },
+  { 0xBFD5233E, 0xD71F },{ 0x26C1374A, 0x1CB8 },{ 0x6121793E, 0x1369 },{ 0xF8356D4A, 0xD8CE },
+  { 0x8CAE95B3, 0x3733 },{ 0x15BA81C7, 0xFC94 },{ 0x525ACFB3, 0xF345 },{ 0xCB4EDBC7, 0x38E2 },
+  { 0x0772E623, 0xB12B },{ 0x9E66F257, 0x7A8C },{ 0xD986BC23, 0x755D },{ 0x4092A857, 0xBEFA },
+  { 0x340950AE, 0x5107 },{ 0xAD1D44DA, 0x9AA0 },{ 0xEAFD0AAE, 0x9571 },{ 0x73E91EDA, 0x5ED6 },
+  { 0xB8A7C51D, 0x6634 },{ 0x21B3D169, 0xAD93 },{ 0x66539F1D, 0xA242 },{ 0xFF478B69, 0x69E5 },
+  { 0x8BDC7390, 0x8618 },{ 0x12C867E4, 0x4DBF },{ 0x55282990, 0x426E },{ 0xCC3C3DE4, 0x89C9 },
+  { 0x3F6510B4, 0x4B0E },{ 0xA67104C0, 0x80A9 },{ 0xE1914AB4, 0x8F78 },{ 0x78855EC0, 0x44DF },
+  { 0x0C1EA639, 0xAB22 },{ 0x950AB24D, 0x6085 },{ 0xD2EAFC39, 0x6F54 },{ 0x4BFEE84D, 0xA4F3 },
+  { 0x80B0338A, 0x9C11 },{ 0x19A427FE, 0x57B6 },{ 0x5E44698A, 0x5867 },{ 0xC7507DFE, 0x93C0 },
+  { 0xB3CB8507, 0x7C3D },{ 0x2ADF9173, 0xB79A },{ 0x6D3FDF07, 0xB84B },{ 0xF42BCB73, 0x73EC },
+  { 0x3817F697, 0xFA25 },{ 0xA103E2E3, 0x3182 },{ 0xE6E3AC97, 0x3E53 },{ 0x7FF7B8E3, 0xF5F4 },
+  { 0x0B6C401A, 0x1A09 },{ 0x9278546E, 0xD1AE },{ 0xD5981A1A, 0xDE7F },{ 0x4C8C0E6E, 0x15D8 },
+  { 0x87C2D5A9, 0x2D3A },{ 0x1ED6C1DD, 0xE69D },{ 0x59368FA9, 0xE94C },{ 0xC0229BDD, 0x22EB },
+  { 0xB4B96324, 0xCD16 },{ 0x2DAD7750, 0x06B1 },{ 0x6A4D3924, 0x0960 },{ 0xF3592D50, 0xC2C7 },
+  { 0xEE1171DF, 0x83E8 },{ 0x770565AB, 0x484F },{ 0x30E52BDF, 0x479E },{ 0xA9F13FAB, 0x8C39 },
+  { 0xDD6AC752, 0x63C4 },{ 0x447ED326, 0xA863 },{ 0x039E9D52, 0xA7B2 },{ 0x9A8A8926, 0x6C15 },
+  { 0x51C452E1, 0x54F7 },{ 0xC8D04695, 0x9F50 },{ 0x8F3008E1, 0x9081 },{ 0x16241C95, 0x5B26 },
+  { 0x62BFE46C, 0xB4DB },{ 0xFBABF018, 0x7F7C },{ 0xBC4BBE6C, 0x70AD },{ 0x255FAA18, 0xBB0A },
+  { 0xE96397FC, 0x32C3 },{ 0x70778388, 0xF964 },{ 0x3797CDFC, 0xF6B5 },{ 0xAE83D988, 0x3D12 },
+  { 0xDA182171, 0xD2EF },{ 0x430C3505, 0x1948 },{ 0x04EC7B71, 0x1699 },{ 0x9DF86F05, 0xDD3E },
+  { 0x56B6B4C2, 0xE5DC },{ 0xCFA2A0B6, 0x2E7B },{ 0x8842EEC2, 0x21AA },{ 0x1156FAB6, 0xEA0D },
+  { 0x65CD024F, 0x05F0 },{ 0xFCD9163B, 0xCE57 },{ 0xBB39584F, 0xC186 },{ 0x222D4C3B, 0x0A21 },
+  { 0xD174616B, 0xC8E6 },{ 0x4860751F, 0x0341 },{ 0x0F803B6B, 0x0C90 },{ 0x96942F1F, 0xC737 },
+  { 0xE20FD7E6, 0x28CA },{ 0x7B1BC392, 0xE36D },{ 0x3CFB8DE6, 0xECBC },{ 0xA5EF9992, 0x271B },
+  { 0x6EA14255, 0x1FF9 },{ 0xF7B55621, 0xD45E },{ 0xB0551855, 0xDB8F },{ 0x29410C21, 0x1028 },
+  { 0x5DDAF4D8, 0xFFD5 },{ 0xC4CEE0AC, 0x3472 },{ 0x832EAED8, 0x3BA3 },{ 0x1A3ABAAC, 0xF004 },
+  { 0xD6068748, 0x79CD },{ 0x4F12933C, 0xB26A },{ 0x08F2DD48, 0xBDBB },{ 0x91E6C93C, 0x761C },
+  { 0xE57D31C5, 0x99E1 },{ 0x7C6925B1, 0x5246 },{ 0x3B896BC5, 0x5D97 },{ 0xA29D7FB1, 0x9630 },
+  { 0x69D3A476, 0xAED2 },{ 0xF0C7B002, 0x6575 },{ 0xB727FE76, 0x6AA4 },{ 0x2E33EA02, 0xA103 },
+  { 0x5AA812FB, 0x4EFE },{ 0xC3BC068F, 0x8559 },{ 0x845C48FB, 0x8A88 },{ 0x1D485C8F, 0x412F },
+  { 0x9D97B42B, 0xE527 },{ 0x0483A05F, 0x2E80 },{ 0x4363EE2B, 0x2151 },{ 0xDA77FA5F, 0xEAF6 },
+  { 0xAEEC02A6, 0x050B },{ 0x37F816D2, 0xCEAC },{ 0x701858A6, 0xC17D },{ 0xE90C4CD2, 0x0ADA },
+  { 0x22429715, 0x3238 },{ 0xBB568361, 0xF99F },{ 0xFCB6CD15, 0xF64E },{ 0x65A2D961, 0x3DE9 },
+  { 0x11392198, 0xD214 },{ 0x882D35EC, 0x19B3 },{ 0xCFCD7B98, 0x1662 },{ 0x56D96FEC, 0xDDC5 },
+  { 0x9AE55208, 0x540C },{ 0x03F1467C, 0x9FAB },{ 0x44110808, 0x907A },{ 0xDD051C7C, 0x5BDD },
+  { 0xA99EE485, 0xB420 },{ 0x308AF0F1, 0x7F87 },{ 0x776ABE85, 0x7056 },{ 0xEE7EAAF1, 0xBBF1 },
+  { 0x25307136, 0x8313 },{ 0xBC246542, 0x48B4 },{ 0xFBC42B36, 0x4765 },{ 0x62D03F42, 0x8CC2 },
+  { 0x164BC7BB, 0x633F },{ 0x8F5FD3CF, 0xA898 },{ 0xC8BF9DBB, 0xA749 },{ 0x51AB89CF, 0x6CEE },
+  { 0xA2F2A49F, 0xAE29 },{ 0x3BE6B0EB, 0x658E },{ 0x7C06FE9F, 0x6A5F },{ 0xE512EAEB, 0xA1F8 },
+  { 0x91891212, 0x4E05 },{ 0x089D0666, 0x85A2 },{ 0x4F7D4812, 0x8A73 },{ 0xD6695C66, 0x41D4 },
+  { 0x1D2787A1, 0x7936 },{ 0x843393D5, 0xB291 },{ 0xC3D3DDA1, 0xBD40 },{ 0x5AC7C9D5, 0x76E7 },
+  { 0x2E5C312C, 0x991A },{ 0xB7482558, 0x52BD },{ 0xF0A86B2C, 0x5D6C },{ 0x69BC7F58, 0x96CB },
+  { 0xA58042BC, 0x1F02 },{ 0x3C9456C8, 0xD4A5 },{ 0x7B7418BC, 0xDB74 },{ 0xE2600CC8, 0x10D3 },
+  { 0x96FBF431, 0xFF2E },{ 0x0FEFE045, 0x3489 },{ 0x480FAE31, 0x3B58 },{ 0xD11BBA45, 0xF0FF },
+  { 0x1A556182, 0xC81D },{ 0x834175F6, 0x03BA },{ 0xC4A13B82, 0x0C6B },{ 0x5DB52FF6, 0xC7CC },
+  { 0x292ED70F, 0x2831 },{ 0xB03AC37B, 0xE396 },{ 0xF7DA8D0F, 0xEC47 },{ 0x6ECE997B, 0x27E0 },
+  { 0x7386C5F4, 0x66CF },{ 0xEA92D180, 0xAD68 },{ 0xAD729FF4, 0xA2B9 },{ 0x34668B80, 0x691E },
+  { 0x40FD7379, 0x86E3 },{ 0xD9E9670D, 0x4D44 },{ 0x9E092979, 0x4295 },{ 0x071D3D0D, 0x8932 },
+  { 0xCC53E6CA, 0xB1D0 },{ 0x5547F2BE, 0x7A77 },{ 0x12A7BCCA, 0x75A6 },{ 0x8BB3A8BE, 0xBE01 },
+  { 0xFF285047, 0x51FC },{ 0x663C4433, 0x9A5B },{ 0x21DC0A47, 0x958A },{ 0xB8C81E33, 0x5E2D },
+  { 0x74F423D7, 0xD7E4 },{ 0xEDE037A3, 0x1C43 },{ 0xAA0079D7, 0x1392 },{ 0x33146DA3, 0xD835 },
+  { 0x478F955A, 0x37C8 },{ 0xDE9B812E, 0xFC6F },{ 0x997BCF5A, 0xF3BE },{ 0x006FDB2E, 0x3819 },
+  { 0xCB2100E9, 0x00FB },{ 0x5235149D, 0xCB5C },{ 0x15D55AE9, 0xC48D },{ 0x8CC14E9D, 0x0F2A },
+  { 0xF85AB664, 0xE0D7 },{ 0x614EA210, 0x2B70 },{ 0x26AEEC64, 0x24A1 },{ 0xBFBAF810, 0xEF06 },
+  { 0x4CE3D540, 0x2DC1 },{ 0xD5F7C134, 0xE666 },{ 0x92178F40, 0xE9B7 },{ 0x0B039B34, 0x2210 },
+  { 0x7F9863CD, 0xCDED },{ 0xE68C77B9, 0x064A },{ 0xA16C39CD, 0x099B },{ 0x38782DB9, 0xC23C },
+  { 0xF336F67E, 0xFADE },{ 0x6A22E20A, 0x3179 },{ 0x2DC2AC7E, 0x3EA8 },{ 0xB4D6B80A, 0xF50F },
+  { 0xC04D40F3, 0x1AF2 },{ 0x59595487, 0xD155 },{ 0x1EB91AF3, 0xDE84 },{ 0x87AD0E87, 0x1523 },
+  { 0x4B913363, 0x9CEA },{ 0xD2852717, 0x574D },{ 0x95656963, 0x589C },{ 0x0C717D17, 0x933B },
+  { 0x78EA85EE, 0x7CC6 },{ 0xE1FE919A, 0xB761 },{ 0xA61EDFEE, 0xB8B0 },{ 0x3F0ACB9A, 0x7317 },
+  { 0xF444105D, 0x4BF5 },{ 0x6D500429, 0x8052 },{ 0x2AB04A5D, 0x8F83 },{ 0xB3A45E29, 0x4424 },
+  { 0xC73FA6D0, 0xABD9 },{ 0x5E2BB2A4, 0x607E },{ 0x19CBFCD0, 0x6FAF },{ 0x80DFE8A4, 0xA408 },
+ },
+ { // data byte #17
+  { 0x00000000, 0x0000 },{ 0x6B601908, 0x12CB },{ 0xB6496138, 0x621E },{ 0xDD297830, 0x70D5 },
+  { 0x310438B1, 0x1B1F },{ 0x5A6421B9, 0x09D4 },{ 0x874D5989, 0x7901 },{ 0xEC2D4081, 0x6BCA },
+  { 0xF2B96FA7, 0xC77E },{ 0x99D976AF, 0xD5B5 },{ 0x44F00E9F, 0xA560 },{ 0x2F901797, 0xB7AB },
+  { 0xC3BD5716, 0xDC61 },{ 0xA8DD4E1E, 0xCEAA },{ 0x75F4362E, 0xBE7F },{ 0x1E942F26, 0xACB4 },
+  { 0x2C63BE05, 0x3009 },{ 0x4703A70D, 0x22C2 },{ 0x9A2ADF3D, 0x5217 },{ 0xF14AC635, 0x40DC },
+  { 0x1D6786B4, 0x2B16 },{ 0x76079FBC, 0x39DD },{ 0xAB2EE78C, 0x4908 },{ 0xC04EFE84, 0x5BC3 },
+  { 0xDEDAD1A2, 0xF777 },{ 0xB5BAC8AA, 0xE5BC },{ 0x6893B09A, 0x9569 },{ 0x03F3A992, 0x87A2 },
+  { 0xEFDEE913, 0xEC68 },{ 0x84BEF01B, 0xFEA3 },{ 0x5997882B, 0x8E76 },{ 0x32F79123, 0x9CBD },
+  { 0xC2FC336B, 0x97F3 },{ 0xA99C2A63, 0x8538 },{ 0x74B55253, 0xF5ED },{ 0x1FD54B5B, 0xE726 },
+  { 0xF3F80BDA, 0x8CEC },{ 0x989812D2, 0x9E27 },{ 0x45B16AE2, 0xEEF2 },{ 0x2ED173EA, 0xFC39 },
+  { 0x30455CCC, 0x508D },{ 0x5B2545C4, 0x4246 },{ 0x860C3DF4, 0x3293 },{ 0xED6C24FC, 0x2058 },
+  { 0x0141647D, 0x4B92 },{ 0x6A217D75, 0x5959 },{ 0xB7080545, 0x298C },{ 0xDC681C4D, 0x3B47 },
+  { 0xEE9F8D6E, 0xA7FA },{ 0x85FF9466, 0xB531 },{ 0x58D6EC56, 0xC5E4 },{ 0x33B6F55E, 0xD72F },
+  { 0xDF9BB5DF, 0xBCE5 },{ 0xB4FBACD7, 0xAE2E },{ 0x69D2D4E7, 0xDEFB },{ 0x02B2CDEF, 0xCC30 },
+  { 0x1C26E2C9, 0x6084 },{ 0x7746FBC1, 0x724F },{ 0xAA6F83F1, 0x029A },{ 0xC10F9AF9, 0x1051 },
+  { 0x2D22DA78, 0x7B9B },{ 0x4642C370, 0x6950 },{ 0x9B6BBB40, 0x1985 },{ 0xF00BA248, 0x0B4E },
+  { 0xF347C78F, 0x4855 },{ 0x9827DE87, 0x5A9E },{ 0x450EA6B7, 0x2A4B },{ 0x2E6EBFBF, 0x3880 },
+  { 0xC243FF3E, 0x534A },{ 0xA923E636, 0x4181 },{ 0x740A9E06, 0x3154 },{ 0x1F6A870E, 0x239F },
+  { 0x01FEA828, 0x8F2B },{ 0x6A9EB120, 0x9DE0 },{ 0xB7B7C910, 0xED35 },{ 0xDCD7D018, 0xFFFE },
+  { 0x30FA9099, 0x9434 },{ 0x5B9A8991, 0x86FF },{ 0x86B3F1A1, 0xF62A },{ 0xEDD3E8A9, 0xE4E1 },
+  { 0xDF24798A, 0x785C },{ 0xB4446082, 0x6A97 },{ 0x696D18B2, 0x1A42 },{ 0x020D01BA, 0x0889 },
+  { 0xEE20413B, 0x6343 },{ 0x85405833, 0x7188 },{ 0x58692003, 0x015D },{ 0x3309390B, 0x1396 },
+  { 0x2D9D162D, 0xBF22 },{ 0x46FD0F25, 0xADE9 },{ 0x9BD47715, 0xDD3C },{ 0xF0B46E1D, 0xCFF7 },
+  { 0x1C992E9C, 0xA43D },{ 0x77F93794, 0xB6F6 },{ 0xAAD04FA4, 0xC623 },{ 0xC1B056AC, 0xD4E8 },
+  { 0x31BBF4E4, 0xDFA6 },{ 0x5ADBEDEC, 0xCD6D },{ 0x87F295DC, 0xBDB8 },{ 0xEC928CD4, 0xAF73 },
+  { 0x00BFCC55, 0xC4B9 },{ 0x6BDFD55D, 0xD672 },{ 0xB6F6AD6D, 0xA6A7 },{ 0xDD96B465, 0xB46C },
+  { 0xC3029B43, 0x18D8 },{ 0xA862824B, 0x0A13 },{ 0x754BFA7B, 0x7AC6 },{ 0x1E2BE373, 0x680D },
+  { 0xF206A3F2, 0x03C7 },{ 0x9966BAFA, 0x110C },{ 0x444FC2CA, 0x61D9 },{ 0x2F2FDBC2, 0x7312 },
+  { 0x1DD84AE1, 0xEFAF },{ 0x76B853E9, 0xFD64 },{ 0xAB912BD9, 0x8DB1 },{ 0xC0F132D1, 0x9F7A },
+  { 0x2CDC7250, 0xF4B0 },{ 0x47BC6B58, 0xE67B },{ 0x9A951368, 0x96AE },{ 0xF1F50A60, 0x8465 },
+  { 0xEF612546, 0x28D1 },{ 0x84013C4E, 0x3A1A },{ 0x5928447E, 0x4ACF },{ 0x32485D76, 0x5804 },
+  { 0xDE651DF7, 0x33CE },{ 0xB50504FF, 0x2105 },{ 0x682C7CCF, 0x51D0 },{ 0x034C65C7, 0x431B },
+  { 0x84117BF2, 0xA7A0 },{ 0xEF7162FA, 0xB56B },{ 0x32581ACA, 0xC5BE },{ 0x593803C2, 0xD775 },
+  { 0xB5154343, 0xBCBF },{ 0xDE755A4B, 0xAE74 },{ 0x035C227B, 0xDEA1 },{ 0x683C3B73, 0xCC6A },
+  { 0x76A81455, 0x60DE },{ 0x1DC80D5D, 0x7215 },{ 0xC0E1756D, 0x02C0 },{ 0xAB816C65, 0x100B },
+  { 0x47AC2CE4, 0x7BC1 },{ 0x2CCC35EC, 0x690A },{ 0xF1E54DDC, 0x19DF },{ 0x9A8554D4, 0x0B14 },
+  { 0xA872C5F7, 0x97A9 },{ 0xC312DCFF, 0x8562 },{ 0x1E3BA4CF, 0xF5B7 },{ 0x755BBDC7, 0xE77C },
+  { 0x9976FD46, 0x8CB6 },{ 0xF216E44E, 0x9E7D },{ 0x2F3F9C7E, 0xEEA8 },{ 0x445F8576, 0xFC63 },
+  { 0x5ACBAA50, 0x50D7 },{ 0x31ABB358, 0x421C },{ 0xEC82CB68, 0x32C9 },{ 0x87E2D260, 0x2002 },
+  { 0x6BCF92E1, 0x4BC8 },{ 0x00AF8BE9, 0x5903 },{ 0xDD86F3D9, 0x29D6 },{ 0xB6E6EAD1, 0x3B1D },
+  { 0x46ED4899, 0x3053 },{ 0x2D8D5191, 0x2298 },{ 0xF0A429A1, 0x524D },{ 0x9BC430A9, 0x4086 },
+  { 0x77E97028, 0x2B4C },{ 0x1C896920, 0x3987 },{ 0xC1A01110, 0x4952 },{ 0xAAC00818, 0x5B99 },
+  { 0xB454273E, 0xF72D },{ 0xDF343E36, 0xE5E6 },{ 0x021D4606, 0x9533 },{ 0x697D5F0E, 0x87F8 },
+  { 0x85501F8F, 0xEC32 },{ 0xEE300687, 0xFEF9 },{ 0x33197EB7, 0x8E2C },{ 0x587967BF, 0x9CE7 },
+  { 0x6A8EF69C, 0x005A },{ 0x01EEEF94, 0x1291 },{ 0xDCC797A4, 0x6244 },{ 0xB7A78EAC, 0x708F },
+  { 0x5B8ACE2D, 0x1B45 },{ 0x30EAD725, 0x098E },{ 0xEDC3AF15, 0x795B },{ 0x86A3B61D, 0x6B90 },
+  { 0x9837993B, 0xC724 },{ 0xF3578033, 0xD5EF },{ 0x2E7EF803, 0xA53A },{ 0x451EE10B, 0xB7F1 },
+  { 0xA933A18A, 0xDC3B },{ 0xC253B882, 0xCEF0 },{ 0x1F7AC0B2, 0xBE25 },{ 0x741AD9BA, 0xACEE },
+  { 0x7756BC7D, 0xEFF5 },{ 0x1C36A575, 0xFD3E },{ 0xC11FDD45, 0x8DEB },{ 0xAA7FC44D, 0x9F20 },
+  { 0x465284CC, 0xF4EA },{ 0x2D329DC4, 0xE621 },{ 0xF01BE5F4, 0x96F4 },{ 0x9B7BFCFC, 0x843F },
+  { 0x85EFD3DA, 0x288B },{ 0xEE8FCAD2, 0x3A40 },{ 0x33A6B2E2, 0x4A95 },{ 0x58C6ABEA, 0x585E },
+  { 0xB4EBEB6B, 0x3394 },{ 0xDF8BF263, 0x215F },{ 0x02A28A53, 0x518A },{ 0x69C2935B, 0x4341 },
+  { 0x5B350278, 0xDFFC },{ 0x30551B70, 0xCD37 },{ 0xED7C6340, 0xBDE2 },{ 0x861C7A48, 0xAF29 },
+  { 0x6A313AC9, 0xC4E3 },{ 0x015123C1, 0xD628 },{ 0xDC785BF1, 0xA6FD },{ 0xB71842F9, 0xB436 },
+  { 0xA98C6DDF, 0x1882 },{ 0xC2EC74D7, 0x0A49 },{ 0x1FC50CE7, 0x7A9C },{ 0x74A515EF, 0x6857 },
+  { 0x9888556E, 0x039D },{ 0xF3E84C66, 0x1156 },{ 0x2EC13456, 0x6183 },{ 0x45A12D5E, 0x7348 },
+  { 0xB5AA8F16, 0x7806 },{ 0xDECA961E, 0x6ACD },{ 0x03E3EE2E, 0x1A18 },{ 0x6883F726, 0x08D3 },
+  { 0x84AEB7A7, 0x6319 },{ 0xEFCEAEAF, 0x71D2 },{ 0x32E7D69F, 0x0107 },{ 0x5987CF97, 0x13CC },
+  { 0x4713E0B1, 0xBF78 },{ 0x2C73F9B9, 0xADB3 },{ 0xF15A8189, 0xDD66 },{ 0x9A3A9881, 0xCFAD },
+  { 0x7617D800, 0xA467 },{ 0x1D77C108, 0xB6AC },{ 0xC05EB938, 0xC679 },{ 0xAB3EA030, 0xD4B2 },
+  { 0x99C93113, 0x480F },{ 0xF2A9281B, 0x5AC4 },{ 0x2F80502B, 0x2A11 },{ 0x44E04923, 0x38DA },
+  { 0xA8CD09A2, 0x5310 },{ 0xC3AD10AA, 0x41DB },{ 0x1E84689A, 0x310E },{ 0x75E47192, 0x23C5 },
+  { 0x6B705EB4, 0x8F71 },{ 0x001047BC, 0x9DBA },{ 0xDD393F8C, 0xED6F },{ 0xB6592684, 0xFFA4 },
+  { 0x5A746605, 0x946E },{ 0x31147F0D, 0x86A5 },{ 0xEC3D073D, 0xF670 },{ 0x875D1E35, 0xE4BB },
+ },
+ { // data byte #18
+  { 0x00000000, 0x0000 },{ 0xD087D8D0, 0x46C5 },{ 0xC26C26E5, 0x3F93 },{ 0x12EBFE35, 0x7956 },
+  { 0xAC012C15, 0x3008 },{ 0x7C86F4C5, 0x76CD },{ 0x6E6D0AF0, 0x0F9B },{ 0xBEEAD220, 0x495E },
+  { 0x4B511D8A, 0xA160 },{ 0x9BD6C55A, 0xE7A5 },{ 0x893D3B6F, 0x9EF3 },{ 0x59BAE3BF, 0xD836 },
+  { 0xE750319F, 0x9168 },{ 0x37D7E94F, 0xD7AD },{ 0x253C177A, 0xAEFB },{ 0xF5BBCFAA, 0xE83E },
+  { 0x07C0175E, 0x1C90 },{ 0xD747CF8E, 0x5A55 },{ 0xC5AC31BB, 0x2303 },{ 0x152BE96B, 0x65C6 },
+  { 0xABC13B4B, 0x2C98 },{ 0x7B46E39B, 0x6A5D },{ 0x69AD1DAE, 0x130B },{ 0xB92AC57E, 0x55CE },
+  { 0x4C910AD4, 0xBDF0 },{ 0x9C16D204, 0xFB35 },{ 0x8EFD2C31, 0x8263 },{ 0x5E7AF4E1, 0xC4A6 },
+  { 0xE09026C1, 0x8DF8 },{ 0x3017FE11, 0xCB3D },{ 0x22FC0024, 0xB26B },{ 0xF27BD8F4, 0xF4AE },
+  { 0xC65FAEBB, 0x1A42 },{ 0x16D8766B, 0x5C87 },{ 0x0433885E, 0x25D1 },{ 0xD4B4508E, 0x6314 },
+  { 0x6A5E82AE, 0x2A4A },{ 0xBAD95A7E, 0x6C8F },{ 0xA832A44B, 0x15D9 },{ 0x78B57C9B, 0x531C },
+  { 0x8D0EB331, 0xBB22 },{ 0x5D896BE1, 0xFDE7 },{ 0x4F6295D4, 0x84B1 },{ 0x9FE54D04, 0xC274 },
+  { 0x210F9F24, 0x8B2A },{ 0xF18847F4, 0xCDEF },{ 0xE363B9C1, 0xB4B9 },{ 0x33E46111, 0xF27C },
+  { 0xC19FB9E5, 0x06D2 },{ 0x11186135, 0x4017 },{ 0x03F39F00, 0x3941 },{ 0xD37447D0, 0x7F84 },
+  { 0x6D9E95F0, 0x36DA },{ 0xBD194D20, 0x701F },{ 0xAFF2B315, 0x0949 },{ 0x7F756BC5, 0x4F8C },
+  { 0x8ACEA46F, 0xA7B2 },{ 0x5A497CBF, 0xE177 },{ 0x48A2828A, 0x9821 },{ 0x98255A5A, 0xDEE4 },
+  { 0x26CF887A, 0x97BA },{ 0xF64850AA, 0xD17F },{ 0xE4A3AE9F, 0xA829 },{ 0x3424764F, 0xEEEC },
+  { 0xB6FAD4E8, 0xA4BE },{ 0x667D0C38, 0xE27B },{ 0x7496F20D, 0x9B2D },{ 0xA4112ADD, 0xDDE8 },
+  { 0x1AFBF8FD, 0x94B6 },{ 0xCA7C202D, 0xD273 },{ 0xD897DE18, 0xAB25 },{ 0x081006C8, 0xEDE0 },
+  { 0xFDABC962, 0x05DE },{ 0x2D2C11B2, 0x431B },{ 0x3FC7EF87, 0x3A4D },{ 0xEF403757, 0x7C88 },
+  { 0x51AAE577, 0x35D6 },{ 0x812D3DA7, 0x7313 },{ 0x93C6C392, 0x0A45 },{ 0x43411B42, 0x4C80 },
+  { 0xB13AC3B6, 0xB82E },{ 0x61BD1B66, 0xFEEB },{ 0x7356E553, 0x87BD },{ 0xA3D13D83, 0xC178 },
+  { 0x1D3BEFA3, 0x8826 },{ 0xCDBC3773, 0xCEE3 },{ 0xDF57C946, 0xB7B5 },{ 0x0FD01196, 0xF170 },
+  { 0xFA6BDE3C, 0x194E },{ 0x2AEC06EC, 0x5F8B },{ 0x3807F8D9, 0x26DD },{ 0xE8802009, 0x6018 },
+  { 0x566AF229, 0x2946 },{ 0x86ED2AF9, 0x6F83 },{ 0x9406D4CC, 0x16D5 },{ 0x44810C1C, 0x5010 },
+  { 0x70A57A53, 0xBEFC },{ 0xA022A283, 0xF839 },{ 0xB2C95CB6, 0x816F },{ 0x624E8466, 0xC7AA },
+  { 0xDCA45646, 0x8EF4 },{ 0x0C238E96, 0xC831 },{ 0x1EC870A3, 0xB167 },{ 0xCE4FA873, 0xF7A2 },
+  { 0x3BF467D9, 0x1F9C },{ 0xEB73BF09, 0x5959 },{ 0xF998413C, 0x200F },{ 0x291F99EC, 0x66CA },
+  { 0x97F54BCC, 0x2F94 },{ 0x4772931C, 0x6951 },{ 0x55996D29, 0x1007 },{ 0x851EB5F9, 0x56C2 },
+  { 0x77656D0D, 0xA26C },{ 0xA7E2B5DD, 0xE4A9 },{ 0xB5094BE8, 0x9DFF },{ 0x658E9338, 0xDB3A },
+  { 0xDB644118, 0x9264 },{ 0x0BE399C8, 0xD4A1 },{ 0x190867FD, 0xADF7 },{ 0xC98FBF2D, 0xEB32 },
+  { 0x3C347087, 0x030C },{ 0xECB3A857, 0x45C9 },{ 0xFE585662, 0x3C9F },{ 0x2EDF8EB2, 0x7A5A },
+  { 0x90355C92, 0x3304 },{ 0x40B28442, 0x75C1 },{ 0x52597A77, 0x0C97 },{ 0x82DEA2A7, 0x4A52 },
+  { 0xF8215462, 0x71CE },{ 0x28A68CB2, 0x370B },{ 0x3A4D7287, 0x4E5D },{ 0xEACAAA57, 0x0898 },
+  { 0x54207877, 0x41C6 },{ 0x84A7A0A7, 0x0703 },{ 0x964C5E92, 0x7E55 },{ 0x46CB8642, 0x3890 },
+  { 0xB37049E8, 0xD0AE },{ 0x63F79138, 0x966B },{ 0x711C6F0D, 0xEF3D },{ 0xA19BB7DD, 0xA9F8 },
+  { 0x1F7165FD, 0xE0A6 },{ 0xCFF6BD2D, 0xA663 },{ 0xDD1D4318, 0xDF35 },{ 0x0D9A9BC8, 0x99F0 },
+  { 0xFFE1433C, 0x6D5E },{ 0x2F669BEC, 0x2B9B },{ 0x3D8D65D9, 0x52CD },{ 0xED0ABD09, 0x1408 },
+  { 0x53E06F29, 0x5D56 },{ 0x8367B7F9, 0x1B93 },{ 0x918C49CC, 0x62C5 },{ 0x410B911C, 0x2400 },
+  { 0xB4B05EB6, 0xCC3E },{ 0x64378666, 0x8AFB },{ 0x76DC7853, 0xF3AD },{ 0xA65BA083, 0xB568 },
+  { 0x18B172A3, 0xFC36 },{ 0xC836AA73, 0xBAF3 },{ 0xDADD5446, 0xC3A5 },{ 0x0A5A8C96, 0x8560 },
+  { 0x3E7EFAD9, 0x6B8C },{ 0xEEF92209, 0x2D49 },{ 0xFC12DC3C, 0x541F },{ 0x2C9504EC, 0x12DA },
+  { 0x927FD6CC, 0x5B84 },{ 0x42F80E1C, 0x1D41 },{ 0x5013F029, 0x6417 },{ 0x809428F9, 0x22D2 },
+  { 0x752FE753, 0xCAEC },{ 0xA5A83F83, 0x8C29 },{ 0xB743C1B6, 0xF57F },{ 0x67C41966, 0xB3BA },
+  { 0xD92ECB46, 0xFAE4 },{ 0x09A91396, 0xBC21 },{ 0x1B42EDA3, 0xC577 },{ 0xCBC53573, 0x83B2 },
+  { 0x39BEED87, 0x771C },{ 0xE9393557, 0x31D9 },{ 0xFBD2CB62, 0x488F },{ 0x2B5513B2, 0x0E4A },
+  { 0x95BFC192, 0x4714 },{ 0x45381942, 0x01D1 },{ 0x57D3E777, 0x7887 },{ 0x87543FA7, 0x3E42 },
+  { 0x72EFF00D, 0xD67C },{ 0xA26828DD, 0x90B9 },{ 0xB083D6E8, 0xE9EF },{ 0x60040E38, 0xAF2A },
+  { 0xDEEEDC18, 0xE674 },{ 0x0E6904C8, 0xA0B1 },{ 0x1C82FAFD, 0xD9E7 },{ 0xCC05222D, 0x9F22 },
+  { 0x4EDB808A, 0xD570 },{ 0x9E5C585A, 0x93B5 },{ 0x8CB7A66F, 0xEAE3 },{ 0x5C307EBF, 0xAC26 },
+  { 0xE2DAAC9F, 0xE578 },{ 0x325D744F, 0xA3BD },{ 0x20B68A7A, 0xDAEB },{ 0xF03152AA, 0x9C2E },
+  { 0x058A9D00, 0x7410 },{ 0xD50D45D0, 0x32D5 },{ 0xC7E6BBE5, 0x4B83 },{ 0x17616335, 0x0D46 },
+  { 0xA98BB115, 0x4418 },{ 0x790C69C5, 0x02DD },{ 0x6BE797F0, 0x7B8B },{ 0xBB604F20, 0x3D4E },
+  { 0x491B97D4, 0xC9E0 },{ 0x999C4F04, 0x8F25 },{ 0x8B77B131, 0xF673 },{ 0x5BF069E1, 0xB0B6 },
+  { 0xE51ABBC1, 0xF9E8 },{ 0x359D6311, 0xBF2D },{ 0x27769D24, 0xC67B },{ 0xF7F145F4, 0x80BE },
+  { 0x024A8A5E, 0x6880 },{ 0xD2CD528E, 0x2E45 },{ 0xC026ACBB, 0x5713 },{ 0x10A1746B, 0x11D6 },
+  { 0xAE4BA64B, 0x5888 },{ 0x7ECC7E9B, 0x1E4D },{ 0x6C2780AE, 0x671B },{ 0xBCA0587E, 0x21DE },
+  { 0x88842E31, 0xCF32 },{ 0x5803F6E1, 0x89F7 },{ 0x4AE808D4, 0xF0A1 },{ 0x9A6FD004, 0xB664 },
+  { 0x24850224, 0xFF3A },{ 0xF402DAF4, 0xB9FF },{ 0xE6E924C1, 0xC0A9 },{ 0x366EFC11, 0x866C },
+  { 0xC3D533BB, 0x6E52 },{ 0x1352EB6B, 0x2897 },{ 0x01B9155E, 0x51C1 },{ 0xD13ECD8E, 0x1704 },
+  { 0x6FD41FAE, 0x5E5A },{ 0xBF53C77E, 0x189F },{ 0xADB8394B, 0x61C9 },{ 0x7D3FE19B, 0x270C },
+  { 0x8F44396F, 0xD3A2 },{ 0x5FC3E1BF, 0x9567 },{ 0x4D281F8A, 0xEC31 },{ 0x9DAFC75A, 0xAAF4 },
+  { 0x2345157A, 0xE3AA },{ 0xF3C2CDAA, 0xA56F },{ 0xE129339F, 0xDC39 },{ 0x31AEEB4F, 0x9AFC },
+  { 0xC41524E5, 0x72C2 },{ 0x1492FC35, 0x3407 },{ 0x06790200, 0x4D51 },{ 0xD6FEDAD0, 0x0B94 },
+  { 0x681408F0, 0x42CA },{ 0xB893D020, 0x040F },{ 0xAA782E15, 0x7D59 },{ 0x7AFFF6C5, 0x3B9C },
+ },
+ { // data byte #19
+  { 0x00000000, 0x0000 },{ 0x9509101B, 0x7105 },{ 0xEA5A9B9E, 0x8368 },{ 0x7F538B85, 0xF26D },
+  { 0xCA7FA270, 0x9BE3 },{ 0x5F76B26B, 0xEAE6 },{ 0x202539EE, 0x188B },{ 0xB52C29F5, 0x698E },
+  { 0x92DBFC35, 0x9D36 },{ 0x07D2EC2E, 0xEC33 },{ 0x788167AB, 0x1E5E },{ 0xED8877B0, 0x6F5B },
+  { 0x58A45E45, 0x06D5 },{ 0xCDAD4E5E, 0x77D0 },{ 0xB2FEC5DB, 0x85BD },{ 0x27F7D5C0, 0xF4B8 },
+  { 0x743818C1, 0xD1EC },{ 0xE13108DA, 0xA0E9 },{ 0x9E62835F, 0x5284 },{ 0x0B6B9344, 0x2381 },
+  { 0xBE47BAB1, 0x4A0F },{ 0x2B4EAAAA, 0x3B0A },{ 0x541D212F, 0xC967 },{ 0xC1143134, 0xB862 },
+  { 0xE6E3E4F4, 0x4CDA },{ 0x73EAF4EF, 0x3DDF },{ 0x0CB97F6A, 0xCFB2 },{ 0x99B06F71, 0xBEB7 },
+  { 0x2C9C4684, 0xD739 },{ 0xB995569F, 0xA63C },{ 0xC6C6DD1A, 0x5451 },{ 0x53CFCD01, 0x2554 },
+  { 0x2E5020D6, 0xD0B8 },{ 0xBB5930CD, 0xA1BD },{ 0xC40ABB48, 0x53D0 },{ 0x5103AB53, 0x22D5 },
+  { 0xE42F82A6, 0x4B5B },{ 0x712692BD, 0x3A5E },{ 0x0E751938, 0xC833 },{ 0x9B7C0923, 0xB936 },
+  { 0xBC8BDCE3, 0x4D8E },{ 0x2982CCF8, 0x3C8B },{ 0x56D1477D, 0xCEE6 },{ 0xC3D85766, 0xBFE3 },
+  { 0x76F47E93, 0xD66D },{ 0xE3FD6E88, 0xA768 },{ 0x9CAEE50D, 0x5505 },{ 0x09A7F516, 0x2400 },
+  { 0x5A683817, 0x0154 },{ 0xCF61280C, 0x7051 },{ 0xB032A389, 0x823C },{ 0x253BB392, 0xF339 },
+  { 0x90179A67, 0x9AB7 },{ 0x051E8A7C, 0xEBB2 },{ 0x7A4D01F9, 0x19DF },{ 0xEF4411E2, 0x68DA },
+  { 0xC8B3C422, 0x9C62 },{ 0x5DBAD439, 0xED67 },{ 0x22E95FBC, 0x1F0A },{ 0xB7E04FA7, 0x6E0F },
+  { 0x02CC6652, 0x0781 },{ 0x97C57649, 0x7684 },{ 0xE896FDCC, 0x84E9 },{ 0x7D9FEDD7, 0xF5EC },
+  { 0xF11860B5, 0xE05F },{ 0x641170AE, 0x915A },{ 0x1B42FB2B, 0x6337 },{ 0x8E4BEB30, 0x1232 },
+  { 0x3B67C2C5, 0x7BBC },{ 0xAE6ED2DE, 0x0AB9 },{ 0xD13D595B, 0xF8D4 },{ 0x44344940, 0x89D1 },
+  { 0x63C39C80, 0x7D69 },{ 0xF6CA8C9B, 0x0C6C },{ 0x8999071E, 0xFE01 },{ 0x1C901705, 0x8F04 },
+  { 0xA9BC3EF0, 0xE68A },{ 0x3CB52EEB, 0x978F },{ 0x43E6A56E, 0x65E2 },{ 0xD6EFB575, 0x14E7 },
+  { 0x85207874, 0x31B3 },{ 0x1029686F, 0x40B6 },{ 0x6F7AE3EA, 0xB2DB },{ 0xFA73F3F1, 0xC3DE },
+  { 0x4F5FDA04, 0xAA50 },{ 0xDA56CA1F, 0xDB55 },{ 0xA505419A, 0x2938 },{ 0x300C5181, 0x583D },
+  { 0x17FB8441, 0xAC85 },{ 0x82F2945A, 0xDD80 },{ 0xFDA11FDF, 0x2FED },{ 0x68A80FC4, 0x5EE8 },
+  { 0xDD842631, 0x3766 },{ 0x488D362A, 0x4663 },{ 0x37DEBDAF, 0xB40E },{ 0xA2D7ADB4, 0xC50B },
+  { 0xDF484063, 0x30E7 },{ 0x4A415078, 0x41E2 },{ 0x3512DBFD, 0xB38F },{ 0xA01BCBE6, 0xC28A },
+  { 0x1537E213, 0xAB04 },{ 0x803EF208, 0xDA01 },{ 0xFF6D798D, 0x286C },{ 0x6A646996, 0x5969 },
+  { 0x4D93BC56, 0xADD1 },{ 0xD89AAC4D, 0xDCD4 },{ 0xA7C927C8, 0x2EB9 },{ 0x32C037D3, 0x5FBC },
+  { 0x87EC1E26, 0x3632 },{ 0x12E50E3D, 0x4737 },{ 0x6DB685B8, 0xB55A },{ 0xF8BF95A3, 0xC45F },
+  { 0xAB7058A2, 0xE10B },{ 0x3E7948B9, 0x900E },{ 0x412AC33C, 0x6263 },{ 0xD423D327, 0x1366 },
+  { 0x610FFAD2, 0x7AE8 },{ 0xF406EAC9, 0x0BED },{ 0x8B55614C, 0xF980 },{ 0x1E5C7157, 0x8885 },
+  { 0x39ABA497, 0x7C3D },{ 0xACA2B48C, 0x0D38 },{ 0xD3F13F09, 0xFF55 },{ 0x46F82F12, 0x8E50 },
+  { 0xF3D406E7, 0xE7DE },{ 0x66DD16FC, 0x96DB },{ 0x198E9D79, 0x64B6 },{ 0x8C878D62, 0x15B3 },
+  { 0x2DAD6E93, 0x2589 },{ 0xB8A47E88, 0x548C },{ 0xC7F7F50D, 0xA6E1 },{ 0x52FEE516, 0xD7E4 },
+  { 0xE7D2CCE3, 0xBE6A },{ 0x72DBDCF8, 0xCF6F },{ 0x0D88577D, 0x3D02 },{ 0x98814766, 0x4C07 },
+  { 0xBF7692A6, 0xB8BF },{ 0x2A7F82BD, 0xC9BA },{ 0x552C0938, 0x3BD7 },{ 0xC0251923, 0x4AD2 },
+  { 0x750930D6, 0x235C },{ 0xE00020CD, 0x5259 },{ 0x9F53AB48, 0xA034 },{ 0x0A5ABB53, 0xD131 },
+  { 0x59957652, 0xF465 },{ 0xCC9C6649, 0x8560 },{ 0xB3CFEDCC, 0x770D },{ 0x26C6FDD7, 0x0608 },
+  { 0x93EAD422, 0x6F86 },{ 0x06E3C439, 0x1E83 },{ 0x79B04FBC, 0xECEE },{ 0xECB95FA7, 0x9DEB },
+  { 0xCB4E8A67, 0x6953 },{ 0x5E479A7C, 0x1856 },{ 0x211411F9, 0xEA3B },{ 0xB41D01E2, 0x9B3E },
+  { 0x01312817, 0xF2B0 },{ 0x9438380C, 0x83B5 },{ 0xEB6BB389, 0x71D8 },{ 0x7E62A392, 0x00DD },
+  { 0x03FD4E45, 0xF531 },{ 0x96F45E5E, 0x8434 },{ 0xE9A7D5DB, 0x7659 },{ 0x7CAEC5C0, 0x075C },
+  { 0xC982EC35, 0x6ED2 },{ 0x5C8BFC2E, 0x1FD7 },{ 0x23D877AB, 0xEDBA },{ 0xB6D167B0, 0x9CBF },
+  { 0x9126B270, 0x6807 },{ 0x042FA26B, 0x1902 },{ 0x7B7C29EE, 0xEB6F },{ 0xEE7539F5, 0x9A6A },
+  { 0x5B591000, 0xF3E4 },{ 0xCE50001B, 0x82E1 },{ 0xB1038B9E, 0x708C },{ 0x240A9B85, 0x0189 },
+  { 0x77C55684, 0x24DD },{ 0xE2CC469F, 0x55D8 },{ 0x9D9FCD1A, 0xA7B5 },{ 0x0896DD01, 0xD6B0 },
+  { 0xBDBAF4F4, 0xBF3E },{ 0x28B3E4EF, 0xCE3B },{ 0x57E06F6A, 0x3C56 },{ 0xC2E97F71, 0x4D53 },
+  { 0xE51EAAB1, 0xB9EB },{ 0x7017BAAA, 0xC8EE },{ 0x0F44312F, 0x3A83 },{ 0x9A4D2134, 0x4B86 },
+  { 0x2F6108C1, 0x2208 },{ 0xBA6818DA, 0x530D },{ 0xC53B935F, 0xA160 },{ 0x50328344, 0xD065 },
+  { 0xDCB50E26, 0xC5D6 },{ 0x49BC1E3D, 0xB4D3 },{ 0x36EF95B8, 0x46BE },{ 0xA3E685A3, 0x37BB },
+  { 0x16CAAC56, 0x5E35 },{ 0x83C3BC4D, 0x2F30 },{ 0xFC9037C8, 0xDD5D },{ 0x699927D3, 0xAC58 },
+  { 0x4E6EF213, 0x58E0 },{ 0xDB67E208, 0x29E5 },{ 0xA434698D, 0xDB88 },{ 0x313D7996, 0xAA8D },
+  { 0x84115063, 0xC303 },{ 0x11184078, 0xB206 },{ 0x6E4BCBFD, 0x406B },{ 0xFB42DBE6, 0x316E },
+  { 0xA88D16E7, 0x143A },{ 0x3D8406FC, 0x653F },{ 0x42D78D79, 0x9752 },{ 0xD7DE9D62, 0xE657 },
+  { 0x62F2B497, 0x8FD9 },{ 0xF7FBA48C, 0xFEDC },{ 0x88A82F09, 0x0CB1 },{ 0x1DA13F12, 0x7DB4 },
+  { 0x3A56EAD2, 0x890C },{ 0xAF5FFAC9, 0xF809 },{ 0xD00C714C, 0x0A64 },{ 0x45056157, 0x7B61 },
+  { 0xF02948A2, 0x12EF },{ 0x652058B9, 0x63EA },{ 0x1A73D33C, 0x9187 },{ 0x8F7AC327, 0xE082 },
+  { 0xF2E52EF0, 0x156E },{ 0x67EC3EEB, 0x646B },{ 0x18BFB56E, 0x9606 },{ 0x8DB6A575, 0xE703 },
+  { 0x389A8C80, 0x8E8D },{ 0xAD939C9B, 0xFF88 },{ 0xD2C0171E, 0x0DE5 },{ 0x47C90705, 0x7CE0 },
+  { 0x603ED2C5, 0x8858 },{ 0xF537C2DE, 0xF95D },{ 0x8A64495B, 0x0B30 },{ 0x1F6D5940, 0x7A35 },
+  { 0xAA4170B5, 0x13BB },{ 0x3F4860AE, 0x62BE },{ 0x401BEB2B, 0x90D3 },{ 0xD512FB30, 0xE1D6 },
+  { 0x86DD3631, 0xC482 },{ 0x13D4262A, 0xB587 },{ 0x6C87ADAF, 0x47EA },{ 0xF98EBDB4, 0x36EF },
+  { 0x4CA29441, 0x5F61 },{ 0xD9AB845A, 0x2E64 },{ 0xA6F80FDF, 0xDC09 },{ 0x33F11FC4, 0xAD0C },
+  { 0x1406CA04, 0x59B4 },{ 0x810FDA1F, 0x28B1 },{ 0xFE5C519A, 0xDADC },{ 0x6B554181, 0xABD9 },
+  { 0xDE796874, 0xC257 },{ 0x4B70786F, 0xB352 },{ 0x3423F3EA, 0x413F },{ 0xA12AE3F1, 0x303A },
+ },
+} ;
+
+#endif // of __LDPC_ENC_H__
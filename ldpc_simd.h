@@ -0,0 +1,223 @@
+#ifndef __LDPC_SIMD_H__
+#define __LDPC_SIMD_H__
+
+// SIMD soft LDPC decoding for receivers on a PC or an ARM board (e.g. behind an SDR): many sync-word candidates
+// per second, most of them noise, thus the failing codewords are decoded 16 (SSE2, NEON) or 32 (AVX2) at a time,
+// one codeword per lane. Results are bit-exact with LDPC_Decoder, the instruction set is chosen at run time.
+
+#include <stdint.h>
+
+#include "ldpc.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+enum LDPC_SIMD_ISA
+{ LDPC_ISA_SCALAR = 0,                                    // LDPC_Decoder, one codeword at a time
+  LDPC_ISA_SSE2,                                          // 16 lanes
+  LDPC_ISA_AVX2,                                          // 32 lanes
+  LDPC_ISA_NEON                                           // 16 lanes, 64-bit ARM
+} ;
+
+// Every lane class V gives: I8 (Lanes x int8_t), I16 (Lanes/2 x int16_t), masks are all-ones lanes,
+// Lo16()/Hi16() sign-extend two halves of an I8 and Pack8() puts them back (saturated) in the same order.
+
+#ifdef __SSE2__
+
+namespace LDPC_SSE2 {
+
+class V
+{ public:
+   typedef __m128i I8;
+   typedef __m128i I16;
+   const static uint8_t Lanes = 16;
+
+   static I8   Zero8(void)                 { return _mm_setzero_si128(); }
+   static I16  Zero16(void)                { return _mm_setzero_si128(); }
+   static I8   Set8(int8_t Val)            { return _mm_set1_epi8(Val); }
+   static I16  Set16(int16_t Val)          { return _mm_set1_epi16(Val); }
+   static I8   Load8(const int8_t *Data)   { return _mm_load_si128((const __m128i *)Data); }
+   static void Store8(int8_t *Data, I8 A)  { _mm_store_si128((__m128i *)Data, A); }
+   static I8   Or8(I8 A, I8 B)             { return _mm_or_si128(A, B); }
+   static I8   Xor8(I8 A, I8 B)            { return _mm_xor_si128(A, B); }
+   static I8   Gt8(I8 A, I8 B)             { return _mm_cmpgt_epi8(A, B); }
+   static I8   Eq8(I8 A, I8 B)             { return _mm_cmpeq_epi8(A, B); }
+   static I8   Sel8(I8 M, I8 A, I8 B)      { return _mm_or_si128(_mm_and_si128(M, A), _mm_andnot_si128(M, B)); }
+   static I8   Min8(I8 A, I8 B)            { return Sel8(_mm_cmpgt_epi8(A, B), B, A); }       // no signed 8-bit min in SSE2
+   static I8   Neg8(I8 A)                  { return _mm_sub_epi8(_mm_setzero_si128(), A); }
+   static I8   Abs8(I8 A)                  { I8 S=_mm_cmpgt_epi8(_mm_setzero_si128(), A); return _mm_sub_epi8(_mm_xor_si128(A, S), S); }
+   static uint32_t Mask8(I8 M)             { return _mm_movemask_epi8(M); }
+   static I16  Lo16(I8 A)                  { return _mm_srai_epi16(_mm_unpacklo_epi8(A, A), 8); }
+   static I16  Hi16(I8 A)                  { return _mm_srai_epi16(_mm_unpackhi_epi8(A, A), 8); }
+   static I8   Pack8(I16 Lo, I16 Hi)       { return _mm_packs_epi16(Lo, Hi); }
+   static I16  Add16(I16 A, I16 B)         { return _mm_add_epi16(A, B); }
+   static I16  Sub16(I16 A, I16 B)         { return _mm_sub_epi16(A, B); }
+   static I16  Xor16(I16 A, I16 B)         { return _mm_xor_si128(A, B); }
+   static I16  Mul16(I16 A, I16 B)         { return _mm_mullo_epi16(A, B); }
+   static I16  Gt16(I16 A, I16 B)          { return _mm_cmpgt_epi16(A, B); }
+   static I16  Min16(I16 A, I16 B)         { return _mm_min_epi16(A, B); }
+   static I16  Sel16(I16 M, I16 A, I16 B)  { return Sel8(M, A, B); }
+   static I16  Div10(I16 A)                                                          // signed A/10 rounded towards zero
+   { return _mm_sub_epi16(_mm_srai_epi16(_mm_mulhi_epi16(A, _mm_set1_epi16(26215)), 2), _mm_srai_epi16(A, 15)); }
+} ;
+
+#include "ldpc_simd_lanes.h"
+
+} // namespace LDPC_SSE2
+
+#endif // __SSE2__
+
+#if defined(__x86_64__) && (defined(__AVX2__) || (defined(__GNUC__) && !defined(__clang__)))
+#define LDPC_SIMD_AVX2
+
+#ifndef __AVX2__                                          // compile only this part for AVX2: it runs only if the CPU has it
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace LDPC_AVX2 {
+
+class V                                                   // 256-bit unpack/pack work within 128-bit halves: Lo16()/Pack8() still pair up
+{ public:
+   typedef __m256i I8;
+   typedef __m256i I16;
+   const static uint8_t Lanes = 32;
+
+   static I8   Zero8(void)                 { return _mm256_setzero_si256(); }
+   static I16  Zero16(void)                { return _mm256_setzero_si256(); }
+   static I8   Set8(int8_t Val)            { return _mm256_set1_epi8(Val); }
+   static I16  Set16(int16_t Val)          { return _mm256_set1_epi16(Val); }
+   static I8   Load8(const int8_t *Data)   { return _mm256_load_si256((const __m256i *)Data); }
+   static void Store8(int8_t *Data, I8 A)  { _mm256_store_si256((__m256i *)Data, A); }
+   static I8   Or8(I8 A, I8 B)             { return _mm256_or_si256(A, B); }
+   static I8   Xor8(I8 A, I8 B)            { return _mm256_xor_si256(A, B); }
+   static I8   Gt8(I8 A, I8 B)             { return _mm256_cmpgt_epi8(A, B); }
+   static I8   Eq8(I8 A, I8 B)             { return _mm256_cmpeq_epi8(A, B); }
+   static I8   Sel8(I8 M, I8 A, I8 B)      { return _mm256_blendv_epi8(B, A, M); }
+   static I8   Min8(I8 A, I8 B)            { return _mm256_min_epi8(A, B); }
+   static I8   Neg8(I8 A)                  { return _mm256_sub_epi8(_mm256_setzero_si256(), A); }
+   static I8   Abs8(I8 A)                  { return _mm256_abs_epi8(A); }                     // abs(-128) = -128 as in the scalar code
+   static uint32_t Mask8(I8 M)             { return (uint32_t)_mm256_movemask_epi8(M); }
+   static I16  Lo16(I8 A)                  { return _mm256_srai_epi16(_mm256_unpacklo_epi8(A, A), 8); }
+   static I16  Hi16(I8 A)                  { return _mm256_srai_epi16(_mm256_unpackhi_epi8(A, A), 8); }
+   static I8   Pack8(I16 Lo, I16 Hi)       { return _mm256_packs_epi16(Lo, Hi); }
+   static I16  Add16(I16 A, I16 B)         { return _mm256_add_epi16(A, B); }
+   static I16  Sub16(I16 A, I16 B)         { return _mm256_sub_epi16(A, B); }
+   static I16  Xor16(I16 A, I16 B)         { return _mm256_xor_si256(A, B); }
+   static I16  Mul16(I16 A, I16 B)         { return _mm256_mullo_epi16(A, B); }
+   static I16  Gt16(I16 A, I16 B)          { return _mm256_cmpgt_epi16(A, B); }
+   static I16  Min16(I16 A, I16 B)         { return _mm256_min_epi16(A, B); }
+   static I16  Sel16(I16 M, I16 A, I16 B)  { return _mm256_blendv_epi8(B, A, M); }
+   static I16  Div10(I16 A)
+   { return _mm256_sub_epi16(_mm256_srai_epi16(_mm256_mulhi_epi16(A, _mm256_set1_epi16(26215)), 2), _mm256_srai_epi16(A, 15)); }
+} ;
+
+#include "ldpc_simd_lanes.h"
+
+} // namespace LDPC_AVX2
+
+#ifndef __AVX2__
+#pragma GCC pop_options
+#endif
+
+#endif // AVX2
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+
+namespace LDPC_NEON {
+
+class V
+{ public:
+   typedef int8x16_t I8;
+   typedef int16x8_t I16;
+   const static uint8_t Lanes = 16;
+
+   static I8   Zero8(void)                 { return vdupq_n_s8(0); }
+   static I16  Zero16(void)                { return vdupq_n_s16(0); }
+   static I8   Set8(int8_t Val)            { return vdupq_n_s8(Val); }
+   static I16  Set16(int16_t Val)          { return vdupq_n_s16(Val); }
+   static I8   Load8(const int8_t *Data)   { return vld1q_s8(Data); }
+   static void Store8(int8_t *Data, I8 A)  { vst1q_s8(Data, A); }
+   static I8   Or8(I8 A, I8 B)             { return vorrq_s8(A, B); }
+   static I8   Xor8(I8 A, I8 B)            { return veorq_s8(A, B); }
+   static I8   Gt8(I8 A, I8 B)             { return vreinterpretq_s8_u8(vcgtq_s8(A, B)); }
+   static I8   Eq8(I8 A, I8 B)             { return vreinterpretq_s8_u8(vceqq_s8(A, B)); }
+   static I8   Sel8(I8 M, I8 A, I8 B)      { return vbslq_s8(vreinterpretq_u8_s8(M), A, B); }
+   static I8   Min8(I8 A, I8 B)            { return vminq_s8(A, B); }
+   static I8   Neg8(I8 A)                  { return vnegq_s8(A); }                           // not saturated: wraps as the scalar code
+   static I8   Abs8(I8 A)                  { return vabsq_s8(A); }
+   static uint32_t Mask8(I8 M)
+   { static const uint8_t Weight[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+     uint8x16_t Bits = vandq_u8(vreinterpretq_u8_s8(M), vld1q_u8(Weight));
+     return vaddv_u8(vget_low_u8(Bits)) | ((uint32_t)vaddv_u8(vget_high_u8(Bits))<<8); }
+   static I16  Lo16(I8 A)                  { return vmovl_s8(vget_low_s8(A)); }
+   static I16  Hi16(I8 A)                  { return vmovl_s8(vget_high_s8(A)); }
+   static I8   Pack8(I16 Lo, I16 Hi)       { return vcombine_s8(vqmovn_s16(Lo), vqmovn_s16(Hi)); }
+   static I16  Add16(I16 A, I16 B)         { return vaddq_s16(A, B); }
+   static I16  Sub16(I16 A, I16 B)         { return vsubq_s16(A, B); }
+   static I16  Xor16(I16 A, I16 B)         { return veorq_s16(A, B); }
+   static I16  Mul16(I16 A, I16 B)         { return vmulq_s16(A, B); }
+   static I16  Gt16(I16 A, I16 B)          { return vreinterpretq_s16_u16(vcgtq_s16(A, B)); }
+   static I16  Min16(I16 A, I16 B)         { return vminq_s16(A, B); }
+   static I16  Sel16(I16 M, I16 A, I16 B)  { return vbslq_s16(vreinterpretq_u16_s16(M), A, B); }
+   static I16  Div10(I16 A)
+   { int16x4_t Lo = vshrn_n_s32(vmull_n_s16(vget_low_s16(A),  26215), 16);
+     int16x4_t Hi = vshrn_n_s32(vmull_n_s16(vget_high_s16(A), 26215), 16);
+     return vsubq_s16(vshrq_n_s16(vcombine_s16(Lo, Hi), 2), vshrq_n_s16(A, 15)); }
+} ;
+
+#include "ldpc_simd_lanes.h"
+
+} // namespace LDPC_NEON
+
+#endif // NEON
+
+inline bool LDPC_SIMD_Supported(LDPC_SIMD_ISA ISA)      // can this instruction set run on this CPU ?
+{ switch(ISA)
+  { case LDPC_ISA_SCALAR: return 1;
+#ifdef __SSE2__
+    case LDPC_ISA_SSE2:   return 1;
+#endif
+#ifdef LDPC_SIMD_AVX2
+    case LDPC_ISA_AVX2:   return __builtin_cpu_supports("avx2");
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    case LDPC_ISA_NEON:   return 1;
+#endif
+    default:              return 0; }
+}
+
+inline LDPC_SIMD_ISA LDPC_SIMD_Best(void)                 // widest instruction set available
+{ if(LDPC_SIMD_Supported(LDPC_ISA_AVX2)) return LDPC_ISA_AVX2;
+  if(LDPC_SIMD_Supported(LDPC_ISA_SSE2)) return LDPC_ISA_SSE2;
+  if(LDPC_SIMD_Supported(LDPC_ISA_NEON)) return LDPC_ISA_NEON;
+  return LDPC_ISA_SCALAR; }
+
+inline const char *LDPC_SIMD_Name(LDPC_SIMD_ISA ISA)
+{ static const char *Name[4] = { "scalar", "sse2", "avx2", "neon" };
+  return Name[ISA]; }
+
+// soft-decode only those codewords which failed the batch check (non-zero Syndrome[]) - in place,
+// with the given (or the best) instruction set, return the number of codewords which could be corrected
+inline int LDPC_DecodeBatchSIMD(uint32_t *Packet, int Packets, const uint64_t *Syndrome, uint8_t MaxIter=32, uint16_t Stride=7,
+                                LDPC_SIMD_ISA ISA=LDPC_SIMD_Best())
+{ switch(ISA)
+  {
+#ifdef __SSE2__
+    case LDPC_ISA_SSE2: return LDPC_SSE2::DecodeBatch(Packet, Packets, Syndrome, MaxIter, Stride);
+#endif
+#ifdef LDPC_SIMD_AVX2
+    case LDPC_ISA_AVX2: return LDPC_AVX2::DecodeBatch(Packet, Packets, Syndrome, MaxIter, Stride);
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    case LDPC_ISA_NEON: return LDPC_NEON::DecodeBatch(Packet, Packets, Syndrome, MaxIter, Stride);
+#endif
+    default: break; }
+  LDPC_Decoder Decoder;
+  return LDPC_DecodeBatch(Packet, Packets, Syndrome, Decoder, MaxIter, Stride); }
+
+#endif // of __LDPC_SIMD_H__
@@ -0,0 +1,119 @@
+// Soft LDPC decoder for many codewords at once: one codeword per SIMD lane, 8-bit a-priori bits, 16-bit sums.
+// Same schedule and the same arithmetic as LDPC_Decoder::ProcessChecks(), thus every lane gives bit-exactly
+// the scalar result. The lane operations come from the class V (see ldpc_simd.h) declared just before:
+// this file is included once for every instruction set, each time in its own namespace, thus there is no include guard.
+
+class LDPC_LaneDecoder
+{ public:
+   typedef V::I8  I8;                                     // Lanes x int8_t
+   typedef V::I16 I16;                                    // Lanes/2 x int16_t
+
+   const static uint8_t Lanes      = V::Lanes;
+   const static uint8_t CodeBits   = LDPC_Decoder::CodeBits;
+   const static uint8_t CodeWords  = LDPC_Decoder::CodeWords;
+   const static uint8_t ParityBits = LDPC_Decoder::ParityBits;
+
+   I8  InpBit[CodeBits];                                  // lane #Lane of InpBit[Bit] is the a-priori bit #Bit of the codeword #Lane
+   I16 OutBit[CodeBits][2];                               // a-posteriori sums: the lanes are split the way V::Lo16()/V::Hi16() split them
+
+  public:
+   void Input(const uint32_t *const *Packet, uint8_t Packets) // hard bits of up to Lanes codewords, missing lanes get the all-zero codeword
+   { alignas(32) int8_t Soft[Lanes];
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { for(uint8_t Lane=0; Lane<Lanes; Lane++)
+         Soft[Lane] = (Lane<Packets && ((Packet[Lane][Bit>>5]>>(Bit&31))&1)) ? +32:-32;
+       InpBit[Bit]=V::Load8(Soft); }
+   }
+
+   void Input(const int8_t *const *Soft, uint8_t Packets)  // soft bits (as LDPC_Decoder::InpBit[]) of up to Lanes codewords
+   { alignas(32) int8_t Lane8[Lanes];
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { for(uint8_t Lane=0; Lane<Lanes; Lane++)
+         Lane8[Lane] = Lane<Packets ? Soft[Lane][Bit]:-32;
+       InpBit[Bit]=V::Load8(Lane8); }
+   }
+
+   void Output(uint32_t *const *Packet, uint8_t Packets) const // hard decisions: 7 words per codeword, as LDPC_Decoder::Output()
+   { for(uint8_t Lane=0; Lane<Packets; Lane++)
+       for(uint8_t Idx=0; Idx<CodeWords; Idx++) Packet[Lane][Idx]=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { uint32_t Ones = V::Mask8(V::Gt8(InpBit[Bit], V::Zero8()));
+       for(uint8_t Lane=0; Lane<Packets; Lane++)
+         Packet[Lane][Bit>>5] |= ((Ones>>Lane)&1)<<(Bit&31); }
+   }
+
+   void getSoft(int8_t Soft[CodeBits], uint8_t Lane) const    // a-priori bits of one lane, to compare with LDPC_Decoder::InpBit[]
+   { alignas(32) int8_t Lane8[Lanes];
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { V::Store8(Lane8, InpBit[Bit]); Soft[Bit]=Lane8[Lane]; }
+   }
+
+   uint32_t ProcessChecks(void)                           // return the mask of the lanes with failing checks: only these are updated
+   { for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+       OutBit[Bit][0]=OutBit[Bit][1]=V::Zero16();
+     I8 Active=V::Zero8();
+     for(uint8_t Row=0; Row<ParityBits; Row++)
+       Active=V::Or8(Active, ProcessCheck(Row));
+     uint32_t Mask=V::Mask8(Active);
+     if(Mask==0) return 0;
+     const I16 Min16=V::Set16(-128), Low16=V::Set16(-127), Max16=V::Set16(127);
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { I16 Ampl[2] = { V::Lo16(InpBit[Bit]), V::Hi16(InpBit[Bit]) };
+       for(uint8_t Half=0; Half<2; Half++)
+       { I16 Sum = V::Add16(V::Mul16(Ampl[Half], V::Set16(9)), OutBit[Bit][Half]);
+         Sum = V::Div10(Sum);                             // (9*InpBit+OutBit)/10, truncated towards zero as in C
+         Sum = V::Sel16(V::Gt16(Min16, Sum), Low16, Sum); // same (asymmetric) clipping as the scalar decoder
+         Ampl[Half] = V::Min16(Sum, Max16); }
+       InpBit[Bit] = V::Sel8(Active, V::Pack8(Ampl[0], Ampl[1]), InpBit[Bit]); }
+     return Mask; }
+
+   I8 ProcessCheck(uint8_t Row)                           // return the lanes where the check fails or its weakest bit is not positive
+   { const uint8_t *CheckIndex = LDPC_ParityCheckIndex[Row];
+     uint8_t CheckWeight = *CheckIndex++;
+     const I8 Zero=V::Zero8();
+     I8 MinAmpl=V::Set8(127), MinAmpl2=MinAmpl, MinBit=Zero, Fails=Zero;
+     for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+     { I8 Inp=InpBit[CheckIndex[Bit]];
+       Fails = V::Xor8(Fails, V::Gt8(Inp, Zero));         // parity of the positive bits
+       I8 Ampl = V::Abs8(Inp);
+       I8 Less = V::Gt8(MinAmpl, Ampl);
+       MinAmpl2 = V::Sel8(Less, MinAmpl, V::Min8(MinAmpl2, Ampl));
+       MinAmpl  = V::Sel8(Less, Ampl, MinAmpl);
+       MinBit   = V::Sel8(Less, V::Set8(Bit), MinBit); }
+     for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+     { uint8_t BitIdx=CheckIndex[Bit];
+       I8 Ampl = V::Sel8(V::Eq8(MinBit, V::Set8(Bit)), MinAmpl2, MinAmpl);
+       Ampl = V::Sel8(Fails, V::Neg8(Ampl), Ampl);        // 8-bit negation: wraps like the scalar code
+       I8 Neg = V::Xor8(V::Gt8(InpBit[BitIdx], Zero), V::Set8(-1)); // the message sign follows the bit
+       I16 Msg, Sign;
+       Msg=V::Lo16(Ampl); Sign=V::Lo16(Neg);
+       OutBit[BitIdx][0] = V::Add16(OutBit[BitIdx][0], V::Sub16(V::Xor16(Msg, Sign), Sign));
+       Msg=V::Hi16(Ampl); Sign=V::Hi16(Neg);
+       OutBit[BitIdx][1] = V::Add16(OutBit[BitIdx][1], V::Sub16(V::Xor16(Msg, Sign), Sign)); }
+     return V::Or8(Fails, V::Gt8(V::Set8(1), MinAmpl)); }
+
+} ;
+
+// soft-decode only those codewords which failed the batch check (non-zero Syndrome[]) - in place,
+// Lanes at a time, return the number of codewords which could be corrected: same results as LDPC_DecodeBatch()
+inline int DecodeBatch(uint32_t *Packet, int Packets, const uint64_t *Syndrome, uint8_t MaxIter, uint16_t Stride)
+{ LDPC_LaneDecoder Decoder; int Corrected=0;
+  uint32_t *Lane[LDPC_LaneDecoder::Lanes]; uint32_t Data[LDPC_LaneDecoder::Lanes][LDPC_LaneDecoder::CodeWords];
+  uint32_t *Out[LDPC_LaneDecoder::Lanes];
+  for(uint8_t Idx=0; Idx<LDPC_LaneDecoder::Lanes; Idx++) Out[Idx]=Data[Idx];
+  for(int Pkt=0; Pkt<Packets; )
+  { uint8_t Count=0;
+    for( ; Pkt<Packets && Count<LDPC_LaneDecoder::Lanes; Pkt++)
+      if(Syndrome[Pkt]) Lane[Count++]=Packet+Pkt*Stride;
+    if(Count==0) break;
+    Decoder.Input(Lane, Count);
+    for(uint8_t Iter=0; Iter<MaxIter; Iter++)
+    { if(Decoder.ProcessChecks()==0) break; }
+    Decoder.Output(Out, Count);
+    for(uint8_t Idx=0; Idx<Count; Idx++)
+    { if(LDPC_Check(Data[Idx])) continue;
+      for(uint8_t Word=0; Word<LDPC_LaneDecoder::CodeWords-1; Word++) Lane[Idx][Word]=Data[Idx][Word];
+      Lane[Idx][6] = (Lane[Idx][6]&0xFFFF0000) | (Data[Idx][6]&0x0000FFFF); // the upper 16 bits are not part of the codeword
+      Corrected++; }
+  }
+  return Corrected; }
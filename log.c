@@ -0,0 +1,171 @@
+#include "log.h"
+#include <string.h>
+#include <FreeRTOS.h>
+#include <task.h>
+#include "usart.h"
+#include "log_buf.h"
+#include "clock.h"
+
+/* -------- variables -------- */
+/* set while the consumer side of the ring (DMA transfer in progress) is owned */
+static volatile uint8_t log_tx_busy;
+
+/* -------- functions -------- */
+/**
+* @brief  Sends the next ready record, the caller owns the consumer side.
+* @param  None
+* @retval None
+*/
+static void Log_Drain(void)
+{
+   uint8_t* data;
+   uint16_t len;
+   uint8_t  idle;
+
+   for (;;)
+   {
+      data = log_peek(&len);
+      if (data)
+      {
+         USART2_SendDMA(data, len);
+         return;
+      }
+      __atomic_store_n(&log_tx_busy, 0, __ATOMIC_RELEASE);
+      /* a record committed just now saw log_tx_busy set: take it over */
+      if (!log_ready()) return;
+      idle = 0;
+      if (!__atomic_compare_exchange_n(&log_tx_busy, &idle, 1, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) return;
+   }
+}
+
+/**
+* @brief  Starts the DMA transfer unless one is in progress.
+* @param  None
+* @retval None
+*/
+static void Log_Kick(void)
+{
+   uint8_t idle = 0;
+   if (__atomic_compare_exchange_n(&log_tx_busy, &idle, 1, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+   {
+      Log_Drain();
+   }
+}
+
+/**
+* @brief  USART2 DMA transfer finished (interrupt).
+* @param  None
+* @retval None
+*/
+static void Log_TxDone(void)
+{
+   log_release();
+   Log_Drain();
+}
+
+/**
+* @brief  Configures the log output: to be called after USART2_Config().
+* @param  None
+* @retval None
+*/
+void Log_Config(void)
+{
+   USART2_TxDMA_Config(Log_TxDone);
+   Log_Kick();
+}
+
+/**
+* @brief  Queues data for the console, never blocks: tasks and interrupts.
+* @param  data, length (up to LOG_REC_MAX)
+* @retval 1 - queued, 0 - dropped (counted in the log buffer statistics)
+*/
+uint8_t Log_Write(const char* data, uint16_t len)
+{
+   uint8_t* rec;
+   /* an empty record would start a zero length DMA transfer: no completion, log_tx_busy stays set */
+   if (len == 0) return 1;
+   rec = log_reserve(len);
+   if (rec == NULL)
+   {
+      log_drop();
+      return 0;
+   }
+   memcpy(rec, data, len);
+   log_commit(rec);
+   Log_Kick();
+   return 1;
+}
+
+/**
+* @brief  Queues a string for the console, never blocks: tasks and interrupts.
+* @param  string
+* @retval None
+*/
+void Log_Send(const char* str)
+{
+   Log_Write(str, strlen(str));
+}
+
+/**
+* @brief  Queues a string for the console after the UTC time, never blocks: tasks and interrupts.
+* @param  string
+* @retval None
+*/
+void Log_SendTime(const char* str)
+{
+   char stamp[20];
+   clock_utc_t utc;
+   uint16_t stamp_len = 1;
+   uint16_t len = strlen(str);
+   uint8_t* rec;
+
+   stamp[0] = '[';
+   if (Clock_GetUTC(&utc) != CLOCK_NONE) stamp_len += Clock_Format(&stamp[1], &utc);
+   else { memcpy(&stamp[1], "--:--:--.------", 15); stamp_len += 15; }
+   stamp[stamp_len++] = ']'; stamp[stamp_len++] = ' ';
+   if (stamp_len + len > LOG_REC_MAX) len = LOG_REC_MAX - stamp_len;
+   /* one record: the time can not be separated from its line by another producer */
+   rec = log_reserve(stamp_len + len);
+   if (rec == NULL)
+   {
+      log_drop();
+      return;
+   }
+   memcpy(rec, stamp, stamp_len);
+   memcpy(rec + stamp_len, str, len);
+   log_commit(rec);
+   Log_Kick();
+}
+
+/**
+* @brief  Queues a string for the console, waits for space when the ring is full: tasks only.
+* @param  string
+* @retval None
+*/
+void Log_SendWait(const char* str)
+{
+   uint16_t len = strlen(str);
+   while (len)
+   {
+      uint16_t part = (len > LOG_REC_MAX) ? LOG_REC_MAX : len;
+      uint8_t* rec;
+      while ((rec = log_reserve(part)) == NULL)
+      {
+         vTaskDelay(2);
+      }
+      memcpy(rec, str, part);
+      log_commit(rec);
+      Log_Kick();
+      str += part; len -= part;
+   }
+}
+
+/**
+* @brief  Waits until everything queued is sent: before a reset (busy loop, any context).
+* @param  None
+* @retval None
+*/
+void Log_Flush(void)
+{
+   while (log_used() || __atomic_load_n(&log_tx_busy, __ATOMIC_ACQUIRE)) { }
+}
@@ -0,0 +1,23 @@
+#ifndef __LOG_H
+#define __LOG_H
+
+#include <stdint.h>
+#include "log_buf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- console output through the log ring, drained by DMA --- */
+void    Log_Config(void);
+uint8_t Log_Write(const char* data, uint16_t len);
+void    Log_Send(const char* str);
+void    Log_SendTime(const char* str);
+void    Log_SendWait(const char* str);
+void    Log_Flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOG_H */
@@ -0,0 +1,163 @@
+/**
+  ************************************
+  * @file    log_buf.c
+  * @author
+  * @brief   Multi-producer/single-consumer ring buffer for console output
+  ************************************
+  */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "log_buf.h"
+
+/* Each record starts with a 4-byte header: data length in the low 16 bits, state in the    */
+/* high 16 bits, the data follows and the record is padded to a multiple of 4 bytes.        */
+/* A record never wraps around the end of the buffer: the producer which does not fit there */
+/* claims the end as well and marks it LOG_SKIP. Released space is cleared by the consumer, */
+/* so a header not yet written by its producer always reads as LOG_BUSY.                    */
+#define LOG_HDR_LEN   4
+#define LOG_BUSY      0
+#define LOG_READY     1
+#define LOG_SKIP      2
+
+static uint32_t log_buf_data[LOG_BUF_LEN/4];
+static log_buf_str log_buf = { (uint8_t*)log_buf_data, 0, 0, 0, 0 };
+
+/* LDREX/STREX on the Cortex-M3, the same on the host */
+#define LOG_LOAD(var)         __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define LOG_STORE(var, val)   __atomic_store_n(&(var), (val), __ATOMIC_RELEASE)
+#define LOG_CAS(var, exp, val) __atomic_compare_exchange_n(&(var), &(exp), (val), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+
+static uint32_t* log_header(uint32_t pos)
+{
+   return (uint32_t*)&log_buf.buf_data[pos & (LOG_BUF_LEN-1)];
+}
+
+/**
+  * @brief  Count a record the producer had to drop.
+  * @param  None
+  * @retval None
+  */
+void log_drop(void)
+{
+   __atomic_fetch_add(&log_buf.drops, 1, __ATOMIC_RELAXED);
+}
+
+/**
+  * @brief  Get the log buffer (for statistics).
+  * @param  None
+  * @retval address of the log buffer descriptor structure
+  */
+log_buf_str* get_log_buf(void)
+{
+   return &log_buf;
+}
+
+/**
+  * @brief   Claim space for a record (producer: any task or interrupt).
+  * @param   len: data length, up to LOG_REC_MAX
+  * @retval  address of the record data or NULL if there is not enough free space
+  * @details The record is not visible to the consumer until log_commit().
+  */
+uint8_t* log_reserve(uint16_t len)
+{
+   uint32_t need = LOG_HDR_LEN + ((len+3)&0xFFFC);
+   uint32_t head = LOG_LOAD(log_buf.head);
+   uint32_t tail, ofs, claim, used;
+
+   if (len > LOG_REC_MAX) return NULL;
+   do
+   {
+      tail  = LOG_LOAD(log_buf.tail);
+      ofs   = head & (LOG_BUF_LEN-1);
+      claim = need;
+      if (ofs + need > LOG_BUF_LEN) claim += LOG_BUF_LEN - ofs;   /* skip the end of the buffer */
+      used  = head - tail + claim;
+      if (used > LOG_BUF_LEN) return NULL;
+   } while (!LOG_CAS(log_buf.head, head, head + claim));   /* another producer was faster: head reloaded */
+
+   if (used > log_buf.high_water) log_buf.high_water = used;  /* statistics: races are harmless */
+   if (claim != need)
+   {
+      LOG_STORE(*log_header(head), (LOG_SKIP<<16) | (LOG_BUF_LEN - ofs - LOG_HDR_LEN));
+      head += LOG_BUF_LEN - ofs;
+   }
+   /* header reads LOG_BUSY until commit: keep the length there already */
+   __atomic_store_n(log_header(head), len, __ATOMIC_RELAXED);
+   return (uint8_t*)log_header(head) + LOG_HDR_LEN;
+}
+
+/**
+  * @brief   Make a filled record available to the consumer (producer).
+  * @param   data: address returned by log_reserve()
+  * @retval  None
+  */
+void log_commit(uint8_t* data)
+{
+   uint32_t* hdr = (uint32_t*)(data - LOG_HDR_LEN);
+   LOG_STORE(*hdr, (LOG_READY<<16) | (*hdr & 0xFFFF));
+}
+
+/**
+  * @brief   Get the oldest record (consumer).
+  * @param   len: record length
+  * @retval  address of the record or NULL if the buffer is empty or the oldest record is not yet committed
+  */
+uint8_t* log_peek(uint16_t* len)
+{
+   for (;;)
+   {
+      uint32_t tail = log_buf.tail;
+      uint32_t hdr;
+
+      if (tail == LOG_LOAD(log_buf.head)) return NULL;
+      hdr = LOG_LOAD(*log_header(tail));
+      if ((hdr>>16) == LOG_SKIP)
+      {
+         uint32_t ofs = tail & (LOG_BUF_LEN-1);
+         memset(&log_buf.buf_data[ofs], 0, LOG_BUF_LEN - ofs);
+         LOG_STORE(log_buf.tail, tail + LOG_BUF_LEN - ofs);
+         continue;
+      }
+      if ((hdr>>16) != LOG_READY) return NULL;
+      *len = hdr & 0xFFFF;
+      return (uint8_t*)log_header(tail) + LOG_HDR_LEN;
+   }
+}
+
+/**
+  * @brief   Free the oldest record, as returned by log_peek() (consumer).
+  * @param   None
+  * @retval  None
+  */
+void log_release(void)
+{
+   uint32_t tail = log_buf.tail;
+   uint32_t size = LOG_HDR_LEN + (((*log_header(tail) & 0xFFFF)+3)&0xFFFC);
+
+   memset(log_header(tail), 0, size);
+   LOG_STORE(log_buf.tail, tail + size);
+}
+
+/**
+  * @brief   Check (without taking it) if a record is waiting for the consumer.
+  * @param   None
+  * @retval  non-zero if log_peek() would find a record or skip the end of the buffer
+  */
+uint8_t log_ready(void)
+{
+   uint32_t tail = LOG_LOAD(log_buf.tail);
+   if (tail == LOG_LOAD(log_buf.head)) return 0;
+   return (LOG_LOAD(*log_header(tail))>>16) != LOG_BUSY;
+}
+
+/**
+  * @brief   Number of bytes in use (including headers and the skipped end).
+  * @param   None
+  * @retval  bytes in use
+  */
+uint16_t log_used(void)
+{
+   return LOG_LOAD(log_buf.head) - LOG_LOAD(log_buf.tail);
+}
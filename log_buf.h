@@ -0,0 +1,46 @@
+/**
+  ************************************
+  * @file    log_buf.h
+  * @author
+  * @brief   Multi-producer/single-consumer ring buffer for console output
+  ************************************
+  */
+
+#ifndef __LOG_BUF_H
+#define __LOG_BUF_H
+
+#include <stdint.h>
+
+#define LOG_BUF_LEN      2048      /* power of 2 */
+#define LOG_REC_MAX      256       /* longest record: longer strings are split or dropped */
+
+/* Producers (tasks and interrupts) never block: they claim space with compare-and-swap   */
+/* on head, fill it and mark the record ready, or drop it (log_drop) when there is no space. */
+/* The single consumer takes ready records in order and stops at the first one being filled. */
+/* head and tail run freely (modulo 2^32), the position in the buffer is (pos & (LEN-1)).   */
+typedef struct {
+   uint8_t*           buf_data;
+   volatile uint32_t  head;        /* producers: end of the claimed space */
+   volatile uint32_t  tail;        /* consumer: oldest record not yet released */
+   uint16_t           high_water;  /* max. number of bytes in use */
+   volatile uint32_t  drops;       /* records dropped for lack of space */
+} log_buf_str;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+log_buf_str* get_log_buf(void);
+uint8_t*     log_reserve(uint16_t len);
+void         log_commit(uint8_t* data);
+void         log_drop(void);
+uint8_t*     log_peek(uint16_t* len);
+void         log_release(void);
+uint8_t      log_ready(void);
+uint16_t     log_used(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOG_BUF_H */
@@ -38,6 +38,7 @@
 #include "control.h"
 #include "display.h"
 #include "background.h"
+#include "clock.h"
 
 /** @addtogroup Template_Project
   * @{
@@ -116,6 +117,7 @@ void prvSetupHardware(void)
    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_4);
    srand(*(uint32_t*)0x1FF80050); /* Set CPU id as seed */
    
+   Clock_Config();
    Background_Config();
    Console_Config();
    Display_Config();
@@ -0,0 +1,175 @@
+// Manchester coding of the OGN packets: soft-decision metric for the LDPC decoder
+//
+// The Spirit1 delivers hard chips only: every bit is sent as two chips, 01 => 1 and 10 => 0,
+// while 00 and 11 are Manchester violations: one of the two chips is wrong, but we can not tell which one.
+// The soft metric is built from what we know about the chip errors:
+// - a bit with a violation carries no information: zero
+// - the chip error rate of the whole packet, estimated from the number of violations
+//   and (independently) from the RSSI, sets the confidence of the clean bits
+// - a violation hints at local interference, thus clean bits sharing the Manchester byte (nibble)
+//   with one or more violations get a reduced confidence.
+// Soft bits are log-likelihood ratios in units of 1/4 nat, positive => 1, as taken by LDPC_MinSumDecoder.
+// Encoding into and decoding from the radio FIFO go by table: one 16-bit code per data byte, one nibble per chip byte.
+//
+// Plain C: included by the firmware (C and C++) and by the host tools.
+
+#ifndef __MANCHESTER_H__
+#define __MANCHESTER_H__
+
+#include <stdint.h>
+
+#define MANCH_LLR_MAX     40           // limit of the soft bits: leave the LDPC decoder head-room up to +/-127
+
+static const uint8_t Manch_Log2Frac[16] =      // 16*log2(1+i/16)
+{ 0, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15 } ;
+
+static inline int16_t Manch_Log2(uint16_t Value) // log2(Value) in 1/16 units, Value>0
+{ int16_t Log=0;
+  while(Value>=32) { Value>>=1; Log+=16; }
+  while(Value<16) { Value<<=1; Log-=16; }
+  return Log + 4*16 + Manch_Log2Frac[Value-16]; }
+
+static const uint8_t Manch_SNR_LLR[16] =       // LLR of a clean bit vs chip S/N [dB] for non-coherent FSK: p=exp(-SNR/2)/2, LLR=2*ln((1-p)/p)
+{ 7, 8, 10, 12, 14, 17, 21, 25, 31, 37, 40, 40, 40, 40, 40, 40 } ;
+
+// LLR of a clean bit with 1, 2 or 3 violations among the other three bits of its Manchester byte, vs the LLR
+// of a clean bit in the packet (in steps of 4). Model: 2% of the Manchester bytes are hit by interference
+// with 30% chip errors - a violation is a sign of interference only when the chip error rate of the packet is low.
+static const uint8_t Manch_BurstLLR[3][MANCH_LLR_MAX/4+1] =
+{ { 1, 4, 8, 12, 16, 19, 20, 20, 19, 18, 16 },
+  { 1, 4, 8, 12, 15, 16, 15, 12, 10,  8,  7 },
+  { 1, 4, 8, 12, 14, 12,  9,  8,  7,  7,  7 } } ;
+
+static inline uint8_t Manch_AirBit(const uint8_t *Data, uint16_t Bit) // bits go on the air MSB first
+{ return (Data[Bit>>3]>>(7-(Bit&7)))&1; }
+
+static inline uint16_t Manch_CountErr(const uint8_t *Err, uint8_t Bytes) // number of Manchester violations
+{ uint16_t Count=0; uint8_t Idx;
+  for(Idx=0; Idx<Bytes; Idx++)
+  { uint8_t Byte=Err[Idx];
+    for( ; Byte; Byte&=Byte-1) Count++; }
+  return Count; }
+
+// confidence of a clean bit in a clean Manchester byte: the lower of the estimates from the violation count and from the S/N
+static inline int8_t Manch_SoftAmpl(const uint8_t *Err, uint8_t Bytes, int16_t SNR_dB)
+{ uint16_t Bits=8*Bytes;
+  uint16_t Viol=Manch_CountErr(Err, Bytes);
+  if(Viol>=Bits) return 0;
+  // chip error rate p=(Viol+1)/(2*Bits+2), LLR=2*ln((1-p)/p) = 8*ln(2)/16 * (16*log2(1-p) - 16*log2(p)) in 1/4 nat units
+  int16_t Ampl = ((int32_t)(Manch_Log2(2*Bits+1-Viol)-Manch_Log2(Viol+1))*89)>>8;
+  if(SNR_dB<0) SNR_dB=0;
+  if(SNR_dB<16 && Ampl>Manch_SNR_LLR[SNR_dB]) Ampl=Manch_SNR_LLR[SNR_dB];
+  if(Ampl<1) Ampl=1;
+  if(Ampl>MANCH_LLR_MAX) Ampl=MANCH_LLR_MAX;
+  return Ampl; }
+
+// Soft bits of a Manchester decoded packet: Data and Err (violations) bytes as delivered by the receiver.
+// Offset = number of bits of the first Manchester byte which precede the packet (belong to the SYNC word).
+// Soft[] is in the LDPC code bit order: bit #0 = LSB of the first byte.
+static inline void Manch_SoftBits(int8_t *Soft, const uint8_t *Data, const uint8_t *Err, uint8_t Bytes, uint8_t Offset, int8_t Ampl)
+{ int16_t Bits=8*Bytes; int16_t Start;
+  for(Start=-(int16_t)Offset; Start<Bits; Start+=4)  // one Manchester byte = four bits at a time
+  { uint8_t Viol=0; int16_t Bit;
+    for(Bit=Start; Bit<Start+4; Bit++)
+    { if(Bit>=0 && Bit<Bits) Viol+=Manch_AirBit(Err, Bit); }
+    for(Bit=Start; Bit<Start+4; Bit++)
+    { if(Bit<0 || Bit>=Bits) continue;
+      int8_t Value=0;
+      if(!Manch_AirBit(Err, Bit))
+      { int8_t Clean=Ampl;
+        if(Viol) { int8_t Burst=Manch_BurstLLR[Viol-1][Ampl>>2]; if(Clean>Burst) Clean=Burst; } // violations next to this bit
+        Value = Manch_AirBit(Data, Bit) ? Clean:-Clean; }
+      Soft[(Bit&0xFFF8)|(7-(Bit&7))]=Value; }
+  }
+}
+
+// Manchester chips as they go through the radio FIFO: every data bit becomes two chips, MSB first, 1 => 01 and 0 => 10,
+// thus every data (air) byte becomes two chip bytes. The packet need not start on an air byte boundary:
+// Ofs (0..7) other bits precede it in the first air byte, thus it takes Manch_AirBytes() air bytes.
+
+static const uint16_t Manch_EncTable[256] =    // chips of a data byte: the first chip is the MSB
+{
+  0xAAAA, 0xAAA9, 0xAAA6, 0xAAA5, 0xAA9A, 0xAA99, 0xAA96, 0xAA95,
+  0xAA6A, 0xAA69, 0xAA66, 0xAA65, 0xAA5A, 0xAA59, 0xAA56, 0xAA55,
+  0xA9AA, 0xA9A9, 0xA9A6, 0xA9A5, 0xA99A, 0xA999, 0xA996, 0xA995,
+  0xA96A, 0xA969, 0xA966, 0xA965, 0xA95A, 0xA959, 0xA956, 0xA955,
+  0xA6AA, 0xA6A9, 0xA6A6, 0xA6A5, 0xA69A, 0xA699, 0xA696, 0xA695,
+  0xA66A, 0xA669, 0xA666, 0xA665, 0xA65A, 0xA659, 0xA656, 0xA655,
+  0xA5AA, 0xA5A9, 0xA5A6, 0xA5A5, 0xA59A, 0xA599, 0xA596, 0xA595,
+  0xA56A, 0xA569, 0xA566, 0xA565, 0xA55A, 0xA559, 0xA556, 0xA555,
+  0x9AAA, 0x9AA9, 0x9AA6, 0x9AA5, 0x9A9A, 0x9A99, 0x9A96, 0x9A95,
+  0x9A6A, 0x9A69, 0x9A66, 0x9A65, 0x9A5A, 0x9A59, 0x9A56, 0x9A55,
+  0x99AA, 0x99A9, 0x99A6, 0x99A5, 0x999A, 0x9999, 0x9996, 0x9995,
+  0x996A, 0x9969, 0x9966, 0x9965, 0x995A, 0x9959, 0x9956, 0x9955,
+  0x96AA, 0x96A9, 0x96A6, 0x96A5, 0x969A, 0x9699, 0x9696, 0x9695,
+  0x966A, 0x9669, 0x9666, 0x9665, 0x965A, 0x9659, 0x9656, 0x9655,
+  0x95AA, 0x95A9, 0x95A6, 0x95A5, 0x959A, 0x9599, 0x9596, 0x9595,
+  0x956A, 0x9569, 0x9566, 0x9565, 0x955A, 0x9559, 0x9556, 0x9555,
+  0x6AAA, 0x6AA9, 0x6AA6, 0x6AA5, 0x6A9A, 0x6A99, 0x6A96, 0x6A95,
+  0x6A6A, 0x6A69, 0x6A66, 0x6A65, 0x6A5A, 0x6A59, 0x6A56, 0x6A55,
+  0x69AA, 0x69A9, 0x69A6, 0x69A5, 0x699A, 0x6999, 0x6996, 0x6995,
+  0x696A, 0x6969, 0x6966, 0x6965, 0x695A, 0x6959, 0x6956, 0x6955,
+  0x66AA, 0x66A9, 0x66A6, 0x66A5, 0x669A, 0x6699, 0x6696, 0x6695,
+  0x666A, 0x6669, 0x6666, 0x6665, 0x665A, 0x6659, 0x6656, 0x6655,
+  0x65AA, 0x65A9, 0x65A6, 0x65A5, 0x659A, 0x6599, 0x6596, 0x6595,
+  0x656A, 0x6569, 0x6566, 0x6565, 0x655A, 0x6559, 0x6556, 0x6555,
+  0x5AAA, 0x5AA9, 0x5AA6, 0x5AA5, 0x5A9A, 0x5A99, 0x5A96, 0x5A95,
+  0x5A6A, 0x5A69, 0x5A66, 0x5A65, 0x5A5A, 0x5A59, 0x5A56, 0x5A55,
+  0x59AA, 0x59A9, 0x59A6, 0x59A5, 0x599A, 0x5999, 0x5996, 0x5995,
+  0x596A, 0x5969, 0x5966, 0x5965, 0x595A, 0x5959, 0x5956, 0x5955,
+  0x56AA, 0x56A9, 0x56A6, 0x56A5, 0x569A, 0x5699, 0x5696, 0x5695,
+  0x566A, 0x5669, 0x5666, 0x5665, 0x565A, 0x5659, 0x5656, 0x5655,
+  0x55AA, 0x55A9, 0x55A6, 0x55A5, 0x559A, 0x5599, 0x5596, 0x5595,
+  0x556A, 0x5569, 0x5566, 0x5565, 0x555A, 0x5559, 0x5556, 0x5555
+} ;
+
+static inline uint8_t Manch_AirBytes(uint8_t Bytes, uint8_t Ofs)
+{ return Bytes + (Ofs!=0); }
+
+// Encode Bytes data bytes straight into the FIFO buffer: Head = the Ofs bits which precede the packet (LSB aligned, higher bits ignored),
+// the upper 8-Ofs bits of Tail complete the last air byte. Return the end of the chips written.
+static inline uint8_t *Manch_Encode(uint8_t *Chips, const uint8_t *Data, uint8_t Bytes, uint8_t Ofs, uint8_t Head, uint8_t Tail)
+{ uint16_t Acc=Head; uint16_t Code; uint8_t Idx;           // Acc: the Ofs bits not yet sent + the new byte
+  for(Idx=0; Idx<Bytes; Idx++)
+  { Acc = (Acc<<8) | Data[Idx];
+    Code = Manch_EncTable[(uint8_t)(Acc>>Ofs)];
+    *Chips++ = Code>>8; *Chips++ = Code; }
+  if(Ofs)
+  { Code = Manch_EncTable[(uint8_t)((Acc<<(8-Ofs)) | (Tail>>Ofs))];
+    *Chips++ = Code>>8; *Chips++ = Code; }
+  return Chips; }
+
+static const uint8_t Manch_DecTable[256] =     // four chip pairs => lower nibble: data bits, upper nibble: violations (00 => 0, 11 => 1)
+{
+  0xF0, 0xE1, 0xE0, 0xF1, 0xD2, 0xC3, 0xC2, 0xD3, 0xD0, 0xC1, 0xC0, 0xD1, 0xF2, 0xE3, 0xE2, 0xF3,
+  0xB4, 0xA5, 0xA4, 0xB5, 0x96, 0x87, 0x86, 0x97, 0x94, 0x85, 0x84, 0x95, 0xB6, 0xA7, 0xA6, 0xB7,
+  0xB0, 0xA1, 0xA0, 0xB1, 0x92, 0x83, 0x82, 0x93, 0x90, 0x81, 0x80, 0x91, 0xB2, 0xA3, 0xA2, 0xB3,
+  0xF4, 0xE5, 0xE4, 0xF5, 0xD6, 0xC7, 0xC6, 0xD7, 0xD4, 0xC5, 0xC4, 0xD5, 0xF6, 0xE7, 0xE6, 0xF7,
+  0x78, 0x69, 0x68, 0x79, 0x5A, 0x4B, 0x4A, 0x5B, 0x58, 0x49, 0x48, 0x59, 0x7A, 0x6B, 0x6A, 0x7B,
+  0x3C, 0x2D, 0x2C, 0x3D, 0x1E, 0x0F, 0x0E, 0x1F, 0x1C, 0x0D, 0x0C, 0x1D, 0x3E, 0x2F, 0x2E, 0x3F,
+  0x38, 0x29, 0x28, 0x39, 0x1A, 0x0B, 0x0A, 0x1B, 0x18, 0x09, 0x08, 0x19, 0x3A, 0x2B, 0x2A, 0x3B,
+  0x7C, 0x6D, 0x6C, 0x7D, 0x5E, 0x4F, 0x4E, 0x5F, 0x5C, 0x4D, 0x4C, 0x5D, 0x7E, 0x6F, 0x6E, 0x7F,
+  0x70, 0x61, 0x60, 0x71, 0x52, 0x43, 0x42, 0x53, 0x50, 0x41, 0x40, 0x51, 0x72, 0x63, 0x62, 0x73,
+  0x34, 0x25, 0x24, 0x35, 0x16, 0x07, 0x06, 0x17, 0x14, 0x05, 0x04, 0x15, 0x36, 0x27, 0x26, 0x37,
+  0x30, 0x21, 0x20, 0x31, 0x12, 0x03, 0x02, 0x13, 0x10, 0x01, 0x00, 0x11, 0x32, 0x23, 0x22, 0x33,
+  0x74, 0x65, 0x64, 0x75, 0x56, 0x47, 0x46, 0x57, 0x54, 0x45, 0x44, 0x55, 0x76, 0x67, 0x66, 0x77,
+  0xF8, 0xE9, 0xE8, 0xF9, 0xDA, 0xCB, 0xCA, 0xDB, 0xD8, 0xC9, 0xC8, 0xD9, 0xFA, 0xEB, 0xEA, 0xFB,
+  0xBC, 0xAD, 0xAC, 0xBD, 0x9E, 0x8F, 0x8E, 0x9F, 0x9C, 0x8D, 0x8C, 0x9D, 0xBE, 0xAF, 0xAE, 0xBF,
+  0xB8, 0xA9, 0xA8, 0xB9, 0x9A, 0x8B, 0x8A, 0x9B, 0x98, 0x89, 0x88, 0x99, 0xBA, 0xAB, 0xAA, 0xBB,
+  0xFC, 0xED, 0xEC, 0xFD, 0xDE, 0xCF, 0xCE, 0xDF, 0xDC, 0xCD, 0xCC, 0xDD, 0xFE, 0xEF, 0xEE, 0xFF
+} ;
+
+// Decode Bytes data bytes straight from the FIFO buffer, two chip bytes per data byte, skip the first Ofs bits:
+// Data and Err (violations) as Manch_SoftBits() takes them.
+static inline void Manch_Decode(uint8_t *Data, uint8_t *Err, const uint8_t *Chips, uint8_t Bytes, uint8_t Ofs)
+{ uint16_t DataAcc=0, ErrAcc=0; uint8_t Code, Shift, Idx;
+  Chips+=Ofs>>2; Ofs&=3; Shift=(4-Ofs)&3;                 // whole chip bytes to skip, then Ofs bits of the next one
+  if(Ofs) { Code=Manch_DecTable[*Chips++]; DataAcc=Code&0x0F; ErrAcc=Code>>4; }
+  for(Idx=0; Idx<Bytes; Idx++)
+  { uint8_t Hi=Manch_DecTable[Chips[0]], Lo=Manch_DecTable[Chips[1]]; Chips+=2;
+    DataAcc = (DataAcc<<8) | ((Hi&0x0F)<<4) | (Lo&0x0F);
+    ErrAcc  = (ErrAcc<<8)  | (Hi&0xF0)      | (Lo>>4);
+    Data[Idx]=DataAcc>>Shift; Err[Idx]=ErrAcc>>Shift; }
+}
+
+#endif // of __MANCHESTER_H__
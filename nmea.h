@@ -3,7 +3,7 @@
 
 #include <stdint.h>
 
-uint8_t NMEA_Check(uint8_t *Data, uint8_t Len) // NMEA check-sum
+inline uint8_t NMEA_Check(uint8_t *Data, uint8_t Len) // NMEA check-sum
 { uint8_t Check=0;                             // to be calculated over characters between '$' and '*'
   uint8_t Idx;                                 // but _excluding_ those.
   for(Idx=0; Idx<Len; Idx++)
@@ -20,6 +20,7 @@ uint8_t NMEA_Check(uint8_t *Data, uint8_t Len) // NMEA check-sum
    uint8_t Parm[MaxParms];           // offset to each comma
    uint8_t State;                    // bits: 0:loading, 1:complete, 2:locked,
    uint8_t Check;                    // check sum: should be a XOR of all bytes between '$' and '*'
+   uint32_t Time;                    // timer count when the '$' arrived: set by the receiver, ProcessByte() leaves it
 
   public:
    void Clear(void)                  // Clear the frame: discard all data, ready for next message
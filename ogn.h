@@ -5,6 +5,7 @@
 
 #include <string.h>
 #include <stdint.h>
+#include <stddef.h>
 #ifndef __AVR__
 #include <time.h>
 #endif
@@ -18,6 +19,96 @@
 
 // const uint32_t OGN_WhitenKey[4] = { 0x01234567, 0x89ABCDEF, 0xFEDCBA98, 0x76543210 } ;
 
+// "float-like" field of the packet: ExpBits of exponent (range), MantBits of mantissa and optionally a sign bit in front.
+// Range E covers [(2^E-1)<<MantBits, (2^(E+1)-1)<<MantBits) in steps of 2^E, larger values saturate at the all-ones code.
+// With W=Value+2^MantBits the range is E=log2(W)-MantBits and the mantissa (W>>E)-2^MantBits: one CLZ, no compare chain.
+// Decoding returns the middle of the step.
+
+template <uint8_t MantBits, uint8_t ExpBits=2, bool Signed=0>
+ class OGN_FloatField
+{ public:
+   static const uint8_t  Bits     = MantBits+ExpBits+Signed;                  // width of the field in the packet
+   static const uint8_t  MaxExp   = (1<<ExpBits)-1;
+   static const uint32_t MaxValue = (((uint32_t)2<<MaxExp)-1)*((uint32_t)1<<MantBits)-1; // largest value which does not saturate
+   static const uint32_t SignBit  = Signed ? (uint32_t)1<<(MantBits+ExpBits):0;
+
+   static uint32_t EncodeMagnitude(uint32_t Value)
+   { if(Value>MaxValue) Value=MaxValue;                                         // compiles to a conditional move/select
+     uint32_t Offset = Value + ((uint32_t)1<<MantBits);
+     uint8_t  Exp = 31-__builtin_clz(Offset)-MantBits;
+     return ((uint32_t)Exp<<MantBits) + (Offset>>Exp) - ((uint32_t)1<<MantBits); }
+
+   static const uint32_t DecodeOffset[8];                                       // start of every range + half a step, up to ExpBits=3
+
+   static uint32_t DecodeMagnitude(uint32_t Code)
+   { uint8_t  Exp  = (Code>>MantBits)&MaxExp;
+     uint32_t Mant =  Code&(((uint32_t)1<<MantBits)-1);
+     return (Mant<<Exp) + DecodeOffset[Exp]; }
+
+   static uint32_t Encode(int32_t Value)                                        // unsigned fields: negative values give zero
+   { if(!Signed) return EncodeMagnitude(Value & ~(Value>>31));
+     uint32_t Sign = Value>>31;                                                  // 0 or all ones
+     return EncodeMagnitude((Value^Sign)-Sign) | (Sign&SignBit); }
+
+   static int32_t Decode(uint32_t Code)
+   { int32_t Value = DecodeMagnitude(Code);
+     if(!Signed) return Value;
+     int32_t Sign = -(int32_t)((Code>>(MantBits+ExpBits))&1);
+     return (Value^Sign)-Sign; }
+
+} ;
+
+#define OGN_FLOAT_OFFSET(Exp) (((((uint32_t)1<<Exp)-1)<<MantBits) + (((uint32_t)1<<Exp)>>1))
+template <uint8_t MantBits, uint8_t ExpBits, bool Signed>
+ const uint32_t OGN_FloatField<MantBits, ExpBits, Signed>::DecodeOffset[8] =
+ { OGN_FLOAT_OFFSET(0), OGN_FLOAT_OFFSET(1), OGN_FLOAT_OFFSET(2), OGN_FLOAT_OFFSET(3),
+   OGN_FLOAT_OFFSET(4), OGN_FLOAT_OFFSET(5), OGN_FLOAT_OFFSET(6), OGN_FLOAT_OFFSET(7) } ;
+#undef OGN_FLOAT_OFFSET
+
+#define TEA_DELTA 0x9e3779b9
+
+#ifndef OGN_ENCR_LOOPS
+#define OGN_ENCR_LOOPS 16           // TEA cycles over each half of an encrypted position (whitening takes 8)
+#endif
+
+// key for the encrypted position: TEA has no key schedule, the 128-bit key is used as it is and the round constant
+// is the running sum of TEA_DELTA. Encrypt()/Decrypt() give the same as OGN_Packet::TEA_Encrypt()/TEA_Decrypt(Data, Key, OGN_ENCR_LOOPS);
+// the number of cycles does not depend on the data or the key, thus the time it takes is fixed.
+class OGN_TEAKey
+{ public:
+   static const uint8_t Loops = OGN_ENCR_LOOPS;
+   uint32_t Key[4];
+
+  public:
+   OGN_TEAKey() { const uint32_t Zero[4] = { 0, 0, 0, 0 }; Set(Zero); }
+
+   void Set(const uint32_t NewKey[4])
+   { for(uint8_t Idx=0; Idx<4; Idx++) Key[Idx]=NewKey[Idx]; }
+
+   bool isZero(void) const { return (Key[0]|Key[1]|Key[2]|Key[3])==0; }
+
+   void Encrypt(uint32_t *Data) const
+   { uint32_t v0=Data[0], v1=Data[1];
+     const uint32_t k0=Key[0], k1=Key[1], k2=Key[2], k3=Key[3]; uint32_t sum=0;
+     for(uint8_t Loop=0; Loop<Loops; Loop++)
+     { sum += TEA_DELTA;
+       v0 += ((v1<<4) + k0) ^ (v1 + sum) ^ ((v1>>5) + k1);
+       v1 += ((v0<<4) + k2) ^ (v0 + sum) ^ ((v0>>5) + k3); }
+     Data[0]=v0; Data[1]=v1; }
+
+   void Decrypt(uint32_t *Data) const
+   { uint32_t v0=Data[0], v1=Data[1];
+     const uint32_t k0=Key[0], k1=Key[1], k2=Key[2], k3=Key[3]; uint32_t sum=TEA_DELTA*Loops;
+     for(uint8_t Loop=0; Loop<Loops; Loop++)
+     { v1 -= ((v0<<4) + k2) ^ (v0 + sum) ^ ((v0>>5) + k3);
+       v0 -= ((v1<<4) + k0) ^ (v1 + sum) ^ ((v1>>5) + k1);
+       sum -= TEA_DELTA; }
+     Data[0]=v0; Data[1]=v1; }
+
+   uint16_t Check(void) const      // key check value: to tell keys apart without showing them
+   { uint32_t Block[2] = { 0, 0 }; Encrypt(Block); return Block[0]>>16; }
+} ;
+
 class OGN_Packet          // Packet structure for the OGN tracker
 { public:
 
@@ -96,6 +187,26 @@ class OGN_Packet          // Packet structure for the OGN tracker
             (int)getFixQuality(), (int)getFixMode()+2, 0.1*(10+DecodeDOP()), (int)getTime(),
             0.0001/60*DecodeLatitude(), 0.0001/60*DecodeLongitude(), (long int)DecodeAltitude(),
             0.2*DecodeSpeed(), 0.1*DecodeHeading(), 0.1*DecodeClimbRate(), 0.1*DecodeTurnRate() ); }
+
+   int PrintLine(char *Out) const                   // same as Print() but into a string and without floating point
+   { int Len=sprintf(Out, "%06lX:%c R%c %c%01X %c%d/%dD/", (long int)getAddress(), '0'+getAddrType(), '0'+getRelayCount(),
+                     isPrivate()?'p':' ', (int)getAcftType(), isEmergency()?'E':' ', (int)getFixQuality(), (int)getFixMode()+2);
+     Len+=Format_Fixed(Out+Len, 10+DecodeDOP(), 1, 0);
+     Len+=sprintf(Out+Len, " %02dsec: [", (int)getTime());
+     Len+=Format_Fixed(Out+Len, DecodeLatitude()*10/6, 6, 1); Out[Len++]=',';         // [0.0001/60 deg] => [1e-6 deg]
+     Len+=Format_Fixed(Out+Len, DecodeLongitude()*10/6, 6, 1);
+     Len+=sprintf(Out+Len, "]deg %ldm ", (long int)DecodeAltitude());
+     Len+=Format_Fixed(Out+Len, 2*DecodeSpeed(), 1, 0); Len+=sprintf(Out+Len, "kt ");   // [0.2 knot] => [0.1 knot]
+     Len+=Format_Fixed(Out+Len, DecodeHeading(), 1, 0); Len+=sprintf(Out+Len, "deg ");
+     Len+=Format_Fixed(Out+Len, DecodeClimbRate(), 1, 1); Len+=sprintf(Out+Len, "m/s ");
+     Len+=Format_Fixed(Out+Len, DecodeTurnRate(), 1, 1); Len+=sprintf(Out+Len, "deg/s");
+     return Len; }
+
+   static int Format_Fixed(char *Out, int32_t Value, uint8_t Frac, uint8_t Sign) // print a fixed-point value with Frac decimal digits
+   { char SignChar='+'; if(Value<0) { SignChar='-'; Value=(-Value); }
+     int32_t Scale=1; for(uint8_t Dig=0; Dig<Frac; Dig++) Scale*=10;
+     int Len=0; if(Sign || (SignChar=='-')) Out[Len++]=SignChar;
+     return Len+sprintf(Out+Len, "%ld.%0*ld", (long int)(Value/Scale), (int)Frac, (long int)(Value%Scale)); }
 #endif // __AVR__
 
    OGN_Packet() { Clear(); }
@@ -108,6 +219,8 @@ class OGN_Packet          // Packet structure for the OGN tracker
    // void Dewhiten(void) { TEA_Decrypt(Position, OGN_WhitenKey, 4); TEA_Decrypt(Position+2, OGN_WhitenKey, 4); } // de-whiten the position
    void Whiten  (void) { TEA_Encrypt_Key0(Position, 8); TEA_Encrypt_Key0(Position+2, 8); } // whiten the position
    void Dewhiten(void) { TEA_Decrypt_Key0(Position, 8); TEA_Decrypt_Key0(Position+2, 8); } // de-whiten the position
+   void Encrypt (const OGN_TEAKey &Key) { Key.Encrypt(Position); Key.Encrypt(Position+2); } // instead of Whiten(): for isEncrypted() packets
+   void Decrypt (const OGN_TEAKey &Key) { Key.Decrypt(Position); Key.Decrypt(Position+2); }
 
    int BitErr(OGN_Packet &RefPacket) const // return number of different data bits between this Packet and RefPacket
    { return Count1s(Header^RefPacket.Header)
@@ -182,76 +295,36 @@ class OGN_Packet          // Packet structure for the OGN tracker
      if(Longitude&0x00800000) Longitude|=0xFF000000;
      Longitude = (Longitude<<4)+8; return Longitude; }
 
+   typedef OGN_FloatField<12>       AltitudeField;    // [m]         0..61432
+   typedef OGN_FloatField< 4>       DOPField;         // [0.1]       0..232 (+10)
+   typedef OGN_FloatField< 8>       SpeedField;       // [0.2 knot]  0..3832
+   typedef OGN_FloatField< 5, 2, 1> TurnRateField;    // [0.1 deg/s] +/-472
+   typedef OGN_FloatField< 6, 2, 1> ClimbRateField;   // [0.1 m/s]   +/-952
+   typedef OGN_FloatField< 5, 2, 1> TemperatureField; // [0.5 degC]  +/-472
+
    void EncodeAltitude(int32_t Altitude)        // encode altitude in meters
-   {      if(Altitude<0)      Altitude=0;
-     else if(Altitude<0x1000) { }
-     else if(Altitude<0x3000) Altitude = 0x1000 | ((Altitude-0x1000)>>1);
-     else if(Altitude<0x7000) Altitude = 0x2000 | ((Altitude-0x3000)>>2);
-     else if(Altitude<0xF000) Altitude = 0x3000 | ((Altitude-0x7000)>>3);
-     else                     Altitude = 0x3FFF;
-     Position[2] = (Position[2]&0xFFFFC000) | (Altitude&0x3FFF); }
+   { Position[2] = (Position[2]&0xFFFFC000) | AltitudeField::Encode(Altitude); }
 
    int32_t DecodeAltitude(void) const            // return Altitude in meters
-   { int32_t Altitude =  Position[2]     &0x0FFF;
-     int32_t Range    = (Position[2]>>12)&0x0003;
-     if(Range==0) return         Altitude;       // 0000..0FFF
-     if(Range==1) return 0x1001+(Altitude<<1);   // 1000..2FFE
-     if(Range==2) return 0x3002+(Altitude<<2);   // 3000..6FFC
-                  return 0x7004+(Altitude<<3); } // 7000..EFF8 => max. altitude: 61432 meters
+   { return AltitudeField::Decode(Position[2]&0x3FFF); }
 
    void EncodeDOP(uint8_t DOP)
-   {      if(DOP<0)    DOP=0;
-     else if(DOP<0x10) { }
-     else if(DOP<0x30) DOP = 0x10 | ((DOP-0x10)>>1);
-     else if(DOP<0x70) DOP = 0x20 | ((DOP-0x30)>>2);
-     else if(DOP<0xF0) DOP = 0x30 | ((DOP-0x70)>>3);
-     else              DOP = 0x3F;
-     Position[1] = (Position[1]&0xC0FFFFFF) | ((uint32_t)DOP<<24); }
+   { Position[1] = (Position[1]&0xC0FFFFFF) | (DOPField::Encode(DOP)<<24); }
 
    uint8_t DecodeDOP(void) const
-   { uint8_t DOP   =  (Position[1]>>24)&0x0F;
-     int8_t Range =  (Position[1]>>28)&0x03;
-     if(Range==0) return       DOP;              // 00..0F
-     if(Range==1) return 0x11+(DOP<<1);          // 10..2E
-     if(Range==2) return 0x31+(DOP<<2);          // 30..6C
-                  return 0x74+(DOP<<4); }        // 70..E8 => max. DOP = 232*0.1=23.2
+   { return DOPField::Decode((Position[1]>>24)&0x3F); }
 
    void EncodeSpeed(int16_t Speed)            // speed in 0.2 knots
-   {      if(Speed<0)     Speed=0;
-     else if(Speed<0x100) { }
-     else if(Speed<0x300) Speed = 0x100 | ((Speed-0x100)>>1);
-     else if(Speed<0x700) Speed = 0x200 | ((Speed-0x300)>>2);
-     else if(Speed<0xF00) Speed = 0x300 | ((Speed-0x700)>>3);
-     else                 Speed = 0x3FF;
-     Position[2] = (Position[2]&0xFF003FFF) | ((uint32_t)Speed<<14); }
+   { Position[2] = (Position[2]&0xFF003FFF) | (SpeedField::Encode(Speed)<<14); }
 
    int16_t DecodeSpeed(void) const           // return speed in 0.2 knots units (0.2 knots is about 0.1 m/s)
-   { int16_t Speed = (Position[2]>>14)&0x00FF;
-     int8_t  Range = (Position[2]>>22)&0x0003;
-     if(Range==0) return Speed;              // 000..0FF
-     if(Range==1) return 0x101+(Speed<<1);   // 100..2FE
-     if(Range==2) return 0x302+(Speed<<2);   // 300..6FC
-                  return 0x704+(Speed<<3); } // 700..EF8 => max. speed: 3832*0.2 = 766 knots
+   { return SpeedField::Decode((Position[2]>>14)&0x03FF); }
 
    void EncodeTurnRate(int16_t Turn)
-   { int8_t Sign=0; if(Turn<0) { Turn=(-Turn); Sign=0x80; }
-          if(Turn<0x020) { }
-     else if(Turn<0x060) Turn = 0x020 | ((Turn-0x020)>>1);
-     else if(Turn<0x0E0) Turn = 0x040 | ((Turn-0x060)>>2);
-     else if(Turn<0x1E0) Turn = 0x060 | ((Turn-0x0E0)>>3);
-     else                Turn = 0x07F;
-     Turn |= Sign;
-     Position[2] = (Position[2]&0x00FFFFFF) | ((uint32_t)Turn<<24); }
+   { Position[2] = (Position[2]&0x00FFFFFF) | (TurnRateField::Encode(Turn)<<24); }
 
    int16_t DecodeTurnRate(void) const
-   { int8_t Sign =(Position[2]>>31)&0x01;
-     int8_t Range=(Position[2]>>29)&0x03;
-     int16_t Turn =(Position[2]>>24)&0x1F;
-          if(Range==0) { }                          // 000..01F
-     else if(Range==1) { Turn = 0x021+(Turn<<1); }  // 020..05E
-     else if(Range==2) { Turn = 0x062+(Turn<<2); }  // 060..0DC
-     else              { Turn = 0x0E4+(Turn<<3); }  // 0E0..1D8 => max. turn rate = +/- 472*0.1 = +/- 47.2 deg/s
-     return Sign ? -Turn:Turn; }
+   { return TurnRateField::Decode((Position[2]>>24)&0xFF); }
 
    int16_t DecodeHeading(void) const         // return Heading in 0.1 degree units
    { int32_t Heading = Position[3]&0x3FF;
@@ -262,44 +335,16 @@ class OGN_Packet          // Packet structure for the OGN tracker
      Position[3] = (Position[3]&0xFFFFFC00) | ((Heading&0x3FF)); }
 
    void EncodeClimbRate(int16_t Climb)
-   { int16_t Sign=0; if(Climb<0) { Climb=(-Climb); Sign=0x100; }
-          if(Climb<0x040) { }
-     else if(Climb<0x0C0) Climb = 0x040 | ((Climb-0x040)>>1);
-     else if(Climb<0x1C0) Climb = 0x080 | ((Climb-0x0C0)>>2);
-     else if(Climb<0x3C0) Climb = 0x0C0 | ((Climb-0x1C0)>>3);
-     else                 Climb = 0x0FF;
-     Climb |= Sign;
-     Position[3] = (Position[3]&0xFFF803FF) | ((int32_t)Climb<<10); }
+   { Position[3] = (Position[3]&0xFFF803FF) | (ClimbRateField::Encode(Climb)<<10); }
 
    int16_t DecodeClimbRate(void) const
-   { int32_t Sign =(Position[3]>>18)&0x01;
-     int32_t Range=(Position[3]>>16)&0x03;
-     int32_t Climb=(Position[3]>>10)&0x3F;
-          if(Range==0) { }                            // 000..03F
-     else if(Range==1) { Climb = 0x041+(Climb<<1); }  // 040..0BE
-     else if(Range==2) { Climb = 0x0C2+(Climb<<2); }  // 0C0..1BC
-     else              { Climb = 0x1C4+(Climb<<3); }  // 1C0..3B8 => max. climb rate = +/- 952*0.1 = +/- 95.2 m/s
-     return Sign ? -Climb:Climb; }
+   { return ClimbRateField::Decode((Position[3]>>10)&0x01FF); }
 
    void EncodeTemperature(int16_t Temp)
-   { int8_t Sign=0; if(Temp<0) { Temp=(-Temp); Sign=0x80; }
-          if(Temp<0x020) { }
-     else if(Temp<0x060) Temp = 0x020 | ((Temp-0x020)>>1);
-     else if(Temp<0x0E0) Temp = 0x040 | ((Temp-0x060)>>2);
-     else if(Temp<0x1E0) Temp = 0x060 | ((Temp-0x0E0)>>3);
-     else                Temp = 0x07F;
-     Temp |= Sign;
-     Position[3] = (Position[3]&0x00FFFFFF) | ((int32_t)Temp<<24); }
+   { Position[3] = (Position[3]&0x00FFFFFF) | (TemperatureField::Encode(Temp)<<24); }
 
    int16_t DecodeTemperature(void) const
-   { int8_t Sign =(Position[3]>>31)&0x01;
-     int8_t Range=(Position[3]>>29)&0x03;
-     int16_t Temp =(Position[3]>>24)&0x1F;
-          if(Range==0) { }                          // 000..01F
-     else if(Range==1) { Temp = 0x021+(Temp<<1); }  // 020..05E
-     else if(Range==2) { Temp = 0x062+(Temp<<2); }  // 060..0DC
-     else              { Temp = 0x0E4+(Temp<<3); }  // 0E0..1D8 => max. temperature = +/- 472*0.5 = +/- 236 degC
-     return Sign ? -Temp:Temp; }
+   { return TemperatureField::Decode((Position[3]>>24)&0xFF); }
 
    static void TEA_Encrypt (uint32_t* Data, const uint32_t *Key, int Loops=4)
    { uint32_t v0=Data[0], v1=Data[1];                         // set up
@@ -312,7 +357,7 @@ class OGN_Packet          // Packet structure for the OGN tracker
      Data[0]=v0; Data[1]=v1;
    }
 
-   void TEA_Decrypt (uint32_t* Data, const uint32_t *Key, int Loops=4)
+   static void TEA_Decrypt (uint32_t* Data, const uint32_t *Key, int Loops=4)
    { uint32_t v0=Data[0], v1=Data[1];                           // set up
      const uint32_t delta=0x9e3779b9; uint32_t sum=delta*Loops; // a key schedule constant
      uint32_t k0=Key[0], k1=Key[1], k2=Key[2], k3=Key[3];       // cache key
@@ -333,7 +378,7 @@ class OGN_Packet          // Packet structure for the OGN tracker
      Data[0]=v0; Data[1]=v1;
    }
 
-   void TEA_Decrypt_Key0 (uint32_t* Data, int Loops=4)
+   static void TEA_Decrypt_Key0 (uint32_t* Data, int Loops=4)
    { uint32_t v0=Data[0], v1=Data[1];                           // set up
      const uint32_t delta=0x9e3779b9; uint32_t sum=delta*Loops; // a key schedule constant
      for (int i=0; i < Loops; i++)                              // basic cycle start */
@@ -345,6 +390,146 @@ class OGN_Packet          // Packet structure for the OGN tracker
 
 } ;
 
+// TEA on many 64-bit blocks at Data, Data+Stride, ... (in place): the one-block functions of OGN_Packet on every block,
+// Key=0 gives TEA_Encrypt_Key0()/TEA_Decrypt_Key0(). The scalar fallback of the SIMD versions in tea_simd.h.
+
+inline void TEA_EncryptBatch(uint32_t *Data, int Blocks, const uint32_t *Key=0, int Loops=4, uint16_t Stride=2)
+{ if(Key) { for( ; Blocks>0; Blocks--, Data+=Stride) OGN_Packet::TEA_Encrypt(Data, Key, Loops); }
+     else { for( ; Blocks>0; Blocks--, Data+=Stride) OGN_Packet::TEA_Encrypt_Key0(Data, Loops); } }
+
+inline void TEA_DecryptBatch(uint32_t *Data, int Blocks, const uint32_t *Key=0, int Loops=4, uint16_t Stride=2)
+{ if(Key) { for( ; Blocks>0; Blocks--, Data+=Stride) OGN_Packet::TEA_Decrypt(Data, Key, Loops); }
+     else { for( ; Blocks>0; Blocks--, Data+=Stride) OGN_Packet::TEA_Decrypt_Key0(Data, Loops); } }
+
+inline void OGN_WhitenBatch(OGN_Packet *Pkt, int Packets)          // Whiten() on every packet
+{ const uint16_t Stride = sizeof(OGN_Packet)/sizeof(uint32_t);
+  TEA_EncryptBatch(Pkt->Position, Packets, 0, 8, Stride); TEA_EncryptBatch(Pkt->Position+2, Packets, 0, 8, Stride); }
+
+inline void OGN_DewhitenBatch(OGN_Packet *Pkt, int Packets)        // Dewhiten() on every packet
+{ const uint16_t Stride = sizeof(OGN_Packet)/sizeof(uint32_t);
+  TEA_DecryptBatch(Pkt->Position, Packets, 0, 8, Stride); TEA_DecryptBatch(Pkt->Position+2, Packets, 0, 8, Stride); }
+
+// Flags[] of OgnDecodedSoA: the header byte as it is (ECRR PMTT) followed by the other single-bit and short fields
+#define OGN_SOA_EMERGENCY   0x80000000
+#define OGN_SOA_ENCRYPTED   0x40000000  // position fields are not valid: they can not be dewhitened
+#define OGN_SOA_RELAY       0x30000000  // relay count: >>28
+#define OGN_SOA_METEO       0x04000000
+#define OGN_SOA_ADDR_TYPE   0x03000000  // address type: >>24
+#define OGN_SOA_ACFT_TYPE   0x00F00000  // aircraft type: >>20
+#define OGN_SOA_PRIVATE     0x00080000
+#define OGN_SOA_BARO        0x00040000
+#define OGN_SOA_FIX_MODE    0x00020000  // 0 = 2-D, 1 = 3-D
+#define OGN_SOA_FIX_QUAL    0x00018000  // fix quality: >>15
+
+// Decoded packets as one array per field (element #Idx of every array comes from packet #Idx),
+// in the units of the OGN_Packet::Decode...() calls. The arrays belong to the caller:
+// Assign() can carve them out of one buffer of Size() bytes, every array aligned to 32 bytes for SIMD loads.
+struct OgnDecodedSoA
+{  uint32_t *Address;    // 24-bit address
+   uint32_t *Flags;      // OGN_SOA_...
+   int32_t  *Latitude;   // [0.0001/60 deg]
+   int32_t  *Longitude;  // [0.0001/60 deg]
+   int32_t  *Altitude;   // [m]
+   int16_t  *Speed;      // [0.2 knot]
+   int16_t  *Heading;    // [0.1 deg]
+   int16_t  *ClimbRate;  // [0.1 m/s]
+   int16_t  *TurnRate;   // [0.1 deg/s]
+   uint8_t  *Time;       // [sec] lower 6 bits
+   uint8_t  *DOP;        // [0.1] DOP minus 1.0
+
+   static size_t ArraySize(size_t Count, size_t ElemSize) { return (Count*ElemSize+31)&~(size_t)31; }
+
+   static size_t Size(size_t Count)                        // bytes for Count packets, including the alignment of the buffer
+   { return 5*ArraySize(Count, 4) + 4*ArraySize(Count, 2) + 2*ArraySize(Count, 1) + 31; }
+
+   void Assign(void *Buffer, size_t Count)
+   { uint8_t *Ptr = (uint8_t *)(((uintptr_t)Buffer+31)&~(uintptr_t)31);
+     Address   = (uint32_t *)Ptr; Ptr+=ArraySize(Count, 4);
+     Flags     = (uint32_t *)Ptr; Ptr+=ArraySize(Count, 4);
+     Latitude  = (int32_t  *)Ptr; Ptr+=ArraySize(Count, 4);
+     Longitude = (int32_t  *)Ptr; Ptr+=ArraySize(Count, 4);
+     Altitude  = (int32_t  *)Ptr; Ptr+=ArraySize(Count, 4);
+     Speed     = (int16_t  *)Ptr; Ptr+=ArraySize(Count, 2);
+     Heading   = (int16_t  *)Ptr; Ptr+=ArraySize(Count, 2);
+     ClimbRate = (int16_t  *)Ptr; Ptr+=ArraySize(Count, 2);
+     TurnRate  = (int16_t  *)Ptr; Ptr+=ArraySize(Count, 2);
+     Time      = (uint8_t  *)Ptr; Ptr+=ArraySize(Count, 1);
+     DOP       = (uint8_t  *)Ptr; }
+} ;
+
+// dewhiten and unpack n received packets: every Position[] word is loaded once and all its fields
+// are taken from the register, instead of one Decode...() call per field. The packets are not modified.
+// Encrypted packets are not dewhitened: OGN_SOA_ENCRYPTED is set and their position fields are not valid.
+// Packets go in chunks of OGN_BATCH_CHUNK: the position words of a chunk are transposed into lanes,
+// thus the TEA rounds run over independent packets (the compiler can vectorize them) and the data stays in L1.
+// Returns the number of packets with valid positions.
+#ifndef OGN_BATCH_CHUNK
+#define OGN_BATCH_CHUNK 16
+#endif
+
+inline size_t OGN_DecodeBatch(const OGN_Packet *Pkts, size_t n, OgnDecodedSoA *Out)
+{ size_t Valid=0;
+  uint32_t *Address=Out->Address, *Flags=Out->Flags;                  // local copies: stores to the arrays can not alias them
+  int32_t  *Latitude=Out->Latitude, *Longitude=Out->Longitude, *Altitude=Out->Altitude;
+  int16_t  *Speed=Out->Speed, *Heading=Out->Heading, *ClimbRate=Out->ClimbRate, *TurnRate=Out->TurnRate;
+  uint8_t  *Time=Out->Time, *DOP=Out->DOP;
+  uint32_t Pos[4][OGN_BATCH_CHUNK] = { { 0 } };                        // Pos[Word][Lane], unused lanes of the last chunk stay defined
+  for(size_t Base=0; Base<n; Base+=OGN_BATCH_CHUNK)
+  { size_t Lanes = n-Base<OGN_BATCH_CHUNK ? n-Base:OGN_BATCH_CHUNK;
+    for(size_t Lane=0; Lane<Lanes; Lane++)
+      for(int Word=0; Word<4; Word++) Pos[Word][Lane]=Pkts[Base+Lane].Position[Word];
+    for(int Pair=0; Pair<4; Pair+=2)                                   // as Dewhiten(): TEA_Decrypt_Key0(.., 8) on both word pairs
+    { uint32_t *V0=Pos[Pair], *V1=Pos[Pair+1];
+      uint32_t Sum=TEA_DELTA*8;
+      for(int Loop=0; Loop<8; Loop++, Sum-=TEA_DELTA)
+        for(int Lane=0; Lane<OGN_BATCH_CHUNK; Lane++)                  // full chunk: a fixed count vectorizes better
+        { V1[Lane] -= (V0[Lane]<<4) ^ (V0[Lane] + Sum) ^ (V0[Lane]>>5);
+          V0[Lane] -= (V1[Lane]<<4) ^ (V1[Lane] + Sum) ^ (V1[Lane]>>5); } }
+    for(size_t Lane=0; Lane<Lanes; Lane++)
+    { size_t Idx=Base+Lane;
+      uint32_t Header=Pkts[Idx].Header;
+      uint32_t P0=Pos[0][Lane], P1=Pos[1][Lane], P2=Pos[2][Lane], P3=Pos[3][Lane];
+      if(Header&OGN_SOA_ENCRYPTED)
+      { P0=Pkts[Idx].Position[0]; P1=Pkts[Idx].Position[1]; P2=Pkts[Idx].Position[2]; P3=Pkts[Idx].Position[3]; }
+      else Valid++;
+      Address[Idx]   = Header&0x00FFFFFF;
+      Flags[Idx]     = (Header&0xFF000000) | (P3&0x00F80000)             // acft type and private are already in place
+                     | ((P1>>12)&OGN_SOA_BARO) | ((P1>>14)&OGN_SOA_FIX_MODE) | ((P0>>15)&OGN_SOA_FIX_QUAL);
+      Latitude[Idx]  = ((int32_t)(P0<<8)>>5) + 4;                        // 24-bit field: sign extended and scaled by 8
+      Longitude[Idx] = ((int32_t)(P1<<8)>>4) + 8;                        // scaled by 16
+      Altitude[Idx]  = OGN_Packet::AltitudeField::Decode(P2&0x3FFF);
+      Speed[Idx]     = OGN_Packet::SpeedField::Decode((P2>>14)&0x03FF);
+      TurnRate[Idx]  = OGN_Packet::TurnRateField::Decode(P2>>24);
+      Heading[Idx]   = ((P3&0x3FF)*3600+512)>>10;
+      ClimbRate[Idx] = OGN_Packet::ClimbRateField::Decode((P3>>10)&0x01FF);
+      Time[Idx]      = (P0>>24)&0x3F;
+      DOP[Idx]       = OGN_Packet::DOPField::Decode((P1>>24)&0x3F); }
+  }
+  return Valid; }
+
+// cosine for the position extrapolation: 1-degree table, scaled by 1<<14
+static const int16_t OGN_CosTable[91] =
+{ 16384, 16382, 16374, 16362, 16344, 16322, 16294, 16262, 16225, 16182,
+  16135, 16083, 16026, 15964, 15897, 15826, 15749, 15668, 15582, 15491,
+  15396, 15296, 15191, 15082, 14968, 14849, 14726, 14598, 14466, 14330,
+  14189, 14044, 13894, 13741, 13583, 13421, 13255, 13085, 12911, 12733,
+  12551, 12365, 12176, 11982, 11786, 11585, 11381, 11174, 10963, 10749,
+  10531, 10311, 10087,  9860,  9630,  9397,  9162,  8923,  8682,  8438,
+   8192,  7943,  7692,  7438,  7182,  6924,  6664,  6402,  6138,  5872,
+   5604,  5334,  5063,  4790,  4516,  4240,  3964,  3686,  3406,  3126,
+   2845,  2563,  2280,  1997,  1713,  1428,  1143,   857,   572,   286,
+      0 } ;
+
+inline int16_t OGN_Icos(int32_t Angle)                              // Angle in 0.1 deg, result scaled by 1<<14, linear interpolation between the degrees
+{ Angle%=3600; if(Angle<0) Angle+=3600;
+  if(Angle>1800) Angle=3600-Angle;                                  // cos(-x) = cos(x)
+  int16_t Sign=1; if(Angle>900) { Angle=1800-Angle; Sign=(-1); }    // cos(180-x) = -cos(x)
+  int32_t Deg=Angle/10, Frac=Angle-Deg*10;
+  int32_t Cos=OGN_CosTable[Deg];
+  if(Frac) Cos+=((OGN_CosTable[Deg+1]-Cos)*Frac)/10;
+  return Sign*Cos; }
+
+inline int16_t OGN_Isin(int32_t Angle) { return OGN_Icos(Angle-900); }
 
 class OgnPosition
 { public:
@@ -532,6 +717,27 @@ class OgnPosition
      TurnRate=TurnRate/TimeDiff;
      return TimeDiff; }
 
+   void Predict(int32_t &Lat, int32_t &Lon, int32_t &Alt, int32_t Delta_ms) const // extrapolate the position Delta_ms ahead along speed, heading, turn and climb rate
+   { int32_t Track = Heading + OGN_Packet::RoundDiv((int32_t)TurnRate*Delta_ms, 2000); // [0.1 deg] mean heading over the interval: follows the arc of a steady turn
+     int32_t Dist  = (int32_t)Speed*Delta_ms;                        // [0.1 knot*ms]: 3600 of these are 0.0001 minute of latitude
+     int32_t North = ((int64_t)Dist*OGN_Icos(Track))>>14;
+     int32_t East  = ((int64_t)Dist*OGN_Isin(Track))>>14;
+     int32_t CosLat = OGN_Icos(OGN_Packet::RoundDiv(Latitude, 60000)); if(CosLat<256) CosLat=256; // [0.1 deg] latitude, stop short of the poles
+     Lat = Latitude  + OGN_Packet::RoundDiv(North, 3600);
+     Lon = Longitude + OGN_Packet::RoundDiv(OGN_Packet::RoundDiv(East, 225)*1024, CosLat); // East/225 in 1/16 units keeps the precision within 32 bits
+     Alt = Altitude  + OGN_Packet::RoundDiv((int32_t)ClimbRate*Delta_ms, 1000); }
+
+   void EncodePredicted(OGN_Packet &Packet, int32_t Delta_ms) const // for a packet made by Encode(): re-encode time, position and heading Delta_ms later
+   { int32_t Lat, Lon, Alt; Predict(Lat, Lon, Alt, Delta_ms);
+     int32_t Time = (int32_t)Sec*1000 + (int32_t)FracSec*10 + Delta_ms + 500; // [ms] rounded to the nearest second, as Encode()
+     Packet.setTime((Time/1000)%60);
+     Packet.EncodeLatitude(Lat);
+     Packet.EncodeLongitude(Lon);
+     Packet.EncodeAltitude((Alt+5)/10);
+     int32_t Hdg = Heading + OGN_Packet::RoundDiv((int32_t)TurnRate*Delta_ms, 1000);
+     Hdg%=3600; if(Hdg<0) Hdg+=3600;
+     Packet.EncodeHeading(Hdg); }
+
    int8_t Encode(OGN_Packet &Packet) const
    { Packet.setFixQuality(FixQuality<3 ? FixQuality:3);
      if((FixQuality>0)&&(FixMode>1)) Packet.setFixMode(FixMode-2);
@@ -726,6 +932,9 @@ class OgnPosition
 
   public:
 
+   int32_t getDayTime_ms(void) const                        // [ms] time-of-day (UTC)
+   { return (((int32_t)Hour*60+Min)*60+Sec)*1000 + (int32_t)FracSec*10; }
+
    uint32_t getUnixTime(void)                               // return the Unix timestamp (tested 2000-2099)
    { uint16_t Days = DaysSince00() + DaysSimce1jan();
      return Times60(Times60(Times24((uint32_t)(Days+10957)))) + Times60((uint32_t)(Times60((uint16_t)Hour) + Min)) + Sec; }
@@ -764,5 +973,126 @@ class OgnPosition
 
 } ;
 
+// Least-squares straight line through a window of samples of a few quantities at a time: the sums are updated
+// as samples enter and leave the window, thus O(1) per sample for any window. The integer sums are exact,
+// nothing drifts however long it runs, and Rebase() keeps them small by moving the origin to the oldest sample.
+template <uint8_t Channels>
+ class OGN_LinFit
+{ public:
+   int32_t Count;                                // samples in the fit
+   int32_t Time0, Value0[Channels];              // origin: times and values are summed relative to it
+   int64_t SumT, SumTT, SumY[Channels], SumTY[Channels];
+
+  public:
+   void Clear(void)
+   { Count=0; Time0=0; SumT=0; SumTT=0;
+     for(uint8_t Ch=0; Ch<Channels; Ch++) { Value0[Ch]=0; SumY[Ch]=0; SumTY[Ch]=0; } }
+
+   void Add(int32_t Time, const int32_t *Value)  // Time in [ms]
+   { if(Count==0) { Time0=Time; for(uint8_t Ch=0; Ch<Channels; Ch++) Value0[Ch]=Value[Ch]; }
+     int64_t T=Time-Time0; Count++; SumT+=T; SumTT+=T*T;
+     for(uint8_t Ch=0; Ch<Channels; Ch++)
+     { int64_t Y=Value[Ch]-Value0[Ch]; SumY[Ch]+=Y; SumTY[Ch]+=T*Y; } }
+
+   void Remove(int32_t Time, const int32_t *Value) // a sample given before to Add()
+   { int64_t T=Time-Time0; Count--; SumT-=T; SumTT-=T*T;
+     for(uint8_t Ch=0; Ch<Channels; Ch++)
+     { int64_t Y=Value[Ch]-Value0[Ch]; SumY[Ch]-=Y; SumTY[Ch]-=T*Y; } }
+
+   void Rebase(int32_t Time, const int32_t *Value) // t'=t-D, y'=y-C for every sample: same fit, smaller sums
+   { int64_t D=Time-Time0;
+     for(uint8_t Ch=0; Ch<Channels; Ch++)
+     { int64_t C=Value[Ch]-Value0[Ch];
+       SumTY[Ch] += Count*D*C - C*SumT - D*SumY[Ch];
+       SumY[Ch]  -= Count*C; Value0[Ch]=Value[Ch]; }
+     SumTT += Count*D*D - 2*D*SumT;
+     SumT  -= Count*D; Time0=Time; }
+
+   int32_t Slope(uint8_t Ch, int32_t Scale) const // [units per ms]*Scale, zero with less than two distinct times
+   { if(Count<2) return 0;
+     int64_t Den = Count*SumTT - SumT*SumT; if(Den<=0) return 0;
+     int64_t Num = (Count*SumTY[Ch] - SumT*SumY[Ch])*Scale;
+     return Num>=0 ? (Num+Den/2)/Den : (Num-Den/2)/Den; }
+} ;
+
+// The last Size fixes (a power of two) indexed by their time, and the least-squares climb and turn rate over the fixes
+// of the last Window ms: works the same at 1 Hz and at 10 Hz. A turn rate fitted to fewer than TurnFitMin fixes is
+// noisier than the difference to the previous fix (1 Hz GPS), that is then used instead. Head() is being filled from the
+// NMEA, Commit() enters it into the history when it is complete and valid.
+template <uint8_t Size>
+ class OgnPosHistory
+{ public:
+   static const uint8_t Mask = Size-1;
+   static const uint8_t Alt=0, Hdg=1;            // fit channels: altitude, unwrapped heading
+   static const uint8_t TurnFitMin=5;            // fewer fixes in the fit: the turn rate is the two-fix difference
+
+   OgnPosition Pos[Size];
+   int32_t     Time[Size];                       // [ms] fix time: time-of-day, continued over midnight
+   int32_t     Value[Size][2];                   // fit inputs of every committed fix
+   uint8_t     Ptr;                              // Pos[Ptr] is being filled from the NMEA
+   uint8_t     Count;                            // committed fixes before Ptr, at most Size-1
+   uint8_t     FitCount;                         // the newest of them which are in the fit
+   int32_t     Window;                           // [ms]
+   int32_t     DayOfs;                           // [ms] added to the time-of-day: one day per midnight
+   OGN_LinFit<2> Fit;
+
+  public:
+   OgnPosHistory(int32_t FitWindow=3000) { Clear(FitWindow); }
+
+   void Clear(int32_t FitWindow)
+   { for(uint8_t Idx=0; Idx<Size; Idx++) Pos[Idx].Clear();
+     Ptr=0; Count=0; FitCount=0; Window=FitWindow; DayOfs=0; Fit.Clear(); }
+
+         OgnPosition &Head(void)       { return Pos[Ptr]; }
+   const OgnPosition &Last(uint8_t Back=0) const { return Pos[(Ptr-1-Back)&Mask]; } // Back < Count
+   int32_t        getTime(uint8_t Back=0) const { return Time[(Ptr-1-Back)&Mask]; }
+
+   const OgnPosition *Find(int32_t Time_ms) const // the newest fix not later than Time_ms: NULL if all are later
+   { uint8_t Lo=0, Hi=Count;                     // fixes are ordered in time: binary search on the age
+     while(Lo<Hi)
+     { uint8_t Mid=(Lo+Hi)>>1;
+       if(getTime(Mid)<=Time_ms) Hi=Mid; else Lo=Mid+1; }
+     return Lo<Count ? &Last(Lo):0; }
+
+   int32_t Commit(void)                          // enter Head(), set its climb and turn rate: return [ms] since the previous fix, -1 if none
+   { OgnPosition &New=Pos[Ptr];
+     int32_t Now=New.getDayTime_ms()+DayOfs, Delta=-1;
+     if(Count)
+     { int32_t Prev=getTime();
+       if(Now<Prev-43200000) { DayOfs+=86400000; Now+=86400000; } // passed midnight
+       Delta=Now-Prev;
+       if(Delta<0) { Count=0; Delta=-1; } }       // time went back (GPS restart): Find() needs the fixes in time order
+     int32_t *Val=Value[Ptr];
+     Val[Alt]=New.Altitude; Val[Hdg]=New.Heading;
+     if(Count)
+     { int32_t Turn=New.Heading-Last().Heading;
+       if(Turn>1800) Turn-=3600; else if(Turn<(-1800)) Turn+=3600;
+       Val[Hdg]=Value[(Ptr-1)&Mask][Hdg]+Turn; }  // heading unwrapped: keeps counting over full circles
+     if(Delta<=0 || Delta>Window) { Fit.Clear(); FitCount=0; } // first fix, time went back or a gap: start again
+     while(FitCount && (FitCount>=Size-1 || Now-Time[(Ptr-FitCount)&Mask]>Window))
+     { uint8_t Old=(Ptr-FitCount)&Mask; Fit.Remove(Time[Old], Value[Old]); FitCount--; }
+     if(FitCount) { uint8_t Old=(Ptr-FitCount)&Mask; Fit.Rebase(Time[Old], Value[Old]); }
+     Time[Ptr]=Now; Fit.Add(Now, Val); FitCount++;
+     if(2*(Now-Time[(Ptr+1-FitCount)&Mask])>=Window)
+     { New.ClimbRate=getClimbRate();
+       New.TurnRate = FitCount>=TurnFitMin ? getTurnRate():getTurnDiff(); }
+     else { New.ClimbRate=0; New.TurnRate=0; }   // too short a fit: GPS noise over 0.1 s is no climb rate
+     Ptr=(Ptr+1)&Mask; if(Count<Size-1) Count++;
+     Pos[Ptr]=New; Pos[Ptr].Flags&=0xFE;         // next fix starts from this one: a late sentence can not complete it
+     return Delta; }
+
+   int16_t getClimbRate(void) const { return Fit.Slope(Alt, 1000); }  // [0.1 m/s]
+   int16_t getTurnRate(void)  const { return Fit.Slope(Hdg, 1000); }  // [0.1 deg/s]
+
+   int16_t getTurnDiff(void) const               // [0.1 deg/s] Pos[Ptr] being committed against the fix before it
+   { if(FitCount<2) return 0;
+     uint8_t Ref=(Ptr-1)&Mask;
+     int32_t Dt=Time[Ptr]-Time[Ref]; if(Dt<=0) return 0;
+     return OGN_Packet::RoundDiv((Value[Ptr][Hdg]-Value[Ref][Hdg])*1000, Dt); }
+
+   int16_t getGroundSpeed(void) const { return Last().Speed; } // [0.1 knot] the GPS (Doppler) speed: the slope of the fitted
+                                                 // positions is 20x worse with 0.5 m position noise (ogn_sim nmea)
+} ;
+
 #endif // of __OGN_H__
 
@@ -1,87 +1,270 @@
 #include <FreeRTOS.h>
 #include <semphr.h>
+#include <task.h>
 
 #include "ogn_lib.h"
+#include "cycle_cnt.h"
+#include "clock.h"
+
+#define LDPC_MINSUM_MAX_ITER OGN_RX_MAX_ITER
 #include "ogn.h"
+#include "manchester.h"
+#include "snapshot.h"
 
 /* -------- defines -------- */
+#define TX_FRESH  0x80              // TxReady flag: published since the last OGN_GetTxPacket()
 /* -------- variables -------- */
-static int         PosPtr=0;        // round buffer pointer
-static OgnPosition Position[4];     // keep a round-buffer of four positions
-static OGN_Packet  Packet;          // encoded OGN packet
+static OgnPosHistory<OGN_POS_HISTORY> Position(OGN_FIT_WINDOW_MS); // the last fixes and the one being read from the NMEA: GPS task only
+static Snapshot<OgnPosition> PosSnap; // latest complete position for the readers
+static OGN_PosStats_t PosStats;
+struct OGN_TxFrame                 // a fix ready to be sent: packet encoded but not whitened, the fix itself for the extrapolation
+{ OGN_Packet  Packet;
+  OgnPosition Pos;
+  int32_t     Epoch;                // [ms] UTC time-of-day of the fix
+  TickType_t  Time; } ;             // tick of the NMEA arrival: the age of the fix when the UTC clock is not running
+
+static OGN_TxFrame TxFrame[3];      // triple buffer of fixes: one being written, one ready, one being sent
+static OGN_Packet  TxOut;           // packet extrapolated to the transmit time: SP1 task only
+static uint8_t     TxWrite=0;       // buffer being prepared: GPS task only
+static uint8_t     TxReady=1;       // latest complete buffer (+TX_FRESH when not yet picked up): exchanged atomically
+static uint8_t     TxRead=2;        // buffer being sent: SP1 task only
+static uint8_t     TxValid=0;       // anything published yet ?
 static uint32_t    AcftID;
+static Snapshot<OGN_TEAKey> EncrKey; // zero key: no encryption. The SP1 task decides and encrypts with one whole copy of the 16 bytes
+static OGN_TxStats_t TxStats;
 
 static SemaphoreHandle_t xOgnPosMutex = 0;
 
+static LDPC_MinSumDecoder RxDecoder; // for the received packets: too big for the task stack
+static LDPC_BitFlipDecoder RxBitFlip; // first stage for packets with a few bit errors
+static OGN_RxStats_t RxStats;
+
 /* -------- functions -------- */
+static void OGN_PreparePacket(const OgnPosition &Pos);
 
 uint8_t OGN_Init(void)
 { xOgnPosMutex = xSemaphoreCreateMutex();
-  for(int Pos=0; Pos<4; Pos++)
-    Position[Pos].Clear();
-  PosPtr=0;
-  Packet.Clear();
+  Position.Clear(OGN_FIT_WINDOW_MS);
+  for(int Buf=0; Buf<3; Buf++)
+    TxFrame[Buf].Packet.Clear();
+  TxOut.Clear();
+  TxWrite=0; TxReady=1; TxRead=2; TxValid=0;
   AcftID = 0;
+  cycle_cnt_init();
   return 0; }
 
 void OGN_SetAcftID(uint32_t id)
 { AcftID = id; }
 
+void OGN_SetEncryptKey(const uint32_t *key)                        // takes effect with the next packet
+{ xSemaphoreTake(xOgnPosMutex, portMAX_DELAY);
+  const uint32_t Zero[4] = { 0, 0, 0, 0 };
+  OGN_TEAKey Key; Key.Set(key ? key:Zero);
+  EncrKey.Write(Key);                                               // writers are serialized by the mutex
+  xSemaphoreGive(xOgnPosMutex); }
+
+uint16_t OGN_GetEncryptKeyCheck(void)
+{ OGN_TEAKey Key; EncrKey.Read(Key);
+  return Key.isZero() ? 0:Key.Check(); }
+
+
+static uint32_t FixFirst;                                          // Clock_Count() at the first sentence of the fix in Head()
+
+static OGN_Parse_res_t OGN_Update_Position(int Ret, int32_t Prev, uint32_t Arrival) // Ret = what ReadNMEA() returned, Prev = Head() time before it,
+{ if(Position.Head().getDayTime_ms()!=Prev) FixFirst=Arrival;      // called with xOgnPosMutex taken. A new time: the first sentence of a fix
+  if(Ret<0)                                return OGN_PARSE_BAD_NMEA;           // bad NMEA
+  if(Ret==0)                               return OGN_PARSE_NO_USEFUL_NMEA;     // no useful NMEA
+  if(!Position.Head().isComplete())        return OGN_PARSE_POS_NOT_COMPLETE;   // position is not yet complete, but the NMEA was useful
+  if(!Position.Head().isValid())
+  { PosSnap.Write(Position.Head());                                // readers see the time even without a fix
+    return OGN_PARSE_POS_NOT_VALID; }                              // position is complete, but not valid (no GPS fix)
+  Clock_SetUTC(Position.Head().getUnixTime(), Position.Head().FracSec*10, FixFirst); // which UTC second the PPS count is
+  int32_t Delta=Position.Commit();                                 // least-squares climb and turn rate over the last OGN_FIT_WINDOW_MS
+  PosSnap.Write(Position.Last());
+  OGN_PreparePacket(Position.Last());                              // encode and publish right away: TX picks up the latest complete packet
+  return Delta<=5000? OGN_PARSE_POS_VALID_CURRENT:OGN_PARSE_POS_VALID_5SECS_AGO; } // GPS lock: check age (if 5 seconds ago)
 
 OGN_Parse_res_t OGN_Parse_NMEA(const char* str, uint8_t len)                   // process NMEA from the GPS
-{ 
-  OGN_Parse_res_t ret_value;
+{ uint32_t Arrival=Clock_Count();                                 // typed on the console: arrives now
   xSemaphoreTake(xOgnPosMutex, portMAX_DELAY);
-  int Delta; int PrevPtr;
-  int Ret=Position[PosPtr].ReadNMEA(str);
-  if(Ret<0)                                { ret_value = OGN_PARSE_BAD_NMEA;         goto Exit; }  // bad NMEA
-  if(Ret==0)                               { ret_value = OGN_PARSE_NO_USEFUL_NMEA;   goto Exit; }  // no useful NMEA 
-  if(!Position[PosPtr].isComplete())       { ret_value = OGN_PARSE_POS_NOT_COMPLETE; goto Exit; }  // position is not yet complete, but the NMEA was useful
-  if(!Position[PosPtr].isValid())          { ret_value = OGN_PARSE_POS_NOT_VALID;    goto Exit; }  // position is complete, but not valid (no GPS fix)
-  PrevPtr=(PosPtr+2)&3; Delta=0;                                   // current position is complete and valid: look two position earlier
-  if(Position[PrevPtr].isValid())
-  { Delta=Position[PosPtr].calcDifferences(Position[PrevPtr]); }
-  else
-  { PrevPtr=(PosPtr+3)&3;
-    Delta=Position[PosPtr].calcDifferences(Position[PrevPtr]); }
-  PosPtr=(PosPtr+1)&3; ret_value=Delta<=5? OGN_PARSE_POS_VALID_CURRENT:OGN_PARSE_POS_VALID_5SECS_AGO; // GPS lock: check age (if 5 seconds ago)
-                                                                 
- Exit:
+  int32_t Prev=Position.Head().getDayTime_ms();
+  OGN_Parse_res_t ret_value = OGN_Update_Position(Position.Head().ReadNMEA(str), Prev, Arrival);
   xSemaphoreGive(xOgnPosMutex);
   return ret_value; }
 
+OGN_Parse_res_t OGN_Parse_NMEA_Msg(void *msg)                      // process NMEA already indexed by OGN_NMEA_ProcessByte()
+{ NMEA_RxMsg *Msg = (NMEA_RxMsg *)msg;
+  if(!Msg->isChecked()) return OGN_PARSE_BAD_NMEA;                 // check-sum was accumulated as the bytes arrived
+  xSemaphoreTake(xOgnPosMutex, portMAX_DELAY);
+  int32_t Prev=Position.Head().getDayTime_ms();
+  OGN_Parse_res_t ret_value = OGN_Update_Position(Position.Head().ReadNMEA(*Msg), Prev, Msg->Time); // dispatch once on the sentence type
+  xSemaphoreGive(xOgnPosMutex);
+  return ret_value; }
+
+uint16_t OGN_NMEA_MsgSize(void)
+{ return sizeof(NMEA_RxMsg); }
+
+void* OGN_NMEA_MsgInit(void *msg)
+{ ((NMEA_RxMsg *)msg)->Clear();
+  return msg; }
+
+uint8_t OGN_NMEA_ProcessByte(void *msg, uint8_t byte)              // called from the USART ISR for every received byte
+{ NMEA_RxMsg *Msg = (NMEA_RxMsg *)msg;
+  if(byte=='$') { Msg->Clear(); Msg->Time=Clock_Count(); }         // a new sentence always starts at '$', drop any unfinished one
+  Msg->ProcessByte(byte);                                          // commas are indexed and the check-sum accumulated on the fly
+  return Msg->isComplete(); }
+
+void OGN_NMEA_SetTime(void *msg, uint32_t cnt)                    // Clock_Count() at the '$' when the bytes are framed later than they arrive
+{ ((NMEA_RxMsg *)msg)->Time=cnt; }
+
+const char* OGN_NMEA_Sentence(const void *msg, uint8_t *len)       // text of the sentence (without CR/LF)
+{ const NMEA_RxMsg *Msg = (const NMEA_RxMsg *)msg;
+  if(len) *len = Msg->Len;
+  if(Msg->Len>=NMEA_RxMsg::MaxLen) return 0;                       // no room for the terminating null
+  return (const char *)Msg->Data; }
+
 uint32_t OGN_GetPosition(char *Output)                             // print into a string current position and other GPS data
-{ xSemaphoreTake(xOgnPosMutex, portMAX_DELAY);
-  int Ptr=PosPtr; if(Output) Output[0]=0;
-  if(Position[Ptr].isComplete())
-  { if(Output) Position[Ptr].PrintLine(Output); }
+{ OgnPosition Pos; uint32_t Retries=0;
+  uint32_t Start=cycle_cnt_get();
+#ifdef OGN_POS_USE_MUTEX
+  xSemaphoreTake(xOgnPosMutex, portMAX_DELAY);                     // waits for the GPS task to finish a sentence
+  Pos=PosSnap.Current();
+  xSemaphoreGive(xOgnPosMutex);
+#else
+  Retries=PosSnap.Read(Pos);                                       // never waits: retries only if a fix was published meanwhile
+#endif
+  uint32_t Cycles=cycle_cnt_get()-Start;
+  PosStats.reads++; PosStats.retries+=Retries;                     // statistics: races between readers are harmless
+  PosStats.wait_cycles_last=Cycles;
+  if(Cycles>PosStats.wait_cycles_max) PosStats.wait_cycles_max=Cycles;
+  if(Output)
+  { Output[0]=0;
+    if(Pos.isComplete()) Pos.PrintLine(Output); }                  // the printing takes long: the GPS task is not held up by it
+  return Pos.getUnixTime(); }
+
+const OGN_PosStats_t* OGN_GetPosStats(void)
+{ return &PosStats; }
+
+void OGN_ClearPosStats(void)
+{ memset(&PosStats, 0, sizeof(PosStats)); }
+
+static void OGN_PreparePacket(const OgnPosition &Pos)              // encode Pos into the write buffer and publish it, called with xOgnPosMutex taken
+{ OGN_TxFrame &Frame = TxFrame[TxWrite];
+  OGN_Packet &Packet = Frame.Packet;
+  uint32_t Address  =  AcftID     &0x00FFFFFF;                     // split ID into elements
+  uint8_t  AddrType = (AcftID>>24)&0x03;
+  uint8_t  AcftType = (AcftID>>26)&0x1F;
+  uint8_t  Private  = (AcftID>>31)&0x01;
+
+  Packet.setAddress(Address); Packet.setAddrType(AddrType); Packet.clrMeteo(); Packet.calcAddrParity();
+  Packet.clrEmergency(); Packet.setRelayCount(0);                  // no emergency source yet: OGN_GetTxPacket() sends emergencies plain
+  Packet.clrEncrypted();                                            // OGN_GetTxPacket() sets it with the key it encrypts with
+  Pos.Encode(Packet);                                               // encode position into the packet
+  Packet.setAcftType(AcftType);                                     // set aircraft type
+  if(Private) Packet.setPrivate();                                  // set private/stealth flag
+         else Packet.clrPrivate();
+  Frame.Pos=Pos;
+  Frame.Epoch=Pos.getDayTime_ms();
+  Frame.Time=xTaskGetTickCount();
+  TxWrite = __atomic_exchange_n(&TxReady, TxWrite|TX_FRESH, __ATOMIC_ACQ_REL)&~TX_FRESH; // publish, take the old ready buffer for the next write
+  __atomic_store_n(&TxValid, 1, __ATOMIC_RELEASE); }
+
+const uint8_t* OGN_GetTxPacket(void)                                // latest fix extrapolated to now, called from the SP1 task only, just before the FIFO write
+{ if(!__atomic_load_n(&TxValid, __ATOMIC_ACQUIRE)) return 0;        // no fix yet
+  if(__atomic_load_n(&TxReady, __ATOMIC_ACQUIRE)&TX_FRESH)          // a newer fix was published: swap it in
+    TxRead = __atomic_exchange_n(&TxReady, TxRead, __ATOMIC_ACQ_REL)&~TX_FRESH;
+  const OGN_TxFrame &Frame = TxFrame[TxRead];
+  clock_utc_t Now; int32_t Age; int16_t SlotTime=-1;               // [ms] fix epoch to the middle of the packet on air
+  if(Clock_GetUTC(&Now)!=CLOCK_NONE)
+  { int32_t DayTime = (Now.sec%86400)*1000 + Now.usec/1000;
+    Age = DayTime - Frame.Epoch; if(Age<(-43200000)) Age+=86400000; // fix before midnight, sent after
+    SlotTime = (Now.usec/1000 + OGN_TX_LEAD_MS)%1000; }
+  else                                                              // no PPS: the NMEA arrival is the best guess of the fix time
+    Age = (TickType_t)(xTaskGetTickCount()-Frame.Time)*portTICK_PERIOD_MS;
+  Age += OGN_TX_LEAD_MS;
+  if(Age > OGN_TX_MAX_AGE_MS) return 0;                             // GPS lost: do not repeat an old position
+  if(SlotTime<0) TxStats.no_clock++;
+  else
+  { TxStats.slot_ms_last = SlotTime;                                // the slots are 400..800 and 800..1200 ms after the PPS
+    if(SlotTime>=OGN_SLOT_END_MS-1000 && SlotTime<OGN_SLOT_START_MS) TxStats.out_of_slot++; }
+  TxOut = Frame.Packet;
+  Frame.Pos.EncodePredicted(TxOut, Age);                            // only time, position and heading change
+  OGN_TEAKey Key; EncrKey.Read(Key);                                // never half old, half new key: no lock on the TX path
+  if(!Key.isZero() && !TxOut.isEmergency())                         // flag and encryption from the same key: a key change between
+  { TxOut.setEncrypted();                                           // the fix and the transmission can not send a zero-key frame
+    uint32_t Start=cycle_cnt_get();
+    TxOut.Encrypt(Key);                                         // encrypt the position/speed data (not the header)
+    uint32_t Cycles=cycle_cnt_get()-Start;                          // fixed number of rounds: only interrupts can make it longer
+    TxStats.encr_cycles_last=Cycles;
+    if(Cycles>TxStats.encr_cycles_max) TxStats.encr_cycles_max=Cycles;
+    if(Cycles>OGN_ENCR_CYCLE_BUDGET) TxStats.encr_over_budget++;
+    TxStats.encrypted++; }
   else
-  { Ptr = (Ptr+3)&3;
-  if(Position[Ptr].isComplete())
-  { if(Output) Position[Ptr].PrintLine(Output); }
+  { TxOut.Whiten();                                                 // Whiten the position/speed data (not the header)
+    TxStats.plain++; }
+  TxOut.setFEC();                                                   // compute the parity checks
+  return (const uint8_t*)&TxOut.Header; }                           // pointer to packet bytes: works only with little-endian CPU
+
+OGN_Decode_res_t OGN_DecodePacket(uint8_t *data, uint8_t *err, float rssi, char *Output) // correct a received packet (in place) and print it
+{ OGN_Decode_res_t ret_value = OGN_DECODE_OK;
+  if(Output) Output[0]=0;
+  uint32_t Code[LDPC_MinSumDecoder::CodeWords];
+  Code[LDPC_MinSumDecoder::CodeWords-1]=0; memcpy(Code, data, OGN_PKT_LEN);
+  uint64_t Syndrome=LDPC_Syndrome(Code);
+  int8_t Fixed=-1;
+  uint8_t Viol = Syndrome ? Manch_CountErr(err, OGN_PKT_LEN):0;
+  if(Syndrome && Viol<=OGN_RX_SYNDROME_VIOL)
+    Fixed=LDPC_SyndromeCorrect(Code, Syndrome);                    // one or two bit errors: straight from the table
+  int8_t Flips=-1;
+  if(Fixed<0 && Syndrome && Viol<=OGN_RX_BITFLIP_VIOL)
+  { uint32_t Start=cycle_cnt_get();
+    RxBitFlip.Input(data, err);                                    // a few bit errors: hard decision bit flipping
+    Flips=RxBitFlip.Decode();
+    uint32_t Cycles=cycle_cnt_get()-Start;
+    RxStats.bitflip_cycles_last=Cycles;
+    if(Cycles>RxStats.bitflip_cycles_max) RxStats.bitflip_cycles_max=Cycles; }
+  if(Fixed>0)
+  { memcpy(data, Code, OGN_PKT_LEN);
+    RxStats.syndrome_hits[Fixed-1]++;
+    RxStats.iter_hist[0]++;
+    RxStats.corrected++; ret_value = OGN_DECODE_CORRECTED; }
+  else if(Flips>0)
+  { RxBitFlip.Output(data);
+    RxStats.bitflip_hits++;
+    RxStats.iter_hist[0]++;
+    RxStats.corrected++; ret_value = OGN_DECODE_CORRECTED; }
+  else if(Syndrome)                                                // if any parity check fails
+  { static int8_t Soft[LDPC_MinSumDecoder::CodeBits];              // soft bits from the Manchester violations and the RSSI
+    int8_t Ampl = Manch_SoftAmpl(err, OGN_PKT_LEN, (int16_t)(rssi-OGN_RX_NOISE_DBM));
+    Manch_SoftBits(Soft, data, err, OGN_PKT_LEN, OGN_RX_MANCH_OFS, Ampl);
+    RxDecoder.Input(Soft);
+    int8_t Iter=RxDecoder.Decode();                                // stops as soon as all checks are satisfied
+    if(Iter<0)                                                     // not corrected within OGN_RX_MAX_ITER iterations
+    { RxStats.failed++; return OGN_DECODE_FAILED; }
+    RxDecoder.Output(data);
+    RxStats.iter_hist[Iter]++;
+    RxStats.corrected++; ret_value = OGN_DECODE_CORRECTED; }
+  else
+  { RxStats.iter_hist[0]++; RxStats.ok++; }
+  if(Output)
+  { OGN_Packet RxPacket;
+    RxPacket.recvBytes(data);
+    if(RxPacket.isEncrypted())                                     // encrypted position can not be decoded
+    { sprintf(Output, "%06lX: encrypted", (long int)RxPacket.getAddress()); }
+    else
+    { RxPacket.Dewhiten();                                         // decode the position/speed data
+      RxPacket.PrintLine(Output); }
   }
-  uint32_t Time=Position[Ptr].getUnixTime();
-  xSemaphoreGive(xOgnPosMutex);
-  return Time; }
+  return ret_value; }
 
-uint8_t* OGN_PreparePacket(void)                                   // Prepare OGN packet
-{ xSemaphoreTake(xOgnPosMutex, portMAX_DELAY);
-  int Ptr = (PosPtr+3)&3; uint8_t* ret_data = 0;                   // get the frame just before the currect pointer
-  if(Position[Ptr].isValid())                                      // is it valid ? (GPS lock ?)
-  { uint32_t Address  =  AcftID     &0x00FFFFFF;                   // split ID into elements
-    uint8_t  AddrType = (AcftID>>24)&0x03;
-    uint8_t  AcftType = (AcftID>>26)&0x1F;
-    uint8_t  Private  = (AcftID>>31)&0x01;
-
-    Packet.setAddress(Address); Packet.setAddrType(AddrType); Packet.clrMeteo(); Packet.calcAddrParity();
-    Packet.clrEmergency(); Packet.clrEncrypted(); Packet.setRelayCount(0);
-    Position[Ptr].Encode(Packet);                                   // encode position into the packet
-    Packet.setAcftType(AcftType);                                   // set aircraft type
-    if(Private) Packet.setPrivate();                                // set private/stealth flag
-           else Packet.clrPrivate();
-    Packet.Whiten();                                                // Whiten the position/speed data (not the header)
-    Packet.setFEC();                                                // compute the parity checks
-    ret_data = (uint8_t*)&Packet.Header; }                          // get pointer to packet bytes: works only with little-endian CPU
-  xSemaphoreGive(xOgnPosMutex);
-  return ret_data; }
+const OGN_RxStats_t* OGN_GetRxStats(void)
+{ return &RxStats; }
+
+void OGN_ClearRxStats(void)
+{ memset(&RxStats, 0, sizeof(RxStats)); }
+
+const OGN_TxStats_t* OGN_GetTxStats(void)
+{ return &TxStats; }
 
+void OGN_ClearTxStats(void)
+{ memset(&TxStats, 0, sizeof(TxStats)); }
@@ -10,6 +10,59 @@ extern "C" {
 #define OGN_PKT_LEN       26           // OGN packet has 26 bytes of data
 #define OGN_PKT_SYNC      0x0AF3656C   // OGN packet starts with these four bytes
 
+#define OGN_RX_MAX_ITER   16           // iteration budget of the LDPC decoder for received packets
+#define OGN_RX_NOISE_DBM  (-112)       // [dBm] receiver noise floor: RSSI at 0dB chip S/N, for the soft-decision metric
+#define OGN_RX_MANCH_OFS  2            // packet bits start in the middle of a Manchester byte: two SYNC bits precede them
+#define OGN_RX_SYNDROME_VIOL 4         // max. Manchester violations for the syndrome table: noisier packets go to the LDPC decoder
+#define OGN_RX_BITFLIP_VIOL  12        // max. Manchester violations for the bit-flipping decoder: noisier packets go to the min-sum decoder
+#define OGN_ENCR_CYCLE_BUDGET 1000     // [CPU cycles] max. time to encrypt the position of a packet (both TEA blocks)
+#define OGN_POS_HISTORY   32           // fixes kept: a power of two, enough for the fit window at 10 Hz
+#define OGN_FIT_WINDOW_MS 3000         // [ms] climb and turn rate are the least-squares slopes over the fixes of this long
+// #define OGN_POS_USE_MUTEX            // position readers wait on the GPS task mutex as before the snapshot: to compare the reader latency
+#define OGN_TX_MAX_AGE_MS 2000         // [ms] do not transmit a fix older than this
+#define OGN_TX_LEAD_MS    3            // [ms] from the FIFO write to the middle of the packet on air: the position is extrapolated to there
+#define OGN_SLOT_START_MS 400          // [ms] after the PPS: the two TX slots are 400..800 ms (868.4 MHz) and 800..1200 ms (868.2 MHz)
+#define OGN_SLOT_END_MS   1200
+
+typedef enum
+{
+    OGN_DECODE_FAILED = -1,            // could not be corrected within the iteration budget
+    OGN_DECODE_OK,                     // received without errors
+    OGN_DECODE_CORRECTED               // corrected by the syndrome table, bit flipping or the LDPC decoder
+} OGN_Decode_res_t;
+
+typedef struct                         // statistics of the received packets
+{
+    uint32_t ok;                       // received without errors
+    uint32_t corrected;                // corrected by the syndrome table, bit flipping or the LDPC decoder
+    uint32_t failed;                   // not corrected within OGN_RX_MAX_ITER iterations
+    uint32_t syndrome_hits[2];         // corrected by the syndrome table: one and two bit errors
+    uint32_t bitflip_hits;             // corrected by the bit-flipping decoder
+    uint32_t bitflip_cycles_last;      // [CPU cycles] bit-flipping decoder on the last packet it was tried on
+    uint32_t bitflip_cycles_max;       // [CPU cycles] longest so far
+    uint32_t iter_hist[OGN_RX_MAX_ITER+1]; // number of decoder iterations it took to correct a packet
+} OGN_RxStats_t;
+
+typedef struct                         // statistics of the transmitted packets
+{
+    uint32_t plain;                    // position whitened only
+    uint32_t encrypted;                // position encrypted with the key
+    uint32_t encr_cycles_last;         // [CPU cycles] encryption of the last packet
+    uint32_t encr_cycles_max;          // [CPU cycles] longest encryption so far
+    uint32_t encr_over_budget;         // encryptions which took more than OGN_ENCR_CYCLE_BUDGET
+    uint32_t slot_ms_last;             // [ms] after the UTC second the last packet was on air
+    uint32_t out_of_slot;              // packets on air outside OGN_SLOT_START_MS..OGN_SLOT_END_MS
+    uint32_t no_clock;                 // packets sent without the UTC clock: the fix age from the NMEA arrival
+} OGN_TxStats_t;
+
+typedef struct
+{
+    uint32_t reads;                    // OGN_GetPosition() calls
+    uint32_t retries;                  // snapshot copies repeated because a fix was published meanwhile
+    uint32_t wait_cycles_last;         // [CPU cycles] to get hold of the position: the last read
+    uint32_t wait_cycles_max;          // [CPU cycles] the longest so far
+} OGN_PosStats_t;
+
 typedef enum
 {
     OGN_PARSE_BAD_NMEA = -1,
@@ -23,9 +76,24 @@ typedef enum
 /* -------- OGN exported functions -------- */
 uint8_t         OGN_Init(void);                                // initialize
 void            OGN_SetAcftID(uint32_t id);                    // set Aircraft identificatin
+void            OGN_SetEncryptKey(const uint32_t *key);        // 128-bit key to encrypt the position, NULL (or all zero): whitening only
+uint16_t        OGN_GetEncryptKeyCheck(void);                  // key check value, zero when encryption is off
 uint32_t        OGN_GetPosition(char *Output);                 // get GPS position in a string: to be displayed in the console
+const OGN_PosStats_t* OGN_GetPosStats(void);                   // position reader statistics
+void            OGN_ClearPosStats(void);
 OGN_Parse_res_t OGN_Parse_NMEA(const char* str, uint8_t len);  // process an NMEA sentence from the GPS
-uint8_t*        OGN_PreparePacket(void);                       // make an OGN packet
+OGN_Parse_res_t OGN_Parse_NMEA_Msg(void *msg);                 // process an NMEA sentence indexed by OGN_NMEA_ProcessByte()
+uint16_t        OGN_NMEA_MsgSize(void);                        // bytes to reserve for an NMEA sentence descriptor
+void*           OGN_NMEA_MsgInit(void *msg);                   // prepare reserved space to receive a sentence
+uint8_t         OGN_NMEA_ProcessByte(void *msg, uint8_t byte); // feed a received byte, returns non-zero when the sentence is complete
+void            OGN_NMEA_SetTime(void *msg, uint32_t cnt);     // Clock_Count() when the '$' arrived: for bytes framed after the fact
+const char*     OGN_NMEA_Sentence(const void *msg, uint8_t *len); // text of a received sentence (without CR/LF)
+const uint8_t*  OGN_GetTxPacket(void);                         // latest valid fix extrapolated to the transmit time, NULL if none or too old
+OGN_Decode_res_t OGN_DecodePacket(uint8_t *data, uint8_t *err, float rssi, char *Output); // correct a received packet and print it
+const OGN_RxStats_t* OGN_GetRxStats(void);                     // RX decoder statistics
+void            OGN_ClearRxStats(void);
+const OGN_TxStats_t* OGN_GetTxStats(void);                     // TX (encryption) statistics
+void            OGN_ClearTxStats(void);
 
 #ifdef __cplusplus
 }
@@ -4,7 +4,7 @@
 #include <stddef.h>
 
 /* -------- defines -------- */
-#define OPTIONS_VER 1
+#define OPTIONS_VER 2        /* 2: gps_dma, encr_key and encrypt added at the end (gps_dma came without a version change) */
 
 #define DATA_EEPROM_START_ADDR  0x08080000
 #define DATA_EEPROM_END_ADDR    0x08083FFF
@@ -30,6 +30,9 @@ typedef struct
    uint8_t   jam_ratio;        // Jamming ratio: 0 - 100 %
    uint16_t  min_bat_level;    // Minimum battery level
    uint16_t  gps_wdg_time;     // GPS watchdog time [s]
+   uint8_t   gps_dma;          // GPS USART reception: 0 - interrupt per byte, 1 - circular DMA
+   uint32_t  encr_key[4];      // 128-bit key for the encrypted position
+   uint8_t   encrypt;          // Position: 0 - whitened, 1 - encrypted with encr_key
 } options_str;
 
 /* -------- variables -------- */
@@ -37,6 +40,17 @@ static options_str options;
 
 /* -------- functions -------- */
 
+/**
+  * @brief  Function resets the encryption options: no key, position only whitened.
+  * @param  void
+  * @retval void
+  */
+static void ResetEncryption(void)
+{ int i;
+  for (i=0; i<4; i++) options.encr_key[i] = 0;
+  options.encrypt       =    0;         // Disabled
+}
+
 /**
   * @brief  Function resets all options to default values.
   * @param  void
@@ -60,6 +74,8 @@ void ResetOptions(void)
   options.jam_ratio     =   10;         // 10%
   options.min_bat_level = 3100;         // 3.1V
   options.gps_wdg_time  = 60;           // 60 sec
+  options.gps_dma       =    0;         // Interrupt per byte
+  ResetEncryption();
 }
 
 /**
@@ -113,6 +129,11 @@ uint8_t WriteOptions(void)
   */
 void InitOptions(void)
 { ReadOptions();
+   if (options.version == 1)               // older layout: keep the options, add the new ones
+   { options.version = OPTIONS_VER;
+     options.gps_dma = 0;                  // a version 1 image may be older than gps_dma: its byte is whatever was there
+     ResetEncryption();
+     WriteOptions(); }
    if (options.version != OPTIONS_VER)
    { ResetOptions();
      WriteOptions(); }
@@ -255,6 +276,28 @@ void SetGPSWdgTime(uint16_t new_value)
 { options.gps_wdg_time = new_value;
   WriteBlock(OFFSETOF(options_str, gps_wdg_time), sizeof(options.gps_wdg_time)); }
 
+uint8_t* GetGPSDMA(void)
+{ return &options.gps_dma; }
+
+void SetGPSDMA(uint8_t new_value)
+{ options.gps_dma = new_value;
+  WriteBlock(OFFSETOF(options_str, gps_dma), sizeof(options.gps_dma)); }
+
+uint32_t* GetEncrKey(void)
+{ return options.encr_key; }
+
+void SetEncrKey(const uint32_t* new_value)
+{ int i;
+  for (i=0; i<4; i++) options.encr_key[i] = new_value[i];
+  WriteBlock(OFFSETOF(options_str, encr_key), sizeof(options.encr_key)); }
+
+uint8_t* GetEncrypt(void)
+{ return &options.encrypt; }
+
+void SetEncrypt(uint8_t new_value)
+{ options.encrypt = new_value;
+  WriteBlock(OFFSETOF(options_str, encrypt), sizeof(options.encrypt)); }
+
  
 /* ------------------------------------------------------ */
 /**
@@ -281,6 +324,9 @@ void* GetOption(option_types opt_code)
     case OPT_JAM_RATIO:  { ret_val = GetJamRatio();  break; }
     case OPT_MIN_BAT_LVL:{ ret_val = GetMinBatLvl(); break; }
     case OPT_GPS_WDG_TIME:{ ret_val = GetGPSWdgTime(); break; }
+    case OPT_GPS_DMA:    { ret_val = GetGPSDMA();    break; }
+    case OPT_ENCR_KEY:   { ret_val = GetEncrKey();   break; }
+    case OPT_ENCRYPT:    { ret_val = GetEncrypt();   break; }
     default: break; }
   return ret_val; }
 
@@ -302,6 +348,9 @@ void SetOption(option_types opt_code, void* value)
     case OPT_JAM_RATIO:  { SetJamRatio (*(uint8_t  *) value); break; }
     case OPT_MIN_BAT_LVL:{ SetMinBatLvl(*(uint16_t *) value); break; }
     case OPT_GPS_WDG_TIME:{SetGPSWdgTime(*(uint16_t *) value); break;}
+    case OPT_GPS_DMA:    { SetGPSDMA   (*(uint8_t  *) value); break; }
+    case OPT_ENCR_KEY:   { SetEncrKey  ( (uint32_t *) value); break; }
+    case OPT_ENCRYPT:    { SetEncrypt  (*(uint8_t  *) value); break; }
     default: break; }
 }
 
@@ -21,7 +21,10 @@ typedef enum
    OPT_GPS_ANT,
    OPT_JAM_RATIO,
    OPT_MIN_BAT_LVL,
-   OPT_GPS_WDG_TIME
+   OPT_GPS_WDG_TIME,
+   OPT_GPS_DMA,
+   OPT_ENCR_KEY,
+   OPT_ENCRYPT
 } option_types;
 
 typedef enum
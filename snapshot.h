@@ -0,0 +1,40 @@
+#ifndef __SNAPSHOT_H__
+#define __SNAPSHOT_H__
+
+// Latest value of a small structure (the GPS position) with one writer and any number of readers, without a lock:
+// the writer fills the copy the readers are not pointed at, then advances the sequence counter to publish it.
+// A reader copies the current one and checks that the counter did not move meanwhile: if it did, the writer may
+// have started on the very copy being read, thus the reader tries again. Nobody ever waits for anybody else,
+// a reader retries only when a publish falls into its copy. Same __atomic builtins as log_buf.c.
+
+#include <stdint.h>
+
+template <class Type>
+ class Snapshot
+{ public:
+   Type     Data[2];
+   uint32_t Seq;                                          // number of publishes: Data[Seq&1] is the current copy
+
+  public:
+   Snapshot() { Seq=0; }
+
+   void Write(const Type &Value)                          // the single writer
+   { uint32_t Next=Seq+1;
+     Data[Next&1]=Value;
+     __atomic_store_n(&Seq, Next, __ATOMIC_RELEASE);
+     __atomic_thread_fence(__ATOMIC_SEQ_CST); }           // the next Write() must not be seen before this publish
+
+   uint32_t Read(Type &Value) const                       // any reader, any time: return the number of retries
+   { for(uint32_t Retries=0; ; Retries++)
+     { uint32_t Now=__atomic_load_n(&Seq, __ATOMIC_ACQUIRE);
+       Value=Data[Now&1];
+       __atomic_thread_fence(__ATOMIC_ACQUIRE);
+       if(__atomic_load_n(&Seq, __ATOMIC_RELAXED)==Now) return Retries; }
+   }
+
+   uint32_t getSeq(void) const { return __atomic_load_n(&Seq, __ATOMIC_ACQUIRE); }
+
+   const Type &Current(void) const { return Data[Seq&1]; } // only where the writer can not run: e.g. under the writer's lock
+} ;
+
+#endif // of __SNAPSHOT_H__
@@ -4,6 +4,7 @@
 #include <task.h>
 #include <semphr.h>
 #include <queue.h>
+#include "usart.h"
 
 /* -------- defines -------- */
 /* RM0038: STM32L reference manual */
@@ -39,6 +40,8 @@ static SemaphoreHandle_t xSPI1SemaphoreB;
 
 static DMA_InitTypeDef  DMA_InitTX;
 static DMA_InitTypeDef  DMA_InitRX;
+/* DMA1 Channel3 serves SPI1 TX or (see SPI1_ReleaseTxDMA) USART3 RX */
+static uint8_t spi1_tx_dma = 1;
 
 /* -------- interrupt handlers -------- */
 /* interrupt raised after SPI1 RX transfer finish */
@@ -65,6 +68,12 @@ void DMA1_Channel2_IRQHandler(void)
 /* interrupt raised after SPI1 TX transfer finish */
 void DMA1_Channel3_IRQHandler(void)
 {
+   if (!spi1_tx_dma)
+   {
+      /* channel handed over to the GPS USART */
+      USART3_RxDMA_IRQHandler();
+      return;
+   }
    /* Test on DMA1 Channel3 Transfer Complete interrupt */
    if(DMA_GetITStatus(DMA1_IT_TC3))
    {
@@ -215,13 +224,17 @@ void SPI1_Config(void)
 void SPI1_Send(uint8_t* data_tx, uint8_t* data_rx, uint8_t len)
 {
    volatile int i;
+   uint8_t idx;
 
    /* Take access to SPI1  - will block if already used */
    xSemaphoreTake(xSPI1Semaphore, portMAX_DELAY);
 
-   DMA_InitTX.DMA_BufferSize = len;
-   DMA_InitTX.DMA_MemoryBaseAddr = (uint32_t)data_tx;
-   DMA_Init(DMA_SPI1_TX_CH, &DMA_InitTX);
+   if (spi1_tx_dma)
+   {
+      DMA_InitTX.DMA_BufferSize = len;
+      DMA_InitTX.DMA_MemoryBaseAddr = (uint32_t)data_tx;
+      DMA_Init(DMA_SPI1_TX_CH, &DMA_InitTX);
+   }
 
    DMA_InitRX.DMA_BufferSize = len;
    DMA_InitRX.DMA_MemoryBaseAddr = (uint32_t)data_rx;
@@ -233,7 +246,19 @@ void SPI1_Send(uint8_t* data_tx, uint8_t* data_rx, uint8_t len)
 
    /* Enable the DMA channels */
    DMA_Cmd(DMA_SPI1_RX_CH, ENABLE);
-   DMA_Cmd(DMA_SPI1_TX_CH, ENABLE);
+   if (spi1_tx_dma)
+   {
+      DMA_Cmd(DMA_SPI1_TX_CH, ENABLE);
+   }
+   else
+   {
+      /* no TX DMA: feed the transmitter from here, RX DMA still collects the answer */
+      for (idx=0; idx<len; idx++)
+      {
+         while (SPI_I2S_GetFlagStatus(SPI1, SPI_I2S_FLAG_TXE) == RESET) { }
+         SPI_I2S_SendData(SPI1, data_tx[idx]);
+      }
+   }
    /* Wait until SPI1 transfer finishes  */
    xSemaphoreTake(xSPI1SemaphoreB, portMAX_DELAY);
    
@@ -242,3 +267,19 @@ void SPI1_Send(uint8_t* data_tx, uint8_t* data_rx, uint8_t len)
       
    xSemaphoreGive(xSPI1Semaphore);
 }
+
+/**
+* @brief  Gives DMA1 Channel3 away: SPI1 TX is fed by the CPU from now on.
+* @brief  The channel is the only one serving USART3 RX (RM0038, Table 40).
+* @param  None
+* @retval None
+*/
+void SPI1_ReleaseTxDMA(void)
+{
+   xSemaphoreTake(xSPI1Semaphore, portMAX_DELAY);
+   SPI_I2S_DMACmd(SPI1, SPI_I2S_DMAReq_Tx, DISABLE);
+   DMA_ITConfig(DMA_SPI1_TX_CH, DMA_IT_TC | DMA_IT_TE, DISABLE);
+   DMA_Cmd(DMA_SPI1_TX_CH, DISABLE);
+   spi1_tx_dma = 0;
+   xSemaphoreGive(xSPI1Semaphore);
+}
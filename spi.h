@@ -14,6 +14,7 @@ extern "C" {
 /* --- SPI1 related functions --- */
 void SPI1_Config(void);
 void SPI1_Send(uint8_t* data_tx, uint8_t* data_rx, uint8_t len);
+void SPI1_ReleaseTxDMA(void);
 
 #ifdef __cplusplus
 }
@@ -14,9 +14,14 @@
 #include "ogn_lib.h"
 #include "control.h"
 #include "timer_const.h"
+#include "manchester.h"
+#include "clock.h"
 
 /* -------- defines -------- */
 #define SPIRIT1_PKT_LEN     (3+2*(OGN_PKT_LEN)+1) // three bytes to complete the OGN SYNC word, 26 data+FEC bytes with Manchester emulation
+#define SPIRIT1_PKT_OFS     6                     // the packet starts 6 bits into the second air byte: 14 bits complete the SYNC
+#define SPIRIT1_SYNC_HEAD   0x256C                // the 14 bits: 10 0101 0110 1100 (the first air byte + SPIRIT1_PKT_OFS bits)
+#define SPIRIT1_PKT_TAIL    0x00                  // two 0 bits complete the last air byte
 
 #define SPR_SPI_MAX_REG_NUM  0xFF
 #define SPR_SPI_HDR_LEN      2
@@ -91,6 +96,8 @@ TimerHandle_t    xSP1Timer;
 
 uint8_t Packet_TxBuff[SPR_MAX_FIFO_LEN], Packet_RxBuff[SPR_MAX_FIFO_LEN];
 uint8_t Packet_TxBuff_Len;
+static uint32_t SP1_TxDropped = 0; /* TX requests from the SP1 timer lost to a full SP1 queue */
+uint8_t Packet_TxLive = 0;   /* encode the latest OGN fix at the transmit time instead of the copied data */
 
 uint8_t SPR_SPI_BufferTX[SPR_SPI_MAX_REG_NUM+SPR_SPI_HDR_LEN];
 uint8_t SPR_SPI_BufferRX[SPR_SPI_MAX_REG_NUM+SPR_SPI_HDR_LEN];
@@ -144,88 +151,6 @@ SGpioInit xGpio1IRQ={
 };
 
 
-/* -------- constants -------- */
-/* Spirit1 Manchester encoding emulation */
-/* 0 encoded as 1->0 (negative) transition: 10 */
-/* 1 encoded as 0->1 (positive) transition: 01 */
-const uint8_t hex_2_manch_encoding[0x10] =         // lookup table for 4-bit nibbles
-{
-   0xAA, /* hex: 0, bin: 0000, manch: 10101010 */
-   0xA9, /* hex: 1, bin: 0001, manch: 10101001 */
-   0xA6, /* hex: 2, bin: 0010, manch: 10100110 */
-   0xA5, /* hex: 3, bin: 0011, manch: 10100101 */
-   0x9A, /* hex: 4, bin: 0100, manch: 10011010 */
-   0x99, /* hex: 5, bin: 0101, manch: 10011001 */
-   0x96, /* hex: 6, bin: 0110, manch: 10010110 */
-   0x95, /* hex: 7, bin: 0111, manch: 10010101 */
-   0x6A, /* hex: 8, bin: 1000, manch: 01101010 */
-   0x69, /* hex: 9, bin: 1001, manch: 01101001 */
-   0x66, /* hex: A, bin: 1010, manch: 01100110 */
-   0x65, /* hex: B, bin: 1011, manch: 01100101 */
-   0x5A, /* hex: C, bin: 1100, manch: 01011010 */
-   0x59, /* hex: D, bin: 1101, manch: 01011001 */
-   0x56, /* hex: E, bin: 1110, manch: 01010110 */
-   0x55  /* hex: F, bin: 1111, manch: 01010101 */
-};
-
-/* Code to generate the Manchester decoding table (compiles with warnings)
-
-#include <stdio.h>
-#include <stdint.h>
-
-int main(int argc, char *argv[])
-{
-  uint8_t Decode[256];
-
-  for(uint8_t Idx=0; ; Idx++)
-  { uint8_t Byte=Idx; uint8_t Code=0;
-    for(int BitIdx=0; BitIdx<4; BitIdx++)
-    { uint8_t DiBit=Byte&0x03;
-      uint8_t Bit; uint8_t Err;
-      switch(DiBit)
-      { case 0: Bit=0; Err=1; break;
-        case 1: Bit=1; Err=0; break;
-        case 2: Bit=0; Err=0; break;
-        case 3: Bit=1; Err=1; break; }
-      Code>>=1; Code |= (Err<<7) | (Bit<<3);
-      Byte>>=2; }
-     Decode[Idx]=Code;
-     if(Idx==255) break; }
-
-  printf("const uint8_t manch_2_hex_to_trans[256] =\n{");
-  for(uint8_t Idx=0; ; Idx++)
-  { if((Idx&0x0F)==0) printf("\n ");
-    printf(" 0x%02X", Decode[Idx]);
-    if(Idx!=255) printf(",");
-            else break;
-  }
-  printf("\n} ;\n");
-
-  return 0; }
-
-*/
-
-const uint8_t manch_2_hex_to_trans[256] = // lower nibble has the data bits and the upper nibble the error pattern
-{
-  0xF0, 0xE1, 0xE0, 0xF1, 0xD2, 0xC3, 0xC2, 0xD3, 0xD0, 0xC1, 0xC0, 0xD1, 0xF2, 0xE3, 0xE2, 0xF3,
-  0xB4, 0xA5, 0xA4, 0xB5, 0x96, 0x87, 0x86, 0x97, 0x94, 0x85, 0x84, 0x95, 0xB6, 0xA7, 0xA6, 0xB7,
-  0xB0, 0xA1, 0xA0, 0xB1, 0x92, 0x83, 0x82, 0x93, 0x90, 0x81, 0x80, 0x91, 0xB2, 0xA3, 0xA2, 0xB3,
-  0xF4, 0xE5, 0xE4, 0xF5, 0xD6, 0xC7, 0xC6, 0xD7, 0xD4, 0xC5, 0xC4, 0xD5, 0xF6, 0xE7, 0xE6, 0xF7,
-  0x78, 0x69, 0x68, 0x79, 0x5A, 0x4B, 0x4A, 0x5B, 0x58, 0x49, 0x48, 0x59, 0x7A, 0x6B, 0x6A, 0x7B,
-  0x3C, 0x2D, 0x2C, 0x3D, 0x1E, 0x0F, 0x0E, 0x1F, 0x1C, 0x0D, 0x0C, 0x1D, 0x3E, 0x2F, 0x2E, 0x3F,
-  0x38, 0x29, 0x28, 0x39, 0x1A, 0x0B, 0x0A, 0x1B, 0x18, 0x09, 0x08, 0x19, 0x3A, 0x2B, 0x2A, 0x3B,
-  0x7C, 0x6D, 0x6C, 0x7D, 0x5E, 0x4F, 0x4E, 0x5F, 0x5C, 0x4D, 0x4C, 0x5D, 0x7E, 0x6F, 0x6E, 0x7F,
-  0x70, 0x61, 0x60, 0x71, 0x52, 0x43, 0x42, 0x53, 0x50, 0x41, 0x40, 0x51, 0x72, 0x63, 0x62, 0x73,
-  0x34, 0x25, 0x24, 0x35, 0x16, 0x07, 0x06, 0x17, 0x14, 0x05, 0x04, 0x15, 0x36, 0x27, 0x26, 0x37,
-  0x30, 0x21, 0x20, 0x31, 0x12, 0x03, 0x02, 0x13, 0x10, 0x01, 0x00, 0x11, 0x32, 0x23, 0x22, 0x33,
-  0x74, 0x65, 0x64, 0x75, 0x56, 0x47, 0x46, 0x57, 0x54, 0x45, 0x44, 0x55, 0x76, 0x67, 0x66, 0x77,
-  0xF8, 0xE9, 0xE8, 0xF9, 0xDA, 0xCB, 0xCA, 0xDB, 0xD8, 0xC9, 0xC8, 0xD9, 0xFA, 0xEB, 0xEA, 0xFB,
-  0xBC, 0xAD, 0xAC, 0xBD, 0x9E, 0x8F, 0x8E, 0x9F, 0x9C, 0x8D, 0x8C, 0x9D, 0xBE, 0xAF, 0xAE, 0xBF,
-  0xB8, 0xA9, 0xA8, 0xB9, 0x9A, 0x8B, 0x8A, 0x9B, 0x98, 0x89, 0x88, 0x99, 0xBA, 0xAB, 0xAA, 0xBB,
-  0xFC, 0xED, 0xEC, 0xFD, 0xDE, 0xCF, 0xCE, 0xDF, 0xDC, 0xCD, 0xCC, 0xDD, 0xFE, 0xEF, 0xEE, 0xFF
-} ;
-
-
 /* -------- interrupt handlers -------- */
 
 /* interrupt for raising GPIO0 line */
@@ -238,7 +163,7 @@ void EXTI0_IRQHandler(void)
    {
         /* Clear the GPIO0 EXTI line pending bit */
         EXTI_ClearITPendingBit(SPR1_GPIO0_EXTI_LINE);
-        sp1_msg.msg_data   = 0;
+        sp1_msg.msg_data   = Clock_Count();   /* RX timestamp: the packet ended just now */
         sp1_msg.msg_len    = 0;
         sp1_msg.msg_opcode = SP1_INT_GPIO0_IRQ;
         sp1_msg.src_id     = SPIRIT1_SRC_ID;
@@ -247,6 +172,16 @@ void EXTI0_IRQHandler(void)
    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
 /* -------- functions -------- */
+/**
+* @brief  TX requests lost to a full SP1 queue.
+* @param  None
+* @retval number of requests since the start
+*/
+uint32_t Spirit1_TxDropped(void)
+{
+   return SP1_TxDropped;
+}
+
 xQueueHandle* Get_SP1Queue()
 {
    return &xQueueSP1;
@@ -384,7 +319,15 @@ void Spirit1ExitShutdown(void)
 */
 void vSP1TimerCallback(TimerHandle_t pxTimer)
 {
-   SP1_TX_packet();
+   task_message sp1_msg;
+
+   /* transmit from the SP1 task: the packet is encoded there and the SPI is not shared */
+   sp1_msg.msg_data   = 0;
+   sp1_msg.msg_len    = 0;
+   sp1_msg.msg_opcode = SP1_TX_PACKET;
+   sp1_msg.src_id     = SPIRIT1_SRC_ID;
+   /* the timer task must not block: a request that does not fit is counted */
+   if (xQueueSend(xQueueSP1, &sp1_msg, 0) != pdPASS) SP1_TxDropped++;
 }
 
 /**
@@ -494,19 +437,14 @@ void static SpiritTXConf(float TxPower)
 */
 void SpiritCopyPacket_OGN(const uint8_t* pkt_data, uint8_t pkt_len)
 {
-   uint8_t in_pkt_pos, out_pkt_pos = 0;
+   uint8_t out_pkt_pos = 0;
    if ((pkt_data)&&(pkt_len))
    {
-      uint8_t Buff = 0x06; uint8_t Byte;     // complete the preamble/SYNC
-      Byte = hex_2_manch_encoding[0x5]; Buff = (Buff<<4) | (Byte>>4); Packet_TxBuff[out_pkt_pos++] = Buff; Buff = Byte&0x0F;
-      Byte = hex_2_manch_encoding[0x6]; Buff = (Buff<<4) | (Byte>>4); Packet_TxBuff[out_pkt_pos++] = Buff; Buff = Byte&0x0F;
-      Byte = hex_2_manch_encoding[0xC]; Buff = (Buff<<4) | (Byte>>4); Packet_TxBuff[out_pkt_pos++] = Buff; Buff = Byte&0x0F;
-      for (in_pkt_pos = 0; in_pkt_pos<pkt_len; in_pkt_pos++)
-      { uint8_t Data = pkt_data[in_pkt_pos]; // get the next data byte => convert in two Manchester bytes
-        Byte = hex_2_manch_encoding[Data>>4];   Buff = (Buff<<4) | (Byte>>4); Packet_TxBuff[out_pkt_pos++] = Buff; Buff = Byte&0x0F;
-        Byte = hex_2_manch_encoding[Data&0x0F]; Buff = (Buff<<4) | (Byte>>4); Packet_TxBuff[out_pkt_pos++] = Buff; Buff = Byte&0x0F;
-      }
-      Buff = (Buff<<4) | 0x0A; Packet_TxBuff[out_pkt_pos++] = Buff;
+      uint16_t code = Manch_EncTable[SPIRIT1_SYNC_HEAD>>SPIRIT1_PKT_OFS];   /* complete the preamble/SYNC */
+      Packet_TxBuff[out_pkt_pos++] = code>>8;
+      Packet_TxBuff[out_pkt_pos++] = code;
+      out_pkt_pos = Manch_Encode(&Packet_TxBuff[out_pkt_pos], pkt_data, pkt_len, SPIRIT1_PKT_OFS,
+                                 (uint8_t)SPIRIT1_SYNC_HEAD, SPIRIT1_PKT_TAIL) - Packet_TxBuff;
    }
    Packet_TxBuff_Len = out_pkt_pos;
 }
@@ -518,6 +456,7 @@ void SpiritCopyPacket_OGN(const uint8_t* pkt_data, uint8_t pkt_len)
 */
 void SP1_TX_packet(void)
 {
+    if (Packet_TxLive) SpiritCopyPacket_OGN(OGN_GetTxPacket(), OGN_PKT_LEN); /* NULL (no recent fix) clears the buffer */
     if (Packet_TxBuff_Len)
     {
         SpiritCmdStrobeFlushTxFifo();
@@ -546,13 +485,12 @@ uint8_t ogn_packet_err[OGN_PKT_LEN];
 
 /**
 * @brief  Receive OGN packet.
-* @param  None
+* @param  Clock_Count() at the RX data ready interrupt
 * @retval None
 */
-rcv_packet_str* SpiritReceivePacket_OGN(void)
+rcv_packet_str* SpiritReceivePacket_OGN(uint32_t rx_time)
 {
     uint16_t cRxData;
-    uint8_t  in_pkt_pos, out_pkt_pos;
 
     cRxData = SpiritLinearFifoReadNumElementsRxFifo();
     SpiritSpiReadLinearFifo(cRxData, Packet_RxBuff);
@@ -567,21 +505,10 @@ rcv_packet_str* SpiritReceivePacket_OGN(void)
     rcv_packet.lqi      = SpiritQiGetLqi();
     rcv_packet.pqi      = SpiritQiGetPqi();
     rcv_packet.sqi      = SpiritQiGetSqi();
+    rcv_packet.time     = rx_time;
 
-    // Decode Manchester
-    in_pkt_pos = 0; uint8_t Manch, Data, Err;
-    Manch = Packet_RxBuff[in_pkt_pos++]; Data=manch_2_hex_to_trans[Manch]; Err=Data>>4; Data&=0x0F;
-    Manch = Packet_RxBuff[in_pkt_pos++]; Data=manch_2_hex_to_trans[Manch]; Err=Data>>4; Data&=0x0F;
-    Manch = Packet_RxBuff[in_pkt_pos++]; Data=manch_2_hex_to_trans[Manch]; Err=Data>>4; Data&=0x0F;
-    Manch = Packet_RxBuff[in_pkt_pos++]; Data=manch_2_hex_to_trans[Manch]; Err=Data>>4; Data&=0x0F;
-
-    for (out_pkt_pos = 0; out_pkt_pos < OGN_PKT_LEN; out_pkt_pos++)
-    { uint8_t DataByte = Data; uint8_t ErrByte=Err;
-      Manch = Packet_RxBuff[in_pkt_pos++]; Data=manch_2_hex_to_trans[Manch]; Err=Data>>4; Data&=0x0F;
-      DataByte = (DataByte<<4) |  Data;     ErrByte = (ErrByte<<4) |  Err;
-      Manch = Packet_RxBuff[in_pkt_pos++]; Data=manch_2_hex_to_trans[Manch]; Err=Data>>4; Data&=0x0F;
-      DataByte = (DataByte<<2) | (Data>>2); ErrByte = (ErrByte<<2) | (Err>>2);
-      ogn_packet_data[out_pkt_pos] = DataByte; ogn_packet_err[out_pkt_pos] = ErrByte; }
+    /* the FIFO starts with the same SYNC bits as sent by SpiritCopyPacket_OGN() */
+    Manch_Decode(ogn_packet_data, ogn_packet_err, &Packet_RxBuff[2], OGN_PKT_LEN, SPIRIT1_PKT_OFS);
 
     return &rcv_packet;
 }
@@ -691,8 +618,12 @@ void vTaskSP1(void* pvParameters)
       switch (msg.msg_opcode)
       {
          case SP1_COPY_OGN_PKT:            // a request to copy a packet data
+            Packet_TxLive = 0;
             SpiritCopyPacket_OGN((uint8_t*)msg.msg_data, msg.msg_len);
             break;
+         case SP1_COPY_OGN_TX:             // transmit the latest fix, encoded at the transmit time
+            Packet_TxLive = 1;
+            break;
          case SP1_CHG_CHANNEL:             // a request to change active channel
             xTimerStop(xSP1Timer, portMAX_DELAY); // cancel running TX timer (if not expired already) 
             SpiritCmdStrobeSabort();       // cancel all activities
@@ -721,7 +652,7 @@ void vTaskSP1(void* pvParameters)
             if (xIrqStatus.IRQ_RX_DATA_READY)
             {
                 /* Attempt to receive OGN packet */
-                rcv_packet_ptr = SpiritReceivePacket_OGN();
+                rcv_packet_ptr = SpiritReceivePacket_OGN(msg.msg_data);
                 if (rcv_packet_ptr && control_queue)
                 {
                     /* Send received packet to control task */
@@ -19,6 +19,7 @@ typedef struct                 // received packet structure
    uint8_t   lqi;       // [S/N] Link Quality Indicator (signal-to-noise)
    uint8_t   pqi;       // [bits] Preamble Quality Indicator ?
    uint8_t   sqi;       // [bits] SYNCword quality Indicator
+   uint32_t  time;      // Clock_Count() at the end of the packet: Clock_CountToUTC() gives its UTC
 } rcv_packet_str;
 
 /* -------- defines -------- */
@@ -34,6 +35,7 @@ typedef struct                 // received packet structure
 typedef enum
 {
    SP1_COPY_OGN_PKT = 1,    // Copy packet data in OGN format
+   SP1_COPY_OGN_TX,         // Transmit the latest GPS fix, extrapolated and encoded at the transmit time
    SP1_CHG_CHANNEL,         // Change active channel
    SP1_START_CW,            // Start transmitting continuous wave
    SP1_STOP_CW,             // Stop transmitting continuous wave
@@ -54,6 +56,7 @@ typedef enum
 void Spirit1_Config(void);
 void vTaskSP1(void* pvParameters);
 xQueueHandle* Get_SP1Queue();
+uint32_t Spirit1_TxDropped(void);
 void Spirit1EnterShutdown(void);
 
 #ifdef __cplusplus
@@ -0,0 +1,222 @@
+#ifndef __TEA_SIMD_H__
+#define __TEA_SIMD_H__
+
+// SIMD TEA for receivers on a PC or an ARM board: whitening/dewhitening (and keyed TEA) of many packets,
+// 4 (SSE2, NEON) or 8 (AVX2) blocks at a time, one block per lane. Results equal TEA_EncryptBatch()/TEA_DecryptBatch()
+// of ogn.h, the instruction set is chosen at run time the same way as for the LDPC decoder (ldpc_simd.h).
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ogn.h"
+#include "ldpc_simd.h"
+
+// Every lane class V gives: U32 (Lanes x uint32_t), Load()/Store() of Lanes blocks Stride words apart
+// with v0 and v1 in separate registers, and the 32-bit operations TEA needs.
+
+#ifdef __SSE2__
+
+namespace TEA_SSE2 {
+
+class V
+{ public:
+   typedef __m128i U32;
+   const static uint8_t Lanes = 4;
+
+   static U32  Set(uint32_t Val)           { return _mm_set1_epi32(Val); }
+   static U32  Add(U32 A, U32 B)           { return _mm_add_epi32(A, B); }
+   static U32  Sub(U32 A, U32 B)           { return _mm_sub_epi32(A, B); }
+   static U32  Xor(U32 A, U32 B)           { return _mm_xor_si128(A, B); }
+   static U32  Shl4(U32 A)                 { return _mm_slli_epi32(A, 4); }
+   static U32  Shr5(U32 A)                 { return _mm_srli_epi32(A, 5); }
+   static void Load(U32 &V0, U32 &V1, const uint32_t *Data, uint16_t Stride)
+   { if(Stride==2)                                                                   // packed blocks: two loads and a de-interleave
+     { __m128 A = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)Data));
+       __m128 B = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)(Data+4)));
+       V0 = _mm_castps_si128(_mm_shuffle_ps(A, B, _MM_SHUFFLE(2, 0, 2, 0)));
+       V1 = _mm_castps_si128(_mm_shuffle_ps(A, B, _MM_SHUFFLE(3, 1, 3, 1))); return; }
+     V0 = _mm_set_epi32(Data[3*Stride],   Data[2*Stride],   Data[Stride],   Data[0]);
+     V1 = _mm_set_epi32(Data[3*Stride+1], Data[2*Stride+1], Data[Stride+1], Data[1]); }
+   static void Store(uint32_t *Data, uint16_t Stride, U32 V0, U32 V1)
+   { if(Stride==2)
+     { _mm_storeu_si128((__m128i *)Data,     _mm_unpacklo_epi32(V0, V1));
+       _mm_storeu_si128((__m128i *)(Data+4), _mm_unpackhi_epi32(V0, V1)); return; }
+     alignas(16) uint32_t W0[Lanes], W1[Lanes];
+     _mm_store_si128((__m128i *)W0, V0); _mm_store_si128((__m128i *)W1, V1);
+     for(uint8_t Lane=0; Lane<Lanes; Lane++, Data+=Stride) { Data[0]=W0[Lane]; Data[1]=W1[Lane]; } }
+} ;
+
+#include "tea_simd_lanes.h"
+
+} // namespace TEA_SSE2
+
+#endif // __SSE2__
+
+#ifdef LDPC_SIMD_AVX2                                     // same condition as for the LDPC decoder
+
+#ifndef __AVX2__
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace TEA_AVX2 {
+
+class V
+{ public:
+   typedef __m256i U32;
+   const static uint8_t Lanes = 8;
+
+   static U32  Set(uint32_t Val)           { return _mm256_set1_epi32(Val); }
+   static U32  Add(U32 A, U32 B)           { return _mm256_add_epi32(A, B); }
+   static U32  Sub(U32 A, U32 B)           { return _mm256_sub_epi32(A, B); }
+   static U32  Xor(U32 A, U32 B)           { return _mm256_xor_si256(A, B); }
+   static U32  Shl4(U32 A)                 { return _mm256_slli_epi32(A, 4); }
+   static U32  Shr5(U32 A)                 { return _mm256_srli_epi32(A, 5); }
+   static void Load(U32 &V0, U32 &V1, const uint32_t *Data, uint16_t Stride)
+   { if(Stride==2)                                       // packed blocks: the lanes come out as 0,1,4,5,2,3,6,7 - Store() puts them back
+     { __m256 A = _mm256_castsi256_ps(_mm256_loadu_si256((const __m256i *)Data));
+       __m256 B = _mm256_castsi256_ps(_mm256_loadu_si256((const __m256i *)(Data+8)));
+       V0 = _mm256_castps_si256(_mm256_shuffle_ps(A, B, _MM_SHUFFLE(2, 0, 2, 0)));
+       V1 = _mm256_castps_si256(_mm256_shuffle_ps(A, B, _MM_SHUFFLE(3, 1, 3, 1))); return; }
+     const __m256i Idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(Stride));
+     V0 = _mm256_i32gather_epi32((const int *)Data,   Idx, 4);
+     V1 = _mm256_i32gather_epi32((const int *)Data+1, Idx, 4); }
+   static void Store(uint32_t *Data, uint16_t Stride, U32 V0, U32 V1)
+   { if(Stride==2)
+     { _mm256_storeu_si256((__m256i *)Data,     _mm256_unpacklo_epi32(V0, V1));
+       _mm256_storeu_si256((__m256i *)(Data+8), _mm256_unpackhi_epi32(V0, V1)); return; }
+     alignas(32) uint32_t W0[Lanes], W1[Lanes];
+     _mm256_store_si256((__m256i *)W0, V0); _mm256_store_si256((__m256i *)W1, V1);
+     for(uint8_t Lane=0; Lane<Lanes; Lane++, Data+=Stride) { Data[0]=W0[Lane]; Data[1]=W1[Lane]; } }
+} ;
+
+#include "tea_simd_lanes.h"
+
+} // namespace TEA_AVX2
+
+#ifndef __AVX2__
+#pragma GCC pop_options
+#endif
+
+#endif // AVX2
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+
+namespace TEA_NEON {
+
+class V
+{ public:
+   typedef uint32x4_t U32;
+   const static uint8_t Lanes = 4;
+
+   static U32  Set(uint32_t Val)           { return vdupq_n_u32(Val); }
+   static U32  Add(U32 A, U32 B)           { return vaddq_u32(A, B); }
+   static U32  Sub(U32 A, U32 B)           { return vsubq_u32(A, B); }
+   static U32  Xor(U32 A, U32 B)           { return veorq_u32(A, B); }
+   static U32  Shl4(U32 A)                 { return vshlq_n_u32(A, 4); }
+   static U32  Shr5(U32 A)                 { return vshrq_n_u32(A, 5); }
+   static void Load(U32 &V0, U32 &V1, const uint32_t *Data, uint16_t Stride)
+   { uint32_t W0[Lanes], W1[Lanes];
+     for(uint8_t Lane=0; Lane<Lanes; Lane++, Data+=Stride) { W0[Lane]=Data[0]; W1[Lane]=Data[1]; }
+     V0 = vld1q_u32(W0); V1 = vld1q_u32(W1); }
+   static void Store(uint32_t *Data, uint16_t Stride, U32 V0, U32 V1)
+   { uint32_t W0[Lanes], W1[Lanes];
+     vst1q_u32(W0, V0); vst1q_u32(W1, V1);
+     for(uint8_t Lane=0; Lane<Lanes; Lane++, Data+=Stride) { Data[0]=W0[Lane]; Data[1]=W1[Lane]; } }
+} ;
+
+#include "tea_simd_lanes.h"
+
+} // namespace TEA_NEON
+
+#endif // NEON
+
+// TEA_EncryptBatch()/TEA_DecryptBatch() with the given (or the best) instruction set
+inline void TEA_EncryptBatchSIMD(uint32_t *Data, int Blocks, const uint32_t *Key=0, int Loops=4, uint16_t Stride=2,
+                                 LDPC_SIMD_ISA ISA=LDPC_SIMD_Best())
+{ switch(ISA)
+  {
+#ifdef __SSE2__
+    case LDPC_ISA_SSE2: TEA_SSE2::EncryptBatch(Data, Blocks, Key, Loops, Stride); return;
+#endif
+#ifdef LDPC_SIMD_AVX2
+    case LDPC_ISA_AVX2: TEA_AVX2::EncryptBatch(Data, Blocks, Key, Loops, Stride); return;
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    case LDPC_ISA_NEON: TEA_NEON::EncryptBatch(Data, Blocks, Key, Loops, Stride); return;
+#endif
+    default: break; }
+  TEA_EncryptBatch(Data, Blocks, Key, Loops, Stride); }
+
+inline void TEA_DecryptBatchSIMD(uint32_t *Data, int Blocks, const uint32_t *Key=0, int Loops=4, uint16_t Stride=2,
+                                 LDPC_SIMD_ISA ISA=LDPC_SIMD_Best())
+{ switch(ISA)
+  {
+#ifdef __SSE2__
+    case LDPC_ISA_SSE2: TEA_SSE2::DecryptBatch(Data, Blocks, Key, Loops, Stride); return;
+#endif
+#ifdef LDPC_SIMD_AVX2
+    case LDPC_ISA_AVX2: TEA_AVX2::DecryptBatch(Data, Blocks, Key, Loops, Stride); return;
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    case LDPC_ISA_NEON: TEA_NEON::DecryptBatch(Data, Blocks, Key, Loops, Stride); return;
+#endif
+    default: break; }
+  TEA_DecryptBatch(Data, Blocks, Key, Loops, Stride); }
+
+inline void OGN_WhitenBatchSIMD(OGN_Packet *Pkt, int Packets, LDPC_SIMD_ISA ISA=LDPC_SIMD_Best())
+{ const uint16_t Stride = sizeof(OGN_Packet)/sizeof(uint32_t);
+  TEA_EncryptBatchSIMD(Pkt->Position, Packets, 0, 8, Stride, ISA); TEA_EncryptBatchSIMD(Pkt->Position+2, Packets, 0, 8, Stride, ISA); }
+
+inline void OGN_DewhitenBatchSIMD(OGN_Packet *Pkt, int Packets, LDPC_SIMD_ISA ISA=LDPC_SIMD_Best())
+{ const uint16_t Stride = sizeof(OGN_Packet)/sizeof(uint32_t);
+  TEA_DecryptBatchSIMD(Pkt->Position, Packets, 0, 8, Stride, ISA); TEA_DecryptBatchSIMD(Pkt->Position+2, Packets, 0, 8, Stride, ISA); }
+
+// Key trial for received encrypted packets: which of the known keys (if any) gives a position that makes sense here ?
+// A right key gives a fix, a time within a second of the reception and a position near the receiver;
+// a wrong key passes these by chance with a probability of about 2e-5 (MaxDist of 300 km, checked time).
+class OGN_KeyTrialRef
+{ public:
+   int32_t Latitude, Longitude;    // [0.0001/60 deg] receiver position
+   int32_t MaxDist;                // [0.0001/60 deg] max. difference in latitude and in longitude (no wrap-around at 180 deg)
+   int8_t  Time;                   // [sec] reception time 0..59 or negative: not checked
+
+  public:
+   bool Match(const uint32_t *Pos) const                // a decrypted Position[4]
+   { if((Pos[0]>>30)==0) return 0;                      // no fix
+     int32_t Lat = ((int32_t)(Pos[0]<<8)>>5) + 4;       // as OGN_Packet::DecodeLatitude()
+     int32_t Lon = ((int32_t)(Pos[1]<<8)>>4) + 8;
+     if(Lat-Latitude>MaxDist || Latitude-Lat>MaxDist) return 0;
+     if(Lon-Longitude>MaxDist || Longitude-Lon>MaxDist) return 0;
+     if(Time<0) return 1;
+     int8_t Diff = (int8_t)((Pos[0]>>24)&0x3F) - Time;  // the packet carries the second of the fix, rounded
+     if(Diff>30) Diff-=60; else if(Diff<(-30)) Diff+=60;
+     return Diff>=(-1) && Diff<=1; }
+} ;
+
+// try Keys[] on every encrypted packet not yet matched (KeyIdx[]<0): a matching packet gets the key index
+// in KeyIdx[] and becomes an ordinary packet (whitened position, isEncrypted() cleared, FEC not updated).
+// The packets go in chunks, every key decrypts a whole chunk with the batch kernels. Returns the number of matches.
+inline int OGN_TryKeys(OGN_Packet *Pkt, int Packets, const OGN_TEAKey *Keys, int NumKeys, const OGN_KeyTrialRef &Ref,
+                       int16_t *KeyIdx, LDPC_SIMD_ISA ISA=LDPC_SIMD_Best())
+{ const int Chunk=64; int Matched=0;
+  uint32_t Cipher[Chunk*4], Plain[Chunk*4]; int Idx[Chunk];
+  for(int Pos=0; Pos<Packets; )
+  { int Count=0;
+    for( ; Pos<Packets && Count<Chunk; Pos++)
+    { if(!Pkt[Pos].isEncrypted() || KeyIdx[Pos]>=0) continue;
+      memcpy(Cipher+4*Count, Pkt[Pos].Position, 16); Idx[Count++]=Pos; }
+    int Left=Count;
+    for(int Key=0; Key<NumKeys && Left>0; Key++)
+    { memcpy(Plain, Cipher, Count*16);
+      TEA_DecryptBatchSIMD(Plain, 2*Count, Keys[Key].Key, OGN_TEAKey::Loops, 2, ISA);
+      for(int Lane=0; Lane<Count; Lane++)
+      { if(KeyIdx[Idx[Lane]]>=0 || !Ref.Match(Plain+4*Lane)) continue;
+        OGN_Packet &Match=Pkt[Idx[Lane]];
+        memcpy(Match.Position, Plain+4*Lane, 16); Match.Whiten(); Match.clrEncrypted();
+        KeyIdx[Idx[Lane]]=Key; Left--; Matched++; }
+    }
+  }
+  return Matched; }
+
+#endif // of __TEA_SIMD_H__
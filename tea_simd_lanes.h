@@ -0,0 +1,33 @@
+// TEA on many 64-bit blocks at once: one block per 32-bit SIMD lane, v0 and v1 in two registers.
+// Same rounds as OGN_Packet::TEA_Encrypt()/TEA_Decrypt(), a zero Key gives the key-0 whitening.
+// The lane operations come from the class V (see tea_simd.h) declared just before:
+// this file is included once for every instruction set, each time in its own namespace, thus there is no include guard.
+
+// Blocks at Data, Data+Stride, ... : full groups of Lanes go through the SIMD rounds, the rest through the scalar code
+inline void EncryptBatch(uint32_t *Data, int Blocks, const uint32_t *Key, int Loops, uint16_t Stride)
+{ const uint32_t Zero[4] = { 0, 0, 0, 0 }; if(Key==0) Key=Zero;
+  const V::U32 K0=V::Set(Key[0]), K1=V::Set(Key[1]), K2=V::Set(Key[2]), K3=V::Set(Key[3]);
+  int Block=0;
+  for( ; Block+V::Lanes<=Blocks; Block+=V::Lanes, Data+=V::Lanes*Stride)
+  { V::U32 V0, V1; V::Load(V0, V1, Data, Stride);
+    uint32_t Sum=0;
+    for(int Loop=0; Loop<Loops; Loop++)
+    { Sum+=TEA_DELTA; V::U32 S=V::Set(Sum);
+      V0 = V::Add(V0, V::Xor(V::Xor(V::Add(V::Shl4(V1), K0), V::Add(V1, S)), V::Add(V::Shr5(V1), K1)));
+      V1 = V::Add(V1, V::Xor(V::Xor(V::Add(V::Shl4(V0), K2), V::Add(V0, S)), V::Add(V::Shr5(V0), K3))); }
+    V::Store(Data, Stride, V0, V1); }
+  TEA_EncryptBatch(Data, Blocks-Block, Key, Loops, Stride); }
+
+inline void DecryptBatch(uint32_t *Data, int Blocks, const uint32_t *Key, int Loops, uint16_t Stride)
+{ const uint32_t Zero[4] = { 0, 0, 0, 0 }; if(Key==0) Key=Zero;
+  const V::U32 K0=V::Set(Key[0]), K1=V::Set(Key[1]), K2=V::Set(Key[2]), K3=V::Set(Key[3]);
+  int Block=0;
+  for( ; Block+V::Lanes<=Blocks; Block+=V::Lanes, Data+=V::Lanes*Stride)
+  { V::U32 V0, V1; V::Load(V0, V1, Data, Stride);
+    uint32_t Sum=TEA_DELTA*Loops;
+    for(int Loop=0; Loop<Loops; Loop++, Sum-=TEA_DELTA)
+    { V::U32 S=V::Set(Sum);
+      V1 = V::Sub(V1, V::Xor(V::Xor(V::Add(V::Shl4(V0), K2), V::Add(V0, S)), V::Add(V::Shr5(V0), K3)));
+      V0 = V::Sub(V0, V::Xor(V::Xor(V::Add(V::Shl4(V1), K0), V::Add(V1, S)), V::Add(V::Shr5(V1), K1))); }
+    V::Store(Data, Stride, V0, V1); }
+  TEA_DecryptBatch(Data, Blocks-Block, Key, Loops, Stride); }
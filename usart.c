@@ -7,6 +7,8 @@
 #include <string.h>
 #include "messages.h"
 #include "cir_buf.h"
+#include "ogn_lib.h"
+#include "spi.h"
 
 /* -------- defines -------- */
 
@@ -36,14 +38,14 @@
 #define USART3_RX_SOURCE                 GPIO_PinSource11
 #define USART3_RX_AF                     GPIO_AF_USART3
 
-#define USART3_RX_BUF_SIZE               128
+/* USART2 TX and USART3 RX DMA: RM0038, Table 40 */
+#define DMA_USART2_TX_CH                 DMA1_Channel7
+#define DMA_USART3_RX_CH                 DMA1_Channel3
+#define USART3_RX_DMA_LEN                512   /* 44ms at 115200 bps, the task is woken every half */
 
 /* -------- variables -------- */
-/* Semaphore used for USART2 TX synchronization */
-static SemaphoreHandle_t xUSART2Semaphore;
-/* USART2 TX data */
-static uint16_t usart2_ctr;
-static uint8_t* usart2_ptr;
+/* USART2 TX DMA transfer finished callback */
+static void (*usart2_tx_done)(void);
 /* USART2 RX queue */
 static xQueueHandle* usart2_queue;
 
@@ -54,32 +56,41 @@ static uint16_t usart3_ctr;
 static uint8_t* usart3_ptr;
 /* USART3 RX queue */
 static xQueueHandle* usart3_queue;
-static uint8_t usart3_rx_buf[USART3_RX_BUF_SIZE];
-static uint8_t usart3_rx_buf_pos;
 static cir_buf_str* usart3_cir_buf;
+/* NMEA sentence being received: indexed in place, inside the circular buffer */
+static void* usart3_nmea_msg;
+static uint16_t usart3_nmea_size;
+/* circular DMA reception: written by the DMA, read by the GPS task */
+static uint8_t usart3_dma_buf[USART3_RX_DMA_LEN];
+static uint16_t usart3_dma_pos;
+/* halves of the buffer filled by the DMA (HT and TC interrupts) and of them, passed by the reader */
+static volatile uint16_t usart3_dma_halves;
+static uint16_t usart3_dma_halves_read;
+/* the DMA went round the buffer before the GPS task read it: bytes lost */
+static uint32_t usart3_dma_laps;
+/* the GPS task has been woken and did not read the buffer yet */
+static volatile uint8_t usart3_dma_pending;
 
 /* -------- interrupt handlers -------- */
+/* wake the GPS task to read the DMA buffer: at most one message in the queue */
+static void USART3_RxDMA_Notify(portBASE_TYPE* woken)
+{
+   task_message msg;
+
+   if (usart3_dma_pending || (usart3_queue == NULL)) return;
+   msg.msg_data   = 0;
+   msg.msg_len    = 0;
+   msg.msg_opcode = USART3_RX_DMA;
+   msg.src_id     = GPS_USART_SRC_ID;
+   if (xQueueSendFromISR(*usart3_queue, &msg, woken) == pdTRUE) usart3_dma_pending = 1;
+}
+
 void USART2_IRQHandler(void)
 {  uint8_t rs_data;
    task_message msg;
 
    portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
 
-   /* USART in mode Transmitter -------------------------------------------------*/
-   if (USART_GetITStatus(USART2, USART_IT_TXE) == SET)
-   {
-      if (usart2_ctr == 0)
-      {
-         USART_ITConfig(USART2, USART_IT_TXE, DISABLE);
-         xSemaphoreGiveFromISR(xUSART2Semaphore, &xHigherPriorityTaskWoken);
-      }
-      else
-      {
-         USART_SendData(USART2, *usart2_ptr++);
-         usart2_ctr--;
-      }
-   }
-
    /* USART in mode Receiver --------------------------------------------------*/
    if(USART_GetITStatus(USART2, USART_IT_RXNE) == SET)
    {
@@ -94,6 +105,17 @@ void USART2_IRQHandler(void)
    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
 
+/* USART2 TX DMA transfer complete */
+void DMA1_Channel7_IRQHandler(void)
+{
+   if (DMA_GetITStatus(DMA1_IT_TC7))
+   {
+      DMA_ClearITPendingBit(DMA1_IT_GL7);
+      DMA_Cmd(DMA_USART2_TX_CH, DISABLE);
+      if (usart2_tx_done) usart2_tx_done();
+   }
+}
+
 void USART3_IRQHandler(void)
 {
    uint8_t rs_data;
@@ -120,28 +142,55 @@ void USART3_IRQHandler(void)
    if(USART_GetITStatus(USART3, USART_IT_RXNE) == SET)
    {
       rs_data = USART_ReceiveData(USART3);
-      if (rs_data == '$') usart3_rx_buf_pos = 0;
-
-      usart3_rx_buf[usart3_rx_buf_pos++] = rs_data;
-      if (rs_data == '\n')
+      if ((usart3_nmea_msg == NULL) && (rs_data == '$') && usart3_cir_buf)
       {
-         if (usart3_rx_buf[0] == '$')
+         /* no space was left for this sentence (GPS task behind): retry at every sentence start */
+         usart3_nmea_msg = cir_reserve(usart3_cir_buf, usart3_nmea_size);
+         if (usart3_nmea_msg) OGN_NMEA_MsgInit(usart3_nmea_msg);
+      }
+      if (usart3_nmea_msg && OGN_NMEA_ProcessByte(usart3_nmea_msg, rs_data))
+      {
+         /* Found complete NMEA sentence: commas already indexed, checksum accumulated */
+         if (usart3_queue && !xQueueIsQueueFullFromISR(*usart3_queue))
          {
-            /* Found valid NMEA sequence */
-            if (usart3_queue)
-            {
-               /* End sequence */
-               usart3_rx_buf[usart3_rx_buf_pos] = '\0';
-
-               msg.msg_data = (uint32_t)cir_put_data(usart3_cir_buf, usart3_rx_buf, usart3_rx_buf_pos+1);
-               msg.msg_len  = usart3_rx_buf_pos;
-               msg.src_id   = GPS_USART_SRC_ID;
-               xQueueSendFromISR(*usart3_queue, &msg, &xHigherPriorityTaskWoken);
-            }
+            /* hand the sentence over: the GPS task releases it from the buffer when parsed */
+            cir_commit(usart3_cir_buf);
+            msg.msg_data   = (uint32_t)usart3_nmea_msg;
+            msg.msg_len    = usart3_nmea_size;
+            msg.msg_opcode = USART3_RX_SENTENCE;
+            msg.src_id     = GPS_USART_SRC_ID;
+            xQueueSendFromISR(*usart3_queue, &msg, &xHigherPriorityTaskWoken);
+            /* Next sentence goes to fresh space in the circular buffer */
+            usart3_nmea_msg = cir_reserve(usart3_cir_buf, usart3_nmea_size);
          }
-         usart3_rx_buf_pos = 0;
+         if (usart3_nmea_msg) OGN_NMEA_MsgInit(usart3_nmea_msg);
       }
-      if (usart3_rx_buf_pos >= USART3_RX_BUF_SIZE) usart3_rx_buf_pos = 0;
+   }
+
+   /* Idle line (DMA reception): end of the GPS burst ---------------------------*/
+   if(USART_GetITStatus(USART3, USART_IT_IDLE) == SET)
+   {
+      /* SR read above, DR read clears the flag */
+      USART_ReceiveData(USART3);
+      USART3_RxDMA_Notify(&xHigherPriorityTaskWoken);
+   }
+   portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/* USART3 RX DMA half/full transfer, called by DMA1_Channel3_IRQHandler() (spi.c) */
+void USART3_RxDMA_IRQHandler(void)
+{
+   portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+
+   uint8_t halves = 0;
+
+   if (DMA_GetITStatus(DMA1_IT_HT3)) halves++;
+   if (DMA_GetITStatus(DMA1_IT_TC3)) halves++;
+   if (halves)
+   {
+      DMA_ClearITPendingBit(DMA1_IT_GL3);
+      usart3_dma_halves += halves;
+      USART3_RxDMA_Notify(&xHigherPriorityTaskWoken);
    }
    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
@@ -207,44 +256,65 @@ void USART2_Config(uint32_t speed)
    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
    NVIC_Init(&NVIC_InitStructure);
-
-   xUSART2Semaphore = xSemaphoreCreateMutex();
 }
 
 /**
-* @brief  Sets queue for USART2 received data.
-* @param  None
+* @brief  Configures USART2 TX by DMA.
+* @param  Callback of a finished transfer (called from the interrupt)
 * @retval None
 */
-void USART2_SetQue(xQueueHandle* handle)
+void USART2_TxDMA_Config(void (*tx_done)(void))
 {
-   usart2_queue = handle;
+   DMA_InitTypeDef  DMA_InitStructure;
+   NVIC_InitTypeDef NVIC_InitStructure;
+
+   usart2_tx_done = tx_done;
+   RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+
+   DMA_DeInit(DMA_USART2_TX_CH);
+   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&USART2->DR;
+   DMA_InitStructure.DMA_MemoryBaseAddr     = 0;   /* set for every transfer */
+   DMA_InitStructure.DMA_DIR                = DMA_DIR_PeripheralDST;
+   DMA_InitStructure.DMA_BufferSize         = 0;
+   DMA_InitStructure.DMA_PeripheralInc      = DMA_PeripheralInc_Disable;
+   DMA_InitStructure.DMA_MemoryInc          = DMA_MemoryInc_Enable;
+   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+   DMA_InitStructure.DMA_MemoryDataSize     = DMA_MemoryDataSize_Byte;
+   DMA_InitStructure.DMA_Mode               = DMA_Mode_Normal;
+   DMA_InitStructure.DMA_Priority           = DMA_Priority_Low;
+   DMA_InitStructure.DMA_M2M                = DMA_M2M_Disable;
+   DMA_Init(DMA_USART2_TX_CH, &DMA_InitStructure);
+   DMA_ITConfig(DMA_USART2_TX_CH, DMA_IT_TC, ENABLE);
+
+   NVIC_InitStructure.NVIC_IRQChannel = DMA1_Channel7_IRQn;
+   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = configCONSOLE_INTERRUPT_PRIORITY;
+   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+   NVIC_Init(&NVIC_InitStructure);
+
+   USART_DMACmd(USART2, USART_DMAReq_Tx, ENABLE);
 }
 
 /**
-* @brief  Sends data over USART2 Peripheral.
-* @brief  Function triggers transfer and exit (if USART clean).
-* @param  data, length
+* @brief  Sets queue for USART2 received data.
+* @param  None
 * @retval None
 */
-void USART2_Send(uint8_t* data, uint16_t len)
+void USART2_SetQue(xQueueHandle* handle)
 {
-   /* Take access to USART2 TX  - will block if already used */
-   xSemaphoreTake(xUSART2Semaphore, portMAX_DELAY);
-   usart2_ptr = data; usart2_ctr = len;
-   USART_ITConfig(USART2, USART_IT_TXE, ENABLE);
+   usart2_queue = handle;
 }
 
 /**
-* @brief  Waits until USART2 transmission finishes.
-* @param  None
+* @brief  Starts a USART2 DMA transfer, the previous one must be finished.
+* @param  data, length
 * @retval None
 */
-void USART2_Wait()
+void USART2_SendDMA(const uint8_t* data, uint16_t len)
 {
-   /* Take access to USART2 TX  - will block if already used */
-   xSemaphoreTake(xUSART2Semaphore, portMAX_DELAY);
-   xSemaphoreGive(xUSART2Semaphore);
+   DMA_USART2_TX_CH->CMAR = (uint32_t)data;
+   DMA_SetCurrDataCounter(DMA_USART2_TX_CH, len);
+   DMA_Cmd(DMA_USART2_TX_CH, ENABLE);
 }
 
 /**
@@ -328,8 +398,6 @@ void USART3_Config(uint32_t speed)
 
    USART_ITConfig(USART3, USART_IT_RXNE, ENABLE);
 
-   usart3_rx_buf_pos = 0;
-
    /* Enable USART3 RX IRQ */
    NVIC_InitStructure.NVIC_IRQChannel = USART3_IRQn;
    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = configGPS_INTERRUPT_PRIORITY;
@@ -347,7 +415,10 @@ void USART3_Config(uint32_t speed)
 */
 void USART3_SetBuf(cir_buf_str* handle)
 {
-   usart3_cir_buf = handle;
+   usart3_cir_buf   = handle;
+   usart3_nmea_size = OGN_NMEA_MsgSize();
+   usart3_nmea_msg  = cir_reserve(usart3_cir_buf, usart3_nmea_size);
+   if (usart3_nmea_msg) OGN_NMEA_MsgInit(usart3_nmea_msg);
 }
 
 /**
@@ -359,3 +430,105 @@ void USART3_SetQue(xQueueHandle* handle)
 {
    usart3_queue = handle;
 }
+
+/**
+* @brief  Switches USART3 reception to circular DMA.
+* @brief  No interrupt per byte: the GPS task is woken on idle line and half/full buffer
+* @brief  and does the sentence framing. To be called before USART3 is enabled.
+* @param  None
+* @retval None
+*/
+void USART3_RxDMA_Config(void)
+{
+   DMA_InitTypeDef  DMA_InitStructure;
+   NVIC_InitTypeDef NVIC_InitStructure;
+
+   /* DMA1 Channel3 is shared with SPI1 TX */
+   SPI1_ReleaseTxDMA();
+   RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+
+   DMA_DeInit(DMA_USART3_RX_CH);
+   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&USART3->DR;
+   DMA_InitStructure.DMA_MemoryBaseAddr     = (uint32_t)usart3_dma_buf;
+   DMA_InitStructure.DMA_DIR                = DMA_DIR_PeripheralSRC;
+   DMA_InitStructure.DMA_BufferSize         = USART3_RX_DMA_LEN;
+   DMA_InitStructure.DMA_PeripheralInc      = DMA_PeripheralInc_Disable;
+   DMA_InitStructure.DMA_MemoryInc          = DMA_MemoryInc_Enable;
+   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+   DMA_InitStructure.DMA_MemoryDataSize     = DMA_MemoryDataSize_Byte;
+   DMA_InitStructure.DMA_Mode               = DMA_Mode_Circular;
+   DMA_InitStructure.DMA_Priority           = DMA_Priority_Medium;
+   DMA_InitStructure.DMA_M2M                = DMA_M2M_Disable;
+   DMA_Init(DMA_USART3_RX_CH, &DMA_InitStructure);
+   DMA_ITConfig(DMA_USART3_RX_CH, DMA_IT_HT | DMA_IT_TC, ENABLE);
+   usart3_dma_pos     = 0;
+   usart3_dma_pending = 0;
+   usart3_dma_halves  = 0;
+   usart3_dma_halves_read = 0;
+   usart3_dma_laps    = 0;
+
+   NVIC_InitStructure.NVIC_IRQChannel = DMA1_Channel3_IRQn;
+   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = configGPS_INTERRUPT_PRIORITY;
+   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+   NVIC_Init(&NVIC_InitStructure);
+
+   /* Idle line instead of the interrupt per byte */
+   USART_ITConfig(USART3, USART_IT_RXNE, DISABLE);
+   USART_ITConfig(USART3, USART_IT_IDLE, ENABLE);
+   USART_DMACmd(USART3, USART_DMAReq_Rx, ENABLE);
+   DMA_Cmd(DMA_USART3_RX_CH, ENABLE);
+}
+
+/**
+* @brief  Gets the bytes received by DMA since the previous call (GPS task).
+* @brief  Returns a contiguous span: call again until it returns 0 (buffer wrap).
+* @brief  The DMA counter can not tell a full lap from no data: the half/full buffer interrupts
+* @brief  counted since the previous read can. After a lap the reading restarts at the DMA position.
+* @param  data: set to the first new byte, NULL - bytes were lost, the sentence being framed is broken
+* @retval number of new bytes
+*/
+uint16_t USART3_RxDMA_Read(uint8_t** data)
+{
+   uint16_t head;
+   uint16_t len;
+   uint16_t halves;
+   uint16_t ahead;
+
+   /* any later event wakes the task again */
+   usart3_dma_pending = 0;
+   /* before the counter: a half filled after the counter was read is not taken for a lap */
+   halves = usart3_dma_halves;
+   head = USART3_RX_DMA_LEN - DMA_GetCurrDataCounter(DMA_USART3_RX_CH);
+   if (head >= USART3_RX_DMA_LEN) head = 0;
+
+   /* half buffer boundaries between the reader and the DMA: more interrupts than that is a lap */
+   ahead = (head - usart3_dma_pos) & (USART3_RX_DMA_LEN - 1);
+   ahead = (usart3_dma_pos + ahead)/(USART3_RX_DMA_LEN/2) - usart3_dma_pos/(USART3_RX_DMA_LEN/2);
+   if ((int16_t)(halves - usart3_dma_halves_read) > (int16_t)ahead)
+   {
+      usart3_dma_laps++;
+      usart3_dma_pos = head;
+      usart3_dma_halves_read = halves;
+      *data = NULL;
+      return 0;
+   }
+
+   *data = &usart3_dma_buf[usart3_dma_pos];
+   if (head >= usart3_dma_pos) len = head - usart3_dma_pos;
+   else len = USART3_RX_DMA_LEN - usart3_dma_pos;
+   usart3_dma_halves_read += (usart3_dma_pos + len)/(USART3_RX_DMA_LEN/2) - usart3_dma_pos/(USART3_RX_DMA_LEN/2);
+   usart3_dma_pos += len;
+   if (usart3_dma_pos >= USART3_RX_DMA_LEN) usart3_dma_pos = 0;
+   return len;
+}
+
+/**
+* @brief  Times the DMA went round the buffer before the GPS task read it.
+* @param  None
+* @retval number of laps since the reception was configured
+*/
+uint32_t USART3_RxDMA_Laps(void)
+{
+   return usart3_dma_laps;
+}
@@ -8,6 +8,13 @@
 #include <queue.h>
 #include "cir_buf.h"
 
+/* --- USART3 (GPS) messages to the GPS task: msg_opcode --- */
+typedef enum
+{
+   USART3_RX_SENTENCE = 0,    /* msg_data: complete NMEA sentence (interrupt per byte) */
+   USART3_RX_DMA              /* new bytes in the DMA buffer: read with USART3_RxDMA_Read() */
+} usart3_rx_opcodes;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -15,8 +22,8 @@ extern "C" {
 /* --- USART2 related functions --- */
 void USART2_Config(uint32_t speed);
 void USART2_SetQue(xQueueHandle* handle);
-void USART2_Send(uint8_t* data, uint16_t len);
-void USART2_Wait(void);
+void USART2_TxDMA_Config(void (*tx_done)(void));
+void USART2_SendDMA(const uint8_t* data, uint16_t len);
 
 /* --- USART3 related functions --- */
 void USART3_Config(uint32_t speed);
@@ -24,6 +31,10 @@ void USART3_SetQue(xQueueHandle* handle);
 void USART3_SetBuf(cir_buf_str* handle);
 void USART3_Send(uint8_t* data, uint16_t len);
 void USART3_Wait(void);
+void USART3_RxDMA_Config(void);
+uint16_t USART3_RxDMA_Read(uint8_t** data);
+uint32_t USART3_RxDMA_Laps(void);
+void USART3_RxDMA_IRQHandler(void);
 
 #ifdef __cplusplus
 }